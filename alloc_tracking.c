@@ -0,0 +1,263 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "alloc_tracking.h"
+#include "statistics.h"
+
+/* Number of slots of a new table of live blocks, a power of two */
+#define INITIAL_LIVE_SLOTS 1024
+
+/* Names of the sites in the report, in the order of the alloc_site enum */
+static char *site_names[ALLOC_SITE_COUNT] = {
+    "add_table_item",
+    "table_index",
+    "analyze_operands",
+    "build_data_word",
+    "get_code_word",
+    "process_code",
+    "process_spass_operand",
+    "get_addressing_type",
+    "file_name",
+    "include_cache",
+    "macro_table",
+    "table_journal",
+    "source_chunks",
+    "failed_lines"
+};
+
+/* A live block, kept in an open addressing table by its address */
+struct live_block {
+    void *pointer;          /* The block, NULL for an empty slot */
+    size_t size;            /* Size of the block */
+    alloc_site site;        /* Site that allocated the block */
+    long file_generation;   /* The file that allocated the block */
+    bool run_lived;         /* Whether the block lives for the whole run */
+};
+
+/* Allocations of a site in the file being assembled */
+struct site_counters {
+    long count;     /* Number of allocations */
+    long bytes;     /* Bytes allocated */
+};
+
+bool alloc_tracking_enabled = FALSE;
+
+static struct live_block *live_blocks = NULL;   /* Table of the live blocks */
+static long live_slots = 0;                     /* Number of slots of the table, a power of two */
+static long live_count = 0;                     /* Number of live blocks */
+static long live_bytes = 0;                     /* Bytes of the live blocks */
+static long peak_live_bytes = 0;                /* Most live bytes since the file started */
+static long file_generation = 0;                /* Incremented by every file */
+static int run_scope_depth = 0;                 /* Depth of the run scopes, allocations live for the run if positive */
+static struct site_counters file_sites[ALLOC_SITE_COUNT];  /* Allocations of the file by site */
+
+/**
+ * @brief Hashes the address of a block to its home slot.
+ *
+ * @param pointer The block.
+ * @param slot_count The number of slots of the table, a power of two.
+ * @return The home slot of the block.
+ */
+static long home_slot_of(void *pointer, long slot_count) {
+    return (long)((((size_t)pointer >> 4) * 2654435761u) & (slot_count - 1));
+}
+
+/**
+ * @brief Finds the slot of a block, or the empty slot where it would be.
+ *
+ * @param slots The table.
+ * @param slot_count The number of slots of the table.
+ * @param pointer The block.
+ * @return The index of the slot.
+ */
+static long find_slot(struct live_block *slots, long slot_count, void *pointer) {
+    long slot = home_slot_of(pointer, slot_count);
+
+    while (slots[slot].pointer != NULL && slots[slot].pointer != pointer) {
+        slot = (slot + 1) & (slot_count - 1);
+    }
+    return slot;
+}
+
+/**
+ * @brief Adds an allocated block to the table of live blocks and to the counters of its site.
+ *
+ * The table grows when it is half full, a block that can't be added is not tracked.
+ */
+static void track_block(alloc_site site, void *pointer, size_t size) {
+    struct live_block *slots;
+    long slot_count;
+    long index;
+    long slot;
+
+    if ((live_count + 1) * 2 > live_slots) {
+        slot_count = live_slots > 0 ? live_slots * 2 : INITIAL_LIVE_SLOTS;
+        slots = (struct live_block *)calloc(slot_count, sizeof(struct live_block));
+        if (slots == NULL) {
+            return;
+        }
+        for (index = 0; index < live_slots; index++) {
+            if (live_blocks[index].pointer != NULL) {
+                slots[find_slot(slots, slot_count, live_blocks[index].pointer)] = live_blocks[index];
+            }
+        }
+        free(live_blocks);
+        live_blocks = slots;
+        live_slots = slot_count;
+    }
+
+    slot = find_slot(live_blocks, live_slots, pointer);
+    live_blocks[slot].pointer = pointer;
+    live_blocks[slot].size = size;
+    live_blocks[slot].site = site;
+    live_blocks[slot].file_generation = file_generation;
+    live_blocks[slot].run_lived = run_scope_depth > 0;
+    live_count++;
+    live_bytes += size;
+    if (live_bytes > peak_live_bytes) {
+        peak_live_bytes = live_bytes;
+    }
+    file_sites[site].count++;
+    file_sites[site].bytes += size;
+}
+
+/**
+ * @brief Removes a freed block from the table of live blocks, shifting back the blocks after it.
+ *
+ * Blocks that are not in the table, because they were allocated before tracking started, are ignored.
+ */
+static void untrack_block(void *pointer) {
+    long slot;
+    long next_slot;
+    long home_slot;
+
+    if (live_slots == 0) {
+        return;
+    }
+    slot = find_slot(live_blocks, live_slots, pointer);
+    if (live_blocks[slot].pointer == NULL) {
+        return;
+    }
+    live_count--;
+    live_bytes -= live_blocks[slot].size;
+
+    /* Move back every following block whose home slot is not between the hole and it */
+    for (next_slot = (slot + 1) & (live_slots - 1); live_blocks[next_slot].pointer != NULL; next_slot = (next_slot + 1) & (live_slots - 1)) {
+        home_slot = home_slot_of(live_blocks[next_slot].pointer, live_slots);
+        if (((next_slot - home_slot) & (live_slots - 1)) >= ((next_slot - slot) & (live_slots - 1))) {
+            live_blocks[slot] = live_blocks[next_slot];
+            slot = next_slot;
+        }
+    }
+    live_blocks[slot].pointer = NULL;
+}
+
+/* Allocates memory for a site, counting it for --stats and tracking it for --track-allocs */
+void *tracked_malloc(alloc_site site, size_t size) {
+    void *pointer = malloc(size);
+
+    STATS_ADD(malloc_calls, 1);
+    if (alloc_tracking_enabled && pointer != NULL) {
+        track_block(site, pointer, size);
+    }
+    return pointer;
+}
+
+/* Allocates zeroed memory for a site, like tracked_malloc */
+void *tracked_calloc(alloc_site site, size_t count, size_t size) {
+    void *pointer = calloc(count, size);
+
+    STATS_ADD(malloc_calls, 1);
+    if (alloc_tracking_enabled && pointer != NULL) {
+        track_block(site, pointer, count * size);
+    }
+    return pointer;
+}
+
+/* Resizes memory allocated by one of the tracked functions, every resize counts as an allocation */
+void *tracked_realloc(alloc_site site, void *pointer, size_t size) {
+    size_t old_address = (size_t)pointer;   /* The old block is only looked up by its address after the resize */
+    void *new_pointer = realloc(pointer, size);
+
+    STATS_ADD(malloc_calls, 1);
+    if (alloc_tracking_enabled && new_pointer != NULL) {
+        if (old_address != 0) {
+            untrack_block((void *)old_address);
+        }
+        track_block(site, new_pointer, size);
+    }
+    return new_pointer;
+}
+
+/* Frees memory allocated by one of the tracked functions */
+void tracked_free(void *pointer) {
+    if (alloc_tracking_enabled && pointer != NULL) {
+        untrack_block(pointer);
+    }
+    free(pointer);
+}
+
+/* Starts a scope whose allocations live for the whole run */
+void alloc_begin_run_scope(void) {
+    run_scope_depth++;
+}
+
+/* Ends a scope started by alloc_begin_run_scope */
+void alloc_end_run_scope(void) {
+    run_scope_depth--;
+}
+
+/* Resets the allocation counters of the file being assembled */
+void alloc_begin_file(void) {
+    file_generation++;
+    peak_live_bytes = live_bytes;
+    memset(file_sites, 0, sizeof(file_sites));
+}
+
+/* Reports the allocations of the file that was assembled and the blocks it leaked */
+long alloc_end_file(char *file_name, FILE *output) {
+    struct site_counters leaks[ALLOC_SITE_COUNT];   /* Blocks of the file still live, by site */
+    long total_count = 0;
+    long total_bytes = 0;
+    long leaked_bytes = 0;
+    long index;
+    int site;
+
+    if (!alloc_tracking_enabled) {
+        return 0;
+    }
+    memset(leaks, 0, sizeof(leaks));
+    for (index = 0; index < live_slots; index++) {
+        if (live_blocks[index].pointer != NULL && live_blocks[index].file_generation == file_generation && !live_blocks[index].run_lived) {
+            leaks[live_blocks[index].site].count++;
+            leaks[live_blocks[index].site].bytes += live_blocks[index].size;
+            leaked_bytes += live_blocks[index].size;
+        }
+    }
+    for (site = 0; site < ALLOC_SITE_COUNT; site++) {
+        total_count += file_sites[site].count;
+        total_bytes += file_sites[site].bytes;
+    }
+
+    fprintf(output, "Allocations of %s: %ld allocations, %ld bytes, peak %ld live bytes\n", file_name, total_count, total_bytes, peak_live_bytes);
+    for (site = 0; site < ALLOC_SITE_COUNT; site++) {
+        if (file_sites[site].count > 0) {
+            fprintf(output, "  %-24s %8ld allocations %10ld bytes\n", site_names[site], file_sites[site].count, file_sites[site].bytes);
+        }
+    }
+    for (site = 0; site < ALLOC_SITE_COUNT; site++) {
+        if (leaks[site].count > 0) {
+            fprintf(output, "  leak: %-18s %8ld blocks      %10ld bytes still allocated\n", site_names[site], leaks[site].count, leaks[site].bytes);
+        }
+    }
+    return leaked_bytes;
+}
+
+/* Frees the table of live allocations */
+void free_alloc_tracking(void) {
+    free(live_blocks);
+    live_blocks = NULL;
+    live_slots = 0;
+    live_count = 0;
+    live_bytes = 0;
+}
@@ -0,0 +1,96 @@
+#ifndef _ALLOC_TRACKING_H
+#define _ALLOC_TRACKING_H
+#include <stdio.h>
+#include <stddef.h>
+#include "global_variables.h"
+
+/* Allocation sites of the assembler, every tracked allocation is attributed to one of them */
+typedef enum alloc_site {
+    ADD_TABLE_ITEM_SITE,            /* Symbol table entries and their names */
+    TABLE_INDEX_SITE,               /* Name index of a symbol table */
+    ANALYZE_OPERANDS_SITE,          /* Operands of an instruction line */
+    BUILD_DATA_WORD_SITE,           /* Extra words of the operands */
+    GET_CODE_WORD_SITE,             /* First words of the instructions */
+    PROCESS_CODE_SITE,              /* Machine words of the first pass */
+    PROCESS_SPASS_OPERAND_SITE,     /* Machine words of the second pass */
+    GET_ADDRESSING_TYPE_SITE,       /* Index of an indexed operand */
+    FILE_NAME_SITE,                 /* File names built by add_extension and resolve_relative_path */
+    INCLUDE_CACHE_SITE,             /* Cached included files */
+    MACRO_TABLE_SITE,               /* Macros of a file and their bodies */
+    TABLE_JOURNAL_SITE,             /* Journals of the symbol tables of the parallel first pass */
+    SOURCE_CHUNKS_SITE,             /* Lines and chunks of a source assembled in parallel */
+    FAILED_LINES_SITE,              /* Lines of the first pass with errors, with --keep-going */
+    ALLOC_SITE_COUNT                /* Number of sites */
+} alloc_site;
+
+/* Whether --track-allocs was given, allocations are only tracked when it is set */
+extern bool alloc_tracking_enabled;
+
+/**
+ * @brief Allocates memory for a site, counting it for --stats and tracking it for --track-allocs.
+ *
+ * @param site The site of the allocation.
+ * @param size The number of bytes to allocate.
+ * @return A pointer to the allocated memory, or NULL if the allocation failed.
+ */
+void *tracked_malloc(alloc_site site, size_t size);
+
+/**
+ * @brief Allocates zeroed memory for a site, like tracked_malloc.
+ *
+ * @param site The site of the allocation.
+ * @param count The number of elements.
+ * @param size The size of an element.
+ * @return A pointer to the allocated memory, or NULL if the allocation failed.
+ */
+void *tracked_calloc(alloc_site site, size_t count, size_t size);
+
+/**
+ * @brief Resizes memory allocated by one of the tracked functions, or allocates it if the pointer is NULL.
+ *
+ * @param site The site of the allocation.
+ * @param pointer The memory to resize, or NULL.
+ * @param size The new number of bytes.
+ * @return A pointer to the resized memory, or NULL if the allocation failed and the memory is unchanged.
+ */
+void *tracked_realloc(alloc_site site, void *pointer, size_t size);
+
+/**
+ * @brief Frees memory allocated by one of the tracked functions.
+ *
+ * @param pointer The memory to free, or NULL.
+ */
+void tracked_free(void *pointer);
+
+/**
+ * @brief Starts a scope whose allocations live for the whole run, like the cache of included files.
+ *
+ * They are not reported as leaks of the file. Scopes may nest.
+ */
+void alloc_begin_run_scope(void);
+
+/**
+ * @brief Ends a scope started by alloc_begin_run_scope.
+ */
+void alloc_end_run_scope(void);
+
+/**
+ * @brief Resets the allocation counters of the file being assembled.
+ */
+void alloc_begin_file(void);
+
+/**
+ * @brief Reports the allocations of the file that was assembled and the blocks it leaked.
+ *
+ * @param file_name The name of the file.
+ * @param output The stream the report is written to.
+ * @return The number of bytes leaked by the file.
+ */
+long alloc_end_file(char *file_name, FILE *output);
+
+/**
+ * @brief Frees the table of live allocations.
+ */
+void free_alloc_tracking(void);
+
+#endif
@@ -4,6 +4,7 @@
 #include "analysis_phase.h"
 #include "code_functions.h"
 #include "utility_functions.h"
+#include "alloc_tracking.h"
 
 /**
  * @brief Processes a single operand in SPASS assembly code.
@@ -22,46 +23,104 @@
  */
 bool process_spass_operand(line_info line, long *curr_ic, long *ic, char *operand, machine_word **code_img, table *symbol_table);
 
-/* Processes a line in the second pass of the assembly process */
-bool process_line_spass(line_info line, long *ic, machine_word **code_img, table *symbol_table) {
+/* Buffer the uses of external symbols of the current thread are recorded to, NULL to add them to the symbol table */
+static __thread extern_use_buffer *current_extern_uses = NULL;
+
+/**
+ * @brief Records a use of an external symbol, in the symbol table or in the buffer of the thread.
+ *
+ * @param symbol_table Pointer to the symbol table.
+ * @param operand The operand that uses the symbol.
+ * @param address The address of the word of the symbol.
+ */
+static void add_extern_use(table *symbol_table, char *operand, long address) {
+    extern_use *uses;
+
+    if (current_extern_uses == NULL) {
+        add_table_item(symbol_table, operand, address, EXTERNAL_REFERENCE);
+        return;
+    }
+    if (current_extern_uses->count == current_extern_uses->capacity) {
+        uses = (extern_use *)tracked_realloc(SOURCE_CHUNKS_SITE, current_extern_uses->uses, (current_extern_uses->capacity * 2 + 16) * sizeof(extern_use));
+        if (uses == NULL) {
+            printf("Memory allocation failed");
+            exit(1);
+        }
+        current_extern_uses->uses = uses;
+        current_extern_uses->capacity = current_extern_uses->capacity * 2 + 16;
+    }
+    current_extern_uses->uses[current_extern_uses->count].name[0] = '\0';
+    strncat(current_extern_uses->uses[current_extern_uses->count].name, operand, MAX_LINE_LENGTH + 1);
+    current_extern_uses->uses[current_extern_uses->count++].address = address;
+}
+
+/* Records the uses of external symbols of the current thread to a buffer instead of the symbol table */
+void buffer_extern_uses(extern_use_buffer *buffer) {
+    current_extern_uses = buffer;
+}
+
+/* Frees the uses of a buffer and empties it */
+void free_extern_uses(extern_use_buffer *buffer) {
+    tracked_free(buffer->uses);
+    buffer->uses = NULL;
+    buffer->count = 0;
+    buffer->capacity = 0;
+}
+
+/* Finds the kind of a line in the second pass */
+spass_line_kind classify_line_spass(line_info line, long *index_instruction) {
     char *index_of_colon;   /* Pointer to the location of a colon in the line content (if present) */
-    char *token;            /* Token extracted from the line content */
-    long index_instruction = 0; /* Index within the line content indicating the start of the instruction */
 
-    
     /* Skip leading spaces */
-    index_instruction = skip_spaces(line.content, index_instruction); 
+    *index_instruction = skip_spaces(line.content, 0);
 
     /* Check for comments or empty lines */
-    if (line.content[index_instruction] == ';' || line.content[index_instruction] == '\n') {
-        return TRUE;
+    if (line.content[*index_instruction] == ';' || line.content[*index_instruction] == '\n') {
+        return SPASS_EMPTY_LINE;
     }
 
     /* Check for label and update index accordingly */
     index_of_colon = strchr(line.content, ':');
     if (index_of_colon != NULL) {
-        index_instruction = index_of_colon - line.content + 1;
+        *index_instruction = index_of_colon - line.content + 1;
     }
 
     /* Skip leading spaces after the label */
-    index_instruction = skip_spaces(line.content, index_instruction); 
+    *index_instruction = skip_spaces(line.content, *index_instruction);
+
+    /* Check if the line contains a directive */
+    return line.content[*index_instruction] == '.' ? SPASS_DIRECTIVE_LINE : SPASS_CODE_LINE;
+}
+
+/* Processes a line in the second pass of the assembly process */
+bool process_line_spass(line_info line, long *ic, machine_word **code_img, table *symbol_table) {
+    char *token;            /* Token extracted from the line content */
+    size_t token_length;    /* Length of the token */
+    long index_instruction; /* Index within the line content indicating the start of the instruction */
+    spass_line_kind kind = classify_line_spass(line, &index_instruction);   /* How the line is processed */
+
+    /* Check for comments or empty lines */
+    if (kind == SPASS_EMPTY_LINE) {
+        return TRUE;
+    }
 
     /* Check if the line contains a directive */
-    if (line.content[index_instruction] == '.') {
+    if (kind == SPASS_DIRECTIVE_LINE) {
         /* Process .entry directive */
         if (strncmp(".entry", line.content, 6) == 0) {
            
             index_instruction += 6; /* Move index past ".entry" */
             index_instruction = skip_spaces(line.content, index_instruction); /* Skip spaces */
-            token = strtok(line.content + index_instruction, " \n\t"); /* Extract token */
+            token = line.content + index_instruction; /* Extract token, up to the first space or new line */
+            token_length = strcspn(token, " \n\t");
              
-            if (token == NULL) {
+            if (token_length == 0) {
                 print_error(line, "You have to specify a label name for .entry instruction.");
                 return FALSE;
             }
+            token[token_length] = '\0';
             if (find_by_types(*symbol_table, token, 1, ENTRY_SYMBOL) == NULL) {
                 table_entry *item;
-                token = strtok(line.content + index_instruction, "\n"); /* Extract token */
 
                 item = find_by_types(*symbol_table, token, 2, DATA_SYMBOL, CODE_SYMBOL);
                 if (item == NULL) {
@@ -86,7 +145,7 @@ bool process_line_spass(line_info line, long *ic, machine_word **code_img, table
 
 
 bool add_symbols_to_code(line_info line, long *ic, machine_word **code_img, table *symbol_table) {
-    char temp_string[MAX_LINE_LENGTH];  /* Temporary string buffer */
+    char temp_string[MAX_LINE_LENGTH + 2];  /* Temporary string buffer, extract_label copies up to a whole line */
     char *operands[2];                  /* Array to store operands extracted from the line content */
     int index_line = 0;                  /* Index within the line content */
     int operand_count;                   /* Number of operands */
@@ -121,13 +180,16 @@ bool add_symbols_to_code(line_info line, long *ic, machine_word **code_img, tabl
         /* Process operands */
         if (operand_count--) {
             is_valid = process_spass_operand(line, &current_ic, ic, operands[0], code_img, symbol_table);
-            free(operands[0]);
+            tracked_free(operands[0]);
             if (!is_valid) {
+                if (operand_count) {
+                    tracked_free(operands[1]);
+                }
                 return FALSE;
             }
             if (operand_count) {
                 is_valid = process_spass_operand(line, &current_ic, ic, operands[1], code_img, symbol_table);
-                free(operands[1]);
+                tracked_free(operands[1]);
                 if (!is_valid) {
                     return FALSE;
                 }
@@ -194,15 +256,21 @@ bool process_spass_operand(line_info line, long *curr_ic, long *ic, char *operan
                 print_error(line, "The symbol %s not found", operand);
                 return FALSE;
             }
+            /* A checked line only resolves its symbols, its words are shared */
+            if (line.check_only) {
+                code_img[(++(*curr_ic)) - IC_INIT_VALUE] = checked_word(0);
+                code_img[(++(*curr_ic)) - IC_INIT_VALUE] = checked_word(0);
+                return TRUE;
+            }
             /* Set data to add */
             data_to_add = item->value;
             /* Handle external symbols */
             if (item->type == EXTERNAL_SYMBOL) {
-                add_table_item(symbol_table, operand, (*curr_ic) + 1, EXTERNAL_REFERENCE);
+                add_extern_use(symbol_table, operand, (*curr_ic) + 1);
             }
 
             /* Write data word for label */
-            word_to_write = (machine_word *)malloc(sizeof(machine_word));
+            word_to_write = (machine_word *)tracked_malloc(PROCESS_SPASS_OPERAND_SITE, sizeof(machine_word));
             if (word_to_write == NULL){
                 print_error(line, "Memory allocation failed\n");  
                 return FALSE;
@@ -212,7 +280,7 @@ bool process_spass_operand(line_info line, long *curr_ic, long *ic, char *operan
             code_img[(++(*curr_ic)) - IC_INIT_VALUE] = word_to_write;
 
             /* Write data word for index */
-            word_to_write = (machine_word *)malloc(sizeof(machine_word));
+            word_to_write = (machine_word *)tracked_malloc(PROCESS_SPASS_OPERAND_SITE, sizeof(machine_word));
             if (word_to_write == NULL){
                 print_error(line, "Memory allocation failed\n");  
                 return FALSE;
@@ -230,17 +298,21 @@ bool process_spass_operand(line_info line, long *curr_ic, long *ic, char *operan
                 print_error(line, "The symbol %s not found", operand);
                 return FALSE;
             }
+            if (line.check_only) {
+                code_img[(++(*curr_ic)) - IC_INIT_VALUE] = checked_word(0);
+                return TRUE;
+            }
             
             /* Set data to add */
             data_to_add = item->value;
             
             /* Handle external symbols */
             if (item->type == EXTERNAL_SYMBOL) {
-                add_table_item(symbol_table, operand, (*curr_ic) + 1, EXTERNAL_REFERENCE);
+                add_extern_use(symbol_table, operand, (*curr_ic) + 1);
             }
             
             /* Write data word */
-            word_to_write = (machine_word *)malloc(sizeof(machine_word));
+            word_to_write = (machine_word *)tracked_malloc(PROCESS_SPASS_OPERAND_SITE, sizeof(machine_word));
             if (word_to_write == NULL){
                 print_error(line, "Memory allocation failed\n");  
                 return FALSE;
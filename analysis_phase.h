@@ -3,6 +3,51 @@
 #include "global_variables.h"
 #include "data_tables.h"
 
+/* Kinds of lines of the second pass */
+typedef enum spass_line_kind {
+    SPASS_EMPTY_LINE,       /* Comment or empty line */
+    SPASS_DIRECTIVE_LINE,   /* Directive, only .entry lines are processed */
+    SPASS_CODE_LINE         /* Instruction, whose operand words are completed */
+} spass_line_kind;
+
+/* A use of an external symbol, buffered by a thread of the parallel second pass */
+typedef struct extern_use {
+    char name[MAX_LINE_LENGTH + 2];     /* The operand that uses the symbol, as the .ext file prints it */
+    long address;                       /* Address of the word of the symbol */
+} extern_use;
+
+/* The uses of external symbols of a thread, in increasing order of address */
+typedef struct extern_use_buffer {
+    extern_use *uses;   /* The uses */
+    long count;         /* Number of uses */
+    long capacity;      /* Allocated length of uses */
+} extern_use_buffer;
+
+/**
+ * @brief Finds the kind of a line in the second pass, the way process_line_spass handles it.
+ *
+ * @param line The line_info structure containing information about the current line.
+ * @param index_instruction Pointer to where the index of the instruction, after the label, is stored.
+ * @return The kind of the line.
+ */
+spass_line_kind classify_line_spass(line_info line, long *index_instruction);
+
+/**
+ * @brief Records the uses of external symbols of the current thread to a buffer instead of the symbol table.
+ *
+ * While a buffer is set, the second pass doesn't change the symbol table, so threads can share it.
+ *
+ * @param buffer The buffer to append to, or NULL to add the uses to the symbol table again.
+ */
+void buffer_extern_uses(extern_use_buffer *buffer);
+
+/**
+ * @brief Frees the uses of a buffer and empties it.
+ *
+ * @param buffer The buffer.
+ */
+void free_extern_uses(extern_use_buffer *buffer);
+
 /**
  * @brief Processes a line in the second pass of the assembly process.
  *
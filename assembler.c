@@ -0,0 +1,901 @@
+#define _POSIX_C_SOURCE 200809L /* open_memstream */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include "assembler.h"
+#include "file_writeing.h"
+#include "parsing_phase.h"
+#include "analysis_phase.h"
+#include "utility_functions.h"
+#include "statistics.h"
+#include "trace.h"
+#include "line_profile.h"
+#include "alloc_tracking.h"
+
+/* Fewest lines of a chunk of the parallel first pass, smaller sources are parsed by a single thread */
+#define MIN_CHUNK_LINES 64
+
+/* Chunks of the parallel first pass per thread, so the threads that finish early take more of them */
+#define CHUNKS_PER_JOB 4
+
+int assembly_jobs = 1;
+bool keep_going_after_errors = FALSE;
+
+/* A source read in memory by the parallel first pass */
+struct source_lines {
+    char (*lines)[MAX_LINE_LENGTH + 2]; /* The lines, as the sequential first pass reads them */
+    bool *too_long;                     /* Whether each line is longer than MAX_LINE_LENGTH */
+    long count;                         /* Number of lines */
+    long capacity;                      /* Allocated length of lines and too_long */
+};
+
+/* A chunk of lines parsed by the parallel first pass, with counters that start from the beginning of the images */
+struct first_pass_chunk {
+    long first_line;                    /* Index of the first line of the chunk */
+    long end_line;                      /* Index of the line after the chunk */
+    long seed_count;                    /* Number of constants of the source defined before the chunk */
+    bool parsed;                        /* Whether the chunk was parsed, it is parsed again in order otherwise */
+    bool success;                       /* Whether every line of the chunk was processed without errors */
+    assembly_context context;           /* Counters, images and symbols of the chunk, the counters from the beginning of the images */
+    table_journal journal;              /* Symbols added by the chunk and the labels it didn't find */
+    diagnostic_sink diagnostics;        /* Errors of the chunk, recorded while it is parsed */
+};
+
+/* Work shared by the threads of the parallel first pass */
+struct first_pass_work {
+    struct source_lines *source;        /* The source */
+    assembly_context *context;          /* The context of the source, read only while the threads run */
+    table_journal *defines;             /* Constants defined by the source, in order */
+    struct first_pass_chunk *chunks;    /* The chunks */
+    long chunk_count;                   /* Number of chunks */
+    long next_chunk;                    /* Index of the next chunk to take */
+};
+
+/* A line of the second pass, planned before the parallel second pass */
+struct planned_line {
+    spass_line_kind kind;               /* How the line is processed, SPASS_EMPTY_LINE if it is skipped */
+    long ic;                            /* Instruction counter when the line is processed */
+};
+
+/* A range of instruction lines completed by a thread of the parallel second pass */
+struct second_pass_chunk {
+    long first_code_line;               /* Index of the first instruction line of the chunk */
+    long end_code_line;                 /* Index of the instruction line after the chunk */
+    bool success;                       /* Whether every line of the chunk was processed without errors */
+    extern_use_buffer extern_uses;      /* Uses of external symbols of the chunk, in increasing order of address */
+};
+
+/* Work shared by the threads of the parallel second pass */
+struct second_pass_work {
+    struct source_lines *source;        /* The source */
+    struct planned_line *plan;          /* How each line is processed */
+    long *code_lines;                   /* Indexes of the instruction lines, in increasing order of address */
+    assembly_context *context;          /* The context of the source, each chunk writes its own range of addresses of the code image, the symbol table is not changed */
+    struct second_pass_chunk *chunks;   /* The chunks */
+    long chunk_count;                   /* Number of chunks */
+    long next_chunk;                    /* Index of the next chunk to take */
+};
+
+/**
+ * @brief Records a line with errors in the first pass, for the second pass to skip it when it keeps going.
+ *
+ * @param context The context of the source.
+ * @param line_number The line, after the lines recorded so far.
+ */
+static void record_failed_line(assembly_context *context, long line_number) {
+    long *failed_lines;
+
+    if (!context->keep_going) {
+        return;
+    }
+    if (context->failed_line_count == context->failed_line_capacity) {
+        failed_lines = (long *)tracked_realloc(FAILED_LINES_SITE, context->failed_lines, (context->failed_line_capacity * 2 + 16) * sizeof(long));
+        if (failed_lines == NULL) {
+            printf("Memory allocation failed");
+            return;
+        }
+        context->failed_lines = failed_lines;
+        context->failed_line_capacity = context->failed_line_capacity * 2 + 16;
+    }
+    context->failed_lines[context->failed_line_count++] = line_number;
+}
+
+/**
+ * @brief Checks whether a line had errors in the first pass.
+ *
+ * @param context The context of the source.
+ * @param line_number The line, the lines are checked in increasing order.
+ * @param next_failed Pointer to the index of the first failed line not before the lines checked so far, 0 at first.
+ * @return Returns TRUE if the line had errors, otherwise FALSE.
+ */
+static bool failed_in_first_pass(assembly_context *context, long line_number, long *next_failed) {
+    while (*next_failed < context->failed_line_count && context->failed_lines[*next_failed] < line_number) {
+        (*next_failed)++;
+    }
+    return *next_failed < context->failed_line_count && context->failed_lines[*next_failed] == line_number;
+}
+
+/**
+ * @brief Moves the instruction counter past an instruction line whose operands failed in the second pass.
+ *
+ * The second pass leaves the counter on a failed instruction, so without this the lines after it
+ * would be matched with the words of the instructions before them.
+ *
+ * @param line The line processed.
+ * @param ic_before The instruction counter before the line.
+ * @param ic Pointer to the instruction counter.
+ * @param code_image The code image.
+ */
+static void skip_failed_instruction(line_info line, long ic_before, long *ic, machine_word **code_image) {
+    long index_instruction;
+
+    if (*ic == ic_before && code_image[ic_before - IC_INIT_VALUE] != NULL && classify_line_spass(line, &index_instruction) == SPASS_CODE_LINE) {
+        *ic += code_image[ic_before - IC_INIT_VALUE]->length;
+    }
+}
+
+/**
+ * @brief Runs the first pass over a source read from a file, line by line.
+ *
+ * @param context The context of the source.
+ * @param input_file_ptr The source.
+ * @return Returns TRUE if every line was processed without errors, otherwise FALSE.
+ */
+static bool first_pass(assembly_context *context, FILE *input_file_ptr) {
+    char current_line_buffer[MAX_LINE_LENGTH + 2];  /* Temporary string variable representing an input line */
+    line_info current_line;               /* Information about the current line being processed */
+    int current_character;                /* Temporary variable for skipping remaining characters*/
+    bool process_success = TRUE;
+
+    /* Initialize line information */
+    current_line.file_name = context->input_file_name;
+    current_line.content = current_line_buffer;
+    current_line.line_number = 1;
+    current_line.diagnostics = context->diagnostics;
+    current_line.check_only = context->check_only;
+
+    while (!diagnostic_limit_reached(context->diagnostics) && fgets(current_line_buffer, MAX_LINE_LENGTH + 2, input_file_ptr) != NULL) {
+        STATS_ADD(lines, 1);
+        /* Check for line length exceeding the maximum */
+        if (strchr(current_line_buffer, '\n') == NULL && !feof(input_file_ptr)) {
+            print_error(current_line, "Line too long to process. Maximum line length should be %d.", MAX_LINE_LENGTH);
+            process_success = FALSE;
+            context->has_long_lines = TRUE;
+
+            /* skip leftovers */
+            current_character = fgetc(input_file_ptr);
+            while (current_character != '\n' && current_character != EOF) {
+                current_character = fgetc(input_file_ptr);
+            }
+        } else {
+            /* Process the line in the current iteration */
+            profile_line_begin();
+            if (!process_line_fpass(current_line, &context->ic, &context->dc, context->code_image, context->data_image, &context->symbol_table)){
+                process_success = FALSE;
+                record_failed_line(context, current_line.line_number);
+            }
+            profile_line_end(current_line);
+        }
+        current_line.line_number++;
+    }
+    context->line_count = current_line.line_number - 1;
+    return process_success;
+}
+
+/**
+ * @brief Makes room for one more line in a source read in memory.
+ *
+ * @param source The source.
+ * @return Returns TRUE if there is room for a line, otherwise FALSE.
+ */
+static bool grow_source_lines(struct source_lines *source) {
+    char (*lines)[MAX_LINE_LENGTH + 2];
+    bool *too_long;
+
+    if (source->count < source->capacity) {
+        return TRUE;
+    }
+    lines = (char (*)[MAX_LINE_LENGTH + 2])tracked_realloc(SOURCE_CHUNKS_SITE, source->lines, (source->capacity * 2 + 256) * sizeof(*lines));
+    if (lines == NULL) {
+        printf("Memory allocation failed");
+        return FALSE;
+    }
+    source->lines = lines;
+    too_long = (bool *)tracked_realloc(SOURCE_CHUNKS_SITE, source->too_long, (source->capacity * 2 + 256) * sizeof(bool));
+    if (too_long == NULL) {
+        printf("Memory allocation failed");
+        return FALSE;
+    }
+    source->too_long = too_long;
+    source->capacity = source->capacity * 2 + 256;
+    return TRUE;
+}
+
+/**
+ * @brief Reads a source in memory, splitting its lines like the sequential first pass.
+ *
+ * @param input_file_ptr The source.
+ * @param source The lines read.
+ * @return Returns TRUE if the source was read, otherwise FALSE.
+ */
+static bool read_source_lines(FILE *input_file_ptr, struct source_lines *source) {
+    char current_line_buffer[MAX_LINE_LENGTH + 2];  /* The line being read */
+    int current_character;
+
+    while (fgets(current_line_buffer, MAX_LINE_LENGTH + 2, input_file_ptr) != NULL) {
+        if (!grow_source_lines(source)) {
+            return FALSE;
+        }
+        STATS_ADD(lines, 1);
+        memcpy(source->lines[source->count], current_line_buffer, sizeof(current_line_buffer));
+        source->too_long[source->count] = strchr(current_line_buffer, '\n') == NULL && !feof(input_file_ptr);
+        if (source->too_long[source->count]) {
+            /* skip leftovers */
+            current_character = fgetc(input_file_ptr);
+            while (current_character != '\n' && current_character != EOF) {
+                current_character = fgetc(input_file_ptr);
+            }
+        }
+        source->count++;
+    }
+    return TRUE;
+}
+
+/**
+ * @brief Runs the first pass over lines of a source read in memory.
+ *
+ * @param source The source.
+ * @param first_line Index of the first line to process.
+ * @param end_line Index of the line after the last line to process.
+ * @param context The context the lines are processed in.
+ * @return Returns TRUE if every line was processed without errors, otherwise FALSE.
+ */
+static bool first_pass_lines(struct source_lines *source, long first_line, long end_line, assembly_context *context) {
+    line_info current_line;
+    bool process_success = TRUE;
+
+    current_line.file_name = context->input_file_name;
+    current_line.diagnostics = context->diagnostics;
+    current_line.check_only = context->check_only;
+    for (current_line.line_number = first_line + 1; current_line.line_number <= end_line && !diagnostic_limit_reached(context->diagnostics); current_line.line_number++) {
+        current_line.content = source->lines[current_line.line_number - 1];
+        if (source->too_long[current_line.line_number - 1]) {
+            print_error(current_line, "Line too long to process. Maximum line length should be %d.", MAX_LINE_LENGTH);
+            process_success = FALSE;
+            context->has_long_lines = TRUE;
+        }
+        else if (!process_line_fpass(current_line, &context->ic, &context->dc, context->code_image, context->data_image, &context->symbol_table)) {
+            process_success = FALSE;
+            record_failed_line(context, current_line.line_number);
+        }
+    }
+    return process_success;
+}
+
+/**
+ * @brief Finds the constants defined by a source, so every chunk starts with the constants defined before it.
+ *
+ * The .define lines only depend on the constants defined before them, so they are checked in order
+ * on their own, and their errors are left to the chunks.
+ *
+ * @param work The work of the threads, the seed count of each chunk is set.
+ * @return Returns TRUE if the constants were found, otherwise FALSE.
+ */
+static bool find_source_defines(struct first_pass_work *work) {
+    table define_table = NULL;      /* The constants defined so far */
+    table curr_entry;
+    line_info current_line;
+    char symbol[MAX_LINE_LENGTH];   /* Name of the constant of a .define line */
+    diagnostic_sink discarded_errors = {FALSE, NULL, 0, 0, 0};
+    long chunk_index = 0;
+
+    open_diagnostic_sink(&discarded_errors, 0);
+    for (curr_entry = work->context->symbol_table; curr_entry != NULL; curr_entry = curr_entry->next) {
+        add_table_item(&define_table, curr_entry->name, curr_entry->value, curr_entry->type);
+    }
+
+    journal_table_changes(work->defines);
+    current_line.file_name = work->context->input_file_name;
+    current_line.diagnostics = &discarded_errors;
+    current_line.check_only = work->context->check_only;
+    for (current_line.line_number = 1; current_line.line_number <= work->source->count; current_line.line_number++) {
+        while (chunk_index < work->chunk_count && work->chunks[chunk_index].first_line == current_line.line_number - 1) {
+            work->chunks[chunk_index++].seed_count = work->defines->count;
+        }
+        current_line.content = work->source->lines[current_line.line_number - 1];
+        if (!work->source->too_long[current_line.line_number - 1] && strncmp(".define", current_line.content, 7) == 0) {
+            check_mdefine(current_line, &define_table, symbol);
+        }
+    }
+    journal_table_changes(NULL);
+
+    free_diagnostic_sink(&discarded_errors);
+    free_table(define_table);
+    return TRUE;
+}
+
+/**
+ * @brief Parses a chunk with counters that start from the beginning of the images.
+ *
+ * The errors of the chunk are recorded, and its symbols are added to a table of its own, seeded with the symbols
+ * of the included files and the constants defined before the chunk.
+ *
+ * @param work The work of the threads.
+ * @param chunk The chunk, its context is initialized.
+ */
+static void parse_chunk(struct first_pass_work *work, struct first_pass_chunk *chunk) {
+    table curr_entry;
+    long index;
+
+    init_assembly_context(&chunk->context, work->context->file_name, &chunk->diagnostics);
+    chunk->context.input_file_name = work->context->input_file_name;
+    chunk->context.check_only = work->context->check_only;
+    chunk->context.keep_going = work->context->keep_going;
+    open_diagnostic_sink(&chunk->diagnostics, 0);
+    for (curr_entry = work->context->symbol_table; curr_entry != NULL; curr_entry = curr_entry->next) {
+        add_table_item(&chunk->context.symbol_table, curr_entry->name, curr_entry->value, curr_entry->type);
+    }
+    for (index = 0; index < chunk->seed_count; index++) {
+        add_table_item(&chunk->context.symbol_table, work->defines->records[index].name, work->defines->records[index].value, work->defines->records[index].type);
+    }
+
+    journal_table_changes(&chunk->journal);
+    chunk->success = first_pass_lines(work->source, chunk->first_line, chunk->end_line, &chunk->context);
+    journal_table_changes(NULL);
+    close_diagnostic_sink(&chunk->diagnostics);
+    chunk->parsed = TRUE;
+}
+
+/**
+ * @brief Parses chunks until none is left, the body of every thread of the parallel first pass.
+ *
+ * @param argument The work of the threads.
+ * @return NULL.
+ */
+static void *parse_chunks(void *argument) {
+    struct first_pass_work *work = (struct first_pass_work *)argument;
+    long chunk_index;
+
+    while ((chunk_index = __sync_fetch_and_add(&work->next_chunk, 1)) < work->chunk_count) {
+        parse_chunk(work, &work->chunks[chunk_index]);
+    }
+    return NULL;
+}
+
+/**
+ * @brief Checks a chunk parsed from the beginning of the images passes the same capacity checks at its real counters.
+ *
+ * The counters only grow, so a check that passed at the counters after the chunk passed on every line of the chunk.
+ *
+ * @param chunk The chunk.
+ * @param ic The instruction counter before the chunk.
+ * @param dc The data counter before the chunk.
+ * @return Returns TRUE if every capacity check of the chunk has the same result at its real counters, otherwise FALSE.
+ */
+static bool chunk_fits(struct first_pass_chunk *chunk, long ic, long dc) {
+    if (ic != IC_INIT_VALUE && (ic - IC_INIT_VALUE) + (chunk->context.ic - IC_INIT_VALUE) + MAX_INSTRUCTION_WORDS >= CODE_ARR_IMG_LENGTH) {
+        return FALSE;
+    }
+    return dc + chunk->context.dc <= CODE_ARR_IMG_LENGTH;
+}
+
+/**
+ * @brief Adds a parsed chunk to the images and the symbol table of a context, moving its counters by the counters before it.
+ *
+ * The symbols are added in the order the chunk added them, so the table is the same as after the sequential first pass.
+ *
+ * @param chunk The chunk.
+ * @param context The context of the source.
+ */
+static void commit_chunk(struct first_pass_chunk *chunk, assembly_context *context) {
+    journal_record *record;
+    long index;
+
+    print_recorded_diagnostics(&chunk->diagnostics, context->diagnostics);
+    for (index = 0; index < chunk->context.failed_line_count; index++) {
+        record_failed_line(context, chunk->context.failed_lines[index]);
+    }
+    context->has_long_lines |= chunk->context.has_long_lines;
+    for (index = 0; index < chunk->journal.count; index++) {
+        record = &chunk->journal.records[index];
+        if (!record->is_lookup) {
+            add_table_item(&context->symbol_table, record->name,
+                           record->type == CODE_SYMBOL ? record->value + context->ic - IC_INIT_VALUE : record->type == DATA_SYMBOL ? record->value + context->dc : record->value,
+                           record->type);
+        }
+    }
+    memcpy(context->code_image + context->ic - IC_INIT_VALUE, chunk->context.code_image, (chunk->context.ic - IC_INIT_VALUE) * sizeof(machine_word *));
+    memcpy(context->data_image + context->dc, chunk->context.data_image, chunk->context.dc * sizeof(long));
+    context->ic += chunk->context.ic - IC_INIT_VALUE;
+    context->dc += chunk->context.dc;
+}
+
+/**
+ * @brief Runs the first pass over a source split in chunks that are parsed by several threads.
+ *
+ * Every chunk is parsed as if it started the images, with the symbols of the included files and the constants
+ * defined before it. The chunks are then added in order, moving their counters by the sum of the counters of the
+ * chunks before them. A chunk whose result could differ from the sequential first pass, because it uses a label
+ * defined by an earlier chunk or its real counters fail a capacity check, is parsed again in order instead.
+ * The errors and the symbol table are the same as after the sequential first pass.
+ *
+ * @param context The context of the source.
+ * @param input_file_ptr The source.
+ * @return Returns TRUE if every line was processed without errors, otherwise FALSE.
+ */
+static bool parallel_first_pass(assembly_context *context, FILE *input_file_ptr) {
+    struct source_lines source;
+    struct first_pass_work work;
+    table_journal defines;
+    pthread_t *threads = NULL;
+    long thread_count = 0;
+    long chunk_index;
+    bool process_success = TRUE;
+
+    memset(&source, 0, sizeof(source));
+    memset(&work, 0, sizeof(work));
+    memset(&defines, 0, sizeof(defines));
+    if (!read_source_lines(input_file_ptr, &source)) {
+        tracked_free(source.lines);
+        tracked_free(source.too_long);
+        return FALSE;
+    }
+    context->line_count = source.count;
+
+    work.source = &source;
+    work.context = context;
+    work.defines = &defines;
+    work.chunk_count = source.count / MIN_CHUNK_LINES < (long)assembly_jobs * CHUNKS_PER_JOB ? source.count / MIN_CHUNK_LINES : (long)assembly_jobs * CHUNKS_PER_JOB;
+    if (work.chunk_count >= 2) {
+        work.chunks = (struct first_pass_chunk *)tracked_calloc(SOURCE_CHUNKS_SITE, work.chunk_count, sizeof(struct first_pass_chunk));
+        threads = (pthread_t *)tracked_malloc(SOURCE_CHUNKS_SITE, (assembly_jobs - 1) * sizeof(pthread_t));
+    }
+
+    if (work.chunks != NULL && threads != NULL) {
+        for (chunk_index = 0; chunk_index < work.chunk_count; chunk_index++) {
+            work.chunks[chunk_index].first_line = source.count * chunk_index / work.chunk_count;
+            work.chunks[chunk_index].end_line = source.count * (chunk_index + 1) / work.chunk_count;
+        }
+        if (!find_source_defines(&work)) {
+            work.next_chunk = work.chunk_count;
+        }
+
+        /* The calling thread parses chunks too */
+        while (thread_count < assembly_jobs - 1 && pthread_create(&threads[thread_count], NULL, parse_chunks, &work) == 0) {
+            thread_count++;
+        }
+        parse_chunks(&work);
+        while (thread_count > 0) {
+            pthread_join(threads[--thread_count], NULL);
+        }
+
+        for (chunk_index = 0; chunk_index < work.chunk_count; chunk_index++) {
+            struct first_pass_chunk *chunk = &work.chunks[chunk_index];
+
+            if (diagnostic_limit_reached(context->diagnostics)) {
+                /* The sequential first pass stops there too */
+                free_code_image(chunk->context.code_image, chunk->context.ic - IC_INIT_VALUE);
+            }
+            else if (chunk->parsed && chunk_fits(chunk, context->ic, context->dc) && journal_lookups_fail(context->symbol_table, &chunk->journal)) {
+                commit_chunk(chunk, context);
+                process_success &= chunk->success;
+            }
+            else {
+                free_code_image(chunk->context.code_image, chunk->context.ic - IC_INIT_VALUE);
+                process_success &= first_pass_lines(&source, chunk->first_line, chunk->end_line, context);
+            }
+            free_table(chunk->context.symbol_table);
+            tracked_free(chunk->context.failed_lines);
+            free_table_journal(&chunk->journal);
+            free_diagnostic_sink(&chunk->diagnostics);
+        }
+    }
+    else {
+        /* Too few lines for more than one chunk */
+        process_success = first_pass_lines(&source, 0, source.count, context);
+    }
+
+    tracked_free(threads);
+    tracked_free(work.chunks);
+    free_table_journal(&defines);
+    tracked_free(source.lines);
+    tracked_free(source.too_long);
+    return process_success;
+}
+
+/**
+ * @brief Runs the second pass over a source read from a file, line by line.
+ *
+ * @param context The context of the source, with the code image of the first pass and the instruction counter reset.
+ * @param input_file_ptr The source, read from its beginning.
+ * @return Returns TRUE if every line was processed without errors, otherwise FALSE.
+ */
+static bool second_pass(assembly_context *context, FILE *input_file_ptr) {
+    char current_line_buffer[MAX_LINE_LENGTH + 2] = "";    /* Temporary string variable representing an input line */
+    line_info current_line;               /* Information about the current line being processed */
+    int line_index;                       /* Index of line, used to track the position within a line of the input file */
+    long next_failed = 0;                 /* Index of the next line with errors in the first pass */
+    long read_line_number;                /* The line in the buffer */
+    long ic_before;                       /* Instruction counter before the current line */
+    bool process_success = TRUE;
+
+    current_line.file_name = context->input_file_name;
+    current_line.content = current_line_buffer;
+    current_line.diagnostics = context->diagnostics;
+    current_line.check_only = context->check_only;
+    for (current_line.line_number = 1; !feof(input_file_ptr) && !diagnostic_limit_reached(context->diagnostics); current_line.line_number++) {
+        line_index = 0;
+        /* The last line, processed again at the end of the file, is skipped too if it had errors in the first pass */
+        read_line_number = fgets(current_line_buffer, MAX_LINE_LENGTH, input_file_ptr) != NULL ? current_line.line_number : current_line.line_number - 1;
+        line_index = skip_spaces(current_line_buffer, line_index);
+        if (failed_in_first_pass(context, read_line_number, &next_failed)) {
+            continue;
+        }
+        if (context->code_image[context->ic - IC_INIT_VALUE] != NULL || current_line_buffer[line_index] == '.') {
+            profile_line_begin();
+            ic_before = context->ic;
+            if (!process_line_spass(current_line, &context->ic, context->code_image, &context->symbol_table)) {
+                process_success = FALSE;
+                if (context->keep_going) {
+                    skip_failed_instruction(current_line, ic_before, &context->ic, context->code_image);
+                }
+            }
+            profile_line_end(current_line);
+        }
+    }
+    return process_success;
+}
+
+/**
+ * @brief Reads a source in memory, splitting its lines like the sequential second pass.
+ *
+ * The sequential second pass processes its last line a second time when the source ends with a new line,
+ * since it only finds the end of the file by failing to read another line.
+ *
+ * @param input_file_ptr The source, read from its beginning.
+ * @param source The lines read.
+ * @param repeats_last_line Pointer to where it is stored whether the last line is processed a second time.
+ * @return Returns TRUE if the source was read, otherwise FALSE.
+ */
+static bool read_spass_lines(FILE *input_file_ptr, struct source_lines *source, bool *repeats_last_line) {
+    *repeats_last_line = FALSE;
+    while (!feof(input_file_ptr)) {
+        if (!grow_source_lines(source)) {
+            return FALSE;
+        }
+        if (fgets(source->lines[source->count], MAX_LINE_LENGTH, input_file_ptr) == NULL) {
+            *repeats_last_line = source->count > 0;
+            return TRUE;
+        }
+        source->count++;
+    }
+    return TRUE;
+}
+
+/**
+ * @brief Runs the second pass over lines of a source read in memory, from a line on.
+ *
+ * @param source The source.
+ * @param first_line Index of the first line to process.
+ * @param repeats_last_line Whether the last line is processed a second time.
+ * @param context The context of the source.
+ * @param ic Pointer to the instruction counter.
+ * @return Returns TRUE if every line was processed without errors, otherwise FALSE.
+ */
+static bool second_pass_lines(struct source_lines *source, long first_line, bool repeats_last_line, assembly_context *context, long *ic) {
+    line_info current_line;
+    long next_failed = 0;                 /* Index of the next line with errors in the first pass */
+    long ic_before;                       /* Instruction counter before the current line */
+    bool process_success = TRUE;
+
+    current_line.file_name = context->input_file_name;
+    current_line.diagnostics = context->diagnostics;
+    current_line.check_only = context->check_only;
+    for (current_line.line_number = first_line + 1; current_line.line_number <= source->count + repeats_last_line && !diagnostic_limit_reached(context->diagnostics); current_line.line_number++) {
+        current_line.content = source->lines[current_line.line_number <= source->count ? current_line.line_number - 1 : source->count - 1];
+        if (failed_in_first_pass(context, current_line.line_number <= source->count ? current_line.line_number : source->count, &next_failed)) {
+            continue;
+        }
+        if (context->code_image[(*ic) - IC_INIT_VALUE] != NULL || current_line.content[skip_spaces(current_line.content, 0)] == '.') {
+            ic_before = *ic;
+            if (!process_line_spass(current_line, ic, context->code_image, &context->symbol_table)) {
+                process_success = FALSE;
+                if (context->keep_going) {
+                    skip_failed_instruction(current_line, ic_before, ic, context->code_image);
+                }
+            }
+        }
+    }
+    return process_success;
+}
+
+/**
+ * @brief Completes the instruction lines of chunks until none is left, the body of every thread of the parallel second pass.
+ *
+ * The errors are discarded, the second pass runs again in order when a line fails.
+ *
+ * @param argument The work of the threads.
+ * @return NULL.
+ */
+static void *complete_chunks(void *argument) {
+    struct second_pass_work *work = (struct second_pass_work *)argument;
+    struct second_pass_chunk *chunk;
+    line_info current_line;
+    table symbol_table = work->context->symbol_table;  /* Lookups only, the uses of external symbols are buffered */
+    long chunk_index;
+    long code_line;
+    long ic;
+    diagnostic_sink discarded_errors = {FALSE, NULL, 0, 0, 0};
+
+    current_line.file_name = work->context->input_file_name;
+    current_line.diagnostics = &discarded_errors;
+    current_line.check_only = work->context->check_only;
+    open_diagnostic_sink(&discarded_errors, 0);
+    while ((chunk_index = __sync_fetch_and_add(&work->next_chunk, 1)) < work->chunk_count) {
+        chunk = &work->chunks[chunk_index];
+        chunk->success = TRUE;
+        buffer_extern_uses(&chunk->extern_uses);
+        for (code_line = chunk->first_code_line; code_line < chunk->end_code_line && chunk->success; code_line++) {
+            current_line.line_number = work->code_lines[code_line] + 1;
+            current_line.content = work->source->lines[work->code_lines[code_line]];
+            ic = work->plan[work->code_lines[code_line]].ic;
+            chunk->success = process_line_spass(current_line, &ic, work->context->code_image, &symbol_table);
+        }
+        buffer_extern_uses(NULL);
+    }
+    free_diagnostic_sink(&discarded_errors);
+    return NULL;
+}
+
+/**
+ * @brief Runs the second pass with the operands of the instructions completed by several threads.
+ *
+ * The lines are planned in order first: which of them are processed, and the instruction counter of each
+ * instruction line. The instruction lines are then split in ranges of addresses completed by the threads,
+ * which only look up the symbol table and buffer the uses of external symbols. Finally the lines are
+ * merged in order: the .entry lines are processed and the buffered uses are added to the symbol table at
+ * the point the sequential second pass adds them, so the symbol table, the output files and the errors
+ * are the same. If a line fails, its words are discarded and the second pass runs again in order.
+ *
+ * @param context The context of the source, with the code image of the first pass and the instruction counter reset.
+ * @param input_file_ptr The source, read from its beginning.
+ * @return Returns TRUE if every line was processed without errors, otherwise FALSE.
+ */
+static bool parallel_second_pass(assembly_context *context, FILE *input_file_ptr) {
+    struct source_lines source;
+    struct second_pass_work work;
+    struct planned_line *plan;
+    machine_word *first_pass_words[CODE_ARR_IMG_LENGTH];   /* The code image before the threads complete it */
+    bool repeats_last_line;
+    pthread_t *threads = NULL;
+    long thread_count = 0;
+    long code_count = 0;
+    long line;
+    long index;
+    long planned_ic = IC_INIT_VALUE;        /* Instruction counter of the plan */
+    long next_failed = 0;                   /* Index of the next line with errors in the first pass */
+    machine_word **code_image = context->code_image;
+    bool process_success = TRUE;
+    line_info current_line;
+
+    memset(&source, 0, sizeof(source));
+    memset(&work, 0, sizeof(work));
+    if (!read_spass_lines(input_file_ptr, &source, &repeats_last_line)) {
+        tracked_free(source.lines);
+        tracked_free(source.too_long);
+        return FALSE;
+    }
+
+    /* Plan the lines the way the sequential second pass goes through them, assuming they succeed */
+    plan = (struct planned_line *)tracked_malloc(SOURCE_CHUNKS_SITE, (source.count + 1) * sizeof(struct planned_line));
+    work.code_lines = (long *)tracked_malloc(SOURCE_CHUNKS_SITE, (source.count + 1) * sizeof(long));
+    if (plan != NULL && work.code_lines != NULL) {
+        current_line.file_name = context->input_file_name;
+        current_line.diagnostics = context->diagnostics;
+        current_line.check_only = context->check_only;
+        for (line = 0; line < source.count; line++) {
+            current_line.content = source.lines[line];
+            plan[line].ic = planned_ic;
+            plan[line].kind = SPASS_EMPTY_LINE;
+            if (failed_in_first_pass(context, line + 1, &next_failed)) {
+                continue;
+            }
+            if (code_image[planned_ic - IC_INIT_VALUE] != NULL || source.lines[line][skip_spaces(source.lines[line], 0)] == '.') {
+                plan[line].kind = classify_line_spass(current_line, &index);
+            }
+            if (plan[line].kind == SPASS_CODE_LINE) {
+                if (code_image[planned_ic - IC_INIT_VALUE] == NULL) {
+                    /* Not an instruction of the first pass, leave the line to the sequential second pass */
+                    code_count = 0;
+                    break;
+                }
+                work.code_lines[code_count++] = line;
+                planned_ic += code_image[planned_ic - IC_INIT_VALUE]->length;
+            }
+        }
+        work.chunk_count = code_count / MIN_CHUNK_LINES < (long)assembly_jobs * CHUNKS_PER_JOB ? code_count / MIN_CHUNK_LINES : (long)assembly_jobs * CHUNKS_PER_JOB;
+    }
+    if (work.chunk_count >= 2) {
+        work.chunks = (struct second_pass_chunk *)tracked_calloc(SOURCE_CHUNKS_SITE, work.chunk_count, sizeof(struct second_pass_chunk));
+        threads = (pthread_t *)tracked_malloc(SOURCE_CHUNKS_SITE, (assembly_jobs - 1) * sizeof(pthread_t));
+    }
+
+    if (work.chunks != NULL && threads != NULL) {
+        work.source = &source;
+        work.plan = plan;
+        work.context = context;
+        for (index = 0; index < work.chunk_count; index++) {
+            work.chunks[index].first_code_line = code_count * index / work.chunk_count;
+            work.chunks[index].end_code_line = code_count * (index + 1) / work.chunk_count;
+        }
+        memcpy(first_pass_words, code_image, sizeof(first_pass_words));
+
+        /* The calling thread completes chunks too */
+        while (thread_count < assembly_jobs - 1 && pthread_create(&threads[thread_count], NULL, complete_chunks, &work) == 0) {
+            thread_count++;
+        }
+        complete_chunks(&work);
+        while (thread_count > 0) {
+            pthread_join(threads[--thread_count], NULL);
+        }
+
+        for (index = 0; index < work.chunk_count && work.chunks[index].success; index++);
+        if (index == work.chunk_count) {
+            /* Merge in order, the uses of a line have addresses between its instruction counter and the next one */
+            struct second_pass_chunk *chunk = work.chunks;
+            long use_index = 0;
+
+            for (line = 0; line <= source.count; line++) {
+                while (chunk < work.chunks + work.chunk_count && (line == source.count || chunk->extern_uses.count == use_index || chunk->extern_uses.uses[use_index].address < plan[line].ic)) {
+                    if (use_index < chunk->extern_uses.count) {
+                        add_table_item(&context->symbol_table, chunk->extern_uses.uses[use_index].name, chunk->extern_uses.uses[use_index].address, EXTERNAL_REFERENCE);
+                        use_index++;
+                    }
+                    else {
+                        chunk++;
+                        use_index = 0;
+                    }
+                }
+                if (line < source.count && plan[line].kind == SPASS_DIRECTIVE_LINE && !diagnostic_limit_reached(context->diagnostics)) {
+                    current_line.line_number = line + 1;
+                    current_line.content = source.lines[line];
+                    context->ic = plan[line].ic;
+                    process_success &= process_line_spass(current_line, &context->ic, code_image, &context->symbol_table);
+                }
+            }
+            context->ic = planned_ic;
+            process_success &= second_pass_lines(&source, source.count, repeats_last_line, context, &context->ic);
+        }
+        else {
+            /* Discard the words of the threads and run again in order, so the errors are the sequential ones */
+            for (index = 0; index < CODE_ARR_IMG_LENGTH; index++) {
+                if (first_pass_words[index] == NULL && code_image[index] != NULL) {
+                    free_code_image(code_image + index, 1);
+                }
+            }
+            context->ic = IC_INIT_VALUE;
+            process_success = second_pass_lines(&source, 0, repeats_last_line, context, &context->ic);
+        }
+        for (index = 0; index < work.chunk_count; index++) {
+            free_extern_uses(&work.chunks[index].extern_uses);
+        }
+    }
+    else {
+        process_success = second_pass_lines(&source, 0, repeats_last_line, context, &context->ic);
+    }
+
+    tracked_free(threads);
+    tracked_free(work.chunks);
+    tracked_free(work.code_lines);
+    tracked_free(plan);
+    tracked_free(source.lines);
+    tracked_free(source.too_long);
+    return process_success;
+}
+
+/* Initializes the context of the assembly of a source */
+void init_assembly_context(assembly_context *context, char *file_name, diagnostic_sink *diagnostics) {
+    context->file_name = file_name;
+    context->output_name = file_name;
+    context->input_file_name = file_name;
+    context->line_count = 0;
+    context->ic = IC_INIT_VALUE;
+    context->dc = 0;
+    context->icf = IC_INIT_VALUE;
+    context->dcf = 0;
+
+    /* Start from an empty code image, the second pass relies on unused entries being NULL */
+    memset(context->code_image, 0, sizeof(context->code_image));
+    context->symbol_table = NULL;
+    context->has_macros = FALSE;
+    context->diagnostics = diagnostics;
+    context->check_only = FALSE;
+    context->keep_going = FALSE;
+    context->failed_lines = NULL;
+    context->failed_line_count = 0;
+    context->failed_line_capacity = 0;
+    context->has_long_lines = FALSE;
+    context->included_files = NULL;
+    context->included_file_count = 0;
+}
+
+/* Runs the first and second pass over a source and writes the output files */
+bool assemble_source(assembly_context *context, FILE *input_file_ptr, bool write_outputs, output_files *rendered_outputs) {
+    bool process_success;                   /* Assembly process status */
+    bool first_pass_success;                /* Whether the first pass had no errors */
+    double phase_start_time;                /* Start time of the trace span of the current phase */
+
+    /* First iteration: process each line of the input file, the counters of the statistics are not shared by threads */
+    stats_begin_phase(FIRST_PASS_PHASE);
+    phase_start_time = trace_now();
+    if (assembly_jobs > 1 && !stats_enabled && !alloc_tracking_enabled) {
+        process_success = parallel_first_pass(context, input_file_ptr);
+    }
+    else {
+        process_success = first_pass(context, input_file_ptr);
+    }
+
+    trace_span("first_pass", context->file_name, phase_start_time);
+    stats_end_phase(FIRST_PASS_PHASE);
+
+    /* Save final IC and DC values of the first pass */
+    context->icf = context->ic;
+    context->dcf = context->dc;
+    /* If the first iteration succeeded, or the errors of the second one are wanted anyway, start the second iteration */
+    first_pass_success = process_success;
+    if (process_success || (context->keep_going && !context->has_long_lines && !diagnostic_limit_reached(context->diagnostics))) {
+        context->ic = IC_INIT_VALUE;
+        add_value_to_type(&context->symbol_table, context->icf, DATA_SYMBOL);
+        rewind(input_file_ptr);
+
+        /* Second iteration: process each line of the input file */
+        stats_begin_phase(SECOND_PASS_PHASE);
+        phase_start_time = trace_now();
+        if (assembly_jobs > 1 && !stats_enabled && !alloc_tracking_enabled) {
+            process_success = parallel_second_pass(context, input_file_ptr) && first_pass_success;
+        }
+        else {
+            process_success = second_pass(context, input_file_ptr) && first_pass_success;
+        }
+
+        trace_span("second_pass", context->file_name, phase_start_time);
+        stats_end_phase(SECOND_PASS_PHASE);
+
+        /* If second iteration succeeded, write output files */
+        if (process_success && write_outputs && !context->check_only) {
+            stats_begin_phase(WRITE_PHASE);
+            phase_start_time = trace_now();
+            if (rendered_outputs != NULL) {
+                process_success = render_output_files(context->code_image, context->data_image, context->icf, context->dcf, context->symbol_table, rendered_outputs);
+                trace_span("render_output_files", context->file_name, phase_start_time);
+            }
+            else {
+                process_success = write_output_files(context->code_image, context->data_image, context->icf, context->dcf, context->output_name, context->symbol_table);
+                trace_span("write_output_files", context->file_name, phase_start_time);
+            }
+            stats_end_phase(WRITE_PHASE);
+            STATS_ADD(words_emitted, (context->icf - IC_INIT_VALUE) + context->dcf);
+        }
+
+    }
+
+    STATS_ADD(symbols, count_table_items(context->symbol_table));
+    return process_success;
+}
+
+/* Frees the code image, the symbol table, the failed lines and the included files of a context */
+void free_assembly_context(assembly_context *context) {
+    free_code_image(context->code_image, context->icf - IC_INIT_VALUE);
+    free_table(context->symbol_table);
+    context->symbol_table = NULL;
+    tracked_free(context->failed_lines);
+    context->failed_lines = NULL;
+    context->failed_line_count = 0;
+    context->failed_line_capacity = 0;
+    while (context->included_file_count > 0) {
+        tracked_free(context->included_files[--context->included_file_count]);
+    }
+    tracked_free(context->included_files);
+    context->included_files = NULL;
+}
@@ -0,0 +1,78 @@
+#ifndef _ASSEMBLER_H
+#define _ASSEMBLER_H
+#include <stdio.h>
+#include "global_variables.h"
+#include "data_tables.h"
+#include "file_writeing.h"
+#include "utility_functions.h"
+
+/* Number of threads of the passes, given by --jobs. With more than one, the passes over sources of many lines are split between threads */
+extern int assembly_jobs;
+
+/* Whether --keep-going was given: the second pass runs after errors of the first pass, over the lines without errors */
+extern bool keep_going_after_errors;
+
+/* The state of the assembly of one source. Every phase works on the context it is given, so sources can be assembled at the same time */
+typedef struct assembly_context {
+    char *file_name;                /* The file name without extension, for the trace spans */
+    char *output_name;              /* The name of the .am and output files without extension, the file name unless they go to another directory */
+    char *input_file_name;          /* Name of the source of the passes, for the error messages */
+    long line_count;                /* Source lines read by the first pass */
+    long ic;                        /* Instruction counter */
+    long dc;                        /* Data counter */
+    long icf;                       /* Instruction counter at the end of the first pass */
+    long dcf;                       /* Data counter at the end of the first pass */
+    machine_word *code_image[CODE_ARR_IMG_LENGTH];  /* Contains an image of the machine code */
+    long data_image[CODE_ARR_IMG_LENGTH];           /* Contains an image of the data */
+    table symbol_table;             /* Symbols of the included files, then of the whole source */
+    bool has_macros;                /* Whether the macro processing found macros, and the passes read an expanded source */
+    diagnostic_sink *diagnostics;   /* Where the errors go, NULL to print them */
+    bool check_only;                /* Whether the passes only check the source, without building machine words or output files */
+    bool keep_going;                /* Whether the second pass runs after errors of the first pass, over the lines without errors */
+    long *failed_lines;             /* Numbers of the lines with errors in the first pass, in increasing order, when keep_going is set */
+    long failed_line_count;         /* Number of lines with errors in the first pass */
+    long failed_line_capacity;      /* Allocated length of failed_lines */
+    bool has_long_lines;            /* Whether the first pass found lines too long, the lines of the second pass don't match its lines then */
+    char **included_files;          /* Paths of the files the source includes, directly or not, with errors or not */
+    int included_file_count;        /* Number of included files */
+} assembly_context;
+
+/**
+ * @brief Initializes the context of the assembly of a source, with empty images and symbol table.
+ *
+ * The .am and output files are named after the file name, until the output name is set.
+ *
+ * @param context The context.
+ * @param file_name The file name without extension.
+ * @param diagnostics Where the errors go, or NULL to print them.
+ */
+void init_assembly_context(assembly_context *context, char *file_name, diagnostic_sink *diagnostics);
+
+/**
+ * @brief Runs the first and second pass over a source and writes the output files.
+ *
+ * The source is the result of the macro processing, it is read twice, once by each pass.
+ * The symbol table of the context may already contain the symbols of the files included by the source.
+ * With assembly_jobs above one, both passes run on several threads, unless the statistics or
+ * the allocations are measured. The results and the errors are the same as with a single thread.
+ * When the first pass has errors, the second pass only runs if the context keeps going, over the lines
+ * without errors, for its errors alone. Lines too long or the error limit of the sink stop it too.
+ * The images and the symbol table are left in the context. When the context is only checked, the
+ * code image only holds the length of each instruction, and no output file is written or rendered.
+ *
+ * @param context The context, with the name of the source set.
+ * @param input_file_ptr The source, read from its beginning. It must support seeking back to its beginning.
+ * @param write_outputs Whether the .ob, .ext and .ent files are written when both passes succeed.
+ * @param rendered_outputs If not NULL, the output files are rendered into it instead of being written.
+ * @return Returns true if the source was assembled without errors, otherwise false.
+ */
+bool assemble_source(assembly_context *context, FILE *input_file_ptr, bool write_outputs, output_files *rendered_outputs);
+
+/**
+ * @brief Frees the code image, the symbol table, the failed lines and the included files of a context.
+ *
+ * @param context The context.
+ */
+void free_assembly_context(assembly_context *context);
+
+#endif
@@ -0,0 +1,208 @@
+#define _POSIX_C_SOURCE 200809L /* fmemopen and open_memstream */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "assembler_api.h"
+#include "assembler.h"
+#include "preprocessor.h"
+#include "data_tables.h"
+#include "file_writeing.h"
+#include "utility_functions.h"
+
+/* The bits of a memory cell */
+#define WORD_MASK 0x3FFF
+
+/**
+ * @brief Copies the symbols of a type, in the order of the output file that lists them.
+ *
+ * @param symbol_table The symbol table of the source.
+ * @param type ENTRY_SYMBOL or EXTERNAL_REFERENCE.
+ * @param symbols Receives the symbols.
+ * @param count Receives the number of symbols.
+ * @return Returns true if the symbols were copied, otherwise false.
+ */
+static bool copy_symbols(table symbol_table, symbol_type type, assembler_symbol **symbols, long *count) {
+    table filtered = filter_table_by_type(symbol_table, type);
+    table curr_entry;
+    bool result = TRUE;
+
+    for (curr_entry = filtered; curr_entry != NULL; curr_entry = curr_entry->next) {
+        (*count)++;
+    }
+    *symbols = *count > 0 ? (assembler_symbol *)calloc(*count, sizeof(assembler_symbol)) : NULL;
+    if (*count > 0 && *symbols == NULL) {
+        *count = 0;
+        result = FALSE;
+    }
+    else {
+        *count = 0;
+        for (curr_entry = filtered; curr_entry != NULL && result; curr_entry = curr_entry->next) {
+            (*symbols)[*count].name = (char *)malloc(strlen(curr_entry->name) + 1);
+            if ((*symbols)[*count].name == NULL) {
+                result = FALSE;
+                continue;
+            }
+            strcpy((*symbols)[*count].name, curr_entry->name);
+            (*symbols)[(*count)++].address = curr_entry->value;
+        }
+    }
+    free_table(filtered);
+    return result;
+}
+
+/**
+ * @brief Copies the images and the symbols of an assembled source to a result.
+ *
+ * @param context The context of the source, after both passes succeeded.
+ * @param result The result.
+ * @return Returns true if everything was copied, otherwise false.
+ */
+static bool copy_images(assembly_context *context, assembler_result *result) {
+    long index;
+
+    result->code_address = IC_INIT_VALUE;
+    result->code_length = context->icf - IC_INIT_VALUE;
+    result->data_address = context->icf;
+    result->data_length = context->dcf;
+    result->code = (long *)malloc((result->code_length + 1) * sizeof(long));
+    result->data = (long *)malloc((result->data_length + 1) * sizeof(long));
+    if (result->code == NULL || result->data == NULL) {
+        return FALSE;
+    }
+    for (index = 0; index < result->code_length; index++) {
+        result->code[index] = code_word_value(context->code_image[index]) & WORD_MASK;
+    }
+    for (index = 0; index < result->data_length; index++) {
+        result->data[index] = context->data_image[index] & WORD_MASK;
+    }
+    return copy_symbols(context->symbol_table, ENTRY_SYMBOL, &result->entries, &result->entry_count) &&
+           copy_symbols(context->symbol_table, EXTERNAL_REFERENCE, &result->externals, &result->external_count);
+}
+
+/**
+ * @brief Moves the errors recorded by a sink to a result, the sink is left empty.
+ *
+ * @param sink The sink, closed.
+ * @param result The result.
+ * @return Returns true if the errors were moved, otherwise false and they are freed.
+ */
+static bool move_diagnostics(diagnostic_sink *sink, assembler_result *result) {
+    long index;
+
+    if (sink->count > 0) {
+        result->diagnostics = (assembler_diagnostic *)malloc(sink->count * sizeof(assembler_diagnostic));
+        if (result->diagnostics == NULL) {
+            free_diagnostic_sink(sink);
+            return FALSE;
+        }
+    }
+    for (index = 0; index < sink->count; index++) {
+        result->diagnostics[index].file_name = sink->records[index].file_name;
+        result->diagnostics[index].line_number = sink->records[index].line_number;
+        result->diagnostics[index].column = sink->records[index].column;
+        result->diagnostics[index].code = sink->records[index].code;
+        result->diagnostics[index].message = sink->records[index].message;
+        result->diagnostics[index].is_located = sink->records[index].format == LOCATED_DIAGNOSTIC;
+    }
+    result->diagnostic_count = sink->count;
+
+    /* The strings belong to the result now */
+    free(sink->records);
+    sink->records = NULL;
+    sink->count = sink->capacity = 0;
+    return TRUE;
+}
+
+/* Assembles a source held in memory */
+int assemble_buffer(const char *source, size_t length, assembler_options *options, assembler_result *result) {
+    /* The assembler only reads the source and its name */
+    char *source_name = (char *)(options != NULL && options->source_name != NULL ? options->source_name : ASSEMBLER_DEFAULT_SOURCE_NAME);
+    bool render_files = options != NULL && options->render_files;
+    assembly_context context;           /* The counters, images and symbols of the source */
+    diagnostic_sink diagnostics;        /* The errors of the source, until they are moved to the result */
+    output_files files = {NULL, 0, NULL, 0, NULL, 0};  /* The rendered files, until they are moved to the result */
+    char *expanded = NULL;              /* The source after the macro processing, if it has macros */
+    size_t expanded_length = 0;
+    FILE *input_file_ptr;
+    FILE *expanded_file_ptr;
+    FILE *am_file_ptr;
+
+    memset(result, 0, sizeof(assembler_result));
+    open_diagnostic_sink(&diagnostics, options != NULL ? options->max_errors : 0);
+    init_assembly_context(&context, source_name, &diagnostics);
+    context.keep_going = options != NULL && options->keep_going;
+
+    input_file_ptr = fmemopen((char *)source, length, "r");
+    expanded_file_ptr = open_memstream(&expanded, &expanded_length);
+    if (input_file_ptr == NULL || expanded_file_ptr == NULL) {
+        printf("Memory allocation failed");
+    }
+    else if (process_macros_stream(&context, input_file_ptr, source_name, expanded_file_ptr)) {
+        fclose(expanded_file_ptr);
+        expanded_file_ptr = NULL;
+
+        /* The errors of both passes name the source, its expanded form has no file of its own */
+        if (!context.has_macros) {
+            rewind(input_file_ptr);
+            result->success = assemble_source(&context, input_file_ptr, render_files, render_files ? &files : NULL);
+        }
+        else if ((am_file_ptr = fmemopen(expanded, expanded_length, "r")) != NULL) {
+            result->success = assemble_source(&context, am_file_ptr, render_files, render_files ? &files : NULL);
+            fclose(am_file_ptr);
+        }
+        if (result->success && !copy_images(&context, result)) {
+            printf("Memory allocation failed");
+            result->success = FALSE;
+        }
+    }
+
+    if (expanded_file_ptr != NULL) {
+        fclose(expanded_file_ptr);
+    }
+    if (input_file_ptr != NULL) {
+        fclose(input_file_ptr);
+    }
+    free(expanded);
+    free_assembly_context(&context);
+    close_diagnostic_sink(&diagnostics);
+    if (!move_diagnostics(&diagnostics, result)) {
+        printf("Memory allocation failed");
+    }
+    result->files.object = files.object;
+    result->files.object_length = files.object_length;
+    result->files.externals = files.externals;
+    result->files.externals_length = files.externals_length;
+    result->files.entries = files.entries;
+    result->files.entries_length = files.entries_length;
+    return result->success;
+}
+
+/* Frees the result of assemble_buffer */
+void free_assembler_result(assembler_result *result) {
+    long index;
+
+    for (index = 0; index < result->entry_count; index++) {
+        free(result->entries[index].name);
+    }
+    for (index = 0; index < result->external_count; index++) {
+        free(result->externals[index].name);
+    }
+    free(result->entries);
+    free(result->externals);
+    for (index = 0; index < result->diagnostic_count; index++) {
+        free(result->diagnostics[index].file_name);
+        free(result->diagnostics[index].message);
+    }
+    free(result->code);
+    free(result->data);
+    free(result->files.object);
+    free(result->files.externals);
+    free(result->files.entries);
+    free(result->diagnostics);
+    memset(result, 0, sizeof(assembler_result));
+}
+
+/* Frees the included files cached by assemble_buffer */
+void free_assembler_include_cache(void) {
+    free_include_cache();
+}
@@ -0,0 +1,99 @@
+#ifndef _ASSEMBLER_API_H
+#define _ASSEMBLER_API_H
+#include <stddef.h>
+
+/* The header of the library stands alone, it uses none of the types of the assembler */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Name of a source given to assemble_buffer without options */
+#define ASSEMBLER_DEFAULT_SOURCE_NAME "source.as"
+
+/* Options of assemble_buffer */
+typedef struct assembler_options {
+    const char *source_name;    /* Name of the source in the errors, its included files are relative to it. NULL for ASSEMBLER_DEFAULT_SOURCE_NAME */
+    int render_files;           /* Nonzero to render the .ob, .ext and .ent files in the result too */
+    long max_errors;            /* Errors recorded at most, the source isn't scanned further. 0 for no limit */
+    int keep_going;             /* Nonzero to resolve the symbols after errors of the first pass, for their errors */
+} assembler_options;
+
+/* An entry symbol or a use of an external symbol in the result of assemble_buffer */
+typedef struct assembler_symbol {
+    char *name;             /* Name of the symbol */
+    long address;           /* Address of the entry, or of the word that uses the external symbol */
+} assembler_symbol;
+
+/* The output files rendered by assemble_buffer */
+typedef struct assembler_files {
+    char *object;               /* Contents of the .ob file */
+    size_t object_length;       /* Length of the .ob file */
+    char *externals;            /* Contents of the .ext file, NULL if there are no external references */
+    size_t externals_length;    /* Length of the .ext file */
+    char *entries;              /* Contents of the .ent file, NULL if there are no entry symbols */
+    size_t entries_length;      /* Length of the .ent file */
+} assembler_files;
+
+/* An error of the source or of one of its included files */
+typedef struct assembler_diagnostic {
+    char *file_name;            /* File of the error */
+    long line_number;           /* Line of the error */
+    long column;                /* Column of the error, from 1, or 0 if it isn't known */
+    unsigned long code;         /* Identifies the message without its arguments */
+    char *message;              /* The message, without the location */
+    int is_located;             /* Nonzero if main_program prints it to the standard error after its file and line, zero if as is to the standard output */
+} assembler_diagnostic;
+
+/* The result of assemble_buffer */
+typedef struct assembler_result {
+    int success;                        /* Nonzero if the source was assembled without errors, the images and symbols are empty otherwise */
+    long code_address;                  /* Address of the first word of the code */
+    long *code;                         /* The words of the code, 14 bits each */
+    long code_length;                   /* Number of words of the code */
+    long data_address;                  /* Address of the first word of the data, right after the code */
+    long *data;                         /* The words of the data, 14 bits each */
+    long data_length;                   /* Number of words of the data */
+    assembler_symbol *entries;          /* The entry symbols, in the order of the .ent file */
+    long entry_count;                   /* Number of entry symbols */
+    assembler_symbol *externals;        /* The uses of external symbols, in the order of the .ext file */
+    long external_count;                /* Number of uses of external symbols */
+    assembler_files files;              /* The rendered .ob, .ext and .ent files, if they were asked for */
+    assembler_diagnostic *diagnostics;  /* The errors of the source, in the order they were reported */
+    long diagnostic_count;              /* Number of errors */
+} assembler_result;
+
+/**
+ * @brief Assembles a source held in memory, without reading or writing any file but its included files.
+ *
+ * The source goes through the macro processing and both passes, like a file given to main_program,
+ * and the result holds what the output files would hold. Several sources can be assembled at the
+ * same time from different threads. The included files are cached for the next sources, until
+ * free_assembler_include_cache is called.
+ *
+ * @param source The source.
+ * @param length The length of the source.
+ * @param options The options, or NULL for the defaults.
+ * @param result Receives the images, the symbols and the errors, freed with free_assembler_result.
+ * @return Returns nonzero if the source was assembled without errors, otherwise zero.
+ */
+int assemble_buffer(const char *source, size_t length, assembler_options *options, assembler_result *result);
+
+/**
+ * @brief Frees the result of assemble_buffer.
+ *
+ * @param result The result, it is reset to an empty result.
+ */
+void free_assembler_result(assembler_result *result);
+
+/**
+ * @brief Frees the included files cached by assemble_buffer, the next sources parse them again.
+ *
+ * No source may be assembled meanwhile.
+ */
+void free_assembler_include_cache(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
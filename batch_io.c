@@ -0,0 +1,559 @@
+#define _DEFAULT_SOURCE /* syscall and mmap */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <linux/io_uring.h>
+#include "batch_io.h"
+
+/* A submission and a completion queue shared with the kernel */
+struct uring {
+    int fd;                         /* The io_uring file descriptor */
+    unsigned entries;               /* Number of submission queue entries */
+    unsigned pending;               /* Entries added since the last submission */
+    bool failed;                    /* Whether a submission was refused */
+    unsigned sq_tail;               /* Tail of the submission queue, published on submission */
+    void *sq_ring;                  /* Mapped submission queue ring */
+    size_t sq_ring_size;            /* Length of the mapped submission queue ring */
+    void *cq_ring;                  /* Mapped completion queue ring, the same mapping with IORING_FEAT_SINGLE_MMAP */
+    size_t cq_ring_size;            /* Length of the mapped completion queue ring */
+    struct io_uring_sqe *sqes;      /* Mapped submission queue entries */
+    unsigned *sq_mask;              /* Mask of the submission queue indexes */
+    unsigned *sq_tail_pointer;      /* Tail of the submission queue read by the kernel */
+    unsigned *sq_array;             /* Indexes of the submitted entries */
+    unsigned *cq_head;              /* Head of the completion queue, advanced as completions are reaped */
+    unsigned *cq_tail;              /* Tail of the completion queue, advanced by the kernel */
+    unsigned *cq_mask;              /* Mask of the completion queue indexes */
+    struct io_uring_cqe *cqes;      /* Completion queue entries */
+};
+
+/* The state of a file of a batch while it is read or written */
+struct file_state {
+    int fd;                 /* The open file, -1 if it isn't open */
+    size_t capacity;        /* Allocated length of the contents, without the extra byte */
+    size_t done_length;     /* Bytes written so far */
+    bool active;            /* Whether the file still has bytes to read or write */
+    bool opened;            /* Whether the file was opened */
+    bool failed;            /* Whether a read, a write or the close of the file failed */
+};
+
+/* A batch run by the fallback thread pool */
+struct pool_work {
+    io_request *requests;   /* The files */
+    int count;              /* Number of files */
+    int next_request;       /* Index of the next file a thread takes */
+    bool writing;           /* Whether the files are written, otherwise they are read */
+};
+
+/* Operations of a round of submissions over the files of a batch */
+typedef enum uring_step {
+    OPEN_FOR_READING_STEP,  /* Open the files that are read */
+    OPEN_FOR_WRITING_STEP,  /* Create or truncate the files that are written */
+    READ_STEP,              /* Read the next bytes of the files */
+    WRITE_STEP,             /* Write the remaining bytes of the files */
+    CLOSE_STEP              /* Close the open files */
+} uring_step;
+
+io_backend batch_io_backend = URING_IO_BACKEND;
+
+/**
+ * @brief Sets up an io_uring instance and maps its queues.
+ *
+ * @param ring The ring to set up.
+ * @param entries The number of submission queue entries.
+ * @return Returns true if the ring was set up, false if io_uring isn't available.
+ */
+static bool open_uring(struct uring *ring, unsigned entries);
+
+/**
+ * @brief Unmaps the queues of a ring and closes it.
+ */
+static void close_uring(struct uring *ring);
+
+/**
+ * @brief Returns a cleared submission queue entry, to be submitted by submit_and_reap.
+ */
+static struct io_uring_sqe *next_sqe(struct uring *ring);
+
+/**
+ * @brief Submits the pending entries, waits for all of them, and passes their results to complete_step.
+ *
+ * @return Returns true if the entries were submitted, otherwise false.
+ */
+static bool submit_and_reap(struct uring *ring, io_request *requests, struct file_state *states, uring_step step);
+
+/**
+ * @brief Adds the operation of a step for a file to the submission queue, if the file needs one.
+ *
+ * @return Returns true if an entry was added, otherwise false.
+ */
+static bool prepare_step(struct uring *ring, io_request *request, struct file_state *state, uring_step step, int index);
+
+/**
+ * @brief Updates a file with the result of the operation of a step.
+ *
+ * @param request The file.
+ * @param state The state of the file.
+ * @param step The step of the operation.
+ * @param result The result of the operation, a negated errno value on failure.
+ */
+static void complete_step(io_request *request, struct file_state *state, uring_step step, int result);
+
+/**
+ * @brief Runs a step over every file of a batch, in submissions of at most the entries of the ring.
+ *
+ * @return Returns true if an operation was submitted, otherwise false.
+ */
+static bool run_step(struct uring *ring, io_request *requests, struct file_state *states, int count, uring_step step);
+
+/**
+ * @brief Reads or writes a batch with io_uring.
+ *
+ * @return Returns true if the batch was handled, false if io_uring isn't available and nothing was done.
+ */
+static bool uring_batch(io_request *requests, int count, bool writing);
+
+/**
+ * @brief Reads or writes a batch on a pool of threads doing blocking calls.
+ */
+static void pool_batch(io_request *requests, int count, bool writing);
+
+/**
+ * @brief The body of the threads of the pool: takes files until none is left.
+ *
+ * @param argument The work of the pool.
+ * @return NULL.
+ */
+static void *pool_worker(void *argument);
+
+/**
+ * @brief Reads a whole file with blocking calls.
+ */
+static void read_whole_file(io_request *request);
+
+/**
+ * @brief Creates or truncates a file and writes its contents with blocking calls.
+ */
+static void write_whole_file(io_request *request);
+
+/* Sets up an io_uring instance and maps its queues */
+static bool open_uring(struct uring *ring, unsigned entries) {
+    struct io_uring_params params;
+    char *sq_ring;
+    char *cq_ring;
+
+    memset(&params, 0, sizeof(params));
+    ring->fd = syscall(__NR_io_uring_setup, entries, &params);
+    if (ring->fd < 0) {
+        return FALSE;
+    }
+
+    ring->sq_ring_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    ring->cq_ring_size = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+    if (params.features & IORING_FEAT_SINGLE_MMAP) {
+        if (ring->cq_ring_size > ring->sq_ring_size) {
+            ring->sq_ring_size = ring->cq_ring_size;
+        }
+        ring->cq_ring_size = ring->sq_ring_size;
+    }
+    ring->sq_ring = mmap(NULL, ring->sq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED, ring->fd, IORING_OFF_SQ_RING);
+    if (ring->sq_ring == MAP_FAILED) {
+        close(ring->fd);
+        return FALSE;
+    }
+    if (params.features & IORING_FEAT_SINGLE_MMAP) {
+        ring->cq_ring = ring->sq_ring;
+    }
+    else {
+        ring->cq_ring = mmap(NULL, ring->cq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED, ring->fd, IORING_OFF_CQ_RING);
+        if (ring->cq_ring == MAP_FAILED) {
+            munmap(ring->sq_ring, ring->sq_ring_size);
+            close(ring->fd);
+            return FALSE;
+        }
+    }
+    ring->sqes = (struct io_uring_sqe *)mmap(NULL, params.sq_entries * sizeof(struct io_uring_sqe), PROT_READ | PROT_WRITE,
+                                             MAP_SHARED, ring->fd, IORING_OFF_SQES);
+    if (ring->sqes == MAP_FAILED) {
+        if (ring->cq_ring != ring->sq_ring) {
+            munmap(ring->cq_ring, ring->cq_ring_size);
+        }
+        munmap(ring->sq_ring, ring->sq_ring_size);
+        close(ring->fd);
+        return FALSE;
+    }
+
+    sq_ring = (char *)ring->sq_ring;
+    cq_ring = (char *)ring->cq_ring;
+    ring->entries = params.sq_entries;
+    ring->pending = 0;
+    ring->failed = FALSE;
+    ring->sq_mask = (unsigned *)(sq_ring + params.sq_off.ring_mask);
+    ring->sq_tail_pointer = (unsigned *)(sq_ring + params.sq_off.tail);
+    ring->sq_array = (unsigned *)(sq_ring + params.sq_off.array);
+    ring->sq_tail = *ring->sq_tail_pointer;
+    ring->cq_head = (unsigned *)(cq_ring + params.cq_off.head);
+    ring->cq_tail = (unsigned *)(cq_ring + params.cq_off.tail);
+    ring->cq_mask = (unsigned *)(cq_ring + params.cq_off.ring_mask);
+    ring->cqes = (struct io_uring_cqe *)(cq_ring + params.cq_off.cqes);
+    return TRUE;
+}
+
+/* Unmaps the queues of a ring and closes it */
+static void close_uring(struct uring *ring) {
+    munmap(ring->sqes, ring->entries * sizeof(struct io_uring_sqe));
+    if (ring->cq_ring != ring->sq_ring) {
+        munmap(ring->cq_ring, ring->cq_ring_size);
+    }
+    munmap(ring->sq_ring, ring->sq_ring_size);
+    close(ring->fd);
+}
+
+/* Returns a cleared submission queue entry, to be submitted by submit_and_reap */
+static struct io_uring_sqe *next_sqe(struct uring *ring) {
+    unsigned index = ring->sq_tail & *ring->sq_mask;
+
+    memset(&ring->sqes[index], 0, sizeof(struct io_uring_sqe));
+    ring->sq_array[index] = index;
+    ring->sq_tail++;
+    ring->pending++;
+    return &ring->sqes[index];
+}
+
+/* Submits the pending entries, waits for all of them, and passes their results to complete_step */
+static bool submit_and_reap(struct uring *ring, io_request *requests, struct file_state *states, uring_step step) {
+    unsigned submitted = ring->pending;
+    unsigned reaped = 0;
+    unsigned head;
+    long result;
+    struct io_uring_cqe *cqe;
+
+    /* Publish the new entries before the kernel reads the tail */
+    __atomic_store_n(ring->sq_tail_pointer, ring->sq_tail, __ATOMIC_RELEASE);
+    ring->pending = 0;
+    do {
+        result = syscall(__NR_io_uring_enter, ring->fd, submitted, submitted, IORING_ENTER_GETEVENTS, NULL, 0);
+    } while (result < 0 && errno == EINTR);
+    if (result < 0) {
+        ring->failed = TRUE;
+        return FALSE;
+    }
+
+    while (reaped < submitted) {
+        head = *ring->cq_head;
+        if (head == __atomic_load_n(ring->cq_tail, __ATOMIC_ACQUIRE)) {
+            /* Interrupted before every completion arrived, wait for the rest */
+            syscall(__NR_io_uring_enter, ring->fd, 0, 1, IORING_ENTER_GETEVENTS, NULL, 0);
+            continue;
+        }
+        cqe = &ring->cqes[head & *ring->cq_mask];
+        complete_step(&requests[cqe->user_data], &states[cqe->user_data], step, cqe->res);
+        __atomic_store_n(ring->cq_head, head + 1, __ATOMIC_RELEASE);
+        reaped++;
+    }
+    return TRUE;
+}
+
+/* Adds the operation of a step for a file to the submission queue, if the file needs one */
+static bool prepare_step(struct uring *ring, io_request *request, struct file_state *state, uring_step step, int index) {
+    struct io_uring_sqe *sqe;
+
+    switch (step) {
+        case OPEN_FOR_READING_STEP:
+        case OPEN_FOR_WRITING_STEP:
+            sqe = next_sqe(ring);
+            sqe->opcode = IORING_OP_OPENAT;
+            sqe->fd = AT_FDCWD;
+            sqe->addr = (unsigned long)request->path;
+            sqe->open_flags = step == OPEN_FOR_READING_STEP ? O_RDONLY : O_WRONLY | O_CREAT | O_TRUNC;
+            sqe->len = 0666;
+            break;
+        case READ_STEP:
+        case WRITE_STEP:
+            if (!state->active) {
+                return FALSE;
+            }
+            sqe = next_sqe(ring);
+            sqe->opcode = step == READ_STEP ? IORING_OP_READ : IORING_OP_WRITE;
+            sqe->fd = state->fd;
+            if (step == READ_STEP) {
+                sqe->addr = (unsigned long)(request->contents + request->length);
+                sqe->len = state->capacity - request->length;
+                sqe->off = request->length;
+            }
+            else {
+                sqe->addr = (unsigned long)(request->contents + state->done_length);
+                sqe->len = request->length - state->done_length;
+                sqe->off = state->done_length;
+            }
+            break;
+        default:
+            if (state->fd < 0) {
+                return FALSE;
+            }
+            sqe = next_sqe(ring);
+            sqe->opcode = IORING_OP_CLOSE;
+            sqe->fd = state->fd;
+            break;
+    }
+    sqe->user_data = index;
+    return TRUE;
+}
+
+/* Updates a file with the result of the operation of a step */
+static void complete_step(io_request *request, struct file_state *state, uring_step step, int result) {
+    char *new_contents;
+
+    switch (step) {
+        case OPEN_FOR_READING_STEP:
+            if (result < 0) {
+                break;
+            }
+            state->fd = result;
+            state->opened = TRUE;
+            state->capacity = INITIAL_READ_SIZE;
+            request->contents = (char *)malloc(state->capacity + 1);
+            if (request->contents == NULL) {
+                printf("Memory allocation failed");
+                state->failed = TRUE;
+                break;
+            }
+            state->active = TRUE;
+            break;
+        case OPEN_FOR_WRITING_STEP:
+            if (result < 0) {
+                break;
+            }
+            state->fd = result;
+            state->opened = TRUE;
+            state->active = request->length > 0;
+            break;
+        case READ_STEP:
+            /* Read until the end of the file, like fgets does */
+            if (result <= 0) {
+                state->failed = result < 0;
+                state->active = FALSE;
+                break;
+            }
+            request->length += result;
+            if (request->length == state->capacity) {
+                new_contents = (char *)realloc(request->contents, state->capacity * 2 + 1);
+                if (new_contents == NULL) {
+                    printf("Memory allocation failed");
+                    state->failed = TRUE;
+                    state->active = FALSE;
+                    break;
+                }
+                request->contents = new_contents;
+                state->capacity *= 2;
+            }
+            break;
+        case WRITE_STEP:
+            /* A file too large or a full disk writes less than asked, then fails */
+            if (result <= 0) {
+                state->failed = TRUE;
+                state->active = FALSE;
+                break;
+            }
+            state->done_length += result;
+            state->active = state->done_length < request->length;
+            break;
+        default:
+            state->failed = state->failed || result < 0;
+            state->fd = -1;
+            break;
+    }
+}
+
+/* Runs a step over every file of a batch, in submissions of at most the entries of the ring */
+static bool run_step(struct uring *ring, io_request *requests, struct file_state *states, int count, uring_step step) {
+    bool submitted = FALSE;
+    int index;
+
+    for (index = 0; index < count; index++) {
+        if (prepare_step(ring, &requests[index], &states[index], step, index)) {
+            submitted = TRUE;
+        }
+        if (ring->pending == ring->entries && !submit_and_reap(ring, requests, states, step)) {
+            return submitted;
+        }
+    }
+    if (ring->pending > 0) {
+        submit_and_reap(ring, requests, states, step);
+    }
+    return submitted;
+}
+
+/* Reads or writes a batch with io_uring */
+static bool uring_batch(io_request *requests, int count, bool writing) {
+    struct uring ring;
+    struct file_state *states;
+    unsigned entries = 1;
+    int index;
+
+    while (entries < (unsigned)count && entries < MAX_URING_ENTRIES) {
+        entries *= 2;
+    }
+    states = (struct file_state *)calloc(count, sizeof(struct file_state));
+    if (states == NULL) {
+        printf("Memory allocation failed");
+        return FALSE;
+    }
+    if (!open_uring(&ring, entries)) {
+        free(states);
+        return FALSE;
+    }
+    for (index = 0; index < count; index++) {
+        states[index].fd = -1;
+    }
+
+    /* Every step is a round of submissions over the whole batch, the reads repeat until every file ended */
+    run_step(&ring, requests, states, count, writing ? OPEN_FOR_WRITING_STEP : OPEN_FOR_READING_STEP);
+    if (ring.failed) {
+        /* The kernel refused the opens, undo them so the thread pool handles the whole batch */
+        for (index = 0; index < count; index++) {
+            if (states[index].fd >= 0) {
+                close(states[index].fd);
+            }
+            if (!writing) {
+                free(requests[index].contents);
+                requests[index].contents = NULL;
+            }
+            requests[index].succeeded = FALSE;
+        }
+        close_uring(&ring);
+        free(states);
+        return FALSE;
+    }
+    while (!ring.failed && run_step(&ring, requests, states, count, writing ? WRITE_STEP : READ_STEP));
+    run_step(&ring, requests, states, count, CLOSE_STEP);
+
+    /* A file whose close couldn't be submitted is closed directly. A file succeeded if it was read or written whole */
+    for (index = 0; index < count; index++) {
+        if (states[index].fd >= 0 && close(states[index].fd) != 0) {
+            states[index].failed = TRUE;
+        }
+        requests[index].succeeded = states[index].opened && !states[index].failed && !states[index].active;
+    }
+    close_uring(&ring);
+    free(states);
+    return TRUE;
+}
+
+/* Reads a whole file with blocking calls */
+static void read_whole_file(io_request *request) {
+    FILE *file = fopen(request->path, "r");
+    size_t capacity = INITIAL_READ_SIZE;
+    size_t read_length;
+    char *new_contents;
+
+    if (file == NULL) {
+        return;
+    }
+    request->contents = (char *)malloc(capacity + 1);
+    while (request->contents != NULL && (read_length = fread(request->contents + request->length, 1, capacity - request->length, file)) > 0) {
+        request->length += read_length;
+        if (request->length == capacity) {
+            capacity *= 2;
+            new_contents = (char *)realloc(request->contents, capacity + 1);
+            if (new_contents == NULL) {
+                free(request->contents);
+            }
+            request->contents = new_contents;
+        }
+    }
+    if (request->contents == NULL) {
+        printf("Memory allocation failed");
+        request->length = 0;
+    }
+    request->succeeded = request->contents != NULL && !ferror(file);
+    fclose(file);
+}
+
+/* Creates or truncates a file and writes its contents with blocking calls */
+static void write_whole_file(io_request *request) {
+    FILE *file = fopen(request->path, "w");
+
+    if (file == NULL) {
+        return;
+    }
+    request->succeeded = fwrite(request->contents, 1, request->length, file) == request->length;
+    request->succeeded = fclose(file) == 0 && request->succeeded;
+}
+
+/* The body of the threads of the pool: takes files until none is left */
+static void *pool_worker(void *argument) {
+    struct pool_work *work = (struct pool_work *)argument;
+    int index;
+
+    while ((index = __sync_fetch_and_add(&work->next_request, 1)) < work->count) {
+        if (work->writing) {
+            write_whole_file(&work->requests[index]);
+        }
+        else {
+            read_whole_file(&work->requests[index]);
+        }
+    }
+    return NULL;
+}
+
+/* Reads or writes a batch on a pool of threads doing blocking calls */
+static void pool_batch(io_request *requests, int count, bool writing) {
+    pthread_t threads[IO_POOL_THREADS];
+    int thread_count = 0;
+    struct pool_work work;
+
+    work.requests = requests;
+    work.count = count;
+    work.next_request = 0;
+    work.writing = writing;
+
+    /* The calling thread takes files too */
+    while (thread_count < IO_POOL_THREADS && thread_count < count - 1 && pthread_create(&threads[thread_count], NULL, pool_worker, &work) == 0) {
+        thread_count++;
+    }
+    pool_worker(&work);
+    while (thread_count > 0) {
+        pthread_join(threads[--thread_count], NULL);
+    }
+}
+
+/* Reads whole files, opening, reading and closing all of them together */
+void batch_read_files(io_request *requests, int count) {
+    int index;
+
+    for (index = 0; index < count; index++) {
+        requests[index].contents = NULL;
+        requests[index].length = 0;
+        requests[index].succeeded = FALSE;
+    }
+    if (count > 0 && (batch_io_backend == THREADS_IO_BACKEND || !uring_batch(requests, count, FALSE))) {
+        pool_batch(requests, count, FALSE);
+    }
+
+    /* The part of a file read before an error isn't kept */
+    for (index = 0; index < count; index++) {
+        if (!requests[index].succeeded) {
+            free(requests[index].contents);
+            requests[index].contents = NULL;
+            requests[index].length = 0;
+        }
+    }
+}
+
+/* Creates or truncates files and writes their contents, all of them together */
+void batch_write_files(io_request *requests, int count) {
+    int index;
+
+    for (index = 0; index < count; index++) {
+        requests[index].succeeded = FALSE;
+    }
+    if (count > 0 && (batch_io_backend == THREADS_IO_BACKEND || !uring_batch(requests, count, TRUE))) {
+        pool_batch(requests, count, TRUE);
+    }
+}
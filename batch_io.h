@@ -0,0 +1,50 @@
+#ifndef _BATCH_IO_H
+#define _BATCH_IO_H
+#include <stddef.h>
+#include "global_variables.h"
+
+/* Files a submission of the io_uring backend holds at most, larger batches are submitted in several rounds */
+#define MAX_URING_ENTRIES 256
+
+/* Threads of the fallback backend, the calling thread works too */
+#define IO_POOL_THREADS 8
+
+/* Size of the buffer a file is first read into, it doubles while the file is longer */
+#define INITIAL_READ_SIZE 16384
+
+/* Backends of the batched file operations */
+typedef enum io_backend {
+    URING_IO_BACKEND,       /* io_uring when the kernel supports it, the thread pool otherwise */
+    THREADS_IO_BACKEND      /* A pool of threads doing blocking calls */
+} io_backend;
+
+/* A file read or written by a batch */
+typedef struct io_request {
+    char *path;             /* Name of the file */
+    char *contents;         /* Contents written, or the contents read, allocated with one more byte than their length */
+    size_t length;          /* Length of the contents */
+    bool succeeded;         /* Whether the file was opened and read or written whole */
+} io_request;
+
+/* The backend given by --io-backend */
+extern io_backend batch_io_backend;
+
+/**
+ * @brief Reads whole files, opening, reading and closing all of them together.
+ *
+ * With io_uring, the opens of all the files are one submission, then their reads, then their closes.
+ *
+ * @param requests The files, their contents are allocated with malloc, or NULL if the file can't be opened or read whole.
+ * @param count The number of files.
+ */
+void batch_read_files(io_request *requests, int count);
+
+/**
+ * @brief Creates or truncates files and writes their contents, all of them together.
+ *
+ * @param requests The files and their contents, a file succeeded if all its contents were written and it was closed.
+ * @param count The number of files.
+ */
+void batch_write_files(io_request *requests, int count);
+
+#endif
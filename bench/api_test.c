@@ -0,0 +1,368 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../assembler_api.h"
+
+/*
+ * Tests of the in-memory assembler library against the fixtures of test_files.
+ *
+ * Usage: api_test [--fixtures dir]
+ *
+ * Every case assembles the file.as.txt of a fixture with assemble_buffer, under the name
+ * file.as, and compares the result with the expected files of the fixture:
+ * - for a valid fixture, the rendered files with file.ob.txt, file.ent.txt and file.ext.txt,
+ *   the code and data images with the words of file.ob.txt, and the entry symbols and the uses
+ *   of external symbols with the lines of file.ent.txt and file.ext.txt;
+ * - for an invalid fixture, the errors with the records of errors.json.txt, and those that
+ *   main_program prints to the standard error with the lines of errors.txt.
+ * It must be linked with libassembler.a, it only uses assembler_api.h.
+ */
+
+#define MAX_PATH_LENGTH 512
+#define MAX_RECORD_LENGTH 1024
+
+/* Base 4 digits of the words of the .ob file, from 0 to 3 */
+#define OB_DIGITS "*#%!"
+
+/* A fixture assembled with the options of its command line */
+struct api_case {
+    char *fixture;          /* Directory of the fixture, relative to the fixtures directory */
+    long max_errors;        /* Like --max-errors, 0 for no limit */
+    int keep_going;         /* Like --keep-going */
+};
+
+static struct api_case cases[] = {
+    {"valid/valid_1", 0, 0},
+    {"valid/valid_2", 0, 0},
+    {"valid/valid_3", 0, 0},
+    {"valid/valid_6", 0, 0},
+    {"invalid/invalid_2", 0, 0},
+    {"invalid/invalid_7", 3, 0},
+    {"invalid/invalid_10", 0, 1},
+    {NULL, 0, 0}
+};
+
+/**
+ * @brief Reads a whole file, without its trailing newlines.
+ *
+ * @param path The path of the file.
+ * @return The contents, to be freed, or NULL if the file can't be read.
+ */
+static char *read_contents(char *path) {
+    FILE *file = fopen(path, "rb");
+    char *contents;
+    long length;
+
+    if (file == NULL) {
+        return NULL;
+    }
+    fseek(file, 0, SEEK_END);
+    length = ftell(file);
+    rewind(file);
+    contents = malloc(length + 1);
+    if (contents == NULL || (long)fread(contents, 1, length, file) != length) {
+        free(contents);
+        fclose(file);
+        return NULL;
+    }
+    fclose(file);
+    while (length > 0 && contents[length - 1] == '\n') {
+        length--;
+    }
+    contents[length] = '\0';
+    return contents;
+}
+
+/**
+ * @brief Compares a rendered file with its expected contents.
+ *
+ * @param fixture The fixture, for the report.
+ * @param name The name of the file, for the report.
+ * @param rendered The rendered file, or NULL if it wasn't rendered.
+ * @param rendered_length The length of the rendered file.
+ * @param expected The expected contents without trailing newlines, or NULL if the file shouldn't be rendered.
+ * @return Returns 1 if they are the same, otherwise 0.
+ */
+static int check_rendered_file(char *fixture, char *name, char *rendered, size_t rendered_length, char *expected) {
+    while (rendered != NULL && rendered_length > 0 && rendered[rendered_length - 1] == '\n') {
+        rendered_length--;
+    }
+    if (expected == NULL && rendered == NULL) {
+        return 1;
+    }
+    if (expected == NULL || rendered == NULL || strlen(expected) != rendered_length || memcmp(expected, rendered, rendered_length) != 0) {
+        printf("FAIL %s: the rendered %s differs from %s.txt\n", fixture, name, name);
+        return 0;
+    }
+    return 1;
+}
+
+/**
+ * @brief Decodes a word of the .ob file.
+ *
+ * @return The word, or -1 if it isn't a word of base 4 digits.
+ */
+static long decode_word(char *digits) {
+    long word = 0;
+    char *digit;
+
+    for (; *digits != '\0' && *digits != '\n'; digits++) {
+        if ((digit = strchr(OB_DIGITS, *digits)) == NULL) {
+            return -1;
+        }
+        word = word * 4 + (digit - OB_DIGITS);
+    }
+    return word;
+}
+
+/**
+ * @brief Compares the images of a result with the words of the expected .ob file.
+ *
+ * @return Returns 1 if they are the same, otherwise 0.
+ */
+static int check_images(char *fixture, assembler_result *result, char *object) {
+    char *line;
+    long code_length, data_length;
+    long address, index;
+    long word;
+    char digits[32];
+
+    line = strtok(object, "\n");
+    if (line == NULL || sscanf(line, "%ld %ld", &code_length, &data_length) != 2) {
+        printf("FAIL %s: file.ob.txt has no header\n", fixture);
+        return 0;
+    }
+    if (result->code_length != code_length || result->data_length != data_length || result->data_address != result->code_address + code_length) {
+        printf("FAIL %s: images of %ld and %ld words at %ld and %ld, file.ob.txt has %ld and %ld words\n", fixture,
+               result->code_length, result->data_length, result->code_address, result->data_address, code_length, data_length);
+        return 0;
+    }
+    for (index = 0; index < code_length + data_length; index++) {
+        line = strtok(NULL, "\n");
+        if (line == NULL || sscanf(line, "%ld %31s", &address, digits) != 2 || (word = decode_word(digits)) < 0) {
+            printf("FAIL %s: file.ob.txt is missing word %ld\n", fixture, index);
+            return 0;
+        }
+        if (address != result->code_address + index || word != (index < code_length ? result->code[index] : result->data[index - code_length])) {
+            printf("FAIL %s: the word at %ld differs from file.ob.txt\n", fixture, address);
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/**
+ * @brief Compares the symbols of a result with the lines of an expected .ent or .ext file.
+ *
+ * @param symbols The entry symbols or the uses of external symbols.
+ * @param count The number of symbols.
+ * @param expected The expected file, or NULL if there are no symbols.
+ * @return Returns 1 if they are the same, otherwise 0.
+ */
+static int check_symbols(char *fixture, char *name, assembler_symbol *symbols, long count, char *expected) {
+    char *line;
+    char symbol_name[MAX_RECORD_LENGTH];
+    long address;
+    long index = 0;
+
+    for (line = expected != NULL ? strtok(expected, "\n") : NULL; line != NULL; line = strtok(NULL, "\n"), index++) {
+        if (sscanf(line, "%1023s %ld", symbol_name, &address) != 2 || index >= count ||
+            strcmp(symbols[index].name, symbol_name) != 0 || symbols[index].address != address) {
+            printf("FAIL %s: symbol %ld differs from %s.txt\n", fixture, index, name);
+            return 0;
+        }
+    }
+    if (index != count) {
+        printf("FAIL %s: %ld symbols, %s.txt has %ld\n", fixture, count, name, index);
+        return 0;
+    }
+    return 1;
+}
+
+/**
+ * @brief Formats an error like the records of --diagnostics-format json.
+ */
+static void format_json_record(char *record, assembler_diagnostic *diagnostic) {
+    char *message;
+
+    record += sprintf(record, "{\"file\":\"%s\",\"line\":%ld,\"column\":%ld,\"code\":\"E%05lX\",\"message\":\"",
+                      diagnostic->file_name, diagnostic->line_number, diagnostic->column, diagnostic->code);
+    for (message = diagnostic->message; *message != '\0'; message++) {
+        if (*message == '"' || *message == '\\') {
+            *record++ = '\\';
+        }
+        *record++ = *message;
+    }
+    strcpy(record, "\"}");
+}
+
+/**
+ * @brief Compares the errors of a result with the expected output of main_program, in text and as JSON.
+ *
+ * @param max_errors The limit of errors of the case, 0 for no limit.
+ * @param text The expected standard error, the located errors and the notice of the limit.
+ * @param json The expected JSON records, with the record of the limit.
+ * @return Returns 1 if they are the same, otherwise 0.
+ */
+static int check_diagnostics(char *fixture, assembler_result *result, long max_errors, char *text, char *json) {
+    char record[MAX_RECORD_LENGTH * 2];
+    char *line;
+    long index;
+
+    /* Every error is a JSON record, in order */
+    line = strtok(json, "\n");
+    for (index = 0; index < result->diagnostic_count; index++, line = strtok(NULL, "\n")) {
+        format_json_record(record, &result->diagnostics[index]);
+        if (line == NULL || strcmp(line, record) != 0) {
+            printf("FAIL %s: error %ld differs from errors.json.txt: %s\n", fixture, index, record);
+            return 0;
+        }
+    }
+    if (max_errors > 0 && result->diagnostic_count == max_errors) {
+        sprintf(record, "{\"code\":\"max-errors\",\"message\":\"Stopped after %ld errors\"}", max_errors);
+        if (line == NULL || strcmp(line, record) != 0) {
+            printf("FAIL %s: errors.json.txt has no record of the limit: %s\n", fixture, record);
+            return 0;
+        }
+        line = strtok(NULL, "\n");
+    }
+    if (line != NULL) {
+        printf("FAIL %s: errors.json.txt has more records than the %ld errors\n", fixture, result->diagnostic_count);
+        return 0;
+    }
+
+    /* The located errors are the lines of the standard error */
+    line = strtok(text, "\n");
+    for (index = 0; index < result->diagnostic_count; index++) {
+        if (!result->diagnostics[index].is_located) {
+            continue;
+        }
+        sprintf(record, "Error In %s:%ld: %s", result->diagnostics[index].file_name, result->diagnostics[index].line_number, result->diagnostics[index].message);
+        if (line == NULL || strcmp(line, record) != 0) {
+            printf("FAIL %s: error %ld differs from errors.txt: %s\n", fixture, index, record);
+            return 0;
+        }
+        line = strtok(NULL, "\n");
+    }
+    if (max_errors > 0 && result->diagnostic_count == max_errors) {
+        sprintf(record, "Stopped after %ld errors, the limit of --max-errors", max_errors);
+        if (line == NULL || strcmp(line, record) != 0) {
+            printf("FAIL %s: errors.txt has no notice of the limit: %s\n", fixture, record);
+            return 0;
+        }
+        line = strtok(NULL, "\n");
+    }
+    if (line != NULL) {
+        printf("FAIL %s: errors.txt has more lines than the located errors\n", fixture);
+        return 0;
+    }
+    return 1;
+}
+
+/**
+ * @brief Assembles the source of a fixture and checks the result.
+ *
+ * @return Returns 1 if the case passed, otherwise 0.
+ */
+static int run_case(char *fixtures_dir, struct api_case *api_case) {
+    char path[MAX_PATH_LENGTH * 2];
+    char *source, *object, *entries, *externals, *text, *json;
+    assembler_options options;
+    assembler_result result;
+    int is_valid = strncmp(api_case->fixture, "valid/", 6) == 0;
+    int passed = 1;
+
+    sprintf(path, "%s/%s/file.as.txt", fixtures_dir, api_case->fixture);
+    if ((source = read_contents(path)) == NULL) {
+        printf("FAIL %s: can't read %s\n", api_case->fixture, path);
+        return 0;
+    }
+    sprintf(path, "%s/%s/file.ob.txt", fixtures_dir, api_case->fixture);
+    object = read_contents(path);
+    sprintf(path, "%s/%s/file.ent.txt", fixtures_dir, api_case->fixture);
+    entries = read_contents(path);
+    sprintf(path, "%s/%s/file.ext.txt", fixtures_dir, api_case->fixture);
+    externals = read_contents(path);
+    sprintf(path, "%s/%s/errors.txt", fixtures_dir, api_case->fixture);
+    text = read_contents(path);
+    sprintf(path, "%s/%s/errors.json.txt", fixtures_dir, api_case->fixture);
+    json = read_contents(path);
+
+    memset(&options, 0, sizeof(options));
+    options.source_name = "file.as";
+    options.render_files = 1;
+    options.max_errors = api_case->max_errors;
+    options.keep_going = api_case->keep_going;
+
+    /* The source is read up to its length, it needs no final null character */
+    if (assemble_buffer(source, strlen(source), &options, &result) != is_valid || result.success != is_valid) {
+        printf("FAIL %s: assemble_buffer returned %d with %ld errors\n", api_case->fixture, result.success, result.diagnostic_count);
+        passed = 0;
+    }
+    else if (is_valid) {
+        passed = result.diagnostic_count == 0 && object != NULL;
+        passed = passed && check_rendered_file(api_case->fixture, "file.ob", result.files.object, result.files.object_length, object);
+        passed = passed && check_rendered_file(api_case->fixture, "file.ent", result.files.entries, result.files.entries_length, entries);
+        passed = passed && check_rendered_file(api_case->fixture, "file.ext", result.files.externals, result.files.externals_length, externals);
+        passed = passed && check_images(api_case->fixture, &result, object);
+        passed = passed && check_symbols(api_case->fixture, "file.ent", result.entries, result.entry_count, entries);
+        passed = passed && check_symbols(api_case->fixture, "file.ext", result.externals, result.external_count, externals);
+    }
+    else if (result.code_length != 0 || result.data_length != 0 || result.entry_count != 0 || result.external_count != 0 || result.files.object != NULL) {
+        printf("FAIL %s: a failed source has images, symbols or rendered files\n", api_case->fixture);
+        passed = 0;
+    }
+    else if (text == NULL || json == NULL) {
+        printf("FAIL %s: missing errors.txt or errors.json.txt\n", api_case->fixture);
+        passed = 0;
+    }
+    else {
+        passed = check_diagnostics(api_case->fixture, &result, api_case->max_errors, text, json);
+    }
+
+    free_assembler_result(&result);
+    if (result.code != NULL || result.diagnostics != NULL || result.diagnostic_count != 0) {
+        printf("FAIL %s: free_assembler_result didn't reset the result\n", api_case->fixture);
+        passed = 0;
+    }
+    free(source);
+    free(object);
+    free(entries);
+    free(externals);
+    free(text);
+    free(json);
+    return passed;
+}
+
+int main(int argc, char *argv[]) {
+    char *fixtures_dir = "test_files";      /* Directory of the valid and invalid fixtures */
+    struct api_case *api_case;
+    int index;
+    int failures = 0;
+    int case_count = 0;
+
+    for (index = 1; index < argc; index++) {
+        if (index + 1 == argc) {
+            fprintf(stderr, "Missing value for %s\n", argv[index]);
+            return 1;
+        }
+        if (strcmp(argv[index], "--fixtures") == 0) fixtures_dir = argv[++index];
+        else {
+            fprintf(stderr, "Unknown argument %s\n", argv[index]);
+            return 1;
+        }
+    }
+    if (strlen(fixtures_dir) + 64 > MAX_PATH_LENGTH) {
+        fprintf(stderr, "The fixtures directory should be short\n");
+        return 1;
+    }
+
+    for (api_case = cases; api_case->fixture != NULL; api_case++) {
+        case_count++;
+        failures += !run_case(fixtures_dir, api_case);
+    }
+    free_assembler_include_cache();
+
+    printf("%d of %d case(s) failed\n", failures, case_count);
+    return failures > 0;
+}
@@ -0,0 +1,429 @@
+#define _DEFAULT_SOURCE /* mkdir, realpath and scandir */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <dirent.h>
+#include <limits.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+
+/*
+ * Regression tests of the assembler over the fixtures of test_files.
+ *
+ * Usage: fixture_test [--assembler path] [--work-dir dir] [fixture-root...]
+ *
+ * Every directory of a fixture root (test_files/valid and test_files/invalid by default) is
+ * a fixture. Its inputs are copied into the work directory, a trailing .txt dropped from their
+ * names (file.as.txt becomes file.as), and the assembler runs there on "file" with the options
+ * of options.txt, if any. Then:
+ * - the standard error must be errors.txt, or empty if there is none,
+ * - the standard error of a second run with --diagnostics-format json must be errors.json.txt,
+ *   if there is one,
+ * - file.ob, file.ent and file.ext must be written exactly when file.ob.txt, file.ent.txt and
+ *   file.ext.txt exist, with the same contents, and file.am must match file.am.txt if it exists.
+ * A missing final newline is ignored everywhere, the fixtures were saved without one.
+ */
+
+#define MAX_PATH_LENGTH 512
+#define MAX_OPTIONS 16
+#define MAX_OPTIONS_LENGTH 256
+
+/* The files of a fixture that hold the expected results, they aren't copied */
+static char *expected_files[] = {
+    "options.txt", "errors.txt", "errors.json.txt", "file.ob.txt", "file.ent.txt", "file.ext.txt", "file.am.txt", NULL
+};
+
+/* The output files of the assembler, and whether they must not be written without an expected file */
+static struct {
+    char *name;
+    int is_required;
+} output_files[] = {
+    {"file.ob", 1}, {"file.ent", 1}, {"file.ext", 1}, {"file.am", 0}, {NULL, 0}
+};
+
+/**
+ * @brief Reads a whole file, without its trailing newlines.
+ *
+ * @param path The path of the file.
+ * @param length Receives the length of the contents.
+ * @return The contents, to be freed, or NULL if the file can't be read.
+ */
+static char *read_contents(char *path, long *length) {
+    FILE *file = fopen(path, "rb");
+    char *contents;
+
+    if (file == NULL) {
+        return NULL;
+    }
+    fseek(file, 0, SEEK_END);
+    *length = ftell(file);
+    rewind(file);
+    contents = malloc(*length + 1);
+    if (contents == NULL || (long)fread(contents, 1, *length, file) != *length) {
+        free(contents);
+        fclose(file);
+        return NULL;
+    }
+    fclose(file);
+    while (*length > 0 && contents[*length - 1] == '\n') {
+        (*length)--;
+    }
+    contents[*length] = '\0';
+    return contents;
+}
+
+/**
+ * @brief Compares a file with its expected contents.
+ *
+ * @return Returns 1 if both files can be read and hold the same contents, otherwise 0.
+ */
+static int same_contents(char *expected_path, char *actual_path) {
+    long expected_length, actual_length;
+    char *expected = read_contents(expected_path, &expected_length);
+    char *actual = read_contents(actual_path, &actual_length);
+    int is_same = expected != NULL && actual != NULL && expected_length == actual_length &&
+                  memcmp(expected, actual, expected_length) == 0;
+
+    free(expected);
+    free(actual);
+    return is_same;
+}
+
+/**
+ * @brief Copies a file.
+ *
+ * @return Returns 0 if the file was copied, otherwise -1.
+ */
+static int copy_file(char *source_path, char *destination_path) {
+    char buffer[4096];
+    size_t count;
+    FILE *source = fopen(source_path, "rb");
+    FILE *destination = fopen(destination_path, "wb");
+    int result = source != NULL && destination != NULL ? 0 : -1;
+
+    while (result == 0 && (count = fread(buffer, 1, sizeof(buffer), source)) > 0) {
+        if (fwrite(buffer, 1, count, destination) != count) {
+            result = -1;
+        }
+    }
+    if (source != NULL) fclose(source);
+    if (destination != NULL) fclose(destination);
+    return result;
+}
+
+/**
+ * @brief Checks if a file of a fixture holds expected results rather than an input.
+ */
+static int is_expected_file(char *name) {
+    int index;
+
+    for (index = 0; expected_files[index] != NULL; index++) {
+        if (strcmp(name, expected_files[index]) == 0) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief Empties the work directory of a fixture, creating it if needed.
+ *
+ * @return Returns 0 if the directory is ready, otherwise -1.
+ */
+static int prepare_work_dir(char *work_dir) {
+    char path[MAX_PATH_LENGTH * 2];
+    struct dirent *entry;
+    DIR *dir;
+
+    mkdir(work_dir, 0755);
+    if ((dir = opendir(work_dir)) == NULL) {
+        return -1;
+    }
+    while ((entry = readdir(dir)) != NULL) {
+        if (entry->d_name[0] != '.') {
+            sprintf(path, "%s/%s", work_dir, entry->d_name);
+            unlink(path);
+        }
+    }
+    closedir(dir);
+    return 0;
+}
+
+/**
+ * @brief Copies the inputs of a fixture into its work directory.
+ *
+ * @return Returns 0 if the inputs were copied, otherwise -1.
+ */
+static int copy_inputs(char *fixture_dir, char *work_dir) {
+    char source_path[MAX_PATH_LENGTH * 2];
+    char destination_path[MAX_PATH_LENGTH * 2];
+    struct dirent *entry;
+    DIR *dir;
+    char *suffix;
+    int result = 0;
+
+    if ((dir = opendir(fixture_dir)) == NULL) {
+        return -1;
+    }
+    while (result == 0 && (entry = readdir(dir)) != NULL) {
+        if (entry->d_name[0] == '.' || is_expected_file(entry->d_name)) {
+            continue;
+        }
+        sprintf(source_path, "%s/%s", fixture_dir, entry->d_name);
+        sprintf(destination_path, "%s/%s", work_dir, entry->d_name);
+
+        /* Drop the .txt of a name that has another extension before it */
+        suffix = strrchr(destination_path, '.');
+        if (suffix != NULL && strcmp(suffix, ".txt") == 0 && strchr(strrchr(destination_path, '/'), '.') != suffix) {
+            *suffix = '\0';
+        }
+        result = copy_file(source_path, destination_path);
+    }
+    closedir(dir);
+    return result;
+}
+
+/**
+ * @brief Reads the options of a fixture, separated by white space.
+ *
+ * @param fixture_dir The directory of the fixture.
+ * @param buffer Holds the options.
+ * @param options Receives the options.
+ * @return The number of options.
+ */
+static int read_options(char *fixture_dir, char *buffer, char *options[]) {
+    char path[MAX_PATH_LENGTH * 2];
+    FILE *file;
+    int count = 0;
+    char *option;
+
+    sprintf(path, "%s/options.txt", fixture_dir);
+    buffer[0] = '\0';
+    if ((file = fopen(path, "r")) != NULL) {
+        if (fgets(buffer, MAX_OPTIONS_LENGTH, file) == NULL) {
+            buffer[0] = '\0';
+        }
+        fclose(file);
+    }
+    for (option = strtok(buffer, " \t\n"); option != NULL && count < MAX_OPTIONS; option = strtok(NULL, " \t\n")) {
+        options[count++] = option;
+    }
+    return count;
+}
+
+/**
+ * @brief Runs the assembler on the file of a fixture, in its work directory.
+ *
+ * @param assembler The absolute path of the assembler executable.
+ * @param work_dir The work directory of the fixture.
+ * @param options The options of the fixture, after the extra options.
+ * @param option_count The number of options.
+ * @param json Nonzero to add --diagnostics-format json.
+ * @param stderr_name The file the standard error is written to, in the work directory.
+ * @return Returns 0 if the assembler ran and exited, otherwise -1.
+ */
+static int run_assembler(char *assembler, char *work_dir, char *options[], int option_count, int json, char *stderr_name) {
+    char *arguments[MAX_OPTIONS + 5];
+    int argument_count = 0;
+    int index;
+    int status;
+    int fd;
+    pid_t pid;
+
+    arguments[argument_count++] = assembler;
+    if (json) {
+        arguments[argument_count++] = "--diagnostics-format";
+        arguments[argument_count++] = "json";
+    }
+    for (index = 0; index < option_count; index++) {
+        arguments[argument_count++] = options[index];
+    }
+    arguments[argument_count++] = "file";
+    arguments[argument_count] = NULL;
+
+    pid = fork();
+    if (pid < 0) {
+        perror("fork");
+        return -1;
+    }
+    if (pid == 0) {
+        if (chdir(work_dir) != 0) {
+            _exit(127);
+        }
+        fd = open("/dev/null", O_WRONLY);
+        if (fd >= 0) {
+            dup2(fd, STDOUT_FILENO);
+        }
+        fd = open(stderr_name, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        if (fd >= 0) {
+            dup2(fd, STDERR_FILENO);
+        }
+        execv(assembler, arguments);
+        _exit(127);
+    }
+    if (waitpid(pid, &status, 0) < 0 || !WIFEXITED(status) || WEXITSTATUS(status) == 127) {
+        return -1;
+    }
+    return 0;
+}
+
+/**
+ * @brief Runs one fixture and reports its mismatches.
+ *
+ * @return The number of mismatches, 0 if the fixture passed.
+ */
+static int run_fixture(char *assembler, char *fixture_dir, char *work_dir, char *name) {
+    char expected_path[MAX_PATH_LENGTH * 2];
+    char actual_path[MAX_PATH_LENGTH * 2];
+    char options_buffer[MAX_OPTIONS_LENGTH];
+    char *options[MAX_OPTIONS];
+    int option_count;
+    int index;
+    int is_expected, is_written;
+    int mismatches = 0;
+
+    if (prepare_work_dir(work_dir) != 0 || copy_inputs(fixture_dir, work_dir) != 0) {
+        printf("FAIL %s: can't prepare %s\n", name, work_dir);
+        return 1;
+    }
+    option_count = read_options(fixture_dir, options_buffer, options);
+
+    if (run_assembler(assembler, work_dir, options, option_count, 0, "errors") != 0) {
+        printf("FAIL %s: the assembler crashed or can't run\n", name);
+        return 1;
+    }
+
+    /* The errors, none if the fixture doesn't expect any */
+    sprintf(expected_path, "%s/errors.txt", fixture_dir);
+    sprintf(actual_path, "%s/errors", work_dir);
+    if (access(expected_path, F_OK) == 0 ? !same_contents(expected_path, actual_path) : !same_contents("/dev/null", actual_path)) {
+        printf("FAIL %s: errors differ from errors.txt, see %s\n", name, actual_path);
+        mismatches++;
+    }
+
+    /* The output files */
+    for (index = 0; output_files[index].name != NULL; index++) {
+        sprintf(expected_path, "%s/%s.txt", fixture_dir, output_files[index].name);
+        sprintf(actual_path, "%s/%s", work_dir, output_files[index].name);
+        is_expected = access(expected_path, F_OK) == 0;
+        is_written = access(actual_path, F_OK) == 0;
+        if (is_expected && !is_written) {
+            printf("FAIL %s: %s wasn't written\n", name, output_files[index].name);
+            mismatches++;
+        }
+        else if (is_expected && !same_contents(expected_path, actual_path)) {
+            printf("FAIL %s: %s differs from %s.txt\n", name, actual_path, output_files[index].name);
+            mismatches++;
+        }
+        else if (!is_expected && is_written && output_files[index].is_required) {
+            printf("FAIL %s: %s was written\n", name, output_files[index].name);
+            mismatches++;
+        }
+    }
+
+    /* The errors as JSON records */
+    sprintf(expected_path, "%s/errors.json.txt", fixture_dir);
+    if (access(expected_path, F_OK) == 0) {
+        sprintf(actual_path, "%s/errors.json", work_dir);
+        if (run_assembler(assembler, work_dir, options, option_count, 1, "errors.json") != 0) {
+            printf("FAIL %s: the assembler crashed or can't run with --diagnostics-format json\n", name);
+            mismatches++;
+        }
+        else if (!same_contents(expected_path, actual_path)) {
+            printf("FAIL %s: errors differ from errors.json.txt, see %s\n", name, actual_path);
+            mismatches++;
+        }
+    }
+    return mismatches;
+}
+
+/**
+ * @brief Runs every fixture of a fixture root, in the order of their names.
+ *
+ * @param fixture_count Incremented for every fixture.
+ * @return The number of fixtures that failed, or -1 if the root can't be read.
+ */
+static int run_fixture_root(char *assembler, char *root, char *work_dir, int *fixture_count) {
+    char fixture_dir[MAX_PATH_LENGTH * 2];
+    char fixture_work_dir[MAX_PATH_LENGTH * 2];
+    struct dirent **entries;
+    struct stat file_stat;
+    int entry_count;
+    int index;
+    int failures = 0;
+
+    entry_count = scandir(root, &entries, NULL, alphasort);
+    if (entry_count < 0) {
+        return -1;
+    }
+    for (index = 0; index < entry_count; index++) {
+        sprintf(fixture_dir, "%s/%s", root, entries[index]->d_name);
+        if (entries[index]->d_name[0] != '.' && stat(fixture_dir, &file_stat) == 0 && S_ISDIR(file_stat.st_mode)) {
+            sprintf(fixture_work_dir, "%s/%s", work_dir, entries[index]->d_name);
+            (*fixture_count)++;
+            failures += run_fixture(assembler, fixture_dir, fixture_work_dir, entries[index]->d_name) != 0;
+        }
+        free(entries[index]);
+    }
+    free(entries);
+    return failures;
+}
+
+int main(int argc, char *argv[]) {
+    char *assembler = "./main_program";     /* Assembler under test */
+    char *work_dir = "bench/work";          /* Directory of the copies of the fixtures */
+    char *default_roots[] = {"test_files/valid", "test_files/invalid"};
+    char **roots = default_roots;
+    int root_count = 2;
+    char assembler_path[PATH_MAX];
+    char fixtures_work_dir[MAX_PATH_LENGTH];
+    int index;
+    int failures = 0;
+    int root_failures;
+    int fixture_count = 0;
+
+    for (index = 1; index < argc && strncmp(argv[index], "--", 2) == 0; index++) {
+        if (index + 1 == argc) {
+            fprintf(stderr, "Missing value for %s\n", argv[index]);
+            return 1;
+        }
+        if (strcmp(argv[index], "--assembler") == 0) assembler = argv[++index];
+        else if (strcmp(argv[index], "--work-dir") == 0) work_dir = argv[++index];
+        else {
+            fprintf(stderr, "Unknown argument %s\n", argv[index]);
+            return 1;
+        }
+    }
+    if (index < argc) {
+        roots = argv + index;
+        root_count = argc - index;
+    }
+    if (strlen(work_dir) + 16 > MAX_PATH_LENGTH) {
+        fprintf(stderr, "The work directory should be short\n");
+        return 1;
+    }
+
+    /* The assembler runs in the work directory of every fixture */
+    if (realpath(assembler, assembler_path) == NULL) {
+        fprintf(stderr, "Can't find the assembler %s\n", assembler);
+        return 1;
+    }
+    mkdir(work_dir, 0755);
+    sprintf(fixtures_work_dir, "%s/fixtures", work_dir);
+    mkdir(fixtures_work_dir, 0755);
+
+    for (index = 0; index < root_count; index++) {
+        root_failures = run_fixture_root(assembler_path, roots[index], fixtures_work_dir, &fixture_count);
+        if (root_failures < 0) {
+            fprintf(stderr, "Can't read the fixtures of %s\n", roots[index]);
+            return 1;
+        }
+        failures += root_failures;
+    }
+
+    printf("%d of %d fixture(s) failed\n", failures, fixture_count);
+    return failures > 0;
+}
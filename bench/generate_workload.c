@@ -0,0 +1,362 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../global_variables.h"
+
+/*
+ * Generates a synthetic assembly program for benchmarking the assembler.
+ *
+ * Usage: generate_workload [--lines N] [--symbols N] [--macros N] [--macro-size N]
+ *                          [--extern-ratio F] [--define-density F] [--data-words N]
+ *                          [--seed N] [-o file.as]
+ *
+ * The program stays within the limits of the assembler: lines of at most MAX_LINE_LENGTH
+ * characters, at most CODE_ARR_IMG_LENGTH code and data words, and at most MEMORY_CELLS
+ * memory cells in total. Requests beyond these limits are clamped and reported on stderr.
+ */
+
+/* Total number of memory cells of the target machine */
+#define MEMORY_CELLS 4096
+
+/* Parameters of the generated program */
+struct workload_params {
+    long lines;             /* Approximate number of source lines */
+    long symbols;           /* Number of labels (code and data) */
+    long macros;            /* Number of macros, each invoked once */
+    long macro_size;        /* Instructions in each macro body */
+    double extern_ratio;    /* Share of symbol operands that reference an external symbol */
+    double define_density;  /* Share of the lines that are .define constants */
+    long data_words;        /* Number of words in the data image */
+    unsigned long seed;     /* Seed of the pseudo random generator */
+};
+
+/* State of the program being generated */
+struct workload_state {
+    FILE *output;           /* The generated source */
+    unsigned long random;   /* State of the pseudo random generator */
+    long lines;             /* Lines written so far */
+    long code_words;        /* Code words used so far */
+    long code_labels;       /* Number of code labels */
+    long data_labels;       /* Number of data labels */
+    long externs;           /* Number of external symbols */
+    long defines;           /* Number of .define constants */
+    double extern_ratio;    /* Share of symbol operands that reference an external symbol */
+};
+
+/**
+ * @brief Returns the next pseudo random number.
+ *
+ * A fixed linear congruential generator, so a seed generates the same program on every platform.
+ *
+ * @param state The generator state.
+ * @param bound The exclusive upper bound of the number.
+ * @return A number between 0 and bound - 1.
+ */
+static long next_random(struct workload_state *state, long bound) {
+    state->random = (state->random * 1103515245UL + 12345UL) & 0x7FFFFFFFUL;
+    return bound > 0 ? (long)((state->random >> 8) % bound) : 0;
+}
+
+/**
+ * @brief Writes the name of a symbol that an operand may reference.
+ *
+ * @param state The generator state.
+ * @param symbol Buffer that receives the symbol name.
+ * @param allow_extern Whether an external symbol may be chosen.
+ */
+static void pick_symbol(struct workload_state *state, char *symbol, bool allow_extern) {
+    if (allow_extern && state->externs > 0 && next_random(state, 1000) < state->extern_ratio * 1000) {
+        sprintf(symbol, "X%ld", next_random(state, state->externs));
+    }
+    else if (state->data_labels > 0 && (state->code_labels == 0 || next_random(state, 2))) {
+        sprintf(symbol, "D%ld", next_random(state, state->data_labels));
+    }
+    else if (state->code_labels > 0) {
+        sprintf(symbol, "C%ld", next_random(state, state->code_labels));
+    }
+    else {
+        strcpy(symbol, "MAIN");
+    }
+}
+
+/**
+ * @brief Writes a random instruction, without a label.
+ *
+ * @param state The generator state.
+ * @param instruction Buffer that receives the instruction.
+ * @return The number of words of the instruction.
+ */
+static int build_instruction(struct workload_state *state, char *instruction) {
+    char symbol[MAX_LINE_LENGTH];
+    long reg = next_random(state, 8);
+    long other_reg = next_random(state, 8);
+
+    switch (next_random(state, 9)) {
+        case 0:
+            pick_symbol(state, symbol, TRUE);
+            sprintf(instruction, "mov %s, r%ld", symbol, reg);
+            return 3;
+        case 1:
+            sprintf(instruction, "cmp r%ld, #%ld", reg, next_random(state, 2000) - 1000);
+            return 3;
+        case 2:
+            sprintf(instruction, "add r%ld, r%ld", reg, other_reg);
+            return 2;
+        case 3:
+            if (state->defines > 0) {
+                sprintf(instruction, "prn #K%ld", next_random(state, state->defines));
+            }
+            else {
+                sprintf(instruction, "prn #%ld", next_random(state, 100));
+            }
+            return 2;
+        case 4:
+            pick_symbol(state, symbol, FALSE);
+            if (state->defines > 0) {
+                sprintf(instruction, "lea %s[K%ld], r%ld", symbol, next_random(state, state->defines), reg);
+            }
+            else {
+                sprintf(instruction, "lea %s[%ld], r%ld", symbol, next_random(state, 10), reg);
+            }
+            return 4;
+        case 5:
+            pick_symbol(state, symbol, TRUE);
+            sprintf(instruction, "jmp %s", symbol);
+            return 2;
+        case 6:
+            pick_symbol(state, symbol, TRUE);
+            sprintf(instruction, "inc %s", symbol);
+            return 2;
+        case 7:
+            sprintf(instruction, "red r%ld", reg);
+            return 2;
+        default:
+            sprintf(instruction, "sub r%ld, r%ld", reg, other_reg);
+            return 2;
+    }
+}
+
+/**
+ * @brief Writes a line of the generated program.
+ *
+ * @param state The generator state.
+ * @param line The line, without the newline.
+ */
+static void emit_line(struct workload_state *state, char *line) {
+    fprintf(state->output, "%s\n", line);
+    state->lines++;
+}
+
+/**
+ * @brief Parses the command-line arguments into the workload parameters.
+ *
+ * @return Returns the output file name (NULL for stdout), or "" if an argument is invalid.
+ */
+static char *parse_arguments(int argc, char *argv[], struct workload_params *params) {
+    int index;
+    char *output_name = NULL;
+
+    for (index = 1; index < argc; index++) {
+        if (index + 1 == argc) {
+            fprintf(stderr, "Missing value for %s\n", argv[index]);
+            return "";
+        }
+        if (strcmp(argv[index], "--lines") == 0) params->lines = atol(argv[++index]);
+        else if (strcmp(argv[index], "--symbols") == 0) params->symbols = atol(argv[++index]);
+        else if (strcmp(argv[index], "--macros") == 0) params->macros = atol(argv[++index]);
+        else if (strcmp(argv[index], "--macro-size") == 0) params->macro_size = atol(argv[++index]);
+        else if (strcmp(argv[index], "--extern-ratio") == 0) params->extern_ratio = atof(argv[++index]);
+        else if (strcmp(argv[index], "--define-density") == 0) params->define_density = atof(argv[++index]);
+        else if (strcmp(argv[index], "--data-words") == 0) params->data_words = atol(argv[++index]);
+        else if (strcmp(argv[index], "--seed") == 0) params->seed = strtoul(argv[++index], NULL, 10);
+        else if (strcmp(argv[index], "-o") == 0) output_name = argv[++index];
+        else {
+            fprintf(stderr, "Unknown argument %s\n", argv[index]);
+            return "";
+        }
+    }
+    return output_name;
+}
+
+/**
+ * @brief Clamps the parameters to the limits of the assembler.
+ *
+ * @param params The parameters to clamp.
+ */
+static void clamp_params(struct workload_params *params) {
+    long max_data_words = CODE_ARR_IMG_LENGTH;
+
+    if (params->data_words > max_data_words) {
+        fprintf(stderr, "generate_workload: data words clamped to %ld\n", max_data_words);
+        params->data_words = max_data_words;
+    }
+    if (params->symbols > params->lines) {
+        params->symbols = params->lines;
+    }
+    if (params->extern_ratio < 0) params->extern_ratio = 0;
+    if (params->extern_ratio > 1) params->extern_ratio = 1;
+    if (params->define_density < 0) params->define_density = 0;
+    if (params->define_density > 0.9) params->define_density = 0.9;
+}
+
+int main(int argc, char *argv[]) {
+    struct workload_params params;      /* Requested shape of the program */
+    struct workload_state state;        /* State of the generation */
+    char line[2 * MAX_LINE_LENGTH];     /* Line being built */
+    char instruction[MAX_LINE_LENGTH];  /* Instruction being built */
+    char *output_name;                  /* Name of the output file, NULL for stdout */
+    long code_budget;                   /* Code words available to the program */
+    long index, inner;
+    long data_left;                     /* Data words still to generate */
+    long code_lines;                    /* Instruction lines of the main code */
+    long entries;                       /* Number of .entry lines */
+    int length;
+
+    /* Default parameters */
+    params.lines = 1000;
+    params.symbols = 200;
+    params.macros = 5;
+    params.macro_size = 4;
+    params.extern_ratio = 0.2;
+    params.define_density = 0.05;
+    params.data_words = 300;
+    params.seed = 1;
+
+    output_name = parse_arguments(argc, argv, &params);
+    if (output_name != NULL && output_name[0] == '\0') {
+        return 1;
+    }
+    clamp_params(&params);
+
+    memset(&state, 0, sizeof(state));
+    state.random = params.seed;
+    state.extern_ratio = params.extern_ratio;
+    state.output = output_name ? fopen(output_name, "w") : stdout;
+    if (state.output == NULL) {
+        fprintf(stderr, "Can't create file %s\n", output_name);
+        return 1;
+    }
+
+    /* The code image shares the memory with the data image */
+    code_budget = CODE_ARR_IMG_LENGTH;
+    if (code_budget > MEMORY_CELLS - IC_INIT_VALUE - params.data_words) {
+        code_budget = MEMORY_CELLS - IC_INIT_VALUE - params.data_words;
+    }
+
+    /* Split the labels between data and code, every data label needs at least one word */
+    state.data_labels = params.symbols / 2;
+    if (state.data_labels > params.data_words) {
+        state.data_labels = params.data_words;
+    }
+    state.code_labels = params.symbols - state.data_labels;
+    state.externs = params.extern_ratio > 0 ? params.symbols / 10 + 1 : 0;
+    state.defines = (long)(params.lines * params.define_density);
+    entries = params.symbols / 10;
+
+    fprintf(state.output, "; generate_workload --lines %ld --symbols %ld --seed %lu\n", params.lines, params.symbols, params.seed);
+    state.lines++;
+
+    /* Constants and external symbols */
+    for (index = 0; index < state.defines; index++) {
+        sprintf(line, ".define K%ld = %ld", index, next_random(&state, 20));
+        emit_line(&state, line);
+    }
+    for (index = 0; index < state.externs; index++) {
+        sprintf(line, ".extern X%ld", index);
+        emit_line(&state, line);
+    }
+
+    /* Macro definitions, each macro is expanded once into the code */
+    for (index = 0; index < params.macros; index++) {
+        sprintf(line, "mcr m%ld", index);
+        emit_line(&state, line);
+        for (inner = 0; inner < params.macro_size && state.code_words + MAX_INSTRUCTION_WORDS < code_budget / 2; inner++) {
+            state.code_words += build_instruction(&state, instruction);
+            sprintf(line, "    %s", instruction);
+            emit_line(&state, line);
+        }
+        emit_line(&state, "endmcr");
+    }
+
+    /* The main code, with the code labels spread over it and the macros invoked in between */
+    code_lines = params.lines - state.lines - params.macros - entries - 1;
+    if (code_lines < state.code_labels + 1) {
+        code_lines = state.code_labels + 1;
+    }
+    emit_line(&state, "MAIN: add r1, r2");
+    state.code_words += 2;
+    for (index = 0; index < code_lines; index++) {
+        /* Keep room for the final hlt and for a hlt line per code label not defined yet */
+        if (state.code_words + MAX_INSTRUCTION_WORDS + 1 + (index < state.code_labels ? state.code_labels - index : 0) >= code_budget) {
+            break;
+        }
+        if (params.macros > 0 && index % (code_lines / params.macros + 1) == 0 && index / (code_lines / params.macros + 1) < params.macros) {
+            sprintf(line, "    m%ld", index / (code_lines / params.macros + 1));
+            emit_line(&state, line);
+        }
+        state.code_words += build_instruction(&state, instruction);
+        if (index < state.code_labels) {
+            sprintf(line, "C%ld: %s", index, instruction);
+        }
+        else {
+            sprintf(line, "    %s", instruction);
+        }
+        emit_line(&state, line);
+    }
+    if (index < code_lines) {
+        fprintf(stderr, "generate_workload: code clamped to %ld lines (%ld words)\n", index, state.code_words);
+    }
+
+    /* Code labels that did not fit are defined on hlt lines */
+    for (; index < state.code_labels; index++) {
+        sprintf(line, "C%ld: hlt", index);
+        emit_line(&state, line);
+    }
+    emit_line(&state, "    hlt");
+
+    /* The data image, split between the data labels */
+    data_left = params.data_words;
+    for (index = 0; data_left > 0; index++) {
+        long words = index < state.data_labels ? data_left / (state.data_labels - index) : data_left;
+
+        if (words < 1) {
+            words = 1;
+        }
+        if (index >= state.data_labels) {
+            /* Words left over after the last label are written without labels */
+            length = sprintf(line, "    .data ");
+        }
+        else {
+            length = sprintf(line, "D%ld: .data ", index);
+        }
+        for (inner = 0; inner < words && length < MAX_LINE_LENGTH - 12; inner++) {
+            if (state.defines > 0 && next_random(&state, 4) == 0) {
+                length += sprintf(line + length, "%sK%ld", inner ? ", " : "", next_random(&state, state.defines));
+            }
+            else {
+                length += sprintf(line + length, "%s%ld", inner ? ", " : "", next_random(&state, 2000) - 1000);
+            }
+        }
+        data_left -= inner;
+        emit_line(&state, line);
+    }
+
+    /* Entry declarations */
+    for (index = 0; index < entries; index++) {
+        if (index % 2 && state.data_labels > 0) {
+            sprintf(line, ".entry D%ld", next_random(&state, state.data_labels));
+        }
+        else if (state.code_labels > 0) {
+            sprintf(line, ".entry C%ld", next_random(&state, state.code_labels));
+        }
+        else {
+            continue;
+        }
+        emit_line(&state, line);
+    }
+
+    if (output_name) {
+        fclose(state.output);
+    }
+    return 0;
+}
@@ -0,0 +1,439 @@
+#define _DEFAULT_SOURCE /* clock_gettime and syscall */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#include "../global_variables.h"
+#include "../code_functions.h"
+#include "../data_tables.h"
+#include "../utility_functions.h"
+#include "../file_writeing.h"
+
+/*
+ * Microbenchmarks of the inner routines of the assembler, linked against its object files.
+ *
+ * Usage: microbench [--warmup N] [--repetitions N] [--sample-ms N] [--symbols N]
+ *                   [--perf] [name ...]
+ *
+ * Every benchmark is calibrated so that one sample runs for about --sample-ms milliseconds,
+ * then runs --warmup unmeasured samples and --repetitions measured ones. The report has the
+ * median, mean and 95% confidence interval of the mean in ns/op. With --perf, cycles and
+ * cache misses per op are read through perf_event_open where the kernel allows it.
+ * Names given on the command line select the benchmarks to run.
+ */
+
+#define MAX_REPETITIONS 200
+#define NAME_LENGTH 32
+
+/* A benchmark: runs its operation a given number of times */
+struct benchmark {
+    char *name;
+    void (*run)(long iterations);
+};
+
+/* Hardware counters read around each sample */
+struct perf_counters {
+    int cycles_fd;          /* perf event of the cycles, or -1 */
+    int cache_misses_fd;    /* perf event of the cache misses, or -1 */
+};
+
+static volatile long sink;              /* Keeps the results of the operations alive */
+static table symbol_table = NULL;       /* Symbols looked up by the benchmarks */
+static char (*symbol_names)[NAME_LENGTH];   /* Names of the code symbols of symbol_table */
+static char (*define_names)[NAME_LENGTH];   /* Names of the constants of symbol_table */
+static long symbol_count = 1000;        /* Number of code symbols and of constants */
+
+/* Words checked by check_label_name and is_special_word, valid labels and reserved words */
+static char *words[] = {"LOOP", "mov", "r3", "data", "END", "STR", "hlt", "W", "LONGLABELNAME", "extern"};
+#define WORDS_COUNT (sizeof(words) / sizeof(words[0]))
+
+/* Operands of get_addressing_type, one of each addressing mode with a symbol */
+static char *operands[] = {"r3", "#-5", "LOOP", "r7", "#12", "END", "LOOP[2]"};
+#define OPERANDS_COUNT (sizeof(operands) / sizeof(operands[0]))
+
+/* Operation names, including names that aren't operations */
+static char *operation_names[] = {"mov", "cmp", "lea", "jsr", "rts", "hlt", "prn", "foo"};
+#define OPERATION_NAMES_COUNT (sizeof(operation_names) / sizeof(operation_names[0]))
+
+/* Instruction names, including names that aren't instructions */
+static char *instruction_names[] = {"data", "string", "entry", "extern", "define", "fill"};
+#define INSTRUCTION_NAMES_COUNT (sizeof(instruction_names) / sizeof(instruction_names[0]))
+
+/* Operand lists of analyze_operands */
+static char *operand_lines[] = {" r3, LOOP\n", " #5, r1\n", " END\n", " LIST[2], r4\n"};
+#define OPERAND_LINES_COUNT (sizeof(operand_lines) / sizeof(operand_lines[0]))
+
+static void run_get_opcode(long iterations) {
+    long i;
+    opcode op;
+
+    for (i = 0; i < iterations; i++) {
+        get_opcode(operation_names[i % OPERATION_NAMES_COUNT], &op);
+        sink += op;
+    }
+}
+
+static void run_find_instruction_by_name(long iterations) {
+    long i;
+
+    for (i = 0; i < iterations; i++) {
+        sink += find_instruction_by_name(instruction_names[i % INSTRUCTION_NAMES_COUNT]);
+    }
+}
+
+static void run_check_label_name(long iterations) {
+    long i;
+
+    for (i = 0; i < iterations; i++) {
+        sink += check_label_name(words[i % WORDS_COUNT]);
+    }
+}
+
+static void run_is_special_word(long iterations) {
+    long i;
+
+    for (i = 0; i < iterations; i++) {
+        sink += is_special_word(words[i % WORDS_COUNT]);
+    }
+}
+
+static void run_get_addressing_type(long iterations) {
+    long i;
+
+    for (i = 0; i < iterations; i++) {
+        sink += get_addressing_type(operands[i % OPERANDS_COUNT], symbol_table);
+    }
+}
+
+static void run_find_by_types(long iterations) {
+    long i;
+
+    for (i = 0; i < iterations; i++) {
+        sink += find_by_types(symbol_table, symbol_names[(i * 7919) % symbol_count], 2, CODE_SYMBOL, DATA_SYMBOL) != NULL;
+    }
+}
+
+static void run_find_by_types_missing(long iterations) {
+    long i;
+
+    for (i = 0; i < iterations; i++) {
+        sink += find_by_types(symbol_table, "MISSING", 1, CODE_SYMBOL) != NULL;
+    }
+}
+
+/* One operation is one insertion, into tables of symbol_count symbols in address order */
+static void run_add_table_item(long iterations) {
+    long i;
+    table new_table = NULL;
+
+    for (i = 0; i < iterations; i++) {
+        if (i % symbol_count == 0) {
+            free_table(new_table);
+            new_table = NULL;
+        }
+        add_table_item(&new_table, symbol_names[i % symbol_count], IC_INIT_VALUE + i % symbol_count, CODE_SYMBOL);
+    }
+    free_table(new_table);
+}
+
+static void run_convert_defind(long iterations) {
+    long i;
+    char operand[MAX_LINE_LENGTH];
+
+    for (i = 0; i < iterations; i++) {
+        operand[0] = '#';
+        strcpy(operand + 1, define_names[(i * 7919) % symbol_count]);
+        convert_defind(operand, symbol_table, TRUE);
+        sink += operand[1];
+    }
+}
+
+static void run_analyze_operands(long iterations) {
+    long i;
+    int operand_count;
+    char *destination[2];
+    char content[MAX_LINE_LENGTH];
+    line_info line;
+
+    line.file_name = "microbench";
+    line.line_number = 1;
+    line.content = content;
+    line.diagnostics = NULL;
+    line.check_only = FALSE;
+    for (i = 0; i < iterations; i++) {
+        strcpy(content, operand_lines[i % OPERAND_LINES_COUNT]);
+        if (analyze_operands(line, 0, destination, &operand_count, "mov", symbol_table)) {
+            free(destination[0]);
+            if (operand_count > 1) {
+                free(destination[1]);
+            }
+        }
+        sink += operand_count;
+    }
+}
+
+static void run_encode_base4_word(long iterations) {
+    long i;
+    char encoded[8];
+
+    for (i = 0; i < iterations; i++) {
+        encode_base4_word(i & 0x3FFF, encoded);
+        sink += encoded[6];
+    }
+}
+
+static struct benchmark benchmarks[] = {
+    {"get_opcode", run_get_opcode},
+    {"find_instruction_by_name", run_find_instruction_by_name},
+    {"check_label_name", run_check_label_name},
+    {"is_special_word", run_is_special_word},
+    {"get_addressing_type", run_get_addressing_type},
+    {"find_by_types", run_find_by_types},
+    {"find_by_types_missing", run_find_by_types_missing},
+    {"add_table_item", run_add_table_item},
+    {"convert_defind", run_convert_defind},
+    {"analyze_operands", run_analyze_operands},
+    {"encode_base4_word", run_encode_base4_word},
+    {NULL, NULL}
+};
+
+/**
+ * @brief Builds the symbol table of the benchmarks.
+ *
+ * The table has symbol_count code symbols, symbol_count constants, and the labels used by
+ * the operands of the benchmarks.
+ *
+ * @return Returns 0 on success, otherwise -1.
+ */
+static int setup_symbol_table(void) {
+    long i;
+
+    symbol_names = malloc(symbol_count * sizeof(*symbol_names));
+    define_names = malloc(symbol_count * sizeof(*define_names));
+    if (symbol_names == NULL || define_names == NULL) {
+        printf("Memory allocation failed");
+        return -1;
+    }
+    for (i = 0; i < symbol_count; i++) {
+        sprintf(symbol_names[i], "S%ld", i);
+        sprintf(define_names[i], "K%ld", i);
+        add_table_item(&symbol_table, symbol_names[i], IC_INIT_VALUE + i, CODE_SYMBOL);
+        add_table_item(&symbol_table, define_names[i], i, MDEFINE_SYMBOL);
+    }
+    add_table_item(&symbol_table, "LOOP", IC_INIT_VALUE, CODE_SYMBOL);
+    add_table_item(&symbol_table, "END", IC_INIT_VALUE + symbol_count, CODE_SYMBOL);
+    add_table_item(&symbol_table, "LIST", IC_INIT_VALUE + symbol_count, DATA_SYMBOL);
+    return 0;
+}
+
+/**
+ * @brief Opens a hardware counter of the calling thread.
+ *
+ * @return The perf event file descriptor, or -1 if the kernel doesn't allow it.
+ */
+static int open_counter(__u64 config) {
+    struct perf_event_attr attr;
+
+    memset(&attr, 0, sizeof(attr));
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.size = sizeof(attr);
+    attr.config = config;
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    return (int)syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+}
+
+/**
+ * @brief Reads a counter and restarts it from zero.
+ *
+ * @return The counted events since the last reset, or -1 if the counter isn't open.
+ */
+static double read_and_reset_counter(int fd) {
+    __u64 count;
+
+    if (fd < 0 || read(fd, &count, sizeof(count)) != sizeof(count)) {
+        return -1;
+    }
+    ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+    return (double)count;
+}
+
+/**
+ * @brief Reads the monotonic clock.
+ *
+ * @return The time in nanoseconds.
+ */
+static double now_ns(void) {
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec * 1e9 + now.tv_nsec;
+}
+
+/**
+ * @brief Compares two doubles, for qsort.
+ */
+static int compare_doubles(const void *first, const void *second) {
+    double difference = *(const double *)first - *(const double *)second;
+    return (difference > 0) - (difference < 0);
+}
+
+/**
+ * @brief Returns the two-sided 95% critical value of Student's t distribution.
+ *
+ * @param degrees The degrees of freedom.
+ */
+static double t_critical_95(int degrees) {
+    static double table_values[] = {12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+                                    2.201, 2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+                                    2.080, 2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042};
+
+    if (degrees < 1) {
+        return 0;
+    }
+    return degrees <= 30 ? table_values[degrees - 1] : 1.96;
+}
+
+/**
+ * @brief Finds the number of iterations that makes a sample last about the given time.
+ */
+static long calibrate(struct benchmark *bench, double sample_ns) {
+    long iterations = 1;
+    double elapsed;
+
+    for (;;) {
+        elapsed = now_ns();
+        bench->run(iterations);
+        elapsed = now_ns() - elapsed;
+        if (elapsed >= sample_ns / 4 || iterations >= 1L << 30) {
+            break;
+        }
+        iterations *= 2;
+    }
+    return elapsed > 0 ? (long)(iterations * sample_ns / elapsed) + 1 : iterations;
+}
+
+int main(int argc, char *argv[]) {
+    int warmup = 3;                     /* Unmeasured samples per benchmark */
+    int repetitions = 20;               /* Measured samples per benchmark */
+    double sample_ns = 20e6;            /* Target duration of a sample */
+    bool use_perf = FALSE;              /* Whether to read the hardware counters */
+    char **selected = NULL;             /* Names of the benchmarks to run, or NULL for all */
+    int selected_count = 0;
+    double samples[MAX_REPETITIONS];    /* ns/op of the measured samples */
+    double cycles;                      /* Cycles over the measured samples */
+    double cache_misses;                /* Cache misses over the measured samples */
+    double elapsed, mean, variance, half_width;
+    struct perf_counters counters = {-1, -1};
+    struct benchmark *bench;
+    long iterations;
+    int index, sample;
+
+    selected = malloc(argc * sizeof(char *));
+    if (selected == NULL) {
+        printf("Memory allocation failed");
+        return 1;
+    }
+    for (index = 1; index < argc; index++) {
+        if (strcmp(argv[index], "--perf") == 0) use_perf = TRUE;
+        else if (strncmp(argv[index], "--", 2) != 0) selected[selected_count++] = argv[index];
+        else if (index + 1 == argc) {
+            fprintf(stderr, "Missing value for %s\n", argv[index]);
+            return 1;
+        }
+        else if (strcmp(argv[index], "--warmup") == 0) warmup = atoi(argv[++index]);
+        else if (strcmp(argv[index], "--repetitions") == 0) repetitions = atoi(argv[++index]);
+        else if (strcmp(argv[index], "--sample-ms") == 0) sample_ns = atof(argv[++index]) * 1e6;
+        else if (strcmp(argv[index], "--symbols") == 0) symbol_count = atol(argv[++index]);
+        else {
+            fprintf(stderr, "Unknown argument %s\n", argv[index]);
+            return 1;
+        }
+    }
+    if (repetitions < 2 || repetitions > MAX_REPETITIONS || symbol_count < 1 || sample_ns <= 0) {
+        fprintf(stderr, "Repetitions should be between 2 and %d, symbols and sample time positive\n", MAX_REPETITIONS);
+        return 1;
+    }
+    if (setup_symbol_table() != 0) {
+        return 1;
+    }
+
+    if (use_perf) {
+        counters.cycles_fd = open_counter(PERF_COUNT_HW_CPU_CYCLES);
+        counters.cache_misses_fd = open_counter(PERF_COUNT_HW_CACHE_MISSES);
+        if (counters.cycles_fd < 0 || counters.cache_misses_fd < 0) {
+            fprintf(stderr, "Hardware counters are not available (see /proc/sys/kernel/perf_event_paranoid)\n");
+        }
+    }
+
+    printf("%-26s %12s %12s %12s %12s", "benchmark", "iterations", "median ns/op", "mean ns/op", "95% CI +-");
+    if (use_perf) {
+        printf(" %12s %12s", "cycles/op", "misses/op");
+    }
+    printf("\n");
+
+    for (bench = benchmarks; bench->name != NULL; bench++) {
+        for (index = 0; index < selected_count && strcmp(selected[index], bench->name) != 0; index++);
+        if (selected_count > 0 && index == selected_count) {
+            continue;
+        }
+
+        iterations = calibrate(bench, sample_ns);
+        for (sample = 0; sample < warmup; sample++) {
+            bench->run(iterations);
+        }
+
+        cycles = cache_misses = 0;
+        read_and_reset_counter(counters.cycles_fd);
+        read_and_reset_counter(counters.cache_misses_fd);
+        for (sample = 0; sample < repetitions; sample++) {
+            if (counters.cycles_fd >= 0) ioctl(counters.cycles_fd, PERF_EVENT_IOC_ENABLE, 0);
+            if (counters.cache_misses_fd >= 0) ioctl(counters.cache_misses_fd, PERF_EVENT_IOC_ENABLE, 0);
+            elapsed = now_ns();
+            bench->run(iterations);
+            elapsed = now_ns() - elapsed;
+            if (counters.cycles_fd >= 0) ioctl(counters.cycles_fd, PERF_EVENT_IOC_DISABLE, 0);
+            if (counters.cache_misses_fd >= 0) ioctl(counters.cache_misses_fd, PERF_EVENT_IOC_DISABLE, 0);
+            samples[sample] = elapsed / iterations;
+        }
+        cycles = read_and_reset_counter(counters.cycles_fd);
+        cache_misses = read_and_reset_counter(counters.cache_misses_fd);
+
+        /* Confidence interval of the mean, from the spread of the samples */
+        mean = variance = 0;
+        for (sample = 0; sample < repetitions; sample++) {
+            mean += samples[sample];
+        }
+        mean /= repetitions;
+        for (sample = 0; sample < repetitions; sample++) {
+            variance += (samples[sample] - mean) * (samples[sample] - mean);
+        }
+        variance /= repetitions - 1;
+        half_width = t_critical_95(repetitions - 1) * sqrt(variance / repetitions);
+
+        qsort(samples, repetitions, sizeof(double), compare_doubles);
+        printf("%-26s %12ld %12.2f %12.2f %12.2f", bench->name, iterations,
+               (samples[(repetitions - 1) / 2] + samples[repetitions / 2]) / 2, mean, half_width);
+        if (use_perf) {
+            if (cycles >= 0) printf(" %12.2f", cycles / ((double)iterations * repetitions));
+            else printf(" %12s", "n/a");
+            if (cache_misses >= 0) printf(" %12.4f", cache_misses / ((double)iterations * repetitions));
+            else printf(" %12s", "n/a");
+        }
+        printf("\n");
+    }
+
+    if (counters.cycles_fd >= 0) close(counters.cycles_fd);
+    if (counters.cache_misses_fd >= 0) close(counters.cache_misses_fd);
+    free_table(symbol_table);
+    free(symbol_names);
+    free(define_names);
+    free(selected);
+    return (int)(sink & 0);
+}
@@ -0,0 +1,179 @@
+mcr m1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inc r1
+inr1
+inc r1
+inc rcmp 1
+inc r1
+inc r1
+inc r1
+inc rinc r1
+inc r1
+mov r1, VAL
+endmcr
+MAIN: .data 1,2,3
+m1
+m1
+hltr1
+inc rinc r1
+inc r1
+mov r1, VAL
+endmcr
+MAIN: .data 1,2,3
+m1
+m1
+hlt
+VAL: .data 7
+VAL: .data 7
+VAL: .data 7
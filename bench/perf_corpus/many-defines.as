@@ -0,0 +1,4002 @@
+.define K0 = 0
+.define K1 = 1
+.define K2 = 2
+.define K3 = 3
+.define K4 = 4
+.define K5 = 5
+.define K6 = 6
+.define K7 = 7
+.define K8 = 8
+.define K9 = 9
+.define K10 = 10
+.define K11 = 11
+.define K12 = 12
+.define K13 = 13
+.define K14 = 14
+.define K15 = 15
+.define K16 = 16
+.define K17 = 17
+.define K18 = 18
+.define K19 = 19
+.define K20 = 20
+.define K21 = 21
+.define K22 = 22
+.define K23 = 23
+.define K24 = 24
+.define K25 = 25
+.define K26 = 26
+.define K27 = 27
+.define K28 = 28
+.define K29 = 29
+.define K30 = 30
+.define K31 = 31
+.define K32 = 32
+.define K33 = 33
+.define K34 = 34
+.define K35 = 35
+.define K36 = 36
+.define K37 = 37
+.define K38 = 38
+.define K39 = 39
+.define K40 = 40
+.define K41 = 41
+.define K42 = 42
+.define K43 = 43
+.define K44 = 44
+.define K45 = 45
+.define K46 = 46
+.define K47 = 47
+.define K48 = 48
+.define K49 = 49
+.define K50 = 50
+.define K51 = 51
+.define K52 = 52
+.define K53 = 53
+.define K54 = 54
+.define K55 = 55
+.define K56 = 56
+.define K57 = 57
+.define K58 = 58
+.define K59 = 59
+.define K60 = 60
+.define K61 = 61
+.define K62 = 62
+.define K63 = 63
+.define K64 = 64
+.define K65 = 65
+.define K66 = 66
+.define K67 = 67
+.define K68 = 68
+.define K69 = 69
+.define K70 = 70
+.define K71 = 71
+.define K72 = 72
+.define K73 = 73
+.define K74 = 74
+.define K75 = 75
+.define K76 = 76
+.define K77 = 77
+.define K78 = 78
+.define K79 = 79
+.define K80 = 80
+.define K81 = 81
+.define K82 = 82
+.define K83 = 83
+.define K84 = 84
+.define K85 = 85
+.define K86 = 86
+.define K87 = 87
+.define K88 = 88
+.define K89 = 89
+.define K90 = 90
+.define K91 = 91
+.define K92 = 92
+.define K93 = 93
+.define K94 = 94
+.define K95 = 95
+.define K96 = 96
+.define K97 = 97
+.define K98 = 98
+.define K99 = 99
+.define K100 = 100
+.define K101 = 101
+.define K102 = 102
+.define K103 = 103
+.define K104 = 104
+.define K105 = 105
+.define K106 = 106
+.define K107 = 107
+.define K108 = 108
+.define K109 = 109
+.define K110 = 110
+.define K111 = 111
+.define K112 = 112
+.define K113 = 113
+.define K114 = 114
+.define K115 = 115
+.define K116 = 116
+.define K117 = 117
+.define K118 = 118
+.define K119 = 119
+.define K120 = 120
+.define K121 = 121
+.define K122 = 122
+.define K123 = 123
+.define K124 = 124
+.define K125 = 125
+.define K126 = 126
+.define K127 = 127
+.define K128 = 128
+.define K129 = 129
+.define K130 = 130
+.define K131 = 131
+.define K132 = 132
+.define K133 = 133
+.define K134 = 134
+.define K135 = 135
+.define K136 = 136
+.define K137 = 137
+.define K138 = 138
+.define K139 = 139
+.define K140 = 140
+.define K141 = 141
+.define K142 = 142
+.define K143 = 143
+.define K144 = 144
+.define K145 = 145
+.define K146 = 146
+.define K147 = 147
+.define K148 = 148
+.define K149 = 149
+.define K150 = 150
+.define K151 = 151
+.define K152 = 152
+.define K153 = 153
+.define K154 = 154
+.define K155 = 155
+.define K156 = 156
+.define K157 = 157
+.define K158 = 158
+.define K159 = 159
+.define K160 = 160
+.define K161 = 161
+.define K162 = 162
+.define K163 = 163
+.define K164 = 164
+.define K165 = 165
+.define K166 = 166
+.define K167 = 167
+.define K168 = 168
+.define K169 = 169
+.define K170 = 170
+.define K171 = 171
+.define K172 = 172
+.define K173 = 173
+.define K174 = 174
+.define K175 = 175
+.define K176 = 176
+.define K177 = 177
+.define K178 = 178
+.define K179 = 179
+.define K180 = 180
+.define K181 = 181
+.define K182 = 182
+.define K183 = 183
+.define K184 = 184
+.define K185 = 185
+.define K186 = 186
+.define K187 = 187
+.define K188 = 188
+.define K189 = 189
+.define K190 = 190
+.define K191 = 191
+.define K192 = 192
+.define K193 = 193
+.define K194 = 194
+.define K195 = 195
+.define K196 = 196
+.define K197 = 197
+.define K198 = 198
+.define K199 = 199
+.define K200 = 200
+.define K201 = 201
+.define K202 = 202
+.define K203 = 203
+.define K204 = 204
+.define K205 = 205
+.define K206 = 206
+.define K207 = 207
+.define K208 = 208
+.define K209 = 209
+.define K210 = 210
+.define K211 = 211
+.define K212 = 212
+.define K213 = 213
+.define K214 = 214
+.define K215 = 215
+.define K216 = 216
+.define K217 = 217
+.define K218 = 218
+.define K219 = 219
+.define K220 = 220
+.define K221 = 221
+.define K222 = 222
+.define K223 = 223
+.define K224 = 224
+.define K225 = 225
+.define K226 = 226
+.define K227 = 227
+.define K228 = 228
+.define K229 = 229
+.define K230 = 230
+.define K231 = 231
+.define K232 = 232
+.define K233 = 233
+.define K234 = 234
+.define K235 = 235
+.define K236 = 236
+.define K237 = 237
+.define K238 = 238
+.define K239 = 239
+.define K240 = 240
+.define K241 = 241
+.define K242 = 242
+.define K243 = 243
+.define K244 = 244
+.define K245 = 245
+.define K246 = 246
+.define K247 = 247
+.define K248 = 248
+.define K249 = 249
+.define K250 = 250
+.define K251 = 251
+.define K252 = 252
+.define K253 = 253
+.define K254 = 254
+.define K255 = 255
+.define K256 = 256
+.define K257 = 257
+.define K258 = 258
+.define K259 = 259
+.define K260 = 260
+.define K261 = 261
+.define K262 = 262
+.define K263 = 263
+.define K264 = 264
+.define K265 = 265
+.define K266 = 266
+.define K267 = 267
+.define K268 = 268
+.define K269 = 269
+.define K270 = 270
+.define K271 = 271
+.define K272 = 272
+.define K273 = 273
+.define K274 = 274
+.define K275 = 275
+.define K276 = 276
+.define K277 = 277
+.define K278 = 278
+.define K279 = 279
+.define K280 = 280
+.define K281 = 281
+.define K282 = 282
+.define K283 = 283
+.define K284 = 284
+.define K285 = 285
+.define K286 = 286
+.define K287 = 287
+.define K288 = 288
+.define K289 = 289
+.define K290 = 290
+.define K291 = 291
+.define K292 = 292
+.define K293 = 293
+.define K294 = 294
+.define K295 = 295
+.define K296 = 296
+.define K297 = 297
+.define K298 = 298
+.define K299 = 299
+.define K300 = 300
+.define K301 = 301
+.define K302 = 302
+.define K303 = 303
+.define K304 = 304
+.define K305 = 305
+.define K306 = 306
+.define K307 = 307
+.define K308 = 308
+.define K309 = 309
+.define K310 = 310
+.define K311 = 311
+.define K312 = 312
+.define K313 = 313
+.define K314 = 314
+.define K315 = 315
+.define K316 = 316
+.define K317 = 317
+.define K318 = 318
+.define K319 = 319
+.define K320 = 320
+.define K321 = 321
+.define K322 = 322
+.define K323 = 323
+.define K324 = 324
+.define K325 = 325
+.define K326 = 326
+.define K327 = 327
+.define K328 = 328
+.define K329 = 329
+.define K330 = 330
+.define K331 = 331
+.define K332 = 332
+.define K333 = 333
+.define K334 = 334
+.define K335 = 335
+.define K336 = 336
+.define K337 = 337
+.define K338 = 338
+.define K339 = 339
+.define K340 = 340
+.define K341 = 341
+.define K342 = 342
+.define K343 = 343
+.define K344 = 344
+.define K345 = 345
+.define K346 = 346
+.define K347 = 347
+.define K348 = 348
+.define K349 = 349
+.define K350 = 350
+.define K351 = 351
+.define K352 = 352
+.define K353 = 353
+.define K354 = 354
+.define K355 = 355
+.define K356 = 356
+.define K357 = 357
+.define K358 = 358
+.define K359 = 359
+.define K360 = 360
+.define K361 = 361
+.define K362 = 362
+.define K363 = 363
+.define K364 = 364
+.define K365 = 365
+.define K366 = 366
+.define K367 = 367
+.define K368 = 368
+.define K369 = 369
+.define K370 = 370
+.define K371 = 371
+.define K372 = 372
+.define K373 = 373
+.define K374 = 374
+.define K375 = 375
+.define K376 = 376
+.define K377 = 377
+.define K378 = 378
+.define K379 = 379
+.define K380 = 380
+.define K381 = 381
+.define K382 = 382
+.define K383 = 383
+.define K384 = 384
+.define K385 = 385
+.define K386 = 386
+.define K387 = 387
+.define K388 = 388
+.define K389 = 389
+.define K390 = 390
+.define K391 = 391
+.define K392 = 392
+.define K393 = 393
+.define K394 = 394
+.define K395 = 395
+.define K396 = 396
+.define K397 = 397
+.define K398 = 398
+.define K399 = 399
+.define K400 = 400
+.define K401 = 401
+.define K402 = 402
+.define K403 = 403
+.define K404 = 404
+.define K405 = 405
+.define K406 = 406
+.define K407 = 407
+.define K408 = 408
+.define K409 = 409
+.define K410 = 410
+.define K411 = 411
+.define K412 = 412
+.define K413 = 413
+.define K414 = 414
+.define K415 = 415
+.define K416 = 416
+.define K417 = 417
+.define K418 = 418
+.define K419 = 419
+.define K420 = 420
+.define K421 = 421
+.define K422 = 422
+.define K423 = 423
+.define K424 = 424
+.define K425 = 425
+.define K426 = 426
+.define K427 = 427
+.define K428 = 428
+.define K429 = 429
+.define K430 = 430
+.define K431 = 431
+.define K432 = 432
+.define K433 = 433
+.define K434 = 434
+.define K435 = 435
+.define K436 = 436
+.define K437 = 437
+.define K438 = 438
+.define K439 = 439
+.define K440 = 440
+.define K441 = 441
+.define K442 = 442
+.define K443 = 443
+.define K444 = 444
+.define K445 = 445
+.define K446 = 446
+.define K447 = 447
+.define K448 = 448
+.define K449 = 449
+.define K450 = 450
+.define K451 = 451
+.define K452 = 452
+.define K453 = 453
+.define K454 = 454
+.define K455 = 455
+.define K456 = 456
+.define K457 = 457
+.define K458 = 458
+.define K459 = 459
+.define K460 = 460
+.define K461 = 461
+.define K462 = 462
+.define K463 = 463
+.define K464 = 464
+.define K465 = 465
+.define K466 = 466
+.define K467 = 467
+.define K468 = 468
+.define K469 = 469
+.define K470 = 470
+.define K471 = 471
+.define K472 = 472
+.define K473 = 473
+.define K474 = 474
+.define K475 = 475
+.define K476 = 476
+.define K477 = 477
+.define K478 = 478
+.define K479 = 479
+.define K480 = 480
+.define K481 = 481
+.define K482 = 482
+.define K483 = 483
+.define K484 = 484
+.define K485 = 485
+.define K486 = 486
+.define K487 = 487
+.define K488 = 488
+.define K489 = 489
+.define K490 = 490
+.define K491 = 491
+.define K492 = 492
+.define K493 = 493
+.define K494 = 494
+.define K495 = 495
+.define K496 = 496
+.define K497 = 497
+.define K498 = 498
+.define K499 = 499
+.define K500 = 500
+.define K501 = 501
+.define K502 = 502
+.define K503 = 503
+.define K504 = 504
+.define K505 = 505
+.define K506 = 506
+.define K507 = 507
+.define K508 = 508
+.define K509 = 509
+.define K510 = 510
+.define K511 = 511
+.define K512 = 512
+.define K513 = 513
+.define K514 = 514
+.define K515 = 515
+.define K516 = 516
+.define K517 = 517
+.define K518 = 518
+.define K519 = 519
+.define K520 = 520
+.define K521 = 521
+.define K522 = 522
+.define K523 = 523
+.define K524 = 524
+.define K525 = 525
+.define K526 = 526
+.define K527 = 527
+.define K528 = 528
+.define K529 = 529
+.define K530 = 530
+.define K531 = 531
+.define K532 = 532
+.define K533 = 533
+.define K534 = 534
+.define K535 = 535
+.define K536 = 536
+.define K537 = 537
+.define K538 = 538
+.define K539 = 539
+.define K540 = 540
+.define K541 = 541
+.define K542 = 542
+.define K543 = 543
+.define K544 = 544
+.define K545 = 545
+.define K546 = 546
+.define K547 = 547
+.define K548 = 548
+.define K549 = 549
+.define K550 = 550
+.define K551 = 551
+.define K552 = 552
+.define K553 = 553
+.define K554 = 554
+.define K555 = 555
+.define K556 = 556
+.define K557 = 557
+.define K558 = 558
+.define K559 = 559
+.define K560 = 560
+.define K561 = 561
+.define K562 = 562
+.define K563 = 563
+.define K564 = 564
+.define K565 = 565
+.define K566 = 566
+.define K567 = 567
+.define K568 = 568
+.define K569 = 569
+.define K570 = 570
+.define K571 = 571
+.define K572 = 572
+.define K573 = 573
+.define K574 = 574
+.define K575 = 575
+.define K576 = 576
+.define K577 = 577
+.define K578 = 578
+.define K579 = 579
+.define K580 = 580
+.define K581 = 581
+.define K582 = 582
+.define K583 = 583
+.define K584 = 584
+.define K585 = 585
+.define K586 = 586
+.define K587 = 587
+.define K588 = 588
+.define K589 = 589
+.define K590 = 590
+.define K591 = 591
+.define K592 = 592
+.define K593 = 593
+.define K594 = 594
+.define K595 = 595
+.define K596 = 596
+.define K597 = 597
+.define K598 = 598
+.define K599 = 599
+.define K600 = 600
+.define K601 = 601
+.define K602 = 602
+.define K603 = 603
+.define K604 = 604
+.define K605 = 605
+.define K606 = 606
+.define K607 = 607
+.define K608 = 608
+.define K609 = 609
+.define K610 = 610
+.define K611 = 611
+.define K612 = 612
+.define K613 = 613
+.define K614 = 614
+.define K615 = 615
+.define K616 = 616
+.define K617 = 617
+.define K618 = 618
+.define K619 = 619
+.define K620 = 620
+.define K621 = 621
+.define K622 = 622
+.define K623 = 623
+.define K624 = 624
+.define K625 = 625
+.define K626 = 626
+.define K627 = 627
+.define K628 = 628
+.define K629 = 629
+.define K630 = 630
+.define K631 = 631
+.define K632 = 632
+.define K633 = 633
+.define K634 = 634
+.define K635 = 635
+.define K636 = 636
+.define K637 = 637
+.define K638 = 638
+.define K639 = 639
+.define K640 = 640
+.define K641 = 641
+.define K642 = 642
+.define K643 = 643
+.define K644 = 644
+.define K645 = 645
+.define K646 = 646
+.define K647 = 647
+.define K648 = 648
+.define K649 = 649
+.define K650 = 650
+.define K651 = 651
+.define K652 = 652
+.define K653 = 653
+.define K654 = 654
+.define K655 = 655
+.define K656 = 656
+.define K657 = 657
+.define K658 = 658
+.define K659 = 659
+.define K660 = 660
+.define K661 = 661
+.define K662 = 662
+.define K663 = 663
+.define K664 = 664
+.define K665 = 665
+.define K666 = 666
+.define K667 = 667
+.define K668 = 668
+.define K669 = 669
+.define K670 = 670
+.define K671 = 671
+.define K672 = 672
+.define K673 = 673
+.define K674 = 674
+.define K675 = 675
+.define K676 = 676
+.define K677 = 677
+.define K678 = 678
+.define K679 = 679
+.define K680 = 680
+.define K681 = 681
+.define K682 = 682
+.define K683 = 683
+.define K684 = 684
+.define K685 = 685
+.define K686 = 686
+.define K687 = 687
+.define K688 = 688
+.define K689 = 689
+.define K690 = 690
+.define K691 = 691
+.define K692 = 692
+.define K693 = 693
+.define K694 = 694
+.define K695 = 695
+.define K696 = 696
+.define K697 = 697
+.define K698 = 698
+.define K699 = 699
+.define K700 = 700
+.define K701 = 701
+.define K702 = 702
+.define K703 = 703
+.define K704 = 704
+.define K705 = 705
+.define K706 = 706
+.define K707 = 707
+.define K708 = 708
+.define K709 = 709
+.define K710 = 710
+.define K711 = 711
+.define K712 = 712
+.define K713 = 713
+.define K714 = 714
+.define K715 = 715
+.define K716 = 716
+.define K717 = 717
+.define K718 = 718
+.define K719 = 719
+.define K720 = 720
+.define K721 = 721
+.define K722 = 722
+.define K723 = 723
+.define K724 = 724
+.define K725 = 725
+.define K726 = 726
+.define K727 = 727
+.define K728 = 728
+.define K729 = 729
+.define K730 = 730
+.define K731 = 731
+.define K732 = 732
+.define K733 = 733
+.define K734 = 734
+.define K735 = 735
+.define K736 = 736
+.define K737 = 737
+.define K738 = 738
+.define K739 = 739
+.define K740 = 740
+.define K741 = 741
+.define K742 = 742
+.define K743 = 743
+.define K744 = 744
+.define K745 = 745
+.define K746 = 746
+.define K747 = 747
+.define K748 = 748
+.define K749 = 749
+.define K750 = 750
+.define K751 = 751
+.define K752 = 752
+.define K753 = 753
+.define K754 = 754
+.define K755 = 755
+.define K756 = 756
+.define K757 = 757
+.define K758 = 758
+.define K759 = 759
+.define K760 = 760
+.define K761 = 761
+.define K762 = 762
+.define K763 = 763
+.define K764 = 764
+.define K765 = 765
+.define K766 = 766
+.define K767 = 767
+.define K768 = 768
+.define K769 = 769
+.define K770 = 770
+.define K771 = 771
+.define K772 = 772
+.define K773 = 773
+.define K774 = 774
+.define K775 = 775
+.define K776 = 776
+.define K777 = 777
+.define K778 = 778
+.define K779 = 779
+.define K780 = 780
+.define K781 = 781
+.define K782 = 782
+.define K783 = 783
+.define K784 = 784
+.define K785 = 785
+.define K786 = 786
+.define K787 = 787
+.define K788 = 788
+.define K789 = 789
+.define K790 = 790
+.define K791 = 791
+.define K792 = 792
+.define K793 = 793
+.define K794 = 794
+.define K795 = 795
+.define K796 = 796
+.define K797 = 797
+.define K798 = 798
+.define K799 = 799
+.define K800 = 800
+.define K801 = 801
+.define K802 = 802
+.define K803 = 803
+.define K804 = 804
+.define K805 = 805
+.define K806 = 806
+.define K807 = 807
+.define K808 = 808
+.define K809 = 809
+.define K810 = 810
+.define K811 = 811
+.define K812 = 812
+.define K813 = 813
+.define K814 = 814
+.define K815 = 815
+.define K816 = 816
+.define K817 = 817
+.define K818 = 818
+.define K819 = 819
+.define K820 = 820
+.define K821 = 821
+.define K822 = 822
+.define K823 = 823
+.define K824 = 824
+.define K825 = 825
+.define K826 = 826
+.define K827 = 827
+.define K828 = 828
+.define K829 = 829
+.define K830 = 830
+.define K831 = 831
+.define K832 = 832
+.define K833 = 833
+.define K834 = 834
+.define K835 = 835
+.define K836 = 836
+.define K837 = 837
+.define K838 = 838
+.define K839 = 839
+.define K840 = 840
+.define K841 = 841
+.define K842 = 842
+.define K843 = 843
+.define K844 = 844
+.define K845 = 845
+.define K846 = 846
+.define K847 = 847
+.define K848 = 848
+.define K849 = 849
+.define K850 = 850
+.define K851 = 851
+.define K852 = 852
+.define K853 = 853
+.define K854 = 854
+.define K855 = 855
+.define K856 = 856
+.define K857 = 857
+.define K858 = 858
+.define K859 = 859
+.define K860 = 860
+.define K861 = 861
+.define K862 = 862
+.define K863 = 863
+.define K864 = 864
+.define K865 = 865
+.define K866 = 866
+.define K867 = 867
+.define K868 = 868
+.define K869 = 869
+.define K870 = 870
+.define K871 = 871
+.define K872 = 872
+.define K873 = 873
+.define K874 = 874
+.define K875 = 875
+.define K876 = 876
+.define K877 = 877
+.define K878 = 878
+.define K879 = 879
+.define K880 = 880
+.define K881 = 881
+.define K882 = 882
+.define K883 = 883
+.define K884 = 884
+.define K885 = 885
+.define K886 = 886
+.define K887 = 887
+.define K888 = 888
+.define K889 = 889
+.define K890 = 890
+.define K891 = 891
+.define K892 = 892
+.define K893 = 893
+.define K894 = 894
+.define K895 = 895
+.define K896 = 896
+.define K897 = 897
+.define K898 = 898
+.define K899 = 899
+.define K900 = 900
+.define K901 = 901
+.define K902 = 902
+.define K903 = 903
+.define K904 = 904
+.define K905 = 905
+.define K906 = 906
+.define K907 = 907
+.define K908 = 908
+.define K909 = 909
+.define K910 = 910
+.define K911 = 911
+.define K912 = 912
+.define K913 = 913
+.define K914 = 914
+.define K915 = 915
+.define K916 = 916
+.define K917 = 917
+.define K918 = 918
+.define K919 = 919
+.define K920 = 920
+.define K921 = 921
+.define K922 = 922
+.define K923 = 923
+.define K924 = 924
+.define K925 = 925
+.define K926 = 926
+.define K927 = 927
+.define K928 = 928
+.define K929 = 929
+.define K930 = 930
+.define K931 = 931
+.define K932 = 932
+.define K933 = 933
+.define K934 = 934
+.define K935 = 935
+.define K936 = 936
+.define K937 = 937
+.define K938 = 938
+.define K939 = 939
+.define K940 = 940
+.define K941 = 941
+.define K942 = 942
+.define K943 = 943
+.define K944 = 944
+.define K945 = 945
+.define K946 = 946
+.define K947 = 947
+.define K948 = 948
+.define K949 = 949
+.define K950 = 950
+.define K951 = 951
+.define K952 = 952
+.define K953 = 953
+.define K954 = 954
+.define K955 = 955
+.define K956 = 956
+.define K957 = 957
+.define K958 = 958
+.define K959 = 959
+.define K960 = 960
+.define K961 = 961
+.define K962 = 962
+.define K963 = 963
+.define K964 = 964
+.define K965 = 965
+.define K966 = 966
+.define K967 = 967
+.define K968 = 968
+.define K969 = 969
+.define K970 = 970
+.define K971 = 971
+.define K972 = 972
+.define K973 = 973
+.define K974 = 974
+.define K975 = 975
+.define K976 = 976
+.define K977 = 977
+.define K978 = 978
+.define K979 = 979
+.define K980 = 980
+.define K981 = 981
+.define K982 = 982
+.define K983 = 983
+.define K984 = 984
+.define K985 = 985
+.define K986 = 986
+.define K987 = 987
+.define K988 = 988
+.define K989 = 989
+.define K990 = 990
+.define K991 = 991
+.define K992 = 992
+.define K993 = 993
+.define K994 = 994
+.define K995 = 995
+.define K996 = 996
+.define K997 = 997
+.define K998 = 998
+.define K999 = 999
+.define K1000 = 1000
+.define K1001 = 1001
+.define K1002 = 1002
+.define K1003 = 1003
+.define K1004 = 1004
+.define K1005 = 1005
+.define K1006 = 1006
+.define K1007 = 1007
+.define K1008 = 1008
+.define K1009 = 1009
+.define K1010 = 1010
+.define K1011 = 1011
+.define K1012 = 1012
+.define K1013 = 1013
+.define K1014 = 1014
+.define K1015 = 1015
+.define K1016 = 1016
+.define K1017 = 1017
+.define K1018 = 1018
+.define K1019 = 1019
+.define K1020 = 1020
+.define K1021 = 1021
+.define K1022 = 1022
+.define K1023 = 1023
+.define K1024 = 1024
+.define K1025 = 1025
+.define K1026 = 1026
+.define K1027 = 1027
+.define K1028 = 1028
+.define K1029 = 1029
+.define K1030 = 1030
+.define K1031 = 1031
+.define K1032 = 1032
+.define K1033 = 1033
+.define K1034 = 1034
+.define K1035 = 1035
+.define K1036 = 1036
+.define K1037 = 1037
+.define K1038 = 1038
+.define K1039 = 1039
+.define K1040 = 1040
+.define K1041 = 1041
+.define K1042 = 1042
+.define K1043 = 1043
+.define K1044 = 1044
+.define K1045 = 1045
+.define K1046 = 1046
+.define K1047 = 1047
+.define K1048 = 1048
+.define K1049 = 1049
+.define K1050 = 1050
+.define K1051 = 1051
+.define K1052 = 1052
+.define K1053 = 1053
+.define K1054 = 1054
+.define K1055 = 1055
+.define K1056 = 1056
+.define K1057 = 1057
+.define K1058 = 1058
+.define K1059 = 1059
+.define K1060 = 1060
+.define K1061 = 1061
+.define K1062 = 1062
+.define K1063 = 1063
+.define K1064 = 1064
+.define K1065 = 1065
+.define K1066 = 1066
+.define K1067 = 1067
+.define K1068 = 1068
+.define K1069 = 1069
+.define K1070 = 1070
+.define K1071 = 1071
+.define K1072 = 1072
+.define K1073 = 1073
+.define K1074 = 1074
+.define K1075 = 1075
+.define K1076 = 1076
+.define K1077 = 1077
+.define K1078 = 1078
+.define K1079 = 1079
+.define K1080 = 1080
+.define K1081 = 1081
+.define K1082 = 1082
+.define K1083 = 1083
+.define K1084 = 1084
+.define K1085 = 1085
+.define K1086 = 1086
+.define K1087 = 1087
+.define K1088 = 1088
+.define K1089 = 1089
+.define K1090 = 1090
+.define K1091 = 1091
+.define K1092 = 1092
+.define K1093 = 1093
+.define K1094 = 1094
+.define K1095 = 1095
+.define K1096 = 1096
+.define K1097 = 1097
+.define K1098 = 1098
+.define K1099 = 1099
+.define K1100 = 1100
+.define K1101 = 1101
+.define K1102 = 1102
+.define K1103 = 1103
+.define K1104 = 1104
+.define K1105 = 1105
+.define K1106 = 1106
+.define K1107 = 1107
+.define K1108 = 1108
+.define K1109 = 1109
+.define K1110 = 1110
+.define K1111 = 1111
+.define K1112 = 1112
+.define K1113 = 1113
+.define K1114 = 1114
+.define K1115 = 1115
+.define K1116 = 1116
+.define K1117 = 1117
+.define K1118 = 1118
+.define K1119 = 1119
+.define K1120 = 1120
+.define K1121 = 1121
+.define K1122 = 1122
+.define K1123 = 1123
+.define K1124 = 1124
+.define K1125 = 1125
+.define K1126 = 1126
+.define K1127 = 1127
+.define K1128 = 1128
+.define K1129 = 1129
+.define K1130 = 1130
+.define K1131 = 1131
+.define K1132 = 1132
+.define K1133 = 1133
+.define K1134 = 1134
+.define K1135 = 1135
+.define K1136 = 1136
+.define K1137 = 1137
+.define K1138 = 1138
+.define K1139 = 1139
+.define K1140 = 1140
+.define K1141 = 1141
+.define K1142 = 1142
+.define K1143 = 1143
+.define K1144 = 1144
+.define K1145 = 1145
+.define K1146 = 1146
+.define K1147 = 1147
+.define K1148 = 1148
+.define K1149 = 1149
+.define K1150 = 1150
+.define K1151 = 1151
+.define K1152 = 1152
+.define K1153 = 1153
+.define K1154 = 1154
+.define K1155 = 1155
+.define K1156 = 1156
+.define K1157 = 1157
+.define K1158 = 1158
+.define K1159 = 1159
+.define K1160 = 1160
+.define K1161 = 1161
+.define K1162 = 1162
+.define K1163 = 1163
+.define K1164 = 1164
+.define K1165 = 1165
+.define K1166 = 1166
+.define K1167 = 1167
+.define K1168 = 1168
+.define K1169 = 1169
+.define K1170 = 1170
+.define K1171 = 1171
+.define K1172 = 1172
+.define K1173 = 1173
+.define K1174 = 1174
+.define K1175 = 1175
+.define K1176 = 1176
+.define K1177 = 1177
+.define K1178 = 1178
+.define K1179 = 1179
+.define K1180 = 1180
+.define K1181 = 1181
+.define K1182 = 1182
+.define K1183 = 1183
+.define K1184 = 1184
+.define K1185 = 1185
+.define K1186 = 1186
+.define K1187 = 1187
+.define K1188 = 1188
+.define K1189 = 1189
+.define K1190 = 1190
+.define K1191 = 1191
+.define K1192 = 1192
+.define K1193 = 1193
+.define K1194 = 1194
+.define K1195 = 1195
+.define K1196 = 1196
+.define K1197 = 1197
+.define K1198 = 1198
+.define K1199 = 1199
+.define K1200 = 1200
+.define K1201 = 1201
+.define K1202 = 1202
+.define K1203 = 1203
+.define K1204 = 1204
+.define K1205 = 1205
+.define K1206 = 1206
+.define K1207 = 1207
+.define K1208 = 1208
+.define K1209 = 1209
+.define K1210 = 1210
+.define K1211 = 1211
+.define K1212 = 1212
+.define K1213 = 1213
+.define K1214 = 1214
+.define K1215 = 1215
+.define K1216 = 1216
+.define K1217 = 1217
+.define K1218 = 1218
+.define K1219 = 1219
+.define K1220 = 1220
+.define K1221 = 1221
+.define K1222 = 1222
+.define K1223 = 1223
+.define K1224 = 1224
+.define K1225 = 1225
+.define K1226 = 1226
+.define K1227 = 1227
+.define K1228 = 1228
+.define K1229 = 1229
+.define K1230 = 1230
+.define K1231 = 1231
+.define K1232 = 1232
+.define K1233 = 1233
+.define K1234 = 1234
+.define K1235 = 1235
+.define K1236 = 1236
+.define K1237 = 1237
+.define K1238 = 1238
+.define K1239 = 1239
+.define K1240 = 1240
+.define K1241 = 1241
+.define K1242 = 1242
+.define K1243 = 1243
+.define K1244 = 1244
+.define K1245 = 1245
+.define K1246 = 1246
+.define K1247 = 1247
+.define K1248 = 1248
+.define K1249 = 1249
+.define K1250 = 1250
+.define K1251 = 1251
+.define K1252 = 1252
+.define K1253 = 1253
+.define K1254 = 1254
+.define K1255 = 1255
+.define K1256 = 1256
+.define K1257 = 1257
+.define K1258 = 1258
+.define K1259 = 1259
+.define K1260 = 1260
+.define K1261 = 1261
+.define K1262 = 1262
+.define K1263 = 1263
+.define K1264 = 1264
+.define K1265 = 1265
+.define K1266 = 1266
+.define K1267 = 1267
+.define K1268 = 1268
+.define K1269 = 1269
+.define K1270 = 1270
+.define K1271 = 1271
+.define K1272 = 1272
+.define K1273 = 1273
+.define K1274 = 1274
+.define K1275 = 1275
+.define K1276 = 1276
+.define K1277 = 1277
+.define K1278 = 1278
+.define K1279 = 1279
+.define K1280 = 1280
+.define K1281 = 1281
+.define K1282 = 1282
+.define K1283 = 1283
+.define K1284 = 1284
+.define K1285 = 1285
+.define K1286 = 1286
+.define K1287 = 1287
+.define K1288 = 1288
+.define K1289 = 1289
+.define K1290 = 1290
+.define K1291 = 1291
+.define K1292 = 1292
+.define K1293 = 1293
+.define K1294 = 1294
+.define K1295 = 1295
+.define K1296 = 1296
+.define K1297 = 1297
+.define K1298 = 1298
+.define K1299 = 1299
+.define K1300 = 1300
+.define K1301 = 1301
+.define K1302 = 1302
+.define K1303 = 1303
+.define K1304 = 1304
+.define K1305 = 1305
+.define K1306 = 1306
+.define K1307 = 1307
+.define K1308 = 1308
+.define K1309 = 1309
+.define K1310 = 1310
+.define K1311 = 1311
+.define K1312 = 1312
+.define K1313 = 1313
+.define K1314 = 1314
+.define K1315 = 1315
+.define K1316 = 1316
+.define K1317 = 1317
+.define K1318 = 1318
+.define K1319 = 1319
+.define K1320 = 1320
+.define K1321 = 1321
+.define K1322 = 1322
+.define K1323 = 1323
+.define K1324 = 1324
+.define K1325 = 1325
+.define K1326 = 1326
+.define K1327 = 1327
+.define K1328 = 1328
+.define K1329 = 1329
+.define K1330 = 1330
+.define K1331 = 1331
+.define K1332 = 1332
+.define K1333 = 1333
+.define K1334 = 1334
+.define K1335 = 1335
+.define K1336 = 1336
+.define K1337 = 1337
+.define K1338 = 1338
+.define K1339 = 1339
+.define K1340 = 1340
+.define K1341 = 1341
+.define K1342 = 1342
+.define K1343 = 1343
+.define K1344 = 1344
+.define K1345 = 1345
+.define K1346 = 1346
+.define K1347 = 1347
+.define K1348 = 1348
+.define K1349 = 1349
+.define K1350 = 1350
+.define K1351 = 1351
+.define K1352 = 1352
+.define K1353 = 1353
+.define K1354 = 1354
+.define K1355 = 1355
+.define K1356 = 1356
+.define K1357 = 1357
+.define K1358 = 1358
+.define K1359 = 1359
+.define K1360 = 1360
+.define K1361 = 1361
+.define K1362 = 1362
+.define K1363 = 1363
+.define K1364 = 1364
+.define K1365 = 1365
+.define K1366 = 1366
+.define K1367 = 1367
+.define K1368 = 1368
+.define K1369 = 1369
+.define K1370 = 1370
+.define K1371 = 1371
+.define K1372 = 1372
+.define K1373 = 1373
+.define K1374 = 1374
+.define K1375 = 1375
+.define K1376 = 1376
+.define K1377 = 1377
+.define K1378 = 1378
+.define K1379 = 1379
+.define K1380 = 1380
+.define K1381 = 1381
+.define K1382 = 1382
+.define K1383 = 1383
+.define K1384 = 1384
+.define K1385 = 1385
+.define K1386 = 1386
+.define K1387 = 1387
+.define K1388 = 1388
+.define K1389 = 1389
+.define K1390 = 1390
+.define K1391 = 1391
+.define K1392 = 1392
+.define K1393 = 1393
+.define K1394 = 1394
+.define K1395 = 1395
+.define K1396 = 1396
+.define K1397 = 1397
+.define K1398 = 1398
+.define K1399 = 1399
+.define K1400 = 1400
+.define K1401 = 1401
+.define K1402 = 1402
+.define K1403 = 1403
+.define K1404 = 1404
+.define K1405 = 1405
+.define K1406 = 1406
+.define K1407 = 1407
+.define K1408 = 1408
+.define K1409 = 1409
+.define K1410 = 1410
+.define K1411 = 1411
+.define K1412 = 1412
+.define K1413 = 1413
+.define K1414 = 1414
+.define K1415 = 1415
+.define K1416 = 1416
+.define K1417 = 1417
+.define K1418 = 1418
+.define K1419 = 1419
+.define K1420 = 1420
+.define K1421 = 1421
+.define K1422 = 1422
+.define K1423 = 1423
+.define K1424 = 1424
+.define K1425 = 1425
+.define K1426 = 1426
+.define K1427 = 1427
+.define K1428 = 1428
+.define K1429 = 1429
+.define K1430 = 1430
+.define K1431 = 1431
+.define K1432 = 1432
+.define K1433 = 1433
+.define K1434 = 1434
+.define K1435 = 1435
+.define K1436 = 1436
+.define K1437 = 1437
+.define K1438 = 1438
+.define K1439 = 1439
+.define K1440 = 1440
+.define K1441 = 1441
+.define K1442 = 1442
+.define K1443 = 1443
+.define K1444 = 1444
+.define K1445 = 1445
+.define K1446 = 1446
+.define K1447 = 1447
+.define K1448 = 1448
+.define K1449 = 1449
+.define K1450 = 1450
+.define K1451 = 1451
+.define K1452 = 1452
+.define K1453 = 1453
+.define K1454 = 1454
+.define K1455 = 1455
+.define K1456 = 1456
+.define K1457 = 1457
+.define K1458 = 1458
+.define K1459 = 1459
+.define K1460 = 1460
+.define K1461 = 1461
+.define K1462 = 1462
+.define K1463 = 1463
+.define K1464 = 1464
+.define K1465 = 1465
+.define K1466 = 1466
+.define K1467 = 1467
+.define K1468 = 1468
+.define K1469 = 1469
+.define K1470 = 1470
+.define K1471 = 1471
+.define K1472 = 1472
+.define K1473 = 1473
+.define K1474 = 1474
+.define K1475 = 1475
+.define K1476 = 1476
+.define K1477 = 1477
+.define K1478 = 1478
+.define K1479 = 1479
+.define K1480 = 1480
+.define K1481 = 1481
+.define K1482 = 1482
+.define K1483 = 1483
+.define K1484 = 1484
+.define K1485 = 1485
+.define K1486 = 1486
+.define K1487 = 1487
+.define K1488 = 1488
+.define K1489 = 1489
+.define K1490 = 1490
+.define K1491 = 1491
+.define K1492 = 1492
+.define K1493 = 1493
+.define K1494 = 1494
+.define K1495 = 1495
+.define K1496 = 1496
+.define K1497 = 1497
+.define K1498 = 1498
+.define K1499 = 1499
+.define K1500 = 1500
+.define K1501 = 1501
+.define K1502 = 1502
+.define K1503 = 1503
+.define K1504 = 1504
+.define K1505 = 1505
+.define K1506 = 1506
+.define K1507 = 1507
+.define K1508 = 1508
+.define K1509 = 1509
+.define K1510 = 1510
+.define K1511 = 1511
+.define K1512 = 1512
+.define K1513 = 1513
+.define K1514 = 1514
+.define K1515 = 1515
+.define K1516 = 1516
+.define K1517 = 1517
+.define K1518 = 1518
+.define K1519 = 1519
+.define K1520 = 1520
+.define K1521 = 1521
+.define K1522 = 1522
+.define K1523 = 1523
+.define K1524 = 1524
+.define K1525 = 1525
+.define K1526 = 1526
+.define K1527 = 1527
+.define K1528 = 1528
+.define K1529 = 1529
+.define K1530 = 1530
+.define K1531 = 1531
+.define K1532 = 1532
+.define K1533 = 1533
+.define K1534 = 1534
+.define K1535 = 1535
+.define K1536 = 1536
+.define K1537 = 1537
+.define K1538 = 1538
+.define K1539 = 1539
+.define K1540 = 1540
+.define K1541 = 1541
+.define K1542 = 1542
+.define K1543 = 1543
+.define K1544 = 1544
+.define K1545 = 1545
+.define K1546 = 1546
+.define K1547 = 1547
+.define K1548 = 1548
+.define K1549 = 1549
+.define K1550 = 1550
+.define K1551 = 1551
+.define K1552 = 1552
+.define K1553 = 1553
+.define K1554 = 1554
+.define K1555 = 1555
+.define K1556 = 1556
+.define K1557 = 1557
+.define K1558 = 1558
+.define K1559 = 1559
+.define K1560 = 1560
+.define K1561 = 1561
+.define K1562 = 1562
+.define K1563 = 1563
+.define K1564 = 1564
+.define K1565 = 1565
+.define K1566 = 1566
+.define K1567 = 1567
+.define K1568 = 1568
+.define K1569 = 1569
+.define K1570 = 1570
+.define K1571 = 1571
+.define K1572 = 1572
+.define K1573 = 1573
+.define K1574 = 1574
+.define K1575 = 1575
+.define K1576 = 1576
+.define K1577 = 1577
+.define K1578 = 1578
+.define K1579 = 1579
+.define K1580 = 1580
+.define K1581 = 1581
+.define K1582 = 1582
+.define K1583 = 1583
+.define K1584 = 1584
+.define K1585 = 1585
+.define K1586 = 1586
+.define K1587 = 1587
+.define K1588 = 1588
+.define K1589 = 1589
+.define K1590 = 1590
+.define K1591 = 1591
+.define K1592 = 1592
+.define K1593 = 1593
+.define K1594 = 1594
+.define K1595 = 1595
+.define K1596 = 1596
+.define K1597 = 1597
+.define K1598 = 1598
+.define K1599 = 1599
+.define K1600 = 1600
+.define K1601 = 1601
+.define K1602 = 1602
+.define K1603 = 1603
+.define K1604 = 1604
+.define K1605 = 1605
+.define K1606 = 1606
+.define K1607 = 1607
+.define K1608 = 1608
+.define K1609 = 1609
+.define K1610 = 1610
+.define K1611 = 1611
+.define K1612 = 1612
+.define K1613 = 1613
+.define K1614 = 1614
+.define K1615 = 1615
+.define K1616 = 1616
+.define K1617 = 1617
+.define K1618 = 1618
+.define K1619 = 1619
+.define K1620 = 1620
+.define K1621 = 1621
+.define K1622 = 1622
+.define K1623 = 1623
+.define K1624 = 1624
+.define K1625 = 1625
+.define K1626 = 1626
+.define K1627 = 1627
+.define K1628 = 1628
+.define K1629 = 1629
+.define K1630 = 1630
+.define K1631 = 1631
+.define K1632 = 1632
+.define K1633 = 1633
+.define K1634 = 1634
+.define K1635 = 1635
+.define K1636 = 1636
+.define K1637 = 1637
+.define K1638 = 1638
+.define K1639 = 1639
+.define K1640 = 1640
+.define K1641 = 1641
+.define K1642 = 1642
+.define K1643 = 1643
+.define K1644 = 1644
+.define K1645 = 1645
+.define K1646 = 1646
+.define K1647 = 1647
+.define K1648 = 1648
+.define K1649 = 1649
+.define K1650 = 1650
+.define K1651 = 1651
+.define K1652 = 1652
+.define K1653 = 1653
+.define K1654 = 1654
+.define K1655 = 1655
+.define K1656 = 1656
+.define K1657 = 1657
+.define K1658 = 1658
+.define K1659 = 1659
+.define K1660 = 1660
+.define K1661 = 1661
+.define K1662 = 1662
+.define K1663 = 1663
+.define K1664 = 1664
+.define K1665 = 1665
+.define K1666 = 1666
+.define K1667 = 1667
+.define K1668 = 1668
+.define K1669 = 1669
+.define K1670 = 1670
+.define K1671 = 1671
+.define K1672 = 1672
+.define K1673 = 1673
+.define K1674 = 1674
+.define K1675 = 1675
+.define K1676 = 1676
+.define K1677 = 1677
+.define K1678 = 1678
+.define K1679 = 1679
+.define K1680 = 1680
+.define K1681 = 1681
+.define K1682 = 1682
+.define K1683 = 1683
+.define K1684 = 1684
+.define K1685 = 1685
+.define K1686 = 1686
+.define K1687 = 1687
+.define K1688 = 1688
+.define K1689 = 1689
+.define K1690 = 1690
+.define K1691 = 1691
+.define K1692 = 1692
+.define K1693 = 1693
+.define K1694 = 1694
+.define K1695 = 1695
+.define K1696 = 1696
+.define K1697 = 1697
+.define K1698 = 1698
+.define K1699 = 1699
+.define K1700 = 1700
+.define K1701 = 1701
+.define K1702 = 1702
+.define K1703 = 1703
+.define K1704 = 1704
+.define K1705 = 1705
+.define K1706 = 1706
+.define K1707 = 1707
+.define K1708 = 1708
+.define K1709 = 1709
+.define K1710 = 1710
+.define K1711 = 1711
+.define K1712 = 1712
+.define K1713 = 1713
+.define K1714 = 1714
+.define K1715 = 1715
+.define K1716 = 1716
+.define K1717 = 1717
+.define K1718 = 1718
+.define K1719 = 1719
+.define K1720 = 1720
+.define K1721 = 1721
+.define K1722 = 1722
+.define K1723 = 1723
+.define K1724 = 1724
+.define K1725 = 1725
+.define K1726 = 1726
+.define K1727 = 1727
+.define K1728 = 1728
+.define K1729 = 1729
+.define K1730 = 1730
+.define K1731 = 1731
+.define K1732 = 1732
+.define K1733 = 1733
+.define K1734 = 1734
+.define K1735 = 1735
+.define K1736 = 1736
+.define K1737 = 1737
+.define K1738 = 1738
+.define K1739 = 1739
+.define K1740 = 1740
+.define K1741 = 1741
+.define K1742 = 1742
+.define K1743 = 1743
+.define K1744 = 1744
+.define K1745 = 1745
+.define K1746 = 1746
+.define K1747 = 1747
+.define K1748 = 1748
+.define K1749 = 1749
+.define K1750 = 1750
+.define K1751 = 1751
+.define K1752 = 1752
+.define K1753 = 1753
+.define K1754 = 1754
+.define K1755 = 1755
+.define K1756 = 1756
+.define K1757 = 1757
+.define K1758 = 1758
+.define K1759 = 1759
+.define K1760 = 1760
+.define K1761 = 1761
+.define K1762 = 1762
+.define K1763 = 1763
+.define K1764 = 1764
+.define K1765 = 1765
+.define K1766 = 1766
+.define K1767 = 1767
+.define K1768 = 1768
+.define K1769 = 1769
+.define K1770 = 1770
+.define K1771 = 1771
+.define K1772 = 1772
+.define K1773 = 1773
+.define K1774 = 1774
+.define K1775 = 1775
+.define K1776 = 1776
+.define K1777 = 1777
+.define K1778 = 1778
+.define K1779 = 1779
+.define K1780 = 1780
+.define K1781 = 1781
+.define K1782 = 1782
+.define K1783 = 1783
+.define K1784 = 1784
+.define K1785 = 1785
+.define K1786 = 1786
+.define K1787 = 1787
+.define K1788 = 1788
+.define K1789 = 1789
+.define K1790 = 1790
+.define K1791 = 1791
+.define K1792 = 1792
+.define K1793 = 1793
+.define K1794 = 1794
+.define K1795 = 1795
+.define K1796 = 1796
+.define K1797 = 1797
+.define K1798 = 1798
+.define K1799 = 1799
+.define K1800 = 1800
+.define K1801 = 1801
+.define K1802 = 1802
+.define K1803 = 1803
+.define K1804 = 1804
+.define K1805 = 1805
+.define K1806 = 1806
+.define K1807 = 1807
+.define K1808 = 1808
+.define K1809 = 1809
+.define K1810 = 1810
+.define K1811 = 1811
+.define K1812 = 1812
+.define K1813 = 1813
+.define K1814 = 1814
+.define K1815 = 1815
+.define K1816 = 1816
+.define K1817 = 1817
+.define K1818 = 1818
+.define K1819 = 1819
+.define K1820 = 1820
+.define K1821 = 1821
+.define K1822 = 1822
+.define K1823 = 1823
+.define K1824 = 1824
+.define K1825 = 1825
+.define K1826 = 1826
+.define K1827 = 1827
+.define K1828 = 1828
+.define K1829 = 1829
+.define K1830 = 1830
+.define K1831 = 1831
+.define K1832 = 1832
+.define K1833 = 1833
+.define K1834 = 1834
+.define K1835 = 1835
+.define K1836 = 1836
+.define K1837 = 1837
+.define K1838 = 1838
+.define K1839 = 1839
+.define K1840 = 1840
+.define K1841 = 1841
+.define K1842 = 1842
+.define K1843 = 1843
+.define K1844 = 1844
+.define K1845 = 1845
+.define K1846 = 1846
+.define K1847 = 1847
+.define K1848 = 1848
+.define K1849 = 1849
+.define K1850 = 1850
+.define K1851 = 1851
+.define K1852 = 1852
+.define K1853 = 1853
+.define K1854 = 1854
+.define K1855 = 1855
+.define K1856 = 1856
+.define K1857 = 1857
+.define K1858 = 1858
+.define K1859 = 1859
+.define K1860 = 1860
+.define K1861 = 1861
+.define K1862 = 1862
+.define K1863 = 1863
+.define K1864 = 1864
+.define K1865 = 1865
+.define K1866 = 1866
+.define K1867 = 1867
+.define K1868 = 1868
+.define K1869 = 1869
+.define K1870 = 1870
+.define K1871 = 1871
+.define K1872 = 1872
+.define K1873 = 1873
+.define K1874 = 1874
+.define K1875 = 1875
+.define K1876 = 1876
+.define K1877 = 1877
+.define K1878 = 1878
+.define K1879 = 1879
+.define K1880 = 1880
+.define K1881 = 1881
+.define K1882 = 1882
+.define K1883 = 1883
+.define K1884 = 1884
+.define K1885 = 1885
+.define K1886 = 1886
+.define K1887 = 1887
+.define K1888 = 1888
+.define K1889 = 1889
+.define K1890 = 1890
+.define K1891 = 1891
+.define K1892 = 1892
+.define K1893 = 1893
+.define K1894 = 1894
+.define K1895 = 1895
+.define K1896 = 1896
+.define K1897 = 1897
+.define K1898 = 1898
+.define K1899 = 1899
+.define K1900 = 1900
+.define K1901 = 1901
+.define K1902 = 1902
+.define K1903 = 1903
+.define K1904 = 1904
+.define K1905 = 1905
+.define K1906 = 1906
+.define K1907 = 1907
+.define K1908 = 1908
+.define K1909 = 1909
+.define K1910 = 1910
+.define K1911 = 1911
+.define K1912 = 1912
+.define K1913 = 1913
+.define K1914 = 1914
+.define K1915 = 1915
+.define K1916 = 1916
+.define K1917 = 1917
+.define K1918 = 1918
+.define K1919 = 1919
+.define K1920 = 1920
+.define K1921 = 1921
+.define K1922 = 1922
+.define K1923 = 1923
+.define K1924 = 1924
+.define K1925 = 1925
+.define K1926 = 1926
+.define K1927 = 1927
+.define K1928 = 1928
+.define K1929 = 1929
+.define K1930 = 1930
+.define K1931 = 1931
+.define K1932 = 1932
+.define K1933 = 1933
+.define K1934 = 1934
+.define K1935 = 1935
+.define K1936 = 1936
+.define K1937 = 1937
+.define K1938 = 1938
+.define K1939 = 1939
+.define K1940 = 1940
+.define K1941 = 1941
+.define K1942 = 1942
+.define K1943 = 1943
+.define K1944 = 1944
+.define K1945 = 1945
+.define K1946 = 1946
+.define K1947 = 1947
+.define K1948 = 1948
+.define K1949 = 1949
+.define K1950 = 1950
+.define K1951 = 1951
+.define K1952 = 1952
+.define K1953 = 1953
+.define K1954 = 1954
+.define K1955 = 1955
+.define K1956 = 1956
+.define K1957 = 1957
+.define K1958 = 1958
+.define K1959 = 1959
+.define K1960 = 1960
+.define K1961 = 1961
+.define K1962 = 1962
+.define K1963 = 1963
+.define K1964 = 1964
+.define K1965 = 1965
+.define K1966 = 1966
+.define K1967 = 1967
+.define K1968 = 1968
+.define K1969 = 1969
+.define K1970 = 1970
+.define K1971 = 1971
+.define K1972 = 1972
+.define K1973 = 1973
+.define K1974 = 1974
+.define K1975 = 1975
+.define K1976 = 1976
+.define K1977 = 1977
+.define K1978 = 1978
+.define K1979 = 1979
+.define K1980 = 1980
+.define K1981 = 1981
+.define K1982 = 1982
+.define K1983 = 1983
+.define K1984 = 1984
+.define K1985 = 1985
+.define K1986 = 1986
+.define K1987 = 1987
+.define K1988 = 1988
+.define K1989 = 1989
+.define K1990 = 1990
+.define K1991 = 1991
+.define K1992 = 1992
+.define K1993 = 1993
+.define K1994 = 1994
+.define K1995 = 1995
+.define K1996 = 1996
+.define K1997 = 1997
+.define K1998 = 1998
+.define K1999 = 1999
+.define K2000 = 2000
+.define K2001 = 2001
+.define K2002 = 2002
+.define K2003 = 2003
+.define K2004 = 2004
+.define K2005 = 2005
+.define K2006 = 2006
+.define K2007 = 2007
+.define K2008 = 2008
+.define K2009 = 2009
+.define K2010 = 2010
+.define K2011 = 2011
+.define K2012 = 2012
+.define K2013 = 2013
+.define K2014 = 2014
+.define K2015 = 2015
+.define K2016 = 2016
+.define K2017 = 2017
+.define K2018 = 2018
+.define K2019 = 2019
+.define K2020 = 2020
+.define K2021 = 2021
+.define K2022 = 2022
+.define K2023 = 2023
+.define K2024 = 2024
+.define K2025 = 2025
+.define K2026 = 2026
+.define K2027 = 2027
+.define K2028 = 2028
+.define K2029 = 2029
+.define K2030 = 2030
+.define K2031 = 2031
+.define K2032 = 2032
+.define K2033 = 2033
+.define K2034 = 2034
+.define K2035 = 2035
+.define K2036 = 2036
+.define K2037 = 2037
+.define K2038 = 2038
+.define K2039 = 2039
+.define K2040 = 2040
+.define K2041 = 2041
+.define K2042 = 2042
+.define K2043 = 2043
+.define K2044 = 2044
+.define K2045 = 2045
+.define K2046 = 2046
+.define K2047 = 2047
+.define K2048 = 2048
+.define K2049 = 2049
+.define K2050 = 2050
+.define K2051 = 2051
+.define K2052 = 2052
+.define K2053 = 2053
+.define K2054 = 2054
+.define K2055 = 2055
+.define K2056 = 2056
+.define K2057 = 2057
+.define K2058 = 2058
+.define K2059 = 2059
+.define K2060 = 2060
+.define K2061 = 2061
+.define K2062 = 2062
+.define K2063 = 2063
+.define K2064 = 2064
+.define K2065 = 2065
+.define K2066 = 2066
+.define K2067 = 2067
+.define K2068 = 2068
+.define K2069 = 2069
+.define K2070 = 2070
+.define K2071 = 2071
+.define K2072 = 2072
+.define K2073 = 2073
+.define K2074 = 2074
+.define K2075 = 2075
+.define K2076 = 2076
+.define K2077 = 2077
+.define K2078 = 2078
+.define K2079 = 2079
+.define K2080 = 2080
+.define K2081 = 2081
+.define K2082 = 2082
+.define K2083 = 2083
+.define K2084 = 2084
+.define K2085 = 2085
+.define K2086 = 2086
+.define K2087 = 2087
+.define K2088 = 2088
+.define K2089 = 2089
+.define K2090 = 2090
+.define K2091 = 2091
+.define K2092 = 2092
+.define K2093 = 2093
+.define K2094 = 2094
+.define K2095 = 2095
+.define K2096 = 2096
+.define K2097 = 2097
+.define K2098 = 2098
+.define K2099 = 2099
+.define K2100 = 2100
+.define K2101 = 2101
+.define K2102 = 2102
+.define K2103 = 2103
+.define K2104 = 2104
+.define K2105 = 2105
+.define K2106 = 2106
+.define K2107 = 2107
+.define K2108 = 2108
+.define K2109 = 2109
+.define K2110 = 2110
+.define K2111 = 2111
+.define K2112 = 2112
+.define K2113 = 2113
+.define K2114 = 2114
+.define K2115 = 2115
+.define K2116 = 2116
+.define K2117 = 2117
+.define K2118 = 2118
+.define K2119 = 2119
+.define K2120 = 2120
+.define K2121 = 2121
+.define K2122 = 2122
+.define K2123 = 2123
+.define K2124 = 2124
+.define K2125 = 2125
+.define K2126 = 2126
+.define K2127 = 2127
+.define K2128 = 2128
+.define K2129 = 2129
+.define K2130 = 2130
+.define K2131 = 2131
+.define K2132 = 2132
+.define K2133 = 2133
+.define K2134 = 2134
+.define K2135 = 2135
+.define K2136 = 2136
+.define K2137 = 2137
+.define K2138 = 2138
+.define K2139 = 2139
+.define K2140 = 2140
+.define K2141 = 2141
+.define K2142 = 2142
+.define K2143 = 2143
+.define K2144 = 2144
+.define K2145 = 2145
+.define K2146 = 2146
+.define K2147 = 2147
+.define K2148 = 2148
+.define K2149 = 2149
+.define K2150 = 2150
+.define K2151 = 2151
+.define K2152 = 2152
+.define K2153 = 2153
+.define K2154 = 2154
+.define K2155 = 2155
+.define K2156 = 2156
+.define K2157 = 2157
+.define K2158 = 2158
+.define K2159 = 2159
+.define K2160 = 2160
+.define K2161 = 2161
+.define K2162 = 2162
+.define K2163 = 2163
+.define K2164 = 2164
+.define K2165 = 2165
+.define K2166 = 2166
+.define K2167 = 2167
+.define K2168 = 2168
+.define K2169 = 2169
+.define K2170 = 2170
+.define K2171 = 2171
+.define K2172 = 2172
+.define K2173 = 2173
+.define K2174 = 2174
+.define K2175 = 2175
+.define K2176 = 2176
+.define K2177 = 2177
+.define K2178 = 2178
+.define K2179 = 2179
+.define K2180 = 2180
+.define K2181 = 2181
+.define K2182 = 2182
+.define K2183 = 2183
+.define K2184 = 2184
+.define K2185 = 2185
+.define K2186 = 2186
+.define K2187 = 2187
+.define K2188 = 2188
+.define K2189 = 2189
+.define K2190 = 2190
+.define K2191 = 2191
+.define K2192 = 2192
+.define K2193 = 2193
+.define K2194 = 2194
+.define K2195 = 2195
+.define K2196 = 2196
+.define K2197 = 2197
+.define K2198 = 2198
+.define K2199 = 2199
+.define K2200 = 2200
+.define K2201 = 2201
+.define K2202 = 2202
+.define K2203 = 2203
+.define K2204 = 2204
+.define K2205 = 2205
+.define K2206 = 2206
+.define K2207 = 2207
+.define K2208 = 2208
+.define K2209 = 2209
+.define K2210 = 2210
+.define K2211 = 2211
+.define K2212 = 2212
+.define K2213 = 2213
+.define K2214 = 2214
+.define K2215 = 2215
+.define K2216 = 2216
+.define K2217 = 2217
+.define K2218 = 2218
+.define K2219 = 2219
+.define K2220 = 2220
+.define K2221 = 2221
+.define K2222 = 2222
+.define K2223 = 2223
+.define K2224 = 2224
+.define K2225 = 2225
+.define K2226 = 2226
+.define K2227 = 2227
+.define K2228 = 2228
+.define K2229 = 2229
+.define K2230 = 2230
+.define K2231 = 2231
+.define K2232 = 2232
+.define K2233 = 2233
+.define K2234 = 2234
+.define K2235 = 2235
+.define K2236 = 2236
+.define K2237 = 2237
+.define K2238 = 2238
+.define K2239 = 2239
+.define K2240 = 2240
+.define K2241 = 2241
+.define K2242 = 2242
+.define K2243 = 2243
+.define K2244 = 2244
+.define K2245 = 2245
+.define K2246 = 2246
+.define K2247 = 2247
+.define K2248 = 2248
+.define K2249 = 2249
+.define K2250 = 2250
+.define K2251 = 2251
+.define K2252 = 2252
+.define K2253 = 2253
+.define K2254 = 2254
+.define K2255 = 2255
+.define K2256 = 2256
+.define K2257 = 2257
+.define K2258 = 2258
+.define K2259 = 2259
+.define K2260 = 2260
+.define K2261 = 2261
+.define K2262 = 2262
+.define K2263 = 2263
+.define K2264 = 2264
+.define K2265 = 2265
+.define K2266 = 2266
+.define K2267 = 2267
+.define K2268 = 2268
+.define K2269 = 2269
+.define K2270 = 2270
+.define K2271 = 2271
+.define K2272 = 2272
+.define K2273 = 2273
+.define K2274 = 2274
+.define K2275 = 2275
+.define K2276 = 2276
+.define K2277 = 2277
+.define K2278 = 2278
+.define K2279 = 2279
+.define K2280 = 2280
+.define K2281 = 2281
+.define K2282 = 2282
+.define K2283 = 2283
+.define K2284 = 2284
+.define K2285 = 2285
+.define K2286 = 2286
+.define K2287 = 2287
+.define K2288 = 2288
+.define K2289 = 2289
+.define K2290 = 2290
+.define K2291 = 2291
+.define K2292 = 2292
+.define K2293 = 2293
+.define K2294 = 2294
+.define K2295 = 2295
+.define K2296 = 2296
+.define K2297 = 2297
+.define K2298 = 2298
+.define K2299 = 2299
+.define K2300 = 2300
+.define K2301 = 2301
+.define K2302 = 2302
+.define K2303 = 2303
+.define K2304 = 2304
+.define K2305 = 2305
+.define K2306 = 2306
+.define K2307 = 2307
+.define K2308 = 2308
+.define K2309 = 2309
+.define K2310 = 2310
+.define K2311 = 2311
+.define K2312 = 2312
+.define K2313 = 2313
+.define K2314 = 2314
+.define K2315 = 2315
+.define K2316 = 2316
+.define K2317 = 2317
+.define K2318 = 2318
+.define K2319 = 2319
+.define K2320 = 2320
+.define K2321 = 2321
+.define K2322 = 2322
+.define K2323 = 2323
+.define K2324 = 2324
+.define K2325 = 2325
+.define K2326 = 2326
+.define K2327 = 2327
+.define K2328 = 2328
+.define K2329 = 2329
+.define K2330 = 2330
+.define K2331 = 2331
+.define K2332 = 2332
+.define K2333 = 2333
+.define K2334 = 2334
+.define K2335 = 2335
+.define K2336 = 2336
+.define K2337 = 2337
+.define K2338 = 2338
+.define K2339 = 2339
+.define K2340 = 2340
+.define K2341 = 2341
+.define K2342 = 2342
+.define K2343 = 2343
+.define K2344 = 2344
+.define K2345 = 2345
+.define K2346 = 2346
+.define K2347 = 2347
+.define K2348 = 2348
+.define K2349 = 2349
+.define K2350 = 2350
+.define K2351 = 2351
+.define K2352 = 2352
+.define K2353 = 2353
+.define K2354 = 2354
+.define K2355 = 2355
+.define K2356 = 2356
+.define K2357 = 2357
+.define K2358 = 2358
+.define K2359 = 2359
+.define K2360 = 2360
+.define K2361 = 2361
+.define K2362 = 2362
+.define K2363 = 2363
+.define K2364 = 2364
+.define K2365 = 2365
+.define K2366 = 2366
+.define K2367 = 2367
+.define K2368 = 2368
+.define K2369 = 2369
+.define K2370 = 2370
+.define K2371 = 2371
+.define K2372 = 2372
+.define K2373 = 2373
+.define K2374 = 2374
+.define K2375 = 2375
+.define K2376 = 2376
+.define K2377 = 2377
+.define K2378 = 2378
+.define K2379 = 2379
+.define K2380 = 2380
+.define K2381 = 2381
+.define K2382 = 2382
+.define K2383 = 2383
+.define K2384 = 2384
+.define K2385 = 2385
+.define K2386 = 2386
+.define K2387 = 2387
+.define K2388 = 2388
+.define K2389 = 2389
+.define K2390 = 2390
+.define K2391 = 2391
+.define K2392 = 2392
+.define K2393 = 2393
+.define K2394 = 2394
+.define K2395 = 2395
+.define K2396 = 2396
+.define K2397 = 2397
+.define K2398 = 2398
+.define K2399 = 2399
+.define K2400 = 2400
+.define K2401 = 2401
+.define K2402 = 2402
+.define K2403 = 2403
+.define K2404 = 2404
+.define K2405 = 2405
+.define K2406 = 2406
+.define K2407 = 2407
+.define K2408 = 2408
+.define K2409 = 2409
+.define K2410 = 2410
+.define K2411 = 2411
+.define K2412 = 2412
+.define K2413 = 2413
+.define K2414 = 2414
+.define K2415 = 2415
+.define K2416 = 2416
+.define K2417 = 2417
+.define K2418 = 2418
+.define K2419 = 2419
+.define K2420 = 2420
+.define K2421 = 2421
+.define K2422 = 2422
+.define K2423 = 2423
+.define K2424 = 2424
+.define K2425 = 2425
+.define K2426 = 2426
+.define K2427 = 2427
+.define K2428 = 2428
+.define K2429 = 2429
+.define K2430 = 2430
+.define K2431 = 2431
+.define K2432 = 2432
+.define K2433 = 2433
+.define K2434 = 2434
+.define K2435 = 2435
+.define K2436 = 2436
+.define K2437 = 2437
+.define K2438 = 2438
+.define K2439 = 2439
+.define K2440 = 2440
+.define K2441 = 2441
+.define K2442 = 2442
+.define K2443 = 2443
+.define K2444 = 2444
+.define K2445 = 2445
+.define K2446 = 2446
+.define K2447 = 2447
+.define K2448 = 2448
+.define K2449 = 2449
+.define K2450 = 2450
+.define K2451 = 2451
+.define K2452 = 2452
+.define K2453 = 2453
+.define K2454 = 2454
+.define K2455 = 2455
+.define K2456 = 2456
+.define K2457 = 2457
+.define K2458 = 2458
+.define K2459 = 2459
+.define K2460 = 2460
+.define K2461 = 2461
+.define K2462 = 2462
+.define K2463 = 2463
+.define K2464 = 2464
+.define K2465 = 2465
+.define K2466 = 2466
+.define K2467 = 2467
+.define K2468 = 2468
+.define K2469 = 2469
+.define K2470 = 2470
+.define K2471 = 2471
+.define K2472 = 2472
+.define K2473 = 2473
+.define K2474 = 2474
+.define K2475 = 2475
+.define K2476 = 2476
+.define K2477 = 2477
+.define K2478 = 2478
+.define K2479 = 2479
+.define K2480 = 2480
+.define K2481 = 2481
+.define K2482 = 2482
+.define K2483 = 2483
+.define K2484 = 2484
+.define K2485 = 2485
+.define K2486 = 2486
+.define K2487 = 2487
+.define K2488 = 2488
+.define K2489 = 2489
+.define K2490 = 2490
+.define K2491 = 2491
+.define K2492 = 2492
+.define K2493 = 2493
+.define K2494 = 2494
+.define K2495 = 2495
+.define K2496 = 2496
+.define K2497 = 2497
+.define K2498 = 2498
+.define K2499 = 2499
+.define K2500 = 2500
+.define K2501 = 2501
+.define K2502 = 2502
+.define K2503 = 2503
+.define K2504 = 2504
+.define K2505 = 2505
+.define K2506 = 2506
+.define K2507 = 2507
+.define K2508 = 2508
+.define K2509 = 2509
+.define K2510 = 2510
+.define K2511 = 2511
+.define K2512 = 2512
+.define K2513 = 2513
+.define K2514 = 2514
+.define K2515 = 2515
+.define K2516 = 2516
+.define K2517 = 2517
+.define K2518 = 2518
+.define K2519 = 2519
+.define K2520 = 2520
+.define K2521 = 2521
+.define K2522 = 2522
+.define K2523 = 2523
+.define K2524 = 2524
+.define K2525 = 2525
+.define K2526 = 2526
+.define K2527 = 2527
+.define K2528 = 2528
+.define K2529 = 2529
+.define K2530 = 2530
+.define K2531 = 2531
+.define K2532 = 2532
+.define K2533 = 2533
+.define K2534 = 2534
+.define K2535 = 2535
+.define K2536 = 2536
+.define K2537 = 2537
+.define K2538 = 2538
+.define K2539 = 2539
+.define K2540 = 2540
+.define K2541 = 2541
+.define K2542 = 2542
+.define K2543 = 2543
+.define K2544 = 2544
+.define K2545 = 2545
+.define K2546 = 2546
+.define K2547 = 2547
+.define K2548 = 2548
+.define K2549 = 2549
+.define K2550 = 2550
+.define K2551 = 2551
+.define K2552 = 2552
+.define K2553 = 2553
+.define K2554 = 2554
+.define K2555 = 2555
+.define K2556 = 2556
+.define K2557 = 2557
+.define K2558 = 2558
+.define K2559 = 2559
+.define K2560 = 2560
+.define K2561 = 2561
+.define K2562 = 2562
+.define K2563 = 2563
+.define K2564 = 2564
+.define K2565 = 2565
+.define K2566 = 2566
+.define K2567 = 2567
+.define K2568 = 2568
+.define K2569 = 2569
+.define K2570 = 2570
+.define K2571 = 2571
+.define K2572 = 2572
+.define K2573 = 2573
+.define K2574 = 2574
+.define K2575 = 2575
+.define K2576 = 2576
+.define K2577 = 2577
+.define K2578 = 2578
+.define K2579 = 2579
+.define K2580 = 2580
+.define K2581 = 2581
+.define K2582 = 2582
+.define K2583 = 2583
+.define K2584 = 2584
+.define K2585 = 2585
+.define K2586 = 2586
+.define K2587 = 2587
+.define K2588 = 2588
+.define K2589 = 2589
+.define K2590 = 2590
+.define K2591 = 2591
+.define K2592 = 2592
+.define K2593 = 2593
+.define K2594 = 2594
+.define K2595 = 2595
+.define K2596 = 2596
+.define K2597 = 2597
+.define K2598 = 2598
+.define K2599 = 2599
+.define K2600 = 2600
+.define K2601 = 2601
+.define K2602 = 2602
+.define K2603 = 2603
+.define K2604 = 2604
+.define K2605 = 2605
+.define K2606 = 2606
+.define K2607 = 2607
+.define K2608 = 2608
+.define K2609 = 2609
+.define K2610 = 2610
+.define K2611 = 2611
+.define K2612 = 2612
+.define K2613 = 2613
+.define K2614 = 2614
+.define K2615 = 2615
+.define K2616 = 2616
+.define K2617 = 2617
+.define K2618 = 2618
+.define K2619 = 2619
+.define K2620 = 2620
+.define K2621 = 2621
+.define K2622 = 2622
+.define K2623 = 2623
+.define K2624 = 2624
+.define K2625 = 2625
+.define K2626 = 2626
+.define K2627 = 2627
+.define K2628 = 2628
+.define K2629 = 2629
+.define K2630 = 2630
+.define K2631 = 2631
+.define K2632 = 2632
+.define K2633 = 2633
+.define K2634 = 2634
+.define K2635 = 2635
+.define K2636 = 2636
+.define K2637 = 2637
+.define K2638 = 2638
+.define K2639 = 2639
+.define K2640 = 2640
+.define K2641 = 2641
+.define K2642 = 2642
+.define K2643 = 2643
+.define K2644 = 2644
+.define K2645 = 2645
+.define K2646 = 2646
+.define K2647 = 2647
+.define K2648 = 2648
+.define K2649 = 2649
+.define K2650 = 2650
+.define K2651 = 2651
+.define K2652 = 2652
+.define K2653 = 2653
+.define K2654 = 2654
+.define K2655 = 2655
+.define K2656 = 2656
+.define K2657 = 2657
+.define K2658 = 2658
+.define K2659 = 2659
+.define K2660 = 2660
+.define K2661 = 2661
+.define K2662 = 2662
+.define K2663 = 2663
+.define K2664 = 2664
+.define K2665 = 2665
+.define K2666 = 2666
+.define K2667 = 2667
+.define K2668 = 2668
+.define K2669 = 2669
+.define K2670 = 2670
+.define K2671 = 2671
+.define K2672 = 2672
+.define K2673 = 2673
+.define K2674 = 2674
+.define K2675 = 2675
+.define K2676 = 2676
+.define K2677 = 2677
+.define K2678 = 2678
+.define K2679 = 2679
+.define K2680 = 2680
+.define K2681 = 2681
+.define K2682 = 2682
+.define K2683 = 2683
+.define K2684 = 2684
+.define K2685 = 2685
+.define K2686 = 2686
+.define K2687 = 2687
+.define K2688 = 2688
+.define K2689 = 2689
+.define K2690 = 2690
+.define K2691 = 2691
+.define K2692 = 2692
+.define K2693 = 2693
+.define K2694 = 2694
+.define K2695 = 2695
+.define K2696 = 2696
+.define K2697 = 2697
+.define K2698 = 2698
+.define K2699 = 2699
+.define K2700 = 2700
+.define K2701 = 2701
+.define K2702 = 2702
+.define K2703 = 2703
+.define K2704 = 2704
+.define K2705 = 2705
+.define K2706 = 2706
+.define K2707 = 2707
+.define K2708 = 2708
+.define K2709 = 2709
+.define K2710 = 2710
+.define K2711 = 2711
+.define K2712 = 2712
+.define K2713 = 2713
+.define K2714 = 2714
+.define K2715 = 2715
+.define K2716 = 2716
+.define K2717 = 2717
+.define K2718 = 2718
+.define K2719 = 2719
+.define K2720 = 2720
+.define K2721 = 2721
+.define K2722 = 2722
+.define K2723 = 2723
+.define K2724 = 2724
+.define K2725 = 2725
+.define K2726 = 2726
+.define K2727 = 2727
+.define K2728 = 2728
+.define K2729 = 2729
+.define K2730 = 2730
+.define K2731 = 2731
+.define K2732 = 2732
+.define K2733 = 2733
+.define K2734 = 2734
+.define K2735 = 2735
+.define K2736 = 2736
+.define K2737 = 2737
+.define K2738 = 2738
+.define K2739 = 2739
+.define K2740 = 2740
+.define K2741 = 2741
+.define K2742 = 2742
+.define K2743 = 2743
+.define K2744 = 2744
+.define K2745 = 2745
+.define K2746 = 2746
+.define K2747 = 2747
+.define K2748 = 2748
+.define K2749 = 2749
+.define K2750 = 2750
+.define K2751 = 2751
+.define K2752 = 2752
+.define K2753 = 2753
+.define K2754 = 2754
+.define K2755 = 2755
+.define K2756 = 2756
+.define K2757 = 2757
+.define K2758 = 2758
+.define K2759 = 2759
+.define K2760 = 2760
+.define K2761 = 2761
+.define K2762 = 2762
+.define K2763 = 2763
+.define K2764 = 2764
+.define K2765 = 2765
+.define K2766 = 2766
+.define K2767 = 2767
+.define K2768 = 2768
+.define K2769 = 2769
+.define K2770 = 2770
+.define K2771 = 2771
+.define K2772 = 2772
+.define K2773 = 2773
+.define K2774 = 2774
+.define K2775 = 2775
+.define K2776 = 2776
+.define K2777 = 2777
+.define K2778 = 2778
+.define K2779 = 2779
+.define K2780 = 2780
+.define K2781 = 2781
+.define K2782 = 2782
+.define K2783 = 2783
+.define K2784 = 2784
+.define K2785 = 2785
+.define K2786 = 2786
+.define K2787 = 2787
+.define K2788 = 2788
+.define K2789 = 2789
+.define K2790 = 2790
+.define K2791 = 2791
+.define K2792 = 2792
+.define K2793 = 2793
+.define K2794 = 2794
+.define K2795 = 2795
+.define K2796 = 2796
+.define K2797 = 2797
+.define K2798 = 2798
+.define K2799 = 2799
+.define K2800 = 2800
+.define K2801 = 2801
+.define K2802 = 2802
+.define K2803 = 2803
+.define K2804 = 2804
+.define K2805 = 2805
+.define K2806 = 2806
+.define K2807 = 2807
+.define K2808 = 2808
+.define K2809 = 2809
+.define K2810 = 2810
+.define K2811 = 2811
+.define K2812 = 2812
+.define K2813 = 2813
+.define K2814 = 2814
+.define K2815 = 2815
+.define K2816 = 2816
+.define K2817 = 2817
+.define K2818 = 2818
+.define K2819 = 2819
+.define K2820 = 2820
+.define K2821 = 2821
+.define K2822 = 2822
+.define K2823 = 2823
+.define K2824 = 2824
+.define K2825 = 2825
+.define K2826 = 2826
+.define K2827 = 2827
+.define K2828 = 2828
+.define K2829 = 2829
+.define K2830 = 2830
+.define K2831 = 2831
+.define K2832 = 2832
+.define K2833 = 2833
+.define K2834 = 2834
+.define K2835 = 2835
+.define K2836 = 2836
+.define K2837 = 2837
+.define K2838 = 2838
+.define K2839 = 2839
+.define K2840 = 2840
+.define K2841 = 2841
+.define K2842 = 2842
+.define K2843 = 2843
+.define K2844 = 2844
+.define K2845 = 2845
+.define K2846 = 2846
+.define K2847 = 2847
+.define K2848 = 2848
+.define K2849 = 2849
+.define K2850 = 2850
+.define K2851 = 2851
+.define K2852 = 2852
+.define K2853 = 2853
+.define K2854 = 2854
+.define K2855 = 2855
+.define K2856 = 2856
+.define K2857 = 2857
+.define K2858 = 2858
+.define K2859 = 2859
+.define K2860 = 2860
+.define K2861 = 2861
+.define K2862 = 2862
+.define K2863 = 2863
+.define K2864 = 2864
+.define K2865 = 2865
+.define K2866 = 2866
+.define K2867 = 2867
+.define K2868 = 2868
+.define K2869 = 2869
+.define K2870 = 2870
+.define K2871 = 2871
+.define K2872 = 2872
+.define K2873 = 2873
+.define K2874 = 2874
+.define K2875 = 2875
+.define K2876 = 2876
+.define K2877 = 2877
+.define K2878 = 2878
+.define K2879 = 2879
+.define K2880 = 2880
+.define K2881 = 2881
+.define K2882 = 2882
+.define K2883 = 2883
+.define K2884 = 2884
+.define K2885 = 2885
+.define K2886 = 2886
+.define K2887 = 2887
+.define K2888 = 2888
+.define K2889 = 2889
+.define K2890 = 2890
+.define K2891 = 2891
+.define K2892 = 2892
+.define K2893 = 2893
+.define K2894 = 2894
+.define K2895 = 2895
+.define K2896 = 2896
+.define K2897 = 2897
+.define K2898 = 2898
+.define K2899 = 2899
+.define K2900 = 2900
+.define K2901 = 2901
+.define K2902 = 2902
+.define K2903 = 2903
+.define K2904 = 2904
+.define K2905 = 2905
+.define K2906 = 2906
+.define K2907 = 2907
+.define K2908 = 2908
+.define K2909 = 2909
+.define K2910 = 2910
+.define K2911 = 2911
+.define K2912 = 2912
+.define K2913 = 2913
+.define K2914 = 2914
+.define K2915 = 2915
+.define K2916 = 2916
+.define K2917 = 2917
+.define K2918 = 2918
+.define K2919 = 2919
+.define K2920 = 2920
+.define K2921 = 2921
+.define K2922 = 2922
+.define K2923 = 2923
+.define K2924 = 2924
+.define K2925 = 2925
+.define K2926 = 2926
+.define K2927 = 2927
+.define K2928 = 2928
+.define K2929 = 2929
+.define K2930 = 2930
+.define K2931 = 2931
+.define K2932 = 2932
+.define K2933 = 2933
+.define K2934 = 2934
+.define K2935 = 2935
+.define K2936 = 2936
+.define K2937 = 2937
+.define K2938 = 2938
+.define K2939 = 2939
+.define K2940 = 2940
+.define K2941 = 2941
+.define K2942 = 2942
+.define K2943 = 2943
+.define K2944 = 2944
+.define K2945 = 2945
+.define K2946 = 2946
+.define K2947 = 2947
+.define K2948 = 2948
+.define K2949 = 2949
+.define K2950 = 2950
+.define K2951 = 2951
+.define K2952 = 2952
+.define K2953 = 2953
+.define K2954 = 2954
+.define K2955 = 2955
+.define K2956 = 2956
+.define K2957 = 2957
+.define K2958 = 2958
+.define K2959 = 2959
+.define K2960 = 2960
+.define K2961 = 2961
+.define K2962 = 2962
+.define K2963 = 2963
+.define K2964 = 2964
+.define K2965 = 2965
+.define K2966 = 2966
+.define K2967 = 2967
+.define K2968 = 2968
+.define K2969 = 2969
+.define K2970 = 2970
+.define K2971 = 2971
+.define K2972 = 2972
+.define K2973 = 2973
+.define K2974 = 2974
+.define K2975 = 2975
+.define K2976 = 2976
+.define K2977 = 2977
+.define K2978 = 2978
+.define K2979 = 2979
+.define K2980 = 2980
+.define K2981 = 2981
+.define K2982 = 2982
+.define K2983 = 2983
+.define K2984 = 2984
+.define K2985 = 2985
+.define K2986 = 2986
+.define K2987 = 2987
+.define K2988 = 2988
+.define K2989 = 2989
+.define K2990 = 2990
+.define K2991 = 2991
+.define K2992 = 2992
+.define K2993 = 2993
+.define K2994 = 2994
+.define K2995 = 2995
+.define K2996 = 2996
+.define K2997 = 2997
+.define K2998 = 2998
+.define K2999 = 2999
+.define K3000 = 3000
+.define K3001 = 3001
+.define K3002 = 3002
+.define K3003 = 3003
+.define K3004 = 3004
+.define K3005 = 3005
+.define K3006 = 3006
+.define K3007 = 3007
+.define K3008 = 3008
+.define K3009 = 3009
+.define K3010 = 3010
+.define K3011 = 3011
+.define K3012 = 3012
+.define K3013 = 3013
+.define K3014 = 3014
+.define K3015 = 3015
+.define K3016 = 3016
+.define K3017 = 3017
+.define K3018 = 3018
+.define K3019 = 3019
+.define K3020 = 3020
+.define K3021 = 3021
+.define K3022 = 3022
+.define K3023 = 3023
+.define K3024 = 3024
+.define K3025 = 3025
+.define K3026 = 3026
+.define K3027 = 3027
+.define K3028 = 3028
+.define K3029 = 3029
+.define K3030 = 3030
+.define K3031 = 3031
+.define K3032 = 3032
+.define K3033 = 3033
+.define K3034 = 3034
+.define K3035 = 3035
+.define K3036 = 3036
+.define K3037 = 3037
+.define K3038 = 3038
+.define K3039 = 3039
+.define K3040 = 3040
+.define K3041 = 3041
+.define K3042 = 3042
+.define K3043 = 3043
+.define K3044 = 3044
+.define K3045 = 3045
+.define K3046 = 3046
+.define K3047 = 3047
+.define K3048 = 3048
+.define K3049 = 3049
+.define K3050 = 3050
+.define K3051 = 3051
+.define K3052 = 3052
+.define K3053 = 3053
+.define K3054 = 3054
+.define K3055 = 3055
+.define K3056 = 3056
+.define K3057 = 3057
+.define K3058 = 3058
+.define K3059 = 3059
+.define K3060 = 3060
+.define K3061 = 3061
+.define K3062 = 3062
+.define K3063 = 3063
+.define K3064 = 3064
+.define K3065 = 3065
+.define K3066 = 3066
+.define K3067 = 3067
+.define K3068 = 3068
+.define K3069 = 3069
+.define K3070 = 3070
+.define K3071 = 3071
+.define K3072 = 3072
+.define K3073 = 3073
+.define K3074 = 3074
+.define K3075 = 3075
+.define K3076 = 3076
+.define K3077 = 3077
+.define K3078 = 3078
+.define K3079 = 3079
+.define K3080 = 3080
+.define K3081 = 3081
+.define K3082 = 3082
+.define K3083 = 3083
+.define K3084 = 3084
+.define K3085 = 3085
+.define K3086 = 3086
+.define K3087 = 3087
+.define K3088 = 3088
+.define K3089 = 3089
+.define K3090 = 3090
+.define K3091 = 3091
+.define K3092 = 3092
+.define K3093 = 3093
+.define K3094 = 3094
+.define K3095 = 3095
+.define K3096 = 3096
+.define K3097 = 3097
+.define K3098 = 3098
+.define K3099 = 3099
+.define K3100 = 3100
+.define K3101 = 3101
+.define K3102 = 3102
+.define K3103 = 3103
+.define K3104 = 3104
+.define K3105 = 3105
+.define K3106 = 3106
+.define K3107 = 3107
+.define K3108 = 3108
+.define K3109 = 3109
+.define K3110 = 3110
+.define K3111 = 3111
+.define K3112 = 3112
+.define K3113 = 3113
+.define K3114 = 3114
+.define K3115 = 3115
+.define K3116 = 3116
+.define K3117 = 3117
+.define K3118 = 3118
+.define K3119 = 3119
+.define K3120 = 3120
+.define K3121 = 3121
+.define K3122 = 3122
+.define K3123 = 3123
+.define K3124 = 3124
+.define K3125 = 3125
+.define K3126 = 3126
+.define K3127 = 3127
+.define K3128 = 3128
+.define K3129 = 3129
+.define K3130 = 3130
+.define K3131 = 3131
+.define K3132 = 3132
+.define K3133 = 3133
+.define K3134 = 3134
+.define K3135 = 3135
+.define K3136 = 3136
+.define K3137 = 3137
+.define K3138 = 3138
+.define K3139 = 3139
+.define K3140 = 3140
+.define K3141 = 3141
+.define K3142 = 3142
+.define K3143 = 3143
+.define K3144 = 3144
+.define K3145 = 3145
+.define K3146 = 3146
+.define K3147 = 3147
+.define K3148 = 3148
+.define K3149 = 3149
+.define K3150 = 3150
+.define K3151 = 3151
+.define K3152 = 3152
+.define K3153 = 3153
+.define K3154 = 3154
+.define K3155 = 3155
+.define K3156 = 3156
+.define K3157 = 3157
+.define K3158 = 3158
+.define K3159 = 3159
+.define K3160 = 3160
+.define K3161 = 3161
+.define K3162 = 3162
+.define K3163 = 3163
+.define K3164 = 3164
+.define K3165 = 3165
+.define K3166 = 3166
+.define K3167 = 3167
+.define K3168 = 3168
+.define K3169 = 3169
+.define K3170 = 3170
+.define K3171 = 3171
+.define K3172 = 3172
+.define K3173 = 3173
+.define K3174 = 3174
+.define K3175 = 3175
+.define K3176 = 3176
+.define K3177 = 3177
+.define K3178 = 3178
+.define K3179 = 3179
+.define K3180 = 3180
+.define K3181 = 3181
+.define K3182 = 3182
+.define K3183 = 3183
+.define K3184 = 3184
+.define K3185 = 3185
+.define K3186 = 3186
+.define K3187 = 3187
+.define K3188 = 3188
+.define K3189 = 3189
+.define K3190 = 3190
+.define K3191 = 3191
+.define K3192 = 3192
+.define K3193 = 3193
+.define K3194 = 3194
+.define K3195 = 3195
+.define K3196 = 3196
+.define K3197 = 3197
+.define K3198 = 3198
+.define K3199 = 3199
+.define K3200 = 3200
+.define K3201 = 3201
+.define K3202 = 3202
+.define K3203 = 3203
+.define K3204 = 3204
+.define K3205 = 3205
+.define K3206 = 3206
+.define K3207 = 3207
+.define K3208 = 3208
+.define K3209 = 3209
+.define K3210 = 3210
+.define K3211 = 3211
+.define K3212 = 3212
+.define K3213 = 3213
+.define K3214 = 3214
+.define K3215 = 3215
+.define K3216 = 3216
+.define K3217 = 3217
+.define K3218 = 3218
+.define K3219 = 3219
+.define K3220 = 3220
+.define K3221 = 3221
+.define K3222 = 3222
+.define K3223 = 3223
+.define K3224 = 3224
+.define K3225 = 3225
+.define K3226 = 3226
+.define K3227 = 3227
+.define K3228 = 3228
+.define K3229 = 3229
+.define K3230 = 3230
+.define K3231 = 3231
+.define K3232 = 3232
+.define K3233 = 3233
+.define K3234 = 3234
+.define K3235 = 3235
+.define K3236 = 3236
+.define K3237 = 3237
+.define K3238 = 3238
+.define K3239 = 3239
+.define K3240 = 3240
+.define K3241 = 3241
+.define K3242 = 3242
+.define K3243 = 3243
+.define K3244 = 3244
+.define K3245 = 3245
+.define K3246 = 3246
+.define K3247 = 3247
+.define K3248 = 3248
+.define K3249 = 3249
+.define K3250 = 3250
+.define K3251 = 3251
+.define K3252 = 3252
+.define K3253 = 3253
+.define K3254 = 3254
+.define K3255 = 3255
+.define K3256 = 3256
+.define K3257 = 3257
+.define K3258 = 3258
+.define K3259 = 3259
+.define K3260 = 3260
+.define K3261 = 3261
+.define K3262 = 3262
+.define K3263 = 3263
+.define K3264 = 3264
+.define K3265 = 3265
+.define K3266 = 3266
+.define K3267 = 3267
+.define K3268 = 3268
+.define K3269 = 3269
+.define K3270 = 3270
+.define K3271 = 3271
+.define K3272 = 3272
+.define K3273 = 3273
+.define K3274 = 3274
+.define K3275 = 3275
+.define K3276 = 3276
+.define K3277 = 3277
+.define K3278 = 3278
+.define K3279 = 3279
+.define K3280 = 3280
+.define K3281 = 3281
+.define K3282 = 3282
+.define K3283 = 3283
+.define K3284 = 3284
+.define K3285 = 3285
+.define K3286 = 3286
+.define K3287 = 3287
+.define K3288 = 3288
+.define K3289 = 3289
+.define K3290 = 3290
+.define K3291 = 3291
+.define K3292 = 3292
+.define K3293 = 3293
+.define K3294 = 3294
+.define K3295 = 3295
+.define K3296 = 3296
+.define K3297 = 3297
+.define K3298 = 3298
+.define K3299 = 3299
+.define K3300 = 3300
+.define K3301 = 3301
+.define K3302 = 3302
+.define K3303 = 3303
+.define K3304 = 3304
+.define K3305 = 3305
+.define K3306 = 3306
+.define K3307 = 3307
+.define K3308 = 3308
+.define K3309 = 3309
+.define K3310 = 3310
+.define K3311 = 3311
+.define K3312 = 3312
+.define K3313 = 3313
+.define K3314 = 3314
+.define K3315 = 3315
+.define K3316 = 3316
+.define K3317 = 3317
+.define K3318 = 3318
+.define K3319 = 3319
+.define K3320 = 3320
+.define K3321 = 3321
+.define K3322 = 3322
+.define K3323 = 3323
+.define K3324 = 3324
+.define K3325 = 3325
+.define K3326 = 3326
+.define K3327 = 3327
+.define K3328 = 3328
+.define K3329 = 3329
+.define K3330 = 3330
+.define K3331 = 3331
+.define K3332 = 3332
+.define K3333 = 3333
+.define K3334 = 3334
+.define K3335 = 3335
+.define K3336 = 3336
+.define K3337 = 3337
+.define K3338 = 3338
+.define K3339 = 3339
+.define K3340 = 3340
+.define K3341 = 3341
+.define K3342 = 3342
+.define K3343 = 3343
+.define K3344 = 3344
+.define K3345 = 3345
+.define K3346 = 3346
+.define K3347 = 3347
+.define K3348 = 3348
+.define K3349 = 3349
+.define K3350 = 3350
+.define K3351 = 3351
+.define K3352 = 3352
+.define K3353 = 3353
+.define K3354 = 3354
+.define K3355 = 3355
+.define K3356 = 3356
+.define K3357 = 3357
+.define K3358 = 3358
+.define K3359 = 3359
+.define K3360 = 3360
+.define K3361 = 3361
+.define K3362 = 3362
+.define K3363 = 3363
+.define K3364 = 3364
+.define K3365 = 3365
+.define K3366 = 3366
+.define K3367 = 3367
+.define K3368 = 3368
+.define K3369 = 3369
+.define K3370 = 3370
+.define K3371 = 3371
+.define K3372 = 3372
+.define K3373 = 3373
+.define K3374 = 3374
+.define K3375 = 3375
+.define K3376 = 3376
+.define K3377 = 3377
+.define K3378 = 3378
+.define K3379 = 3379
+.define K3380 = 3380
+.define K3381 = 3381
+.define K3382 = 3382
+.define K3383 = 3383
+.define K3384 = 3384
+.define K3385 = 3385
+.define K3386 = 3386
+.define K3387 = 3387
+.define K3388 = 3388
+.define K3389 = 3389
+.define K3390 = 3390
+.define K3391 = 3391
+.define K3392 = 3392
+.define K3393 = 3393
+.define K3394 = 3394
+.define K3395 = 3395
+.define K3396 = 3396
+.define K3397 = 3397
+.define K3398 = 3398
+.define K3399 = 3399
+.define K3400 = 3400
+.define K3401 = 3401
+.define K3402 = 3402
+.define K3403 = 3403
+.define K3404 = 3404
+.define K3405 = 3405
+.define K3406 = 3406
+.define K3407 = 3407
+.define K3408 = 3408
+.define K3409 = 3409
+.define K3410 = 3410
+.define K3411 = 3411
+.define K3412 = 3412
+.define K3413 = 3413
+.define K3414 = 3414
+.define K3415 = 3415
+.define K3416 = 3416
+.define K3417 = 3417
+.define K3418 = 3418
+.define K3419 = 3419
+.define K3420 = 3420
+.define K3421 = 3421
+.define K3422 = 3422
+.define K3423 = 3423
+.define K3424 = 3424
+.define K3425 = 3425
+.define K3426 = 3426
+.define K3427 = 3427
+.define K3428 = 3428
+.define K3429 = 3429
+.define K3430 = 3430
+.define K3431 = 3431
+.define K3432 = 3432
+.define K3433 = 3433
+.define K3434 = 3434
+.define K3435 = 3435
+.define K3436 = 3436
+.define K3437 = 3437
+.define K3438 = 3438
+.define K3439 = 3439
+.define K3440 = 3440
+.define K3441 = 3441
+.define K3442 = 3442
+.define K3443 = 3443
+.define K3444 = 3444
+.define K3445 = 3445
+.define K3446 = 3446
+.define K3447 = 3447
+.define K3448 = 3448
+.define K3449 = 3449
+.define K3450 = 3450
+.define K3451 = 3451
+.define K3452 = 3452
+.define K3453 = 3453
+.define K3454 = 3454
+.define K3455 = 3455
+.define K3456 = 3456
+.define K3457 = 3457
+.define K3458 = 3458
+.define K3459 = 3459
+.define K3460 = 3460
+.define K3461 = 3461
+.define K3462 = 3462
+.define K3463 = 3463
+.define K3464 = 3464
+.define K3465 = 3465
+.define K3466 = 3466
+.define K3467 = 3467
+.define K3468 = 3468
+.define K3469 = 3469
+.define K3470 = 3470
+.define K3471 = 3471
+.define K3472 = 3472
+.define K3473 = 3473
+.define K3474 = 3474
+.define K3475 = 3475
+.define K3476 = 3476
+.define K3477 = 3477
+.define K3478 = 3478
+.define K3479 = 3479
+.define K3480 = 3480
+.define K3481 = 3481
+.define K3482 = 3482
+.define K3483 = 3483
+.define K3484 = 3484
+.define K3485 = 3485
+.define K3486 = 3486
+.define K3487 = 3487
+.define K3488 = 3488
+.define K3489 = 3489
+.define K3490 = 3490
+.define K3491 = 3491
+.define K3492 = 3492
+.define K3493 = 3493
+.define K3494 = 3494
+.define K3495 = 3495
+.define K3496 = 3496
+.define K3497 = 3497
+.define K3498 = 3498
+.define K3499 = 3499
+.define K3500 = 3500
+.define K3501 = 3501
+.define K3502 = 3502
+.define K3503 = 3503
+.define K3504 = 3504
+.define K3505 = 3505
+.define K3506 = 3506
+.define K3507 = 3507
+.define K3508 = 3508
+.define K3509 = 3509
+.define K3510 = 3510
+.define K3511 = 3511
+.define K3512 = 3512
+.define K3513 = 3513
+.define K3514 = 3514
+.define K3515 = 3515
+.define K3516 = 3516
+.define K3517 = 3517
+.define K3518 = 3518
+.define K3519 = 3519
+.define K3520 = 3520
+.define K3521 = 3521
+.define K3522 = 3522
+.define K3523 = 3523
+.define K3524 = 3524
+.define K3525 = 3525
+.define K3526 = 3526
+.define K3527 = 3527
+.define K3528 = 3528
+.define K3529 = 3529
+.define K3530 = 3530
+.define K3531 = 3531
+.define K3532 = 3532
+.define K3533 = 3533
+.define K3534 = 3534
+.define K3535 = 3535
+.define K3536 = 3536
+.define K3537 = 3537
+.define K3538 = 3538
+.define K3539 = 3539
+.define K3540 = 3540
+.define K3541 = 3541
+.define K3542 = 3542
+.define K3543 = 3543
+.define K3544 = 3544
+.define K3545 = 3545
+.define K3546 = 3546
+.define K3547 = 3547
+.define K3548 = 3548
+.define K3549 = 3549
+.define K3550 = 3550
+.define K3551 = 3551
+.define K3552 = 3552
+.define K3553 = 3553
+.define K3554 = 3554
+.define K3555 = 3555
+.define K3556 = 3556
+.define K3557 = 3557
+.define K3558 = 3558
+.define K3559 = 3559
+.define K3560 = 3560
+.define K3561 = 3561
+.define K3562 = 3562
+.define K3563 = 3563
+.define K3564 = 3564
+.define K3565 = 3565
+.define K3566 = 3566
+.define K3567 = 3567
+.define K3568 = 3568
+.define K3569 = 3569
+.define K3570 = 3570
+.define K3571 = 3571
+.define K3572 = 3572
+.define K3573 = 3573
+.define K3574 = 3574
+.define K3575 = 3575
+.define K3576 = 3576
+.define K3577 = 3577
+.define K3578 = 3578
+.define K3579 = 3579
+.define K3580 = 3580
+.define K3581 = 3581
+.define K3582 = 3582
+.define K3583 = 3583
+.define K3584 = 3584
+.define K3585 = 3585
+.define K3586 = 3586
+.define K3587 = 3587
+.define K3588 = 3588
+.define K3589 = 3589
+.define K3590 = 3590
+.define K3591 = 3591
+.define K3592 = 3592
+.define K3593 = 3593
+.define K3594 = 3594
+.define K3595 = 3595
+.define K3596 = 3596
+.define K3597 = 3597
+.define K3598 = 3598
+.define K3599 = 3599
+.define K3600 = 3600
+.define K3601 = 3601
+.define K3602 = 3602
+.define K3603 = 3603
+.define K3604 = 3604
+.define K3605 = 3605
+.define K3606 = 3606
+.define K3607 = 3607
+.define K3608 = 3608
+.define K3609 = 3609
+.define K3610 = 3610
+.define K3611 = 3611
+.define K3612 = 3612
+.define K3613 = 3613
+.define K3614 = 3614
+.define K3615 = 3615
+.define K3616 = 3616
+.define K3617 = 3617
+.define K3618 = 3618
+.define K3619 = 3619
+.define K3620 = 3620
+.define K3621 = 3621
+.define K3622 = 3622
+.define K3623 = 3623
+.define K3624 = 3624
+.define K3625 = 3625
+.define K3626 = 3626
+.define K3627 = 3627
+.define K3628 = 3628
+.define K3629 = 3629
+.define K3630 = 3630
+.define K3631 = 3631
+.define K3632 = 3632
+.define K3633 = 3633
+.define K3634 = 3634
+.define K3635 = 3635
+.define K3636 = 3636
+.define K3637 = 3637
+.define K3638 = 3638
+.define K3639 = 3639
+.define K3640 = 3640
+.define K3641 = 3641
+.define K3642 = 3642
+.define K3643 = 3643
+.define K3644 = 3644
+.define K3645 = 3645
+.define K3646 = 3646
+.define K3647 = 3647
+.define K3648 = 3648
+.define K3649 = 3649
+.define K3650 = 3650
+.define K3651 = 3651
+.define K3652 = 3652
+.define K3653 = 3653
+.define K3654 = 3654
+.define K3655 = 3655
+.define K3656 = 3656
+.define K3657 = 3657
+.define K3658 = 3658
+.define K3659 = 3659
+.define K3660 = 3660
+.define K3661 = 3661
+.define K3662 = 3662
+.define K3663 = 3663
+.define K3664 = 3664
+.define K3665 = 3665
+.define K3666 = 3666
+.define K3667 = 3667
+.define K3668 = 3668
+.define K3669 = 3669
+.define K3670 = 3670
+.define K3671 = 3671
+.define K3672 = 3672
+.define K3673 = 3673
+.define K3674 = 3674
+.define K3675 = 3675
+.define K3676 = 3676
+.define K3677 = 3677
+.define K3678 = 3678
+.define K3679 = 3679
+.define K3680 = 3680
+.define K3681 = 3681
+.define K3682 = 3682
+.define K3683 = 3683
+.define K3684 = 3684
+.define K3685 = 3685
+.define K3686 = 3686
+.define K3687 = 3687
+.define K3688 = 3688
+.define K3689 = 3689
+.define K3690 = 3690
+.define K3691 = 3691
+.define K3692 = 3692
+.define K3693 = 3693
+.define K3694 = 3694
+.define K3695 = 3695
+.define K3696 = 3696
+.define K3697 = 3697
+.define K3698 = 3698
+.define K3699 = 3699
+.define K3700 = 3700
+.define K3701 = 3701
+.define K3702 = 3702
+.define K3703 = 3703
+.define K3704 = 3704
+.define K3705 = 3705
+.define K3706 = 3706
+.define K3707 = 3707
+.define K3708 = 3708
+.define K3709 = 3709
+.define K3710 = 3710
+.define K3711 = 3711
+.define K3712 = 3712
+.define K3713 = 3713
+.define K3714 = 3714
+.define K3715 = 3715
+.define K3716 = 3716
+.define K3717 = 3717
+.define K3718 = 3718
+.define K3719 = 3719
+.define K3720 = 3720
+.define K3721 = 3721
+.define K3722 = 3722
+.define K3723 = 3723
+.define K3724 = 3724
+.define K3725 = 3725
+.define K3726 = 3726
+.define K3727 = 3727
+.define K3728 = 3728
+.define K3729 = 3729
+.define K3730 = 3730
+.define K3731 = 3731
+.define K3732 = 3732
+.define K3733 = 3733
+.define K3734 = 3734
+.define K3735 = 3735
+.define K3736 = 3736
+.define K3737 = 3737
+.define K3738 = 3738
+.define K3739 = 3739
+.define K3740 = 3740
+.define K3741 = 3741
+.define K3742 = 3742
+.define K3743 = 3743
+.define K3744 = 3744
+.define K3745 = 3745
+.define K3746 = 3746
+.define K3747 = 3747
+.define K3748 = 3748
+.define K3749 = 3749
+.define K3750 = 3750
+.define K3751 = 3751
+.define K3752 = 3752
+.define K3753 = 3753
+.define K3754 = 3754
+.define K3755 = 3755
+.define K3756 = 3756
+.define K3757 = 3757
+.define K3758 = 3758
+.define K3759 = 3759
+.define K3760 = 3760
+.define K3761 = 3761
+.define K3762 = 3762
+.define K3763 = 3763
+.define K3764 = 3764
+.define K3765 = 3765
+.define K3766 = 3766
+.define K3767 = 3767
+.define K3768 = 3768
+.define K3769 = 3769
+.define K3770 = 3770
+.define K3771 = 3771
+.define K3772 = 3772
+.define K3773 = 3773
+.define K3774 = 3774
+.define K3775 = 3775
+.define K3776 = 3776
+.define K3777 = 3777
+.define K3778 = 3778
+.define K3779 = 3779
+.define K3780 = 3780
+.define K3781 = 3781
+.define K3782 = 3782
+.define K3783 = 3783
+.define K3784 = 3784
+.define K3785 = 3785
+.define K3786 = 3786
+.define K3787 = 3787
+.define K3788 = 3788
+.define K3789 = 3789
+.define K3790 = 3790
+.define K3791 = 3791
+.define K3792 = 3792
+.define K3793 = 3793
+.define K3794 = 3794
+.define K3795 = 3795
+.define K3796 = 3796
+.define K3797 = 3797
+.define K3798 = 3798
+.define K3799 = 3799
+.define K3800 = 3800
+.define K3801 = 3801
+.define K3802 = 3802
+.define K3803 = 3803
+.define K3804 = 3804
+.define K3805 = 3805
+.define K3806 = 3806
+.define K3807 = 3807
+.define K3808 = 3808
+.define K3809 = 3809
+.define K3810 = 3810
+.define K3811 = 3811
+.define K3812 = 3812
+.define K3813 = 3813
+.define K3814 = 3814
+.define K3815 = 3815
+.define K3816 = 3816
+.define K3817 = 3817
+.define K3818 = 3818
+.define K3819 = 3819
+.define K3820 = 3820
+.define K3821 = 3821
+.define K3822 = 3822
+.define K3823 = 3823
+.define K3824 = 3824
+.define K3825 = 3825
+.define K3826 = 3826
+.define K3827 = 3827
+.define K3828 = 3828
+.define K3829 = 3829
+.define K3830 = 3830
+.define K3831 = 3831
+.define K3832 = 3832
+.define K3833 = 3833
+.define K3834 = 3834
+.define K3835 = 3835
+.define K3836 = 3836
+.define K3837 = 3837
+.define K3838 = 3838
+.define K3839 = 3839
+.define K3840 = 3840
+.define K3841 = 3841
+.define K3842 = 3842
+.define K3843 = 3843
+.define K3844 = 3844
+.define K3845 = 3845
+.define K3846 = 3846
+.define K3847 = 3847
+.define K3848 = 3848
+.define K3849 = 3849
+.define K3850 = 3850
+.define K3851 = 3851
+.define K3852 = 3852
+.define K3853 = 3853
+.define K3854 = 3854
+.define K3855 = 3855
+.define K3856 = 3856
+.define K3857 = 3857
+.define K3858 = 3858
+.define K3859 = 3859
+.define K3860 = 3860
+.define K3861 = 3861
+.define K3862 = 3862
+.define K3863 = 3863
+.define K3864 = 3864
+.define K3865 = 3865
+.define K3866 = 3866
+.define K3867 = 3867
+.define K3868 = 3868
+.define K3869 = 3869
+.define K3870 = 3870
+.define K3871 = 3871
+.define K3872 = 3872
+.define K3873 = 3873
+.define K3874 = 3874
+.define K3875 = 3875
+.define K3876 = 3876
+.define K3877 = 3877
+.define K3878 = 3878
+.define K3879 = 3879
+.define K3880 = 3880
+.define K3881 = 3881
+.define K3882 = 3882
+.define K3883 = 3883
+.define K3884 = 3884
+.define K3885 = 3885
+.define K3886 = 3886
+.define K3887 = 3887
+.define K3888 = 3888
+.define K3889 = 3889
+.define K3890 = 3890
+.define K3891 = 3891
+.define K3892 = 3892
+.define K3893 = 3893
+.define K3894 = 3894
+.define K3895 = 3895
+.define K3896 = 3896
+.define K3897 = 3897
+.define K3898 = 3898
+.define K3899 = 3899
+.define K3900 = 3900
+.define K3901 = 3901
+.define K3902 = 3902
+.define K3903 = 3903
+.define K3904 = 3904
+.define K3905 = 3905
+.define K3906 = 3906
+.define K3907 = 3907
+.define K3908 = 3908
+.define K3909 = 3909
+.define K3910 = 3910
+.define K3911 = 3911
+.define K3912 = 3912
+.define K3913 = 3913
+.define K3914 = 3914
+.define K3915 = 3915
+.define K3916 = 3916
+.define K3917 = 3917
+.define K3918 = 3918
+.define K3919 = 3919
+.define K3920 = 3920
+.define K3921 = 3921
+.define K3922 = 3922
+.define K3923 = 3923
+.define K3924 = 3924
+.define K3925 = 3925
+.define K3926 = 3926
+.define K3927 = 3927
+.define K3928 = 3928
+.define K3929 = 3929
+.define K3930 = 3930
+.define K3931 = 3931
+.define K3932 = 3932
+.define K3933 = 3933
+.define K3934 = 3934
+.define K3935 = 3935
+.define K3936 = 3936
+.define K3937 = 3937
+.define K3938 = 3938
+.define K3939 = 3939
+.define K3940 = 3940
+.define K3941 = 3941
+.define K3942 = 3942
+.define K3943 = 3943
+.define K3944 = 3944
+.define K3945 = 3945
+.define K3946 = 3946
+.define K3947 = 3947
+.define K3948 = 3948
+.define K3949 = 3949
+.define K3950 = 3950
+.define K3951 = 3951
+.define K3952 = 3952
+.define K3953 = 3953
+.define K3954 = 3954
+.define K3955 = 3955
+.define K3956 = 3956
+.define K3957 = 3957
+.define K3958 = 3958
+.define K3959 = 3959
+.define K3960 = 3960
+.define K3961 = 3961
+.define K3962 = 3962
+.define K3963 = 3963
+.define K3964 = 3964
+.define K3965 = 3965
+.define K3966 = 3966
+.define K3967 = 3967
+.define K3968 = 3968
+.define K3969 = 3969
+.define K3970 = 3970
+.define K3971 = 3971
+.define K3972 = 3972
+.define K3973 = 3973
+.define K3974 = 3974
+.define K3975 = 3975
+.define K3976 = 3976
+.define K3977 = 3977
+.define K3978 = 3978
+.define K3979 = 3979
+.define K3980 = 3980
+.define K3981 = 3981
+.define K3982 = 3982
+.define K3983 = 3983
+.define K3984 = 3984
+.define K3985 = 3985
+.define K3986 = 3986
+.define K3987 = 3987
+.define K3988 = 3988
+.define K3989 = 3989
+.define K3990 = 3990
+.define K3991 = 3991
+.define K3992 = 3992
+.define K3993 = 3993
+.define K3994 = 3994
+.define K3995 = 3995
+.define K3996 = 3996
+.define K3997 = 3997
+.define K3998 = 3998
+.define K3999 = 3999
+MAIN: prn #K3999
+hlt
@@ -0,0 +1,1654 @@
+.extern X
+.entry MAIN
+MAIN: jsr X
+L0: .data 0
+L1: .data 1
+L2: .data 2
+L3: .data 3
+L4: .data 4
+L5: .data 5
+L6: .data 6
+L7: .data 7
+L8: .data 8
+L9: .data 9
+L10: .data 10
+L11: .data 11
+L12: .data 12
+L13: .data 13
+L14: .data 14
+L15: .data 15
+L16: .data 16
+L17: .data 17
+L18: .data 18
+L19: .data 19
+L20: .data 20
+L21: .data 21
+L22: .data 22
+L23: .data 23
+L24: .data 24
+L25: .data 25
+L26: .data 26
+L27: .data 27
+L28: .data 28
+L29: .data 29
+L30: .data 30
+L31: .data 31
+L32: .data 32
+L33: .data 33
+L34: .data 34
+L35: .data 35
+L36: .data 36
+L37: .data 37
+L38: .data 38
+L39: .data 39
+L40: .data 40
+L41: .data 41
+L42: .data 42
+L43: .data 43
+L44: .data 44
+L45: .data 45
+L46: .data 46
+L47: .data 47
+L48: .data 48
+L49: .data 49
+L50: .data 50
+L51: .data 51
+L52: .data 52
+L53: .data 53
+L54: .data 54
+L55: .data 55
+L56: .data 56
+L57: .data 57
+L58: .data 58
+L59: .data 59
+L60: .data 60
+L61: .data 61
+L62: .data 62
+L63: .data 63
+L64: .data 64
+L65: .data 65
+L66: .data 66
+L67: .data 67
+L68: .data 68
+L69: .data 69
+L70: .data 70
+L71: .data 71
+L72: .data 72
+L73: .data 73
+L74: .data 74
+L75: .data 75
+L76: .data 76
+L77: .data 77
+L78: .data 78
+L79: .data 79
+L80: .data 80
+L81: .data 81
+L82: .data 82
+L83: .data 83
+L84: .data 84
+L85: .data 85
+L86: .data 86
+L87: .data 87
+L88: .data 88
+L89: .data 89
+L90: .data 90
+L91: .data 91
+L92: .data 92
+L93: .data 93
+L94: .data 94
+L95: .data 95
+L96: .data 96
+L97: .data 97
+L98: .data 98
+L99: .data 99
+L100: .data 100
+L101: .data 101
+L102: .data 102
+L103: .data 103
+L104: .data 104
+L105: .data 105
+L106: .data 106
+L107: .data 107
+L108: .data 108
+L109: .data 109
+L110: .data 110
+L111: .data 111
+L112: .data 112
+L113: .data 113
+L114: .data 114
+L115: .data 115
+L116: .data 116
+L117: .data 117
+L118: .data 118
+L119: .data 119
+L120: .data 120
+L121: .data 121
+L122: .data 122
+L123: .data 123
+L124: .data 124
+L125: .data 125
+L126: .data 126
+L127: .data 127
+L128: .data 128
+L129: .data 129
+L130: .data 130
+L131: .data 131
+L132: .data 132
+L133: .data 133
+L134: .data 134
+L135: .data 135
+L136: .data 136
+L137: .data 137
+L138: .data 138
+L139: .data 139
+L140: .data 140
+L141: .data 141
+L142: .data 142
+L143: .data 143
+L144: .data 144
+L145: .data 145
+L146: .data 146
+L147: .data 147
+L148: .data 148
+L149: .data 149
+L150: .data 150
+L151: .data 151
+L152: .data 152
+L153: .data 153
+L154: .data 154
+L155: .data 155
+L156: .data 156
+L157: .data 157
+L158: .data 158
+L159: .data 159
+L160: .data 160
+L161: .data 161
+L162: .data 162
+L163: .data 163
+L164: .data 164
+L165: .data 165
+L166: .data 166
+L167: .data 167
+L168: .data 168
+L169: .data 169
+L170: .data 170
+L171: .data 171
+L172: .data 172
+L173: .data 173
+L174: .data 174
+L175: .data 175
+L176: .data 176
+L177: .data 177
+L178: .data 178
+L179: .data 179
+L180: .data 180
+L181: .data 181
+L182: .data 182
+L183: .data 183
+L184: .data 184
+L185: .data 185
+L186: .data 186
+L187: .data 187
+L188: .data 188
+L189: .data 189
+L190: .data 190
+L191: .data 191
+L192: .data 192
+L193: .data 193
+L194: .data 194
+L195: .data 195
+L196: .data 196
+L197: .data 197
+L198: .data 198
+L199: .data 199
+L200: .data 200
+L201: .data 201
+L202: .data 202
+L203: .data 203
+L204: .data 204
+L205: .data 205
+L206: .data 206
+L207: .data 207
+L208: .data 208
+L209: .data 209
+L210: .data 210
+L211: .data 211
+L212: .data 212
+L213: .data 213
+L214: .data 214
+L215: .data 215
+L216: .data 216
+L217: .data 217
+L218: .data 218
+L219: .data 219
+L220: .data 220
+L221: .data 221
+L222: .data 222
+L223: .data 223
+L224: .data 224
+L225: .data 225
+L226: .data 226
+L227: .data 227
+L228: .data 228
+L229: .data 229
+L230: .data 230
+L231: .data 231
+L232: .data 232
+L233: .data 233
+L234: .data 234
+L235: .data 235
+L236: .data 236
+L237: .data 237
+L238: .data 238
+L239: .data 239
+L240: .data 240
+L241: .data 241
+L242: .data 242
+L243: .data 243
+L244: .data 244
+L245: .data 245
+L246: .data 246
+L247: .data 247
+L248: .data 248
+L249: .data 249
+L250: .data 250
+L251: .data 251
+L252: .data 252
+L253: .data 253
+L254: .data 254
+L255: .data 255
+L256: .data 256
+L257: .data 257
+L258: .data 258
+L259: .data 259
+L260: .data 260
+L261: .data 261
+L262: .data 262
+L263: .data 263
+L264: .data 264
+L265: .data 265
+L266: .data 266
+L267: .data 267
+L268: .data 268
+L269: .data 269
+L270: .data 270
+L271: .data 271
+L272: .data 272
+L273: .data 273
+L274: .data 274
+L275: .data 275
+L276: .data 276
+L277: .data 277
+L278: .data 278
+L279: .data 279
+L280: .data 280
+L281: .data 281
+L282: .data 282
+L283: .data 283
+L284: .data 284
+L285: .data 285
+L286: .data 286
+L287: .data 287
+L288: .data 288
+L289: .data 289
+L290: .data 290
+L291: .data 291
+L292: .data 292
+L293: .data 293
+L294: .data 294
+L295: .data 295
+L296: .data 296
+L297: .data 297
+L298: .data 298
+L299: .data 299
+L300: .data 300
+L301: .data 301
+L302: .data 302
+L303: .data 303
+L304: .data 304
+L305: .data 305
+L306: .data 306
+L307: .data 307
+L308: .data 308
+L309: .data 309
+L310: .data 310
+L311: .data 311
+L312: .data 312
+L313: .data 313
+L314: .data 314
+L315: .data 315
+L316: .data 316
+L317: .data 317
+L318: .data 318
+L319: .data 319
+L320: .data 320
+L321: .data 321
+L322: .data 322
+L323: .data 323
+L324: .data 324
+L325: .data 325
+L326: .data 326
+L327: .data 327
+L328: .data 328
+L329: .data 329
+L330: .data 330
+L331: .data 331
+L332: .data 332
+L333: .data 333
+L334: .data 334
+L335: .data 335
+L336: .data 336
+L337: .data 337
+L338: .data 338
+L339: .data 339
+L340: .data 340
+L341: .data 341
+L342: .data 342
+L343: .data 343
+L344: .data 344
+L345: .data 345
+L346: .data 346
+L347: .data 347
+L348: .data 348
+L349: .data 349
+L350: .data 350
+L351: .data 351
+L352: .data 352
+L353: .data 353
+L354: .data 354
+L355: .data 355
+L356: .data 356
+L357: .data 357
+L358: .data 358
+L359: .data 359
+L360: .data 360
+L361: .data 361
+L362: .data 362
+L363: .data 363
+L364: .data 364
+L365: .data 365
+L366: .data 366
+L367: .data 367
+L368: .data 368
+L369: .data 369
+L370: .data 370
+L371: .data 371
+L372: .data 372
+L373: .data 373
+L374: .data 374
+L375: .data 375
+L376: .data 376
+L377: .data 377
+L378: .data 378
+L379: .data 379
+L380: .data 380
+L381: .data 381
+L382: .data 382
+L383: .data 383
+L384: .data 384
+L385: .data 385
+L386: .data 386
+L387: .data 387
+L388: .data 388
+L389: .data 389
+L390: .data 390
+L391: .data 391
+L392: .data 392
+L393: .data 393
+L394: .data 394
+L395: .data 395
+L396: .data 396
+L397: .data 397
+L398: .data 398
+L399: .data 399
+L400: .data 400
+L401: .data 401
+L402: .data 402
+L403: .data 403
+L404: .data 404
+L405: .data 405
+L406: .data 406
+L407: .data 407
+L408: .data 408
+L409: .data 409
+L410: .data 410
+L411: .data 411
+L412: .data 412
+L413: .data 413
+L414: .data 414
+L415: .data 415
+L416: .data 416
+L417: .data 417
+L418: .data 418
+L419: .data 419
+L420: .data 420
+L421: .data 421
+L422: .data 422
+L423: .data 423
+L424: .data 424
+L425: .data 425
+L426: .data 426
+L427: .data 427
+L428: .data 428
+L429: .data 429
+L430: .data 430
+L431: .data 431
+L432: .data 432
+L433: .data 433
+L434: .data 434
+L435: .data 435
+L436: .data 436
+L437: .data 437
+L438: .data 438
+L439: .data 439
+L440: .data 440
+L441: .data 441
+L442: .data 442
+L443: .data 443
+L444: .data 444
+L445: .data 445
+L446: .data 446
+L447: .data 447
+L448: .data 448
+L449: .data 449
+L450: .data 450
+L451: .data 451
+L452: .data 452
+L453: .data 453
+L454: .data 454
+L455: .data 455
+L456: .data 456
+L457: .data 457
+L458: .data 458
+L459: .data 459
+L460: .data 460
+L461: .data 461
+L462: .data 462
+L463: .data 463
+L464: .data 464
+L465: .data 465
+L466: .data 466
+L467: .data 467
+L468: .data 468
+L469: .data 469
+L470: .data 470
+L471: .data 471
+L472: .data 472
+L473: .data 473
+L474: .data 474
+L475: .data 475
+L476: .data 476
+L477: .data 477
+L478: .data 478
+L479: .data 479
+L480: .data 480
+L481: .data 481
+L482: .data 482
+L483: .data 483
+L484: .data 484
+L485: .data 485
+L486: .data 486
+L487: .data 487
+L488: .data 488
+L489: .data 489
+L490: .data 490
+L491: .data 491
+L492: .data 492
+L493: .data 493
+L494: .data 494
+L495: .data 495
+L496: .data 496
+L497: .data 497
+L498: .data 498
+L499: .data 499
+L500: .data 500
+L501: .data 501
+L502: .data 502
+L503: .data 503
+L504: .data 504
+L505: .data 505
+L506: .data 506
+L507: .data 507
+L508: .data 508
+L509: .data 509
+L510: .data 510
+L511: .data 511
+L512: .data 512
+L513: .data 513
+L514: .data 514
+L515: .data 515
+L516: .data 516
+L517: .data 517
+L518: .data 518
+L519: .data 519
+L520: .data 520
+L521: .data 521
+L522: .data 522
+L523: .data 523
+L524: .data 524
+L525: .data 525
+L526: .data 526
+L527: .data 527
+L528: .data 528
+L529: .data 529
+L530: .data 530
+L531: .data 531
+L532: .data 532
+L533: .data 533
+L534: .data 534
+L535: .data 535
+L536: .data 536
+L537: .data 537
+L538: .data 538
+L539: .data 539
+L540: .data 540
+L541: .data 541
+L542: .data 542
+L543: .data 543
+L544: .data 544
+L545: .data 545
+L546: .data 546
+L547: .data 547
+L548: .data 548
+L549: .data 549
+L550: .data 550
+L551: .data 551
+L552: .data 552
+L553: .data 553
+L554: .data 554
+L555: .data 555
+L556: .data 556
+L557: .data 557
+L558: .data 558
+L559: .data 559
+L560: .data 560
+L561: .data 561
+L562: .data 562
+L563: .data 563
+L564: .data 564
+L565: .data 565
+L566: .data 566
+L567: .data 567
+L568: .data 568
+L569: .data 569
+L570: .data 570
+L571: .data 571
+L572: .data 572
+L573: .data 573
+L574: .data 574
+L575: .data 575
+L576: .data 576
+L577: .data 577
+L578: .data 578
+L579: .data 579
+L580: .data 580
+L581: .data 581
+L582: .data 582
+L583: .data 583
+L584: .data 584
+L585: .data 585
+L586: .data 586
+L587: .data 587
+L588: .data 588
+L589: .data 589
+L590: .data 590
+L591: .data 591
+L592: .data 592
+L593: .data 593
+L594: .data 594
+L595: .data 595
+L596: .data 596
+L597: .data 597
+L598: .data 598
+L599: .data 599
+L600: .data 600
+L601: .data 601
+L602: .data 602
+L603: .data 603
+L604: .data 604
+L605: .data 605
+L606: .data 606
+L607: .data 607
+L608: .data 608
+L609: .data 609
+L610: .data 610
+L611: .data 611
+L612: .data 612
+L613: .data 613
+L614: .data 614
+L615: .data 615
+L616: .data 616
+L617: .data 617
+L618: .data 618
+L619: .data 619
+L620: .data 620
+L621: .data 621
+L622: .data 622
+L623: .data 623
+L624: .data 624
+L625: .data 625
+L626: .data 626
+L627: .data 627
+L628: .data 628
+L629: .data 629
+L630: .data 630
+L631: .data 631
+L632: .data 632
+L633: .data 633
+L634: .data 634
+L635: .data 635
+L636: .data 636
+L637: .data 637
+L638: .data 638
+L639: .data 639
+L640: .data 640
+L641: .data 641
+L642: .data 642
+L643: .data 643
+L644: .data 644
+L645: .data 645
+L646: .data 646
+L647: .data 647
+L648: .data 648
+L649: .data 649
+L650: .data 650
+L651: .data 651
+L652: .data 652
+L653: .data 653
+L654: .data 654
+L655: .data 655
+L656: .data 656
+L657: .data 657
+L658: .data 658
+L659: .data 659
+L660: .data 660
+L661: .data 661
+L662: .data 662
+L663: .data 663
+L664: .data 664
+L665: .data 665
+L666: .data 666
+L667: .data 667
+L668: .data 668
+L669: .data 669
+L670: .data 670
+L671: .data 671
+L672: .data 672
+L673: .data 673
+L674: .data 674
+L675: .data 675
+L676: .data 676
+L677: .data 677
+L678: .data 678
+L679: .data 679
+L680: .data 680
+L681: .data 681
+L682: .data 682
+L683: .data 683
+L684: .data 684
+L685: .data 685
+L686: .data 686
+L687: .data 687
+L688: .data 688
+L689: .data 689
+L690: .data 690
+L691: .data 691
+L692: .data 692
+L693: .data 693
+L694: .data 694
+L695: .data 695
+L696: .data 696
+L697: .data 697
+L698: .data 698
+L699: .data 699
+L700: .data 700
+L701: .data 701
+L702: .data 702
+L703: .data 703
+L704: .data 704
+L705: .data 705
+L706: .data 706
+L707: .data 707
+L708: .data 708
+L709: .data 709
+L710: .data 710
+L711: .data 711
+L712: .data 712
+L713: .data 713
+L714: .data 714
+L715: .data 715
+L716: .data 716
+L717: .data 717
+L718: .data 718
+L719: .data 719
+L720: .data 720
+L721: .data 721
+L722: .data 722
+L723: .data 723
+L724: .data 724
+L725: .data 725
+L726: .data 726
+L727: .data 727
+L728: .data 728
+L729: .data 729
+L730: .data 730
+L731: .data 731
+L732: .data 732
+L733: .data 733
+L734: .data 734
+L735: .data 735
+L736: .data 736
+L737: .data 737
+L738: .data 738
+L739: .data 739
+L740: .data 740
+L741: .data 741
+L742: .data 742
+L743: .data 743
+L744: .data 744
+L745: .data 745
+L746: .data 746
+L747: .data 747
+L748: .data 748
+L749: .data 749
+L750: .data 750
+L751: .data 751
+L752: .data 752
+L753: .data 753
+L754: .data 754
+L755: .data 755
+L756: .data 756
+L757: .data 757
+L758: .data 758
+L759: .data 759
+L760: .data 760
+L761: .data 761
+L762: .data 762
+L763: .data 763
+L764: .data 764
+L765: .data 765
+L766: .data 766
+L767: .data 767
+L768: .data 768
+L769: .data 769
+L770: .data 770
+L771: .data 771
+L772: .data 772
+L773: .data 773
+L774: .data 774
+L775: .data 775
+L776: .data 776
+L777: .data 777
+L778: .data 778
+L779: .data 779
+L780: .data 780
+L781: .data 781
+L782: .data 782
+L783: .data 783
+L784: .data 784
+L785: .data 785
+L786: .data 786
+L787: .data 787
+L788: .data 788
+L789: .data 789
+L790: .data 790
+L791: .data 791
+L792: .data 792
+L793: .data 793
+L794: .data 794
+L795: .data 795
+L796: .data 796
+L797: .data 797
+L798: .data 798
+L799: .data 799
+L800: .data 800
+L801: .data 801
+L802: .data 802
+L803: .data 803
+L804: .data 804
+L805: .data 805
+L806: .data 806
+L807: .data 807
+L808: .data 808
+L809: .data 809
+L810: .data 810
+L811: .data 811
+L812: .data 812
+L813: .data 813
+L814: .data 814
+L815: .data 815
+L816: .data 816
+L817: .data 817
+L818: .data 818
+L819: .data 819
+L820: .data 820
+L821: .data 821
+L822: .data 822
+L823: .data 823
+L824: .data 824
+L825: .data 825
+L826: .data 826
+L827: .data 827
+L828: .data 828
+L829: .data 829
+L830: .data 830
+L831: .data 831
+L832: .data 832
+L833: .data 833
+L834: .data 834
+L835: .data 835
+L836: .data 836
+L837: .data 837
+L838: .data 838
+L839: .data 839
+L840: .data 840
+L841: .data 841
+L842: .data 842
+L843: .data 843
+L844: .data 844
+L845: .data 845
+L846: .data 846
+L847: .data 847
+L848: .data 848
+L849: .data 849
+L850: .data 850
+L851: .data 851
+L852: .data 852
+L853: .data 853
+L854: .data 854
+L855: .data 855
+L856: .data 856
+L857: .data 857
+L858: .data 858
+L859: .data 859
+L860: .data 860
+L861: .data 861
+L862: .data 862
+L863: .data 863
+L864: .data 864
+L865: .data 865
+L866: .data 866
+L867: .data 867
+L868: .data 868
+L869: .data 869
+L870: .data 870
+L871: .data 871
+L872: .data 872
+L873: .data 873
+L874: .data 874
+L875: .data 875
+L876: .data 876
+L877: .data 877
+L878: .data 878
+L879: .data 879
+L880: .data 880
+L881: .data 881
+L882: .data 882
+L883: .data 883
+L884: .data 884
+L885: .data 885
+L886: .data 886
+L887: .data 887
+L888: .data 888
+L889: .data 889
+L890: .data 890
+L891: .data 891
+L892: .data 892
+L893: .data 893
+L894: .data 894
+L895: .data 895
+L896: .data 896
+L897: .data 897
+L898: .data 898
+L899: .data 899
+L900: .data 900
+L901: .data 901
+L902: .data 902
+L903: .data 903
+L904: .data 904
+L905: .data 905
+L906: .data 906
+L907: .data 907
+L908: .data 908
+L909: .data 909
+L910: .data 910
+L911: .data 911
+L912: .data 912
+L913: .data 913
+L914: .data 914
+L915: .data 915
+L916: .data 916
+L917: .data 917
+L918: .data 918
+L919: .data 919
+L920: .data 920
+L921: .data 921
+L922: .data 922
+L923: .data 923
+L924: .data 924
+L925: .data 925
+L926: .data 926
+L927: .data 927
+L928: .data 928
+L929: .data 929
+L930: .data 930
+L931: .data 931
+L932: .data 932
+L933: .data 933
+L934: .data 934
+L935: .data 935
+L936: .data 936
+L937: .data 937
+L938: .data 938
+L939: .data 939
+L940: .data 940
+L941: .data 941
+L942: .data 942
+L943: .data 943
+L944: .data 944
+L945: .data 945
+L946: .data 946
+L947: .data 947
+L948: .data 948
+L949: .data 949
+L950: .data 950
+L951: .data 951
+L952: .data 952
+L953: .data 953
+L954: .data 954
+L955: .data 955
+L956: .data 956
+L957: .data 957
+L958: .data 958
+L959: .data 959
+L960: .data 960
+L961: .data 961
+L962: .data 962
+L963: .data 963
+L964: .data 964
+L965: .data 965
+L966: .data 966
+L967: .data 967
+L968: .data 968
+L969: .data 969
+L970: .data 970
+L971: .data 971
+L972: .data 972
+L973: .data 973
+L974: .data 974
+L975: .data 975
+L976: .data 976
+L977: .data 977
+L978: .data 978
+L979: .data 979
+L980: .data 980
+L981: .data 981
+L982: .data 982
+L983: .data 983
+L984: .data 984
+L985: .data 985
+L986: .data 986
+L987: .data 987
+L988: .data 988
+L989: .data 989
+L990: .data 990
+L991: .data 991
+L992: .data 992
+L993: .data 993
+L994: .data 994
+L995: .data 995
+L996: .data 996
+L997: .data 997
+L998: .data 998
+L999: .data 999
+L1000: .data 1000
+L1001: .data 1001
+L1002: .data 1002
+L1003: .data 1003
+L1004: .data 1004
+L1005: .data 1005
+L1006: .data 1006
+L1007: .data 1007
+L1008: .data 1008
+L1009: .data 1009
+L1010: .data 1010
+L1011: .data 1011
+L1012: .data 1012
+L1013: .data 1013
+L1014: .data 1014
+L1015: .data 1015
+L1016: .data 1016
+L1017: .data 1017
+L1018: .data 1018
+L1019: .data 1019
+L1020: .data 1020
+L1021: .data 1021
+L1022: .data 1022
+L1023: .data 1023
+L1024: .data 1024
+L1025: .data 1025
+L1026: .data 1026
+L1027: .data 1027
+L1028: .data 1028
+L1029: .data 1029
+L1030: .data 1030
+L1031: .data 1031
+L1032: .data 1032
+L1033: .data 1033
+L1034: .data 1034
+L1035: .data 1035
+L1036: .data 1036
+L1037: .data 1037
+L1038: .data 1038
+L1039: .data 1039
+L1040: .data 1040
+L1041: .data 1041
+L1042: .data 1042
+L1043: .data 1043
+L1044: .data 1044
+L1045: .data 1045
+L1046: .data 1046
+L1047: .data 1047
+L1048: .data 1048
+L1049: .data 1049
+L1050: .data 1050
+L1051: .data 1051
+L1052: .data 1052
+L1053: .data 1053
+L1054: .data 1054
+L1055: .data 1055
+L1056: .data 1056
+L1057: .data 1057
+L1058: .data 1058
+L1059: .data 1059
+L1060: .data 1060
+L1061: .data 1061
+L1062: .data 1062
+L1063: .data 1063
+L1064: .data 1064
+L1065: .data 1065
+L1066: .data 1066
+L1067: .data 1067
+L1068: .data 1068
+L1069: .data 1069
+L1070: .data 1070
+L1071: .data 1071
+L1072: .data 1072
+L1073: .data 1073
+L1074: .data 1074
+L1075: .data 1075
+L1076: .data 1076
+L1077: .data 1077
+L1078: .data 1078
+L1079: .data 1079
+L1080: .data 1080
+L1081: .data 1081
+L1082: .data 1082
+L1083: .data 1083
+L1084: .data 1084
+L1085: .data 1085
+L1086: .data 1086
+L1087: .data 1087
+L1088: .data 1088
+L1089: .data 1089
+L1090: .data 1090
+L1091: .data 1091
+L1092: .data 1092
+L1093: .data 1093
+L1094: .data 1094
+L1095: .data 1095
+L1096: .data 1096
+L1097: .data 1097
+L1098: .data 1098
+L1099: .data 1099
+jsr L0
+jsr L7
+jsr L14
+jsr L21
+jsr L28
+jsr L35
+jsr L42
+jsr L49
+jsr L56
+jsr L63
+jsr L70
+jsr L77
+jsr L84
+jsr L91
+jsr L98
+jsr L105
+jsr L112
+jsr L119
+jsr L126
+jsr L133
+jsr L140
+jsr L147
+jsr L154
+jsr L161
+jsr L168
+jsr L175
+jsr L182
+jsr L189
+jsr L196
+jsr L203
+jsr L210
+jsr L217
+jsr L224
+jsr L231
+jsr L238
+jsr L245
+jsr L252
+jsr L259
+jsr L266
+jsr L273
+jsr L280
+jsr L287
+jsr L294
+jsr L301
+jsr L308
+jsr L315
+jsr L322
+jsr L329
+jsr L336
+jsr L343
+jsr L350
+jsr L357
+jsr L364
+jsr L371
+jsr L378
+jsr L385
+jsr L392
+jsr L399
+jsr L406
+jsr L413
+jsr L420
+jsr L427
+jsr L434
+jsr L441
+jsr L448
+jsr L455
+jsr L462
+jsr L469
+jsr L476
+jsr L483
+jsr L490
+jsr L497
+jsr L504
+jsr L511
+jsr L518
+jsr L525
+jsr L532
+jsr L539
+jsr L546
+jsr L553
+jsr L560
+jsr L567
+jsr L574
+jsr L581
+jsr L588
+jsr L595
+jsr L602
+jsr L609
+jsr L616
+jsr L623
+jsr L630
+jsr L637
+jsr L644
+jsr L651
+jsr L658
+jsr L665
+jsr L672
+jsr L679
+jsr L686
+jsr L693
+jsr L700
+jsr L707
+jsr L714
+jsr L721
+jsr L728
+jsr L735
+jsr L742
+jsr L749
+jsr L756
+jsr L763
+jsr L770
+jsr L777
+jsr L784
+jsr L791
+jsr L798
+jsr L805
+jsr L812
+jsr L819
+jsr L826
+jsr L833
+jsr L840
+jsr L847
+jsr L854
+jsr L861
+jsr L868
+jsr L875
+jsr L882
+jsr L889
+jsr L896
+jsr L903
+jsr L910
+jsr L917
+jsr L924
+jsr L931
+jsr L938
+jsr L945
+jsr L952
+jsr L959
+jsr L966
+jsr L973
+jsr L980
+jsr L987
+jsr L994
+jsr L1001
+jsr L1008
+jsr L1015
+jsr L1022
+jsr L1029
+jsr L1036
+jsr L1043
+jsr L1050
+jsr L1057
+jsr L1064
+jsr L1071
+jsr L1078
+jsr L1085
+jsr L1092
+jsr L1099
+jsr L6
+jsr L13
+jsr L20
+jsr L27
+jsr L34
+jsr L41
+jsr L48
+jsr L55
+jsr L62
+jsr L69
+jsr L76
+jsr L83
+jsr L90
+jsr L97
+jsr L104
+jsr L111
+jsr L118
+jsr L125
+jsr L132
+jsr L139
+jsr L146
+jsr L153
+jsr L160
+jsr L167
+jsr L174
+jsr L181
+jsr L188
+jsr L195
+jsr L202
+jsr L209
+jsr L216
+jsr L223
+jsr L230
+jsr L237
+jsr L244
+jsr L251
+jsr L258
+jsr L265
+jsr L272
+jsr L279
+jsr L286
+jsr L293
+jsr L300
+jsr L307
+jsr L314
+jsr L321
+jsr L328
+jsr L335
+jsr L342
+jsr L349
+jsr L356
+jsr L363
+jsr L370
+jsr L377
+jsr L384
+jsr L391
+jsr L398
+jsr L405
+jsr L412
+jsr L419
+jsr L426
+jsr L433
+jsr L440
+jsr L447
+jsr L454
+jsr L461
+jsr L468
+jsr L475
+jsr L482
+jsr L489
+jsr L496
+jsr L503
+jsr L510
+jsr L517
+jsr L524
+jsr L531
+jsr L538
+jsr L545
+jsr L552
+jsr L559
+jsr L566
+jsr L573
+jsr L580
+jsr L587
+jsr L594
+jsr L601
+jsr L608
+jsr L615
+jsr L622
+jsr L629
+jsr L636
+jsr L643
+jsr L650
+jsr L657
+jsr L664
+jsr L671
+jsr L678
+jsr L685
+jsr L692
+jsr L699
+jsr L706
+jsr L713
+jsr L720
+jsr L727
+jsr L734
+jsr L741
+jsr L748
+jsr L755
+jsr L762
+jsr L769
+jsr L776
+jsr L783
+jsr L790
+jsr L797
+jsr L804
+jsr L811
+jsr L818
+jsr L825
+jsr L832
+jsr L839
+jsr L846
+jsr L853
+jsr L860
+jsr L867
+jsr L874
+jsr L881
+jsr L888
+jsr L895
+jsr L902
+jsr L909
+jsr L916
+jsr L923
+jsr L930
+jsr L937
+jsr L944
+jsr L951
+jsr L958
+jsr L965
+jsr L972
+jsr L979
+jsr L986
+jsr L993
+jsr L1000
+jsr L1007
+jsr L1014
+jsr L1021
+jsr L1028
+jsr L1035
+jsr L1042
+jsr L1049
+jsr L1056
+jsr L1063
+jsr L1070
+jsr L1077
+jsr L1084
+jsr L1091
+jsr L1098
+jsr L5
+jsr L12
+jsr L19
+jsr L26
+jsr L33
+jsr L40
+jsr L47
+jsr L54
+jsr L61
+jsr L68
+jsr L75
+jsr L82
+jsr L89
+jsr L96
+jsr L103
+jsr L110
+jsr L117
+jsr L124
+jsr L131
+jsr L138
+jsr L145
+jsr L152
+jsr L159
+jsr L166
+jsr L173
+jsr L180
+jsr L187
+jsr L194
+jsr L201
+jsr L208
+jsr L215
+jsr L222
+jsr L229
+jsr L236
+jsr L243
+jsr L250
+jsr L257
+jsr L264
+jsr L271
+jsr L278
+jsr L285
+jsr L292
+jsr L299
+jsr L306
+jsr L313
+jsr L320
+jsr L327
+jsr L334
+jsr L341
+jsr L348
+jsr L355
+jsr L362
+jsr L369
+jsr L376
+jsr L383
+jsr L390
+jsr L397
+jsr L404
+jsr L411
+jsr L418
+jsr L425
+jsr L432
+jsr L439
+jsr L446
+jsr L453
+jsr L460
+jsr L467
+jsr L474
+jsr L481
+jsr L488
+jsr L495
+jsr L502
+jsr L509
+jsr L516
+jsr L523
+jsr L530
+jsr L537
+jsr L544
+jsr L551
+jsr L558
+jsr L565
+jsr L572
+jsr L579
+jsr L586
+jsr L593
+jsr L600
+jsr L607
+jsr L614
+jsr L621
+jsr L628
+jsr L635
+jsr L642
+jsr L649
+jsr L656
+jsr L663
+jsr L670
+jsr L677
+jsr L684
+jsr L691
+jsr L698
+jsr L705
+jsr L712
+jsr L719
+jsr L726
+jsr L733
+jsr L740
+jsr L747
+jsr L754
+jsr L761
+jsr L768
+jsr L775
+jsr L782
+jsr L789
+jsr L796
+jsr L803
+jsr L810
+jsr L817
+jsr L824
+jsr L831
+jsr L838
+jsr L845
+jsr L852
+jsr L859
+jsr L866
+jsr L873
+jsr L880
+jsr L887
+jsr L894
+jsr L901
+jsr L908
+jsr L915
+jsr L922
+jsr L929
+jsr L936
+jsr L943
+jsr L950
+jsr L957
+jsr L964
+jsr L971
+jsr L978
+jsr L985
+jsr L992
+jsr L999
+jsr L1006
+jsr L1013
+jsr L1020
+jsr L1027
+jsr L1034
+jsr L1041
+jsr L1048
+jsr L1055
+jsr L1062
+jsr L1069
+jsr L1076
+jsr L1083
+jsr L1090
+jsr L1097
+jsr L4
+jsr L11
+jsr L18
+jsr L25
+jsr L32
+jsr L39
+jsr L46
+jsr L53
+jsr L60
+jsr L67
+jsr L74
+jsr L81
+jsr L88
+jsr L95
+jsr L102
+jsr L109
+jsr L116
+jsr L123
+jsr L130
+jsr L137
+jsr L144
+jsr L151
+jsr L158
+jsr L165
+jsr L172
+jsr L179
+jsr L186
+jsr L193
+jsr L200
+jsr L207
+jsr L214
+jsr L221
+jsr L228
+jsr L235
+jsr L242
+jsr L249
+jsr L256
+jsr L263
+jsr L270
+jsr L277
+jsr L284
+jsr L291
+jsr L298
+jsr L305
+jsr L312
+jsr L319
+jsr L326
+jsr L333
+jsr L340
+jsr L347
+jsr L354
+jsr L361
+jsr L368
+jsr L375
+jsr L382
+jsr L389
+jsr L396
+jsr L403
+jsr L410
+jsr L417
+jsr L424
+jsr L431
+jsr L438
+jsr L445
+jsr L452
+jsr L459
+jsr L466
+jsr L473
+jsr L480
+jsr L487
+jsr L494
+jsr L501
+jsr L508
+jsr L515
+jsr L522
+jsr L529
+jsr L536
+jsr L543
+hlt
@@ -0,0 +1,6501 @@
+mcr m0
+inc r0
+endmcr
+mcr m1
+inc r1
+endmcr
+mcr m2
+inc r2
+endmcr
+mcr m3
+inc r3
+endmcr
+mcr m4
+inc r4
+endmcr
+mcr m5
+inc r5
+endmcr
+mcr m6
+inc r6
+endmcr
+mcr m7
+inc r7
+endmcr
+mcr m8
+inc r0
+endmcr
+mcr m9
+inc r1
+endmcr
+mcr m10
+inc r2
+endmcr
+mcr m11
+inc r3
+endmcr
+mcr m12
+inc r4
+endmcr
+mcr m13
+inc r5
+endmcr
+mcr m14
+inc r6
+endmcr
+mcr m15
+inc r7
+endmcr
+mcr m16
+inc r0
+endmcr
+mcr m17
+inc r1
+endmcr
+mcr m18
+inc r2
+endmcr
+mcr m19
+inc r3
+endmcr
+mcr m20
+inc r4
+endmcr
+mcr m21
+inc r5
+endmcr
+mcr m22
+inc r6
+endmcr
+mcr m23
+inc r7
+endmcr
+mcr m24
+inc r0
+endmcr
+mcr m25
+inc r1
+endmcr
+mcr m26
+inc r2
+endmcr
+mcr m27
+inc r3
+endmcr
+mcr m28
+inc r4
+endmcr
+mcr m29
+inc r5
+endmcr
+mcr m30
+inc r6
+endmcr
+mcr m31
+inc r7
+endmcr
+mcr m32
+inc r0
+endmcr
+mcr m33
+inc r1
+endmcr
+mcr m34
+inc r2
+endmcr
+mcr m35
+inc r3
+endmcr
+mcr m36
+inc r4
+endmcr
+mcr m37
+inc r5
+endmcr
+mcr m38
+inc r6
+endmcr
+mcr m39
+inc r7
+endmcr
+mcr m40
+inc r0
+endmcr
+mcr m41
+inc r1
+endmcr
+mcr m42
+inc r2
+endmcr
+mcr m43
+inc r3
+endmcr
+mcr m44
+inc r4
+endmcr
+mcr m45
+inc r5
+endmcr
+mcr m46
+inc r6
+endmcr
+mcr m47
+inc r7
+endmcr
+mcr m48
+inc r0
+endmcr
+mcr m49
+inc r1
+endmcr
+mcr m50
+inc r2
+endmcr
+mcr m51
+inc r3
+endmcr
+mcr m52
+inc r4
+endmcr
+mcr m53
+inc r5
+endmcr
+mcr m54
+inc r6
+endmcr
+mcr m55
+inc r7
+endmcr
+mcr m56
+inc r0
+endmcr
+mcr m57
+inc r1
+endmcr
+mcr m58
+inc r2
+endmcr
+mcr m59
+inc r3
+endmcr
+mcr m60
+inc r4
+endmcr
+mcr m61
+inc r5
+endmcr
+mcr m62
+inc r6
+endmcr
+mcr m63
+inc r7
+endmcr
+mcr m64
+inc r0
+endmcr
+mcr m65
+inc r1
+endmcr
+mcr m66
+inc r2
+endmcr
+mcr m67
+inc r3
+endmcr
+mcr m68
+inc r4
+endmcr
+mcr m69
+inc r5
+endmcr
+mcr m70
+inc r6
+endmcr
+mcr m71
+inc r7
+endmcr
+mcr m72
+inc r0
+endmcr
+mcr m73
+inc r1
+endmcr
+mcr m74
+inc r2
+endmcr
+mcr m75
+inc r3
+endmcr
+mcr m76
+inc r4
+endmcr
+mcr m77
+inc r5
+endmcr
+mcr m78
+inc r6
+endmcr
+mcr m79
+inc r7
+endmcr
+mcr m80
+inc r0
+endmcr
+mcr m81
+inc r1
+endmcr
+mcr m82
+inc r2
+endmcr
+mcr m83
+inc r3
+endmcr
+mcr m84
+inc r4
+endmcr
+mcr m85
+inc r5
+endmcr
+mcr m86
+inc r6
+endmcr
+mcr m87
+inc r7
+endmcr
+mcr m88
+inc r0
+endmcr
+mcr m89
+inc r1
+endmcr
+mcr m90
+inc r2
+endmcr
+mcr m91
+inc r3
+endmcr
+mcr m92
+inc r4
+endmcr
+mcr m93
+inc r5
+endmcr
+mcr m94
+inc r6
+endmcr
+mcr m95
+inc r7
+endmcr
+mcr m96
+inc r0
+endmcr
+mcr m97
+inc r1
+endmcr
+mcr m98
+inc r2
+endmcr
+mcr m99
+inc r3
+endmcr
+mcr m100
+inc r4
+endmcr
+mcr m101
+inc r5
+endmcr
+mcr m102
+inc r6
+endmcr
+mcr m103
+inc r7
+endmcr
+mcr m104
+inc r0
+endmcr
+mcr m105
+inc r1
+endmcr
+mcr m106
+inc r2
+endmcr
+mcr m107
+inc r3
+endmcr
+mcr m108
+inc r4
+endmcr
+mcr m109
+inc r5
+endmcr
+mcr m110
+inc r6
+endmcr
+mcr m111
+inc r7
+endmcr
+mcr m112
+inc r0
+endmcr
+mcr m113
+inc r1
+endmcr
+mcr m114
+inc r2
+endmcr
+mcr m115
+inc r3
+endmcr
+mcr m116
+inc r4
+endmcr
+mcr m117
+inc r5
+endmcr
+mcr m118
+inc r6
+endmcr
+mcr m119
+inc r7
+endmcr
+mcr m120
+inc r0
+endmcr
+mcr m121
+inc r1
+endmcr
+mcr m122
+inc r2
+endmcr
+mcr m123
+inc r3
+endmcr
+mcr m124
+inc r4
+endmcr
+mcr m125
+inc r5
+endmcr
+mcr m126
+inc r6
+endmcr
+mcr m127
+inc r7
+endmcr
+mcr m128
+inc r0
+endmcr
+mcr m129
+inc r1
+endmcr
+mcr m130
+inc r2
+endmcr
+mcr m131
+inc r3
+endmcr
+mcr m132
+inc r4
+endmcr
+mcr m133
+inc r5
+endmcr
+mcr m134
+inc r6
+endmcr
+mcr m135
+inc r7
+endmcr
+mcr m136
+inc r0
+endmcr
+mcr m137
+inc r1
+endmcr
+mcr m138
+inc r2
+endmcr
+mcr m139
+inc r3
+endmcr
+mcr m140
+inc r4
+endmcr
+mcr m141
+inc r5
+endmcr
+mcr m142
+inc r6
+endmcr
+mcr m143
+inc r7
+endmcr
+mcr m144
+inc r0
+endmcr
+mcr m145
+inc r1
+endmcr
+mcr m146
+inc r2
+endmcr
+mcr m147
+inc r3
+endmcr
+mcr m148
+inc r4
+endmcr
+mcr m149
+inc r5
+endmcr
+mcr m150
+inc r6
+endmcr
+mcr m151
+inc r7
+endmcr
+mcr m152
+inc r0
+endmcr
+mcr m153
+inc r1
+endmcr
+mcr m154
+inc r2
+endmcr
+mcr m155
+inc r3
+endmcr
+mcr m156
+inc r4
+endmcr
+mcr m157
+inc r5
+endmcr
+mcr m158
+inc r6
+endmcr
+mcr m159
+inc r7
+endmcr
+mcr m160
+inc r0
+endmcr
+mcr m161
+inc r1
+endmcr
+mcr m162
+inc r2
+endmcr
+mcr m163
+inc r3
+endmcr
+mcr m164
+inc r4
+endmcr
+mcr m165
+inc r5
+endmcr
+mcr m166
+inc r6
+endmcr
+mcr m167
+inc r7
+endmcr
+mcr m168
+inc r0
+endmcr
+mcr m169
+inc r1
+endmcr
+mcr m170
+inc r2
+endmcr
+mcr m171
+inc r3
+endmcr
+mcr m172
+inc r4
+endmcr
+mcr m173
+inc r5
+endmcr
+mcr m174
+inc r6
+endmcr
+mcr m175
+inc r7
+endmcr
+mcr m176
+inc r0
+endmcr
+mcr m177
+inc r1
+endmcr
+mcr m178
+inc r2
+endmcr
+mcr m179
+inc r3
+endmcr
+mcr m180
+inc r4
+endmcr
+mcr m181
+inc r5
+endmcr
+mcr m182
+inc r6
+endmcr
+mcr m183
+inc r7
+endmcr
+mcr m184
+inc r0
+endmcr
+mcr m185
+inc r1
+endmcr
+mcr m186
+inc r2
+endmcr
+mcr m187
+inc r3
+endmcr
+mcr m188
+inc r4
+endmcr
+mcr m189
+inc r5
+endmcr
+mcr m190
+inc r6
+endmcr
+mcr m191
+inc r7
+endmcr
+mcr m192
+inc r0
+endmcr
+mcr m193
+inc r1
+endmcr
+mcr m194
+inc r2
+endmcr
+mcr m195
+inc r3
+endmcr
+mcr m196
+inc r4
+endmcr
+mcr m197
+inc r5
+endmcr
+mcr m198
+inc r6
+endmcr
+mcr m199
+inc r7
+endmcr
+mcr m200
+inc r0
+endmcr
+mcr m201
+inc r1
+endmcr
+mcr m202
+inc r2
+endmcr
+mcr m203
+inc r3
+endmcr
+mcr m204
+inc r4
+endmcr
+mcr m205
+inc r5
+endmcr
+mcr m206
+inc r6
+endmcr
+mcr m207
+inc r7
+endmcr
+mcr m208
+inc r0
+endmcr
+mcr m209
+inc r1
+endmcr
+mcr m210
+inc r2
+endmcr
+mcr m211
+inc r3
+endmcr
+mcr m212
+inc r4
+endmcr
+mcr m213
+inc r5
+endmcr
+mcr m214
+inc r6
+endmcr
+mcr m215
+inc r7
+endmcr
+mcr m216
+inc r0
+endmcr
+mcr m217
+inc r1
+endmcr
+mcr m218
+inc r2
+endmcr
+mcr m219
+inc r3
+endmcr
+mcr m220
+inc r4
+endmcr
+mcr m221
+inc r5
+endmcr
+mcr m222
+inc r6
+endmcr
+mcr m223
+inc r7
+endmcr
+mcr m224
+inc r0
+endmcr
+mcr m225
+inc r1
+endmcr
+mcr m226
+inc r2
+endmcr
+mcr m227
+inc r3
+endmcr
+mcr m228
+inc r4
+endmcr
+mcr m229
+inc r5
+endmcr
+mcr m230
+inc r6
+endmcr
+mcr m231
+inc r7
+endmcr
+mcr m232
+inc r0
+endmcr
+mcr m233
+inc r1
+endmcr
+mcr m234
+inc r2
+endmcr
+mcr m235
+inc r3
+endmcr
+mcr m236
+inc r4
+endmcr
+mcr m237
+inc r5
+endmcr
+mcr m238
+inc r6
+endmcr
+mcr m239
+inc r7
+endmcr
+mcr m240
+inc r0
+endmcr
+mcr m241
+inc r1
+endmcr
+mcr m242
+inc r2
+endmcr
+mcr m243
+inc r3
+endmcr
+mcr m244
+inc r4
+endmcr
+mcr m245
+inc r5
+endmcr
+mcr m246
+inc r6
+endmcr
+mcr m247
+inc r7
+endmcr
+mcr m248
+inc r0
+endmcr
+mcr m249
+inc r1
+endmcr
+mcr m250
+inc r2
+endmcr
+mcr m251
+inc r3
+endmcr
+mcr m252
+inc r4
+endmcr
+mcr m253
+inc r5
+endmcr
+mcr m254
+inc r6
+endmcr
+mcr m255
+inc r7
+endmcr
+mcr m256
+inc r0
+endmcr
+mcr m257
+inc r1
+endmcr
+mcr m258
+inc r2
+endmcr
+mcr m259
+inc r3
+endmcr
+mcr m260
+inc r4
+endmcr
+mcr m261
+inc r5
+endmcr
+mcr m262
+inc r6
+endmcr
+mcr m263
+inc r7
+endmcr
+mcr m264
+inc r0
+endmcr
+mcr m265
+inc r1
+endmcr
+mcr m266
+inc r2
+endmcr
+mcr m267
+inc r3
+endmcr
+mcr m268
+inc r4
+endmcr
+mcr m269
+inc r5
+endmcr
+mcr m270
+inc r6
+endmcr
+mcr m271
+inc r7
+endmcr
+mcr m272
+inc r0
+endmcr
+mcr m273
+inc r1
+endmcr
+mcr m274
+inc r2
+endmcr
+mcr m275
+inc r3
+endmcr
+mcr m276
+inc r4
+endmcr
+mcr m277
+inc r5
+endmcr
+mcr m278
+inc r6
+endmcr
+mcr m279
+inc r7
+endmcr
+mcr m280
+inc r0
+endmcr
+mcr m281
+inc r1
+endmcr
+mcr m282
+inc r2
+endmcr
+mcr m283
+inc r3
+endmcr
+mcr m284
+inc r4
+endmcr
+mcr m285
+inc r5
+endmcr
+mcr m286
+inc r6
+endmcr
+mcr m287
+inc r7
+endmcr
+mcr m288
+inc r0
+endmcr
+mcr m289
+inc r1
+endmcr
+mcr m290
+inc r2
+endmcr
+mcr m291
+inc r3
+endmcr
+mcr m292
+inc r4
+endmcr
+mcr m293
+inc r5
+endmcr
+mcr m294
+inc r6
+endmcr
+mcr m295
+inc r7
+endmcr
+mcr m296
+inc r0
+endmcr
+mcr m297
+inc r1
+endmcr
+mcr m298
+inc r2
+endmcr
+mcr m299
+inc r3
+endmcr
+mcr m300
+inc r4
+endmcr
+mcr m301
+inc r5
+endmcr
+mcr m302
+inc r6
+endmcr
+mcr m303
+inc r7
+endmcr
+mcr m304
+inc r0
+endmcr
+mcr m305
+inc r1
+endmcr
+mcr m306
+inc r2
+endmcr
+mcr m307
+inc r3
+endmcr
+mcr m308
+inc r4
+endmcr
+mcr m309
+inc r5
+endmcr
+mcr m310
+inc r6
+endmcr
+mcr m311
+inc r7
+endmcr
+mcr m312
+inc r0
+endmcr
+mcr m313
+inc r1
+endmcr
+mcr m314
+inc r2
+endmcr
+mcr m315
+inc r3
+endmcr
+mcr m316
+inc r4
+endmcr
+mcr m317
+inc r5
+endmcr
+mcr m318
+inc r6
+endmcr
+mcr m319
+inc r7
+endmcr
+mcr m320
+inc r0
+endmcr
+mcr m321
+inc r1
+endmcr
+mcr m322
+inc r2
+endmcr
+mcr m323
+inc r3
+endmcr
+mcr m324
+inc r4
+endmcr
+mcr m325
+inc r5
+endmcr
+mcr m326
+inc r6
+endmcr
+mcr m327
+inc r7
+endmcr
+mcr m328
+inc r0
+endmcr
+mcr m329
+inc r1
+endmcr
+mcr m330
+inc r2
+endmcr
+mcr m331
+inc r3
+endmcr
+mcr m332
+inc r4
+endmcr
+mcr m333
+inc r5
+endmcr
+mcr m334
+inc r6
+endmcr
+mcr m335
+inc r7
+endmcr
+mcr m336
+inc r0
+endmcr
+mcr m337
+inc r1
+endmcr
+mcr m338
+inc r2
+endmcr
+mcr m339
+inc r3
+endmcr
+mcr m340
+inc r4
+endmcr
+mcr m341
+inc r5
+endmcr
+mcr m342
+inc r6
+endmcr
+mcr m343
+inc r7
+endmcr
+mcr m344
+inc r0
+endmcr
+mcr m345
+inc r1
+endmcr
+mcr m346
+inc r2
+endmcr
+mcr m347
+inc r3
+endmcr
+mcr m348
+inc r4
+endmcr
+mcr m349
+inc r5
+endmcr
+mcr m350
+inc r6
+endmcr
+mcr m351
+inc r7
+endmcr
+mcr m352
+inc r0
+endmcr
+mcr m353
+inc r1
+endmcr
+mcr m354
+inc r2
+endmcr
+mcr m355
+inc r3
+endmcr
+mcr m356
+inc r4
+endmcr
+mcr m357
+inc r5
+endmcr
+mcr m358
+inc r6
+endmcr
+mcr m359
+inc r7
+endmcr
+mcr m360
+inc r0
+endmcr
+mcr m361
+inc r1
+endmcr
+mcr m362
+inc r2
+endmcr
+mcr m363
+inc r3
+endmcr
+mcr m364
+inc r4
+endmcr
+mcr m365
+inc r5
+endmcr
+mcr m366
+inc r6
+endmcr
+mcr m367
+inc r7
+endmcr
+mcr m368
+inc r0
+endmcr
+mcr m369
+inc r1
+endmcr
+mcr m370
+inc r2
+endmcr
+mcr m371
+inc r3
+endmcr
+mcr m372
+inc r4
+endmcr
+mcr m373
+inc r5
+endmcr
+mcr m374
+inc r6
+endmcr
+mcr m375
+inc r7
+endmcr
+mcr m376
+inc r0
+endmcr
+mcr m377
+inc r1
+endmcr
+mcr m378
+inc r2
+endmcr
+mcr m379
+inc r3
+endmcr
+mcr m380
+inc r4
+endmcr
+mcr m381
+inc r5
+endmcr
+mcr m382
+inc r6
+endmcr
+mcr m383
+inc r7
+endmcr
+mcr m384
+inc r0
+endmcr
+mcr m385
+inc r1
+endmcr
+mcr m386
+inc r2
+endmcr
+mcr m387
+inc r3
+endmcr
+mcr m388
+inc r4
+endmcr
+mcr m389
+inc r5
+endmcr
+mcr m390
+inc r6
+endmcr
+mcr m391
+inc r7
+endmcr
+mcr m392
+inc r0
+endmcr
+mcr m393
+inc r1
+endmcr
+mcr m394
+inc r2
+endmcr
+mcr m395
+inc r3
+endmcr
+mcr m396
+inc r4
+endmcr
+mcr m397
+inc r5
+endmcr
+mcr m398
+inc r6
+endmcr
+mcr m399
+inc r7
+endmcr
+mcr m400
+inc r0
+endmcr
+mcr m401
+inc r1
+endmcr
+mcr m402
+inc r2
+endmcr
+mcr m403
+inc r3
+endmcr
+mcr m404
+inc r4
+endmcr
+mcr m405
+inc r5
+endmcr
+mcr m406
+inc r6
+endmcr
+mcr m407
+inc r7
+endmcr
+mcr m408
+inc r0
+endmcr
+mcr m409
+inc r1
+endmcr
+mcr m410
+inc r2
+endmcr
+mcr m411
+inc r3
+endmcr
+mcr m412
+inc r4
+endmcr
+mcr m413
+inc r5
+endmcr
+mcr m414
+inc r6
+endmcr
+mcr m415
+inc r7
+endmcr
+mcr m416
+inc r0
+endmcr
+mcr m417
+inc r1
+endmcr
+mcr m418
+inc r2
+endmcr
+mcr m419
+inc r3
+endmcr
+mcr m420
+inc r4
+endmcr
+mcr m421
+inc r5
+endmcr
+mcr m422
+inc r6
+endmcr
+mcr m423
+inc r7
+endmcr
+mcr m424
+inc r0
+endmcr
+mcr m425
+inc r1
+endmcr
+mcr m426
+inc r2
+endmcr
+mcr m427
+inc r3
+endmcr
+mcr m428
+inc r4
+endmcr
+mcr m429
+inc r5
+endmcr
+mcr m430
+inc r6
+endmcr
+mcr m431
+inc r7
+endmcr
+mcr m432
+inc r0
+endmcr
+mcr m433
+inc r1
+endmcr
+mcr m434
+inc r2
+endmcr
+mcr m435
+inc r3
+endmcr
+mcr m436
+inc r4
+endmcr
+mcr m437
+inc r5
+endmcr
+mcr m438
+inc r6
+endmcr
+mcr m439
+inc r7
+endmcr
+mcr m440
+inc r0
+endmcr
+mcr m441
+inc r1
+endmcr
+mcr m442
+inc r2
+endmcr
+mcr m443
+inc r3
+endmcr
+mcr m444
+inc r4
+endmcr
+mcr m445
+inc r5
+endmcr
+mcr m446
+inc r6
+endmcr
+mcr m447
+inc r7
+endmcr
+mcr m448
+inc r0
+endmcr
+mcr m449
+inc r1
+endmcr
+mcr m450
+inc r2
+endmcr
+mcr m451
+inc r3
+endmcr
+mcr m452
+inc r4
+endmcr
+mcr m453
+inc r5
+endmcr
+mcr m454
+inc r6
+endmcr
+mcr m455
+inc r7
+endmcr
+mcr m456
+inc r0
+endmcr
+mcr m457
+inc r1
+endmcr
+mcr m458
+inc r2
+endmcr
+mcr m459
+inc r3
+endmcr
+mcr m460
+inc r4
+endmcr
+mcr m461
+inc r5
+endmcr
+mcr m462
+inc r6
+endmcr
+mcr m463
+inc r7
+endmcr
+mcr m464
+inc r0
+endmcr
+mcr m465
+inc r1
+endmcr
+mcr m466
+inc r2
+endmcr
+mcr m467
+inc r3
+endmcr
+mcr m468
+inc r4
+endmcr
+mcr m469
+inc r5
+endmcr
+mcr m470
+inc r6
+endmcr
+mcr m471
+inc r7
+endmcr
+mcr m472
+inc r0
+endmcr
+mcr m473
+inc r1
+endmcr
+mcr m474
+inc r2
+endmcr
+mcr m475
+inc r3
+endmcr
+mcr m476
+inc r4
+endmcr
+mcr m477
+inc r5
+endmcr
+mcr m478
+inc r6
+endmcr
+mcr m479
+inc r7
+endmcr
+mcr m480
+inc r0
+endmcr
+mcr m481
+inc r1
+endmcr
+mcr m482
+inc r2
+endmcr
+mcr m483
+inc r3
+endmcr
+mcr m484
+inc r4
+endmcr
+mcr m485
+inc r5
+endmcr
+mcr m486
+inc r6
+endmcr
+mcr m487
+inc r7
+endmcr
+mcr m488
+inc r0
+endmcr
+mcr m489
+inc r1
+endmcr
+mcr m490
+inc r2
+endmcr
+mcr m491
+inc r3
+endmcr
+mcr m492
+inc r4
+endmcr
+mcr m493
+inc r5
+endmcr
+mcr m494
+inc r6
+endmcr
+mcr m495
+inc r7
+endmcr
+mcr m496
+inc r0
+endmcr
+mcr m497
+inc r1
+endmcr
+mcr m498
+inc r2
+endmcr
+mcr m499
+inc r3
+endmcr
+mcr m500
+inc r4
+endmcr
+mcr m501
+inc r5
+endmcr
+mcr m502
+inc r6
+endmcr
+mcr m503
+inc r7
+endmcr
+mcr m504
+inc r0
+endmcr
+mcr m505
+inc r1
+endmcr
+mcr m506
+inc r2
+endmcr
+mcr m507
+inc r3
+endmcr
+mcr m508
+inc r4
+endmcr
+mcr m509
+inc r5
+endmcr
+mcr m510
+inc r6
+endmcr
+mcr m511
+inc r7
+endmcr
+mcr m512
+inc r0
+endmcr
+mcr m513
+inc r1
+endmcr
+mcr m514
+inc r2
+endmcr
+mcr m515
+inc r3
+endmcr
+mcr m516
+inc r4
+endmcr
+mcr m517
+inc r5
+endmcr
+mcr m518
+inc r6
+endmcr
+mcr m519
+inc r7
+endmcr
+mcr m520
+inc r0
+endmcr
+mcr m521
+inc r1
+endmcr
+mcr m522
+inc r2
+endmcr
+mcr m523
+inc r3
+endmcr
+mcr m524
+inc r4
+endmcr
+mcr m525
+inc r5
+endmcr
+mcr m526
+inc r6
+endmcr
+mcr m527
+inc r7
+endmcr
+mcr m528
+inc r0
+endmcr
+mcr m529
+inc r1
+endmcr
+mcr m530
+inc r2
+endmcr
+mcr m531
+inc r3
+endmcr
+mcr m532
+inc r4
+endmcr
+mcr m533
+inc r5
+endmcr
+mcr m534
+inc r6
+endmcr
+mcr m535
+inc r7
+endmcr
+mcr m536
+inc r0
+endmcr
+mcr m537
+inc r1
+endmcr
+mcr m538
+inc r2
+endmcr
+mcr m539
+inc r3
+endmcr
+mcr m540
+inc r4
+endmcr
+mcr m541
+inc r5
+endmcr
+mcr m542
+inc r6
+endmcr
+mcr m543
+inc r7
+endmcr
+mcr m544
+inc r0
+endmcr
+mcr m545
+inc r1
+endmcr
+mcr m546
+inc r2
+endmcr
+mcr m547
+inc r3
+endmcr
+mcr m548
+inc r4
+endmcr
+mcr m549
+inc r5
+endmcr
+mcr m550
+inc r6
+endmcr
+mcr m551
+inc r7
+endmcr
+mcr m552
+inc r0
+endmcr
+mcr m553
+inc r1
+endmcr
+mcr m554
+inc r2
+endmcr
+mcr m555
+inc r3
+endmcr
+mcr m556
+inc r4
+endmcr
+mcr m557
+inc r5
+endmcr
+mcr m558
+inc r6
+endmcr
+mcr m559
+inc r7
+endmcr
+mcr m560
+inc r0
+endmcr
+mcr m561
+inc r1
+endmcr
+mcr m562
+inc r2
+endmcr
+mcr m563
+inc r3
+endmcr
+mcr m564
+inc r4
+endmcr
+mcr m565
+inc r5
+endmcr
+mcr m566
+inc r6
+endmcr
+mcr m567
+inc r7
+endmcr
+mcr m568
+inc r0
+endmcr
+mcr m569
+inc r1
+endmcr
+mcr m570
+inc r2
+endmcr
+mcr m571
+inc r3
+endmcr
+mcr m572
+inc r4
+endmcr
+mcr m573
+inc r5
+endmcr
+mcr m574
+inc r6
+endmcr
+mcr m575
+inc r7
+endmcr
+mcr m576
+inc r0
+endmcr
+mcr m577
+inc r1
+endmcr
+mcr m578
+inc r2
+endmcr
+mcr m579
+inc r3
+endmcr
+mcr m580
+inc r4
+endmcr
+mcr m581
+inc r5
+endmcr
+mcr m582
+inc r6
+endmcr
+mcr m583
+inc r7
+endmcr
+mcr m584
+inc r0
+endmcr
+mcr m585
+inc r1
+endmcr
+mcr m586
+inc r2
+endmcr
+mcr m587
+inc r3
+endmcr
+mcr m588
+inc r4
+endmcr
+mcr m589
+inc r5
+endmcr
+mcr m590
+inc r6
+endmcr
+mcr m591
+inc r7
+endmcr
+mcr m592
+inc r0
+endmcr
+mcr m593
+inc r1
+endmcr
+mcr m594
+inc r2
+endmcr
+mcr m595
+inc r3
+endmcr
+mcr m596
+inc r4
+endmcr
+mcr m597
+inc r5
+endmcr
+mcr m598
+inc r6
+endmcr
+mcr m599
+inc r7
+endmcr
+mcr m600
+inc r0
+endmcr
+mcr m601
+inc r1
+endmcr
+mcr m602
+inc r2
+endmcr
+mcr m603
+inc r3
+endmcr
+mcr m604
+inc r4
+endmcr
+mcr m605
+inc r5
+endmcr
+mcr m606
+inc r6
+endmcr
+mcr m607
+inc r7
+endmcr
+mcr m608
+inc r0
+endmcr
+mcr m609
+inc r1
+endmcr
+mcr m610
+inc r2
+endmcr
+mcr m611
+inc r3
+endmcr
+mcr m612
+inc r4
+endmcr
+mcr m613
+inc r5
+endmcr
+mcr m614
+inc r6
+endmcr
+mcr m615
+inc r7
+endmcr
+mcr m616
+inc r0
+endmcr
+mcr m617
+inc r1
+endmcr
+mcr m618
+inc r2
+endmcr
+mcr m619
+inc r3
+endmcr
+mcr m620
+inc r4
+endmcr
+mcr m621
+inc r5
+endmcr
+mcr m622
+inc r6
+endmcr
+mcr m623
+inc r7
+endmcr
+mcr m624
+inc r0
+endmcr
+mcr m625
+inc r1
+endmcr
+mcr m626
+inc r2
+endmcr
+mcr m627
+inc r3
+endmcr
+mcr m628
+inc r4
+endmcr
+mcr m629
+inc r5
+endmcr
+mcr m630
+inc r6
+endmcr
+mcr m631
+inc r7
+endmcr
+mcr m632
+inc r0
+endmcr
+mcr m633
+inc r1
+endmcr
+mcr m634
+inc r2
+endmcr
+mcr m635
+inc r3
+endmcr
+mcr m636
+inc r4
+endmcr
+mcr m637
+inc r5
+endmcr
+mcr m638
+inc r6
+endmcr
+mcr m639
+inc r7
+endmcr
+mcr m640
+inc r0
+endmcr
+mcr m641
+inc r1
+endmcr
+mcr m642
+inc r2
+endmcr
+mcr m643
+inc r3
+endmcr
+mcr m644
+inc r4
+endmcr
+mcr m645
+inc r5
+endmcr
+mcr m646
+inc r6
+endmcr
+mcr m647
+inc r7
+endmcr
+mcr m648
+inc r0
+endmcr
+mcr m649
+inc r1
+endmcr
+mcr m650
+inc r2
+endmcr
+mcr m651
+inc r3
+endmcr
+mcr m652
+inc r4
+endmcr
+mcr m653
+inc r5
+endmcr
+mcr m654
+inc r6
+endmcr
+mcr m655
+inc r7
+endmcr
+mcr m656
+inc r0
+endmcr
+mcr m657
+inc r1
+endmcr
+mcr m658
+inc r2
+endmcr
+mcr m659
+inc r3
+endmcr
+mcr m660
+inc r4
+endmcr
+mcr m661
+inc r5
+endmcr
+mcr m662
+inc r6
+endmcr
+mcr m663
+inc r7
+endmcr
+mcr m664
+inc r0
+endmcr
+mcr m665
+inc r1
+endmcr
+mcr m666
+inc r2
+endmcr
+mcr m667
+inc r3
+endmcr
+mcr m668
+inc r4
+endmcr
+mcr m669
+inc r5
+endmcr
+mcr m670
+inc r6
+endmcr
+mcr m671
+inc r7
+endmcr
+mcr m672
+inc r0
+endmcr
+mcr m673
+inc r1
+endmcr
+mcr m674
+inc r2
+endmcr
+mcr m675
+inc r3
+endmcr
+mcr m676
+inc r4
+endmcr
+mcr m677
+inc r5
+endmcr
+mcr m678
+inc r6
+endmcr
+mcr m679
+inc r7
+endmcr
+mcr m680
+inc r0
+endmcr
+mcr m681
+inc r1
+endmcr
+mcr m682
+inc r2
+endmcr
+mcr m683
+inc r3
+endmcr
+mcr m684
+inc r4
+endmcr
+mcr m685
+inc r5
+endmcr
+mcr m686
+inc r6
+endmcr
+mcr m687
+inc r7
+endmcr
+mcr m688
+inc r0
+endmcr
+mcr m689
+inc r1
+endmcr
+mcr m690
+inc r2
+endmcr
+mcr m691
+inc r3
+endmcr
+mcr m692
+inc r4
+endmcr
+mcr m693
+inc r5
+endmcr
+mcr m694
+inc r6
+endmcr
+mcr m695
+inc r7
+endmcr
+mcr m696
+inc r0
+endmcr
+mcr m697
+inc r1
+endmcr
+mcr m698
+inc r2
+endmcr
+mcr m699
+inc r3
+endmcr
+mcr m700
+inc r4
+endmcr
+mcr m701
+inc r5
+endmcr
+mcr m702
+inc r6
+endmcr
+mcr m703
+inc r7
+endmcr
+mcr m704
+inc r0
+endmcr
+mcr m705
+inc r1
+endmcr
+mcr m706
+inc r2
+endmcr
+mcr m707
+inc r3
+endmcr
+mcr m708
+inc r4
+endmcr
+mcr m709
+inc r5
+endmcr
+mcr m710
+inc r6
+endmcr
+mcr m711
+inc r7
+endmcr
+mcr m712
+inc r0
+endmcr
+mcr m713
+inc r1
+endmcr
+mcr m714
+inc r2
+endmcr
+mcr m715
+inc r3
+endmcr
+mcr m716
+inc r4
+endmcr
+mcr m717
+inc r5
+endmcr
+mcr m718
+inc r6
+endmcr
+mcr m719
+inc r7
+endmcr
+mcr m720
+inc r0
+endmcr
+mcr m721
+inc r1
+endmcr
+mcr m722
+inc r2
+endmcr
+mcr m723
+inc r3
+endmcr
+mcr m724
+inc r4
+endmcr
+mcr m725
+inc r5
+endmcr
+mcr m726
+inc r6
+endmcr
+mcr m727
+inc r7
+endmcr
+mcr m728
+inc r0
+endmcr
+mcr m729
+inc r1
+endmcr
+mcr m730
+inc r2
+endmcr
+mcr m731
+inc r3
+endmcr
+mcr m732
+inc r4
+endmcr
+mcr m733
+inc r5
+endmcr
+mcr m734
+inc r6
+endmcr
+mcr m735
+inc r7
+endmcr
+mcr m736
+inc r0
+endmcr
+mcr m737
+inc r1
+endmcr
+mcr m738
+inc r2
+endmcr
+mcr m739
+inc r3
+endmcr
+mcr m740
+inc r4
+endmcr
+mcr m741
+inc r5
+endmcr
+mcr m742
+inc r6
+endmcr
+mcr m743
+inc r7
+endmcr
+mcr m744
+inc r0
+endmcr
+mcr m745
+inc r1
+endmcr
+mcr m746
+inc r2
+endmcr
+mcr m747
+inc r3
+endmcr
+mcr m748
+inc r4
+endmcr
+mcr m749
+inc r5
+endmcr
+mcr m750
+inc r6
+endmcr
+mcr m751
+inc r7
+endmcr
+mcr m752
+inc r0
+endmcr
+mcr m753
+inc r1
+endmcr
+mcr m754
+inc r2
+endmcr
+mcr m755
+inc r3
+endmcr
+mcr m756
+inc r4
+endmcr
+mcr m757
+inc r5
+endmcr
+mcr m758
+inc r6
+endmcr
+mcr m759
+inc r7
+endmcr
+mcr m760
+inc r0
+endmcr
+mcr m761
+inc r1
+endmcr
+mcr m762
+inc r2
+endmcr
+mcr m763
+inc r3
+endmcr
+mcr m764
+inc r4
+endmcr
+mcr m765
+inc r5
+endmcr
+mcr m766
+inc r6
+endmcr
+mcr m767
+inc r7
+endmcr
+mcr m768
+inc r0
+endmcr
+mcr m769
+inc r1
+endmcr
+mcr m770
+inc r2
+endmcr
+mcr m771
+inc r3
+endmcr
+mcr m772
+inc r4
+endmcr
+mcr m773
+inc r5
+endmcr
+mcr m774
+inc r6
+endmcr
+mcr m775
+inc r7
+endmcr
+mcr m776
+inc r0
+endmcr
+mcr m777
+inc r1
+endmcr
+mcr m778
+inc r2
+endmcr
+mcr m779
+inc r3
+endmcr
+mcr m780
+inc r4
+endmcr
+mcr m781
+inc r5
+endmcr
+mcr m782
+inc r6
+endmcr
+mcr m783
+inc r7
+endmcr
+mcr m784
+inc r0
+endmcr
+mcr m785
+inc r1
+endmcr
+mcr m786
+inc r2
+endmcr
+mcr m787
+inc r3
+endmcr
+mcr m788
+inc r4
+endmcr
+mcr m789
+inc r5
+endmcr
+mcr m790
+inc r6
+endmcr
+mcr m791
+inc r7
+endmcr
+mcr m792
+inc r0
+endmcr
+mcr m793
+inc r1
+endmcr
+mcr m794
+inc r2
+endmcr
+mcr m795
+inc r3
+endmcr
+mcr m796
+inc r4
+endmcr
+mcr m797
+inc r5
+endmcr
+mcr m798
+inc r6
+endmcr
+mcr m799
+inc r7
+endmcr
+mcr m800
+inc r0
+endmcr
+mcr m801
+inc r1
+endmcr
+mcr m802
+inc r2
+endmcr
+mcr m803
+inc r3
+endmcr
+mcr m804
+inc r4
+endmcr
+mcr m805
+inc r5
+endmcr
+mcr m806
+inc r6
+endmcr
+mcr m807
+inc r7
+endmcr
+mcr m808
+inc r0
+endmcr
+mcr m809
+inc r1
+endmcr
+mcr m810
+inc r2
+endmcr
+mcr m811
+inc r3
+endmcr
+mcr m812
+inc r4
+endmcr
+mcr m813
+inc r5
+endmcr
+mcr m814
+inc r6
+endmcr
+mcr m815
+inc r7
+endmcr
+mcr m816
+inc r0
+endmcr
+mcr m817
+inc r1
+endmcr
+mcr m818
+inc r2
+endmcr
+mcr m819
+inc r3
+endmcr
+mcr m820
+inc r4
+endmcr
+mcr m821
+inc r5
+endmcr
+mcr m822
+inc r6
+endmcr
+mcr m823
+inc r7
+endmcr
+mcr m824
+inc r0
+endmcr
+mcr m825
+inc r1
+endmcr
+mcr m826
+inc r2
+endmcr
+mcr m827
+inc r3
+endmcr
+mcr m828
+inc r4
+endmcr
+mcr m829
+inc r5
+endmcr
+mcr m830
+inc r6
+endmcr
+mcr m831
+inc r7
+endmcr
+mcr m832
+inc r0
+endmcr
+mcr m833
+inc r1
+endmcr
+mcr m834
+inc r2
+endmcr
+mcr m835
+inc r3
+endmcr
+mcr m836
+inc r4
+endmcr
+mcr m837
+inc r5
+endmcr
+mcr m838
+inc r6
+endmcr
+mcr m839
+inc r7
+endmcr
+mcr m840
+inc r0
+endmcr
+mcr m841
+inc r1
+endmcr
+mcr m842
+inc r2
+endmcr
+mcr m843
+inc r3
+endmcr
+mcr m844
+inc r4
+endmcr
+mcr m845
+inc r5
+endmcr
+mcr m846
+inc r6
+endmcr
+mcr m847
+inc r7
+endmcr
+mcr m848
+inc r0
+endmcr
+mcr m849
+inc r1
+endmcr
+mcr m850
+inc r2
+endmcr
+mcr m851
+inc r3
+endmcr
+mcr m852
+inc r4
+endmcr
+mcr m853
+inc r5
+endmcr
+mcr m854
+inc r6
+endmcr
+mcr m855
+inc r7
+endmcr
+mcr m856
+inc r0
+endmcr
+mcr m857
+inc r1
+endmcr
+mcr m858
+inc r2
+endmcr
+mcr m859
+inc r3
+endmcr
+mcr m860
+inc r4
+endmcr
+mcr m861
+inc r5
+endmcr
+mcr m862
+inc r6
+endmcr
+mcr m863
+inc r7
+endmcr
+mcr m864
+inc r0
+endmcr
+mcr m865
+inc r1
+endmcr
+mcr m866
+inc r2
+endmcr
+mcr m867
+inc r3
+endmcr
+mcr m868
+inc r4
+endmcr
+mcr m869
+inc r5
+endmcr
+mcr m870
+inc r6
+endmcr
+mcr m871
+inc r7
+endmcr
+mcr m872
+inc r0
+endmcr
+mcr m873
+inc r1
+endmcr
+mcr m874
+inc r2
+endmcr
+mcr m875
+inc r3
+endmcr
+mcr m876
+inc r4
+endmcr
+mcr m877
+inc r5
+endmcr
+mcr m878
+inc r6
+endmcr
+mcr m879
+inc r7
+endmcr
+mcr m880
+inc r0
+endmcr
+mcr m881
+inc r1
+endmcr
+mcr m882
+inc r2
+endmcr
+mcr m883
+inc r3
+endmcr
+mcr m884
+inc r4
+endmcr
+mcr m885
+inc r5
+endmcr
+mcr m886
+inc r6
+endmcr
+mcr m887
+inc r7
+endmcr
+mcr m888
+inc r0
+endmcr
+mcr m889
+inc r1
+endmcr
+mcr m890
+inc r2
+endmcr
+mcr m891
+inc r3
+endmcr
+mcr m892
+inc r4
+endmcr
+mcr m893
+inc r5
+endmcr
+mcr m894
+inc r6
+endmcr
+mcr m895
+inc r7
+endmcr
+mcr m896
+inc r0
+endmcr
+mcr m897
+inc r1
+endmcr
+mcr m898
+inc r2
+endmcr
+mcr m899
+inc r3
+endmcr
+mcr m900
+inc r4
+endmcr
+mcr m901
+inc r5
+endmcr
+mcr m902
+inc r6
+endmcr
+mcr m903
+inc r7
+endmcr
+mcr m904
+inc r0
+endmcr
+mcr m905
+inc r1
+endmcr
+mcr m906
+inc r2
+endmcr
+mcr m907
+inc r3
+endmcr
+mcr m908
+inc r4
+endmcr
+mcr m909
+inc r5
+endmcr
+mcr m910
+inc r6
+endmcr
+mcr m911
+inc r7
+endmcr
+mcr m912
+inc r0
+endmcr
+mcr m913
+inc r1
+endmcr
+mcr m914
+inc r2
+endmcr
+mcr m915
+inc r3
+endmcr
+mcr m916
+inc r4
+endmcr
+mcr m917
+inc r5
+endmcr
+mcr m918
+inc r6
+endmcr
+mcr m919
+inc r7
+endmcr
+mcr m920
+inc r0
+endmcr
+mcr m921
+inc r1
+endmcr
+mcr m922
+inc r2
+endmcr
+mcr m923
+inc r3
+endmcr
+mcr m924
+inc r4
+endmcr
+mcr m925
+inc r5
+endmcr
+mcr m926
+inc r6
+endmcr
+mcr m927
+inc r7
+endmcr
+mcr m928
+inc r0
+endmcr
+mcr m929
+inc r1
+endmcr
+mcr m930
+inc r2
+endmcr
+mcr m931
+inc r3
+endmcr
+mcr m932
+inc r4
+endmcr
+mcr m933
+inc r5
+endmcr
+mcr m934
+inc r6
+endmcr
+mcr m935
+inc r7
+endmcr
+mcr m936
+inc r0
+endmcr
+mcr m937
+inc r1
+endmcr
+mcr m938
+inc r2
+endmcr
+mcr m939
+inc r3
+endmcr
+mcr m940
+inc r4
+endmcr
+mcr m941
+inc r5
+endmcr
+mcr m942
+inc r6
+endmcr
+mcr m943
+inc r7
+endmcr
+mcr m944
+inc r0
+endmcr
+mcr m945
+inc r1
+endmcr
+mcr m946
+inc r2
+endmcr
+mcr m947
+inc r3
+endmcr
+mcr m948
+inc r4
+endmcr
+mcr m949
+inc r5
+endmcr
+mcr m950
+inc r6
+endmcr
+mcr m951
+inc r7
+endmcr
+mcr m952
+inc r0
+endmcr
+mcr m953
+inc r1
+endmcr
+mcr m954
+inc r2
+endmcr
+mcr m955
+inc r3
+endmcr
+mcr m956
+inc r4
+endmcr
+mcr m957
+inc r5
+endmcr
+mcr m958
+inc r6
+endmcr
+mcr m959
+inc r7
+endmcr
+mcr m960
+inc r0
+endmcr
+mcr m961
+inc r1
+endmcr
+mcr m962
+inc r2
+endmcr
+mcr m963
+inc r3
+endmcr
+mcr m964
+inc r4
+endmcr
+mcr m965
+inc r5
+endmcr
+mcr m966
+inc r6
+endmcr
+mcr m967
+inc r7
+endmcr
+mcr m968
+inc r0
+endmcr
+mcr m969
+inc r1
+endmcr
+mcr m970
+inc r2
+endmcr
+mcr m971
+inc r3
+endmcr
+mcr m972
+inc r4
+endmcr
+mcr m973
+inc r5
+endmcr
+mcr m974
+inc r6
+endmcr
+mcr m975
+inc r7
+endmcr
+mcr m976
+inc r0
+endmcr
+mcr m977
+inc r1
+endmcr
+mcr m978
+inc r2
+endmcr
+mcr m979
+inc r3
+endmcr
+mcr m980
+inc r4
+endmcr
+mcr m981
+inc r5
+endmcr
+mcr m982
+inc r6
+endmcr
+mcr m983
+inc r7
+endmcr
+mcr m984
+inc r0
+endmcr
+mcr m985
+inc r1
+endmcr
+mcr m986
+inc r2
+endmcr
+mcr m987
+inc r3
+endmcr
+mcr m988
+inc r4
+endmcr
+mcr m989
+inc r5
+endmcr
+mcr m990
+inc r6
+endmcr
+mcr m991
+inc r7
+endmcr
+mcr m992
+inc r0
+endmcr
+mcr m993
+inc r1
+endmcr
+mcr m994
+inc r2
+endmcr
+mcr m995
+inc r3
+endmcr
+mcr m996
+inc r4
+endmcr
+mcr m997
+inc r5
+endmcr
+mcr m998
+inc r6
+endmcr
+mcr m999
+inc r7
+endmcr
+mcr m1000
+inc r0
+endmcr
+mcr m1001
+inc r1
+endmcr
+mcr m1002
+inc r2
+endmcr
+mcr m1003
+inc r3
+endmcr
+mcr m1004
+inc r4
+endmcr
+mcr m1005
+inc r5
+endmcr
+mcr m1006
+inc r6
+endmcr
+mcr m1007
+inc r7
+endmcr
+mcr m1008
+inc r0
+endmcr
+mcr m1009
+inc r1
+endmcr
+mcr m1010
+inc r2
+endmcr
+mcr m1011
+inc r3
+endmcr
+mcr m1012
+inc r4
+endmcr
+mcr m1013
+inc r5
+endmcr
+mcr m1014
+inc r6
+endmcr
+mcr m1015
+inc r7
+endmcr
+mcr m1016
+inc r0
+endmcr
+mcr m1017
+inc r1
+endmcr
+mcr m1018
+inc r2
+endmcr
+mcr m1019
+inc r3
+endmcr
+mcr m1020
+inc r4
+endmcr
+mcr m1021
+inc r5
+endmcr
+mcr m1022
+inc r6
+endmcr
+mcr m1023
+inc r7
+endmcr
+mcr m1024
+inc r0
+endmcr
+mcr m1025
+inc r1
+endmcr
+mcr m1026
+inc r2
+endmcr
+mcr m1027
+inc r3
+endmcr
+mcr m1028
+inc r4
+endmcr
+mcr m1029
+inc r5
+endmcr
+mcr m1030
+inc r6
+endmcr
+mcr m1031
+inc r7
+endmcr
+mcr m1032
+inc r0
+endmcr
+mcr m1033
+inc r1
+endmcr
+mcr m1034
+inc r2
+endmcr
+mcr m1035
+inc r3
+endmcr
+mcr m1036
+inc r4
+endmcr
+mcr m1037
+inc r5
+endmcr
+mcr m1038
+inc r6
+endmcr
+mcr m1039
+inc r7
+endmcr
+mcr m1040
+inc r0
+endmcr
+mcr m1041
+inc r1
+endmcr
+mcr m1042
+inc r2
+endmcr
+mcr m1043
+inc r3
+endmcr
+mcr m1044
+inc r4
+endmcr
+mcr m1045
+inc r5
+endmcr
+mcr m1046
+inc r6
+endmcr
+mcr m1047
+inc r7
+endmcr
+mcr m1048
+inc r0
+endmcr
+mcr m1049
+inc r1
+endmcr
+mcr m1050
+inc r2
+endmcr
+mcr m1051
+inc r3
+endmcr
+mcr m1052
+inc r4
+endmcr
+mcr m1053
+inc r5
+endmcr
+mcr m1054
+inc r6
+endmcr
+mcr m1055
+inc r7
+endmcr
+mcr m1056
+inc r0
+endmcr
+mcr m1057
+inc r1
+endmcr
+mcr m1058
+inc r2
+endmcr
+mcr m1059
+inc r3
+endmcr
+mcr m1060
+inc r4
+endmcr
+mcr m1061
+inc r5
+endmcr
+mcr m1062
+inc r6
+endmcr
+mcr m1063
+inc r7
+endmcr
+mcr m1064
+inc r0
+endmcr
+mcr m1065
+inc r1
+endmcr
+mcr m1066
+inc r2
+endmcr
+mcr m1067
+inc r3
+endmcr
+mcr m1068
+inc r4
+endmcr
+mcr m1069
+inc r5
+endmcr
+mcr m1070
+inc r6
+endmcr
+mcr m1071
+inc r7
+endmcr
+mcr m1072
+inc r0
+endmcr
+mcr m1073
+inc r1
+endmcr
+mcr m1074
+inc r2
+endmcr
+mcr m1075
+inc r3
+endmcr
+mcr m1076
+inc r4
+endmcr
+mcr m1077
+inc r5
+endmcr
+mcr m1078
+inc r6
+endmcr
+mcr m1079
+inc r7
+endmcr
+mcr m1080
+inc r0
+endmcr
+mcr m1081
+inc r1
+endmcr
+mcr m1082
+inc r2
+endmcr
+mcr m1083
+inc r3
+endmcr
+mcr m1084
+inc r4
+endmcr
+mcr m1085
+inc r5
+endmcr
+mcr m1086
+inc r6
+endmcr
+mcr m1087
+inc r7
+endmcr
+mcr m1088
+inc r0
+endmcr
+mcr m1089
+inc r1
+endmcr
+mcr m1090
+inc r2
+endmcr
+mcr m1091
+inc r3
+endmcr
+mcr m1092
+inc r4
+endmcr
+mcr m1093
+inc r5
+endmcr
+mcr m1094
+inc r6
+endmcr
+mcr m1095
+inc r7
+endmcr
+mcr m1096
+inc r0
+endmcr
+mcr m1097
+inc r1
+endmcr
+mcr m1098
+inc r2
+endmcr
+mcr m1099
+inc r3
+endmcr
+mcr m1100
+inc r4
+endmcr
+mcr m1101
+inc r5
+endmcr
+mcr m1102
+inc r6
+endmcr
+mcr m1103
+inc r7
+endmcr
+mcr m1104
+inc r0
+endmcr
+mcr m1105
+inc r1
+endmcr
+mcr m1106
+inc r2
+endmcr
+mcr m1107
+inc r3
+endmcr
+mcr m1108
+inc r4
+endmcr
+mcr m1109
+inc r5
+endmcr
+mcr m1110
+inc r6
+endmcr
+mcr m1111
+inc r7
+endmcr
+mcr m1112
+inc r0
+endmcr
+mcr m1113
+inc r1
+endmcr
+mcr m1114
+inc r2
+endmcr
+mcr m1115
+inc r3
+endmcr
+mcr m1116
+inc r4
+endmcr
+mcr m1117
+inc r5
+endmcr
+mcr m1118
+inc r6
+endmcr
+mcr m1119
+inc r7
+endmcr
+mcr m1120
+inc r0
+endmcr
+mcr m1121
+inc r1
+endmcr
+mcr m1122
+inc r2
+endmcr
+mcr m1123
+inc r3
+endmcr
+mcr m1124
+inc r4
+endmcr
+mcr m1125
+inc r5
+endmcr
+mcr m1126
+inc r6
+endmcr
+mcr m1127
+inc r7
+endmcr
+mcr m1128
+inc r0
+endmcr
+mcr m1129
+inc r1
+endmcr
+mcr m1130
+inc r2
+endmcr
+mcr m1131
+inc r3
+endmcr
+mcr m1132
+inc r4
+endmcr
+mcr m1133
+inc r5
+endmcr
+mcr m1134
+inc r6
+endmcr
+mcr m1135
+inc r7
+endmcr
+mcr m1136
+inc r0
+endmcr
+mcr m1137
+inc r1
+endmcr
+mcr m1138
+inc r2
+endmcr
+mcr m1139
+inc r3
+endmcr
+mcr m1140
+inc r4
+endmcr
+mcr m1141
+inc r5
+endmcr
+mcr m1142
+inc r6
+endmcr
+mcr m1143
+inc r7
+endmcr
+mcr m1144
+inc r0
+endmcr
+mcr m1145
+inc r1
+endmcr
+mcr m1146
+inc r2
+endmcr
+mcr m1147
+inc r3
+endmcr
+mcr m1148
+inc r4
+endmcr
+mcr m1149
+inc r5
+endmcr
+mcr m1150
+inc r6
+endmcr
+mcr m1151
+inc r7
+endmcr
+mcr m1152
+inc r0
+endmcr
+mcr m1153
+inc r1
+endmcr
+mcr m1154
+inc r2
+endmcr
+mcr m1155
+inc r3
+endmcr
+mcr m1156
+inc r4
+endmcr
+mcr m1157
+inc r5
+endmcr
+mcr m1158
+inc r6
+endmcr
+mcr m1159
+inc r7
+endmcr
+mcr m1160
+inc r0
+endmcr
+mcr m1161
+inc r1
+endmcr
+mcr m1162
+inc r2
+endmcr
+mcr m1163
+inc r3
+endmcr
+mcr m1164
+inc r4
+endmcr
+mcr m1165
+inc r5
+endmcr
+mcr m1166
+inc r6
+endmcr
+mcr m1167
+inc r7
+endmcr
+mcr m1168
+inc r0
+endmcr
+mcr m1169
+inc r1
+endmcr
+mcr m1170
+inc r2
+endmcr
+mcr m1171
+inc r3
+endmcr
+mcr m1172
+inc r4
+endmcr
+mcr m1173
+inc r5
+endmcr
+mcr m1174
+inc r6
+endmcr
+mcr m1175
+inc r7
+endmcr
+mcr m1176
+inc r0
+endmcr
+mcr m1177
+inc r1
+endmcr
+mcr m1178
+inc r2
+endmcr
+mcr m1179
+inc r3
+endmcr
+mcr m1180
+inc r4
+endmcr
+mcr m1181
+inc r5
+endmcr
+mcr m1182
+inc r6
+endmcr
+mcr m1183
+inc r7
+endmcr
+mcr m1184
+inc r0
+endmcr
+mcr m1185
+inc r1
+endmcr
+mcr m1186
+inc r2
+endmcr
+mcr m1187
+inc r3
+endmcr
+mcr m1188
+inc r4
+endmcr
+mcr m1189
+inc r5
+endmcr
+mcr m1190
+inc r6
+endmcr
+mcr m1191
+inc r7
+endmcr
+mcr m1192
+inc r0
+endmcr
+mcr m1193
+inc r1
+endmcr
+mcr m1194
+inc r2
+endmcr
+mcr m1195
+inc r3
+endmcr
+mcr m1196
+inc r4
+endmcr
+mcr m1197
+inc r5
+endmcr
+mcr m1198
+inc r6
+endmcr
+mcr m1199
+inc r7
+endmcr
+mcr m1200
+inc r0
+endmcr
+mcr m1201
+inc r1
+endmcr
+mcr m1202
+inc r2
+endmcr
+mcr m1203
+inc r3
+endmcr
+mcr m1204
+inc r4
+endmcr
+mcr m1205
+inc r5
+endmcr
+mcr m1206
+inc r6
+endmcr
+mcr m1207
+inc r7
+endmcr
+mcr m1208
+inc r0
+endmcr
+mcr m1209
+inc r1
+endmcr
+mcr m1210
+inc r2
+endmcr
+mcr m1211
+inc r3
+endmcr
+mcr m1212
+inc r4
+endmcr
+mcr m1213
+inc r5
+endmcr
+mcr m1214
+inc r6
+endmcr
+mcr m1215
+inc r7
+endmcr
+mcr m1216
+inc r0
+endmcr
+mcr m1217
+inc r1
+endmcr
+mcr m1218
+inc r2
+endmcr
+mcr m1219
+inc r3
+endmcr
+mcr m1220
+inc r4
+endmcr
+mcr m1221
+inc r5
+endmcr
+mcr m1222
+inc r6
+endmcr
+mcr m1223
+inc r7
+endmcr
+mcr m1224
+inc r0
+endmcr
+mcr m1225
+inc r1
+endmcr
+mcr m1226
+inc r2
+endmcr
+mcr m1227
+inc r3
+endmcr
+mcr m1228
+inc r4
+endmcr
+mcr m1229
+inc r5
+endmcr
+mcr m1230
+inc r6
+endmcr
+mcr m1231
+inc r7
+endmcr
+mcr m1232
+inc r0
+endmcr
+mcr m1233
+inc r1
+endmcr
+mcr m1234
+inc r2
+endmcr
+mcr m1235
+inc r3
+endmcr
+mcr m1236
+inc r4
+endmcr
+mcr m1237
+inc r5
+endmcr
+mcr m1238
+inc r6
+endmcr
+mcr m1239
+inc r7
+endmcr
+mcr m1240
+inc r0
+endmcr
+mcr m1241
+inc r1
+endmcr
+mcr m1242
+inc r2
+endmcr
+mcr m1243
+inc r3
+endmcr
+mcr m1244
+inc r4
+endmcr
+mcr m1245
+inc r5
+endmcr
+mcr m1246
+inc r6
+endmcr
+mcr m1247
+inc r7
+endmcr
+mcr m1248
+inc r0
+endmcr
+mcr m1249
+inc r1
+endmcr
+mcr m1250
+inc r2
+endmcr
+mcr m1251
+inc r3
+endmcr
+mcr m1252
+inc r4
+endmcr
+mcr m1253
+inc r5
+endmcr
+mcr m1254
+inc r6
+endmcr
+mcr m1255
+inc r7
+endmcr
+mcr m1256
+inc r0
+endmcr
+mcr m1257
+inc r1
+endmcr
+mcr m1258
+inc r2
+endmcr
+mcr m1259
+inc r3
+endmcr
+mcr m1260
+inc r4
+endmcr
+mcr m1261
+inc r5
+endmcr
+mcr m1262
+inc r6
+endmcr
+mcr m1263
+inc r7
+endmcr
+mcr m1264
+inc r0
+endmcr
+mcr m1265
+inc r1
+endmcr
+mcr m1266
+inc r2
+endmcr
+mcr m1267
+inc r3
+endmcr
+mcr m1268
+inc r4
+endmcr
+mcr m1269
+inc r5
+endmcr
+mcr m1270
+inc r6
+endmcr
+mcr m1271
+inc r7
+endmcr
+mcr m1272
+inc r0
+endmcr
+mcr m1273
+inc r1
+endmcr
+mcr m1274
+inc r2
+endmcr
+mcr m1275
+inc r3
+endmcr
+mcr m1276
+inc r4
+endmcr
+mcr m1277
+inc r5
+endmcr
+mcr m1278
+inc r6
+endmcr
+mcr m1279
+inc r7
+endmcr
+mcr m1280
+inc r0
+endmcr
+mcr m1281
+inc r1
+endmcr
+mcr m1282
+inc r2
+endmcr
+mcr m1283
+inc r3
+endmcr
+mcr m1284
+inc r4
+endmcr
+mcr m1285
+inc r5
+endmcr
+mcr m1286
+inc r6
+endmcr
+mcr m1287
+inc r7
+endmcr
+mcr m1288
+inc r0
+endmcr
+mcr m1289
+inc r1
+endmcr
+mcr m1290
+inc r2
+endmcr
+mcr m1291
+inc r3
+endmcr
+mcr m1292
+inc r4
+endmcr
+mcr m1293
+inc r5
+endmcr
+mcr m1294
+inc r6
+endmcr
+mcr m1295
+inc r7
+endmcr
+mcr m1296
+inc r0
+endmcr
+mcr m1297
+inc r1
+endmcr
+mcr m1298
+inc r2
+endmcr
+mcr m1299
+inc r3
+endmcr
+mcr m1300
+inc r4
+endmcr
+mcr m1301
+inc r5
+endmcr
+mcr m1302
+inc r6
+endmcr
+mcr m1303
+inc r7
+endmcr
+mcr m1304
+inc r0
+endmcr
+mcr m1305
+inc r1
+endmcr
+mcr m1306
+inc r2
+endmcr
+mcr m1307
+inc r3
+endmcr
+mcr m1308
+inc r4
+endmcr
+mcr m1309
+inc r5
+endmcr
+mcr m1310
+inc r6
+endmcr
+mcr m1311
+inc r7
+endmcr
+mcr m1312
+inc r0
+endmcr
+mcr m1313
+inc r1
+endmcr
+mcr m1314
+inc r2
+endmcr
+mcr m1315
+inc r3
+endmcr
+mcr m1316
+inc r4
+endmcr
+mcr m1317
+inc r5
+endmcr
+mcr m1318
+inc r6
+endmcr
+mcr m1319
+inc r7
+endmcr
+mcr m1320
+inc r0
+endmcr
+mcr m1321
+inc r1
+endmcr
+mcr m1322
+inc r2
+endmcr
+mcr m1323
+inc r3
+endmcr
+mcr m1324
+inc r4
+endmcr
+mcr m1325
+inc r5
+endmcr
+mcr m1326
+inc r6
+endmcr
+mcr m1327
+inc r7
+endmcr
+mcr m1328
+inc r0
+endmcr
+mcr m1329
+inc r1
+endmcr
+mcr m1330
+inc r2
+endmcr
+mcr m1331
+inc r3
+endmcr
+mcr m1332
+inc r4
+endmcr
+mcr m1333
+inc r5
+endmcr
+mcr m1334
+inc r6
+endmcr
+mcr m1335
+inc r7
+endmcr
+mcr m1336
+inc r0
+endmcr
+mcr m1337
+inc r1
+endmcr
+mcr m1338
+inc r2
+endmcr
+mcr m1339
+inc r3
+endmcr
+mcr m1340
+inc r4
+endmcr
+mcr m1341
+inc r5
+endmcr
+mcr m1342
+inc r6
+endmcr
+mcr m1343
+inc r7
+endmcr
+mcr m1344
+inc r0
+endmcr
+mcr m1345
+inc r1
+endmcr
+mcr m1346
+inc r2
+endmcr
+mcr m1347
+inc r3
+endmcr
+mcr m1348
+inc r4
+endmcr
+mcr m1349
+inc r5
+endmcr
+mcr m1350
+inc r6
+endmcr
+mcr m1351
+inc r7
+endmcr
+mcr m1352
+inc r0
+endmcr
+mcr m1353
+inc r1
+endmcr
+mcr m1354
+inc r2
+endmcr
+mcr m1355
+inc r3
+endmcr
+mcr m1356
+inc r4
+endmcr
+mcr m1357
+inc r5
+endmcr
+mcr m1358
+inc r6
+endmcr
+mcr m1359
+inc r7
+endmcr
+mcr m1360
+inc r0
+endmcr
+mcr m1361
+inc r1
+endmcr
+mcr m1362
+inc r2
+endmcr
+mcr m1363
+inc r3
+endmcr
+mcr m1364
+inc r4
+endmcr
+mcr m1365
+inc r5
+endmcr
+mcr m1366
+inc r6
+endmcr
+mcr m1367
+inc r7
+endmcr
+mcr m1368
+inc r0
+endmcr
+mcr m1369
+inc r1
+endmcr
+mcr m1370
+inc r2
+endmcr
+mcr m1371
+inc r3
+endmcr
+mcr m1372
+inc r4
+endmcr
+mcr m1373
+inc r5
+endmcr
+mcr m1374
+inc r6
+endmcr
+mcr m1375
+inc r7
+endmcr
+mcr m1376
+inc r0
+endmcr
+mcr m1377
+inc r1
+endmcr
+mcr m1378
+inc r2
+endmcr
+mcr m1379
+inc r3
+endmcr
+mcr m1380
+inc r4
+endmcr
+mcr m1381
+inc r5
+endmcr
+mcr m1382
+inc r6
+endmcr
+mcr m1383
+inc r7
+endmcr
+mcr m1384
+inc r0
+endmcr
+mcr m1385
+inc r1
+endmcr
+mcr m1386
+inc r2
+endmcr
+mcr m1387
+inc r3
+endmcr
+mcr m1388
+inc r4
+endmcr
+mcr m1389
+inc r5
+endmcr
+mcr m1390
+inc r6
+endmcr
+mcr m1391
+inc r7
+endmcr
+mcr m1392
+inc r0
+endmcr
+mcr m1393
+inc r1
+endmcr
+mcr m1394
+inc r2
+endmcr
+mcr m1395
+inc r3
+endmcr
+mcr m1396
+inc r4
+endmcr
+mcr m1397
+inc r5
+endmcr
+mcr m1398
+inc r6
+endmcr
+mcr m1399
+inc r7
+endmcr
+mcr m1400
+inc r0
+endmcr
+mcr m1401
+inc r1
+endmcr
+mcr m1402
+inc r2
+endmcr
+mcr m1403
+inc r3
+endmcr
+mcr m1404
+inc r4
+endmcr
+mcr m1405
+inc r5
+endmcr
+mcr m1406
+inc r6
+endmcr
+mcr m1407
+inc r7
+endmcr
+mcr m1408
+inc r0
+endmcr
+mcr m1409
+inc r1
+endmcr
+mcr m1410
+inc r2
+endmcr
+mcr m1411
+inc r3
+endmcr
+mcr m1412
+inc r4
+endmcr
+mcr m1413
+inc r5
+endmcr
+mcr m1414
+inc r6
+endmcr
+mcr m1415
+inc r7
+endmcr
+mcr m1416
+inc r0
+endmcr
+mcr m1417
+inc r1
+endmcr
+mcr m1418
+inc r2
+endmcr
+mcr m1419
+inc r3
+endmcr
+mcr m1420
+inc r4
+endmcr
+mcr m1421
+inc r5
+endmcr
+mcr m1422
+inc r6
+endmcr
+mcr m1423
+inc r7
+endmcr
+mcr m1424
+inc r0
+endmcr
+mcr m1425
+inc r1
+endmcr
+mcr m1426
+inc r2
+endmcr
+mcr m1427
+inc r3
+endmcr
+mcr m1428
+inc r4
+endmcr
+mcr m1429
+inc r5
+endmcr
+mcr m1430
+inc r6
+endmcr
+mcr m1431
+inc r7
+endmcr
+mcr m1432
+inc r0
+endmcr
+mcr m1433
+inc r1
+endmcr
+mcr m1434
+inc r2
+endmcr
+mcr m1435
+inc r3
+endmcr
+mcr m1436
+inc r4
+endmcr
+mcr m1437
+inc r5
+endmcr
+mcr m1438
+inc r6
+endmcr
+mcr m1439
+inc r7
+endmcr
+mcr m1440
+inc r0
+endmcr
+mcr m1441
+inc r1
+endmcr
+mcr m1442
+inc r2
+endmcr
+mcr m1443
+inc r3
+endmcr
+mcr m1444
+inc r4
+endmcr
+mcr m1445
+inc r5
+endmcr
+mcr m1446
+inc r6
+endmcr
+mcr m1447
+inc r7
+endmcr
+mcr m1448
+inc r0
+endmcr
+mcr m1449
+inc r1
+endmcr
+mcr m1450
+inc r2
+endmcr
+mcr m1451
+inc r3
+endmcr
+mcr m1452
+inc r4
+endmcr
+mcr m1453
+inc r5
+endmcr
+mcr m1454
+inc r6
+endmcr
+mcr m1455
+inc r7
+endmcr
+mcr m1456
+inc r0
+endmcr
+mcr m1457
+inc r1
+endmcr
+mcr m1458
+inc r2
+endmcr
+mcr m1459
+inc r3
+endmcr
+mcr m1460
+inc r4
+endmcr
+mcr m1461
+inc r5
+endmcr
+mcr m1462
+inc r6
+endmcr
+mcr m1463
+inc r7
+endmcr
+mcr m1464
+inc r0
+endmcr
+mcr m1465
+inc r1
+endmcr
+mcr m1466
+inc r2
+endmcr
+mcr m1467
+inc r3
+endmcr
+mcr m1468
+inc r4
+endmcr
+mcr m1469
+inc r5
+endmcr
+mcr m1470
+inc r6
+endmcr
+mcr m1471
+inc r7
+endmcr
+mcr m1472
+inc r0
+endmcr
+mcr m1473
+inc r1
+endmcr
+mcr m1474
+inc r2
+endmcr
+mcr m1475
+inc r3
+endmcr
+mcr m1476
+inc r4
+endmcr
+mcr m1477
+inc r5
+endmcr
+mcr m1478
+inc r6
+endmcr
+mcr m1479
+inc r7
+endmcr
+mcr m1480
+inc r0
+endmcr
+mcr m1481
+inc r1
+endmcr
+mcr m1482
+inc r2
+endmcr
+mcr m1483
+inc r3
+endmcr
+mcr m1484
+inc r4
+endmcr
+mcr m1485
+inc r5
+endmcr
+mcr m1486
+inc r6
+endmcr
+mcr m1487
+inc r7
+endmcr
+mcr m1488
+inc r0
+endmcr
+mcr m1489
+inc r1
+endmcr
+mcr m1490
+inc r2
+endmcr
+mcr m1491
+inc r3
+endmcr
+mcr m1492
+inc r4
+endmcr
+mcr m1493
+inc r5
+endmcr
+mcr m1494
+inc r6
+endmcr
+mcr m1495
+inc r7
+endmcr
+mcr m1496
+inc r0
+endmcr
+mcr m1497
+inc r1
+endmcr
+mcr m1498
+inc r2
+endmcr
+mcr m1499
+inc r3
+endmcr
+mcr m1500
+inc r4
+endmcr
+mcr m1501
+inc r5
+endmcr
+mcr m1502
+inc r6
+endmcr
+mcr m1503
+inc r7
+endmcr
+mcr m1504
+inc r0
+endmcr
+mcr m1505
+inc r1
+endmcr
+mcr m1506
+inc r2
+endmcr
+mcr m1507
+inc r3
+endmcr
+mcr m1508
+inc r4
+endmcr
+mcr m1509
+inc r5
+endmcr
+mcr m1510
+inc r6
+endmcr
+mcr m1511
+inc r7
+endmcr
+mcr m1512
+inc r0
+endmcr
+mcr m1513
+inc r1
+endmcr
+mcr m1514
+inc r2
+endmcr
+mcr m1515
+inc r3
+endmcr
+mcr m1516
+inc r4
+endmcr
+mcr m1517
+inc r5
+endmcr
+mcr m1518
+inc r6
+endmcr
+mcr m1519
+inc r7
+endmcr
+mcr m1520
+inc r0
+endmcr
+mcr m1521
+inc r1
+endmcr
+mcr m1522
+inc r2
+endmcr
+mcr m1523
+inc r3
+endmcr
+mcr m1524
+inc r4
+endmcr
+mcr m1525
+inc r5
+endmcr
+mcr m1526
+inc r6
+endmcr
+mcr m1527
+inc r7
+endmcr
+mcr m1528
+inc r0
+endmcr
+mcr m1529
+inc r1
+endmcr
+mcr m1530
+inc r2
+endmcr
+mcr m1531
+inc r3
+endmcr
+mcr m1532
+inc r4
+endmcr
+mcr m1533
+inc r5
+endmcr
+mcr m1534
+inc r6
+endmcr
+mcr m1535
+inc r7
+endmcr
+mcr m1536
+inc r0
+endmcr
+mcr m1537
+inc r1
+endmcr
+mcr m1538
+inc r2
+endmcr
+mcr m1539
+inc r3
+endmcr
+mcr m1540
+inc r4
+endmcr
+mcr m1541
+inc r5
+endmcr
+mcr m1542
+inc r6
+endmcr
+mcr m1543
+inc r7
+endmcr
+mcr m1544
+inc r0
+endmcr
+mcr m1545
+inc r1
+endmcr
+mcr m1546
+inc r2
+endmcr
+mcr m1547
+inc r3
+endmcr
+mcr m1548
+inc r4
+endmcr
+mcr m1549
+inc r5
+endmcr
+mcr m1550
+inc r6
+endmcr
+mcr m1551
+inc r7
+endmcr
+mcr m1552
+inc r0
+endmcr
+mcr m1553
+inc r1
+endmcr
+mcr m1554
+inc r2
+endmcr
+mcr m1555
+inc r3
+endmcr
+mcr m1556
+inc r4
+endmcr
+mcr m1557
+inc r5
+endmcr
+mcr m1558
+inc r6
+endmcr
+mcr m1559
+inc r7
+endmcr
+mcr m1560
+inc r0
+endmcr
+mcr m1561
+inc r1
+endmcr
+mcr m1562
+inc r2
+endmcr
+mcr m1563
+inc r3
+endmcr
+mcr m1564
+inc r4
+endmcr
+mcr m1565
+inc r5
+endmcr
+mcr m1566
+inc r6
+endmcr
+mcr m1567
+inc r7
+endmcr
+mcr m1568
+inc r0
+endmcr
+mcr m1569
+inc r1
+endmcr
+mcr m1570
+inc r2
+endmcr
+mcr m1571
+inc r3
+endmcr
+mcr m1572
+inc r4
+endmcr
+mcr m1573
+inc r5
+endmcr
+mcr m1574
+inc r6
+endmcr
+mcr m1575
+inc r7
+endmcr
+mcr m1576
+inc r0
+endmcr
+mcr m1577
+inc r1
+endmcr
+mcr m1578
+inc r2
+endmcr
+mcr m1579
+inc r3
+endmcr
+mcr m1580
+inc r4
+endmcr
+mcr m1581
+inc r5
+endmcr
+mcr m1582
+inc r6
+endmcr
+mcr m1583
+inc r7
+endmcr
+mcr m1584
+inc r0
+endmcr
+mcr m1585
+inc r1
+endmcr
+mcr m1586
+inc r2
+endmcr
+mcr m1587
+inc r3
+endmcr
+mcr m1588
+inc r4
+endmcr
+mcr m1589
+inc r5
+endmcr
+mcr m1590
+inc r6
+endmcr
+mcr m1591
+inc r7
+endmcr
+mcr m1592
+inc r0
+endmcr
+mcr m1593
+inc r1
+endmcr
+mcr m1594
+inc r2
+endmcr
+mcr m1595
+inc r3
+endmcr
+mcr m1596
+inc r4
+endmcr
+mcr m1597
+inc r5
+endmcr
+mcr m1598
+inc r6
+endmcr
+mcr m1599
+inc r7
+endmcr
+mcr m1600
+inc r0
+endmcr
+mcr m1601
+inc r1
+endmcr
+mcr m1602
+inc r2
+endmcr
+mcr m1603
+inc r3
+endmcr
+mcr m1604
+inc r4
+endmcr
+mcr m1605
+inc r5
+endmcr
+mcr m1606
+inc r6
+endmcr
+mcr m1607
+inc r7
+endmcr
+mcr m1608
+inc r0
+endmcr
+mcr m1609
+inc r1
+endmcr
+mcr m1610
+inc r2
+endmcr
+mcr m1611
+inc r3
+endmcr
+mcr m1612
+inc r4
+endmcr
+mcr m1613
+inc r5
+endmcr
+mcr m1614
+inc r6
+endmcr
+mcr m1615
+inc r7
+endmcr
+mcr m1616
+inc r0
+endmcr
+mcr m1617
+inc r1
+endmcr
+mcr m1618
+inc r2
+endmcr
+mcr m1619
+inc r3
+endmcr
+mcr m1620
+inc r4
+endmcr
+mcr m1621
+inc r5
+endmcr
+mcr m1622
+inc r6
+endmcr
+mcr m1623
+inc r7
+endmcr
+mcr m1624
+inc r0
+endmcr
+mcr m1625
+inc r1
+endmcr
+mcr m1626
+inc r2
+endmcr
+mcr m1627
+inc r3
+endmcr
+mcr m1628
+inc r4
+endmcr
+mcr m1629
+inc r5
+endmcr
+mcr m1630
+inc r6
+endmcr
+mcr m1631
+inc r7
+endmcr
+mcr m1632
+inc r0
+endmcr
+mcr m1633
+inc r1
+endmcr
+mcr m1634
+inc r2
+endmcr
+mcr m1635
+inc r3
+endmcr
+mcr m1636
+inc r4
+endmcr
+mcr m1637
+inc r5
+endmcr
+mcr m1638
+inc r6
+endmcr
+mcr m1639
+inc r7
+endmcr
+mcr m1640
+inc r0
+endmcr
+mcr m1641
+inc r1
+endmcr
+mcr m1642
+inc r2
+endmcr
+mcr m1643
+inc r3
+endmcr
+mcr m1644
+inc r4
+endmcr
+mcr m1645
+inc r5
+endmcr
+mcr m1646
+inc r6
+endmcr
+mcr m1647
+inc r7
+endmcr
+mcr m1648
+inc r0
+endmcr
+mcr m1649
+inc r1
+endmcr
+mcr m1650
+inc r2
+endmcr
+mcr m1651
+inc r3
+endmcr
+mcr m1652
+inc r4
+endmcr
+mcr m1653
+inc r5
+endmcr
+mcr m1654
+inc r6
+endmcr
+mcr m1655
+inc r7
+endmcr
+mcr m1656
+inc r0
+endmcr
+mcr m1657
+inc r1
+endmcr
+mcr m1658
+inc r2
+endmcr
+mcr m1659
+inc r3
+endmcr
+mcr m1660
+inc r4
+endmcr
+mcr m1661
+inc r5
+endmcr
+mcr m1662
+inc r6
+endmcr
+mcr m1663
+inc r7
+endmcr
+mcr m1664
+inc r0
+endmcr
+mcr m1665
+inc r1
+endmcr
+mcr m1666
+inc r2
+endmcr
+mcr m1667
+inc r3
+endmcr
+mcr m1668
+inc r4
+endmcr
+mcr m1669
+inc r5
+endmcr
+mcr m1670
+inc r6
+endmcr
+mcr m1671
+inc r7
+endmcr
+mcr m1672
+inc r0
+endmcr
+mcr m1673
+inc r1
+endmcr
+mcr m1674
+inc r2
+endmcr
+mcr m1675
+inc r3
+endmcr
+mcr m1676
+inc r4
+endmcr
+mcr m1677
+inc r5
+endmcr
+mcr m1678
+inc r6
+endmcr
+mcr m1679
+inc r7
+endmcr
+mcr m1680
+inc r0
+endmcr
+mcr m1681
+inc r1
+endmcr
+mcr m1682
+inc r2
+endmcr
+mcr m1683
+inc r3
+endmcr
+mcr m1684
+inc r4
+endmcr
+mcr m1685
+inc r5
+endmcr
+mcr m1686
+inc r6
+endmcr
+mcr m1687
+inc r7
+endmcr
+mcr m1688
+inc r0
+endmcr
+mcr m1689
+inc r1
+endmcr
+mcr m1690
+inc r2
+endmcr
+mcr m1691
+inc r3
+endmcr
+mcr m1692
+inc r4
+endmcr
+mcr m1693
+inc r5
+endmcr
+mcr m1694
+inc r6
+endmcr
+mcr m1695
+inc r7
+endmcr
+mcr m1696
+inc r0
+endmcr
+mcr m1697
+inc r1
+endmcr
+mcr m1698
+inc r2
+endmcr
+mcr m1699
+inc r3
+endmcr
+mcr m1700
+inc r4
+endmcr
+mcr m1701
+inc r5
+endmcr
+mcr m1702
+inc r6
+endmcr
+mcr m1703
+inc r7
+endmcr
+mcr m1704
+inc r0
+endmcr
+mcr m1705
+inc r1
+endmcr
+mcr m1706
+inc r2
+endmcr
+mcr m1707
+inc r3
+endmcr
+mcr m1708
+inc r4
+endmcr
+mcr m1709
+inc r5
+endmcr
+mcr m1710
+inc r6
+endmcr
+mcr m1711
+inc r7
+endmcr
+mcr m1712
+inc r0
+endmcr
+mcr m1713
+inc r1
+endmcr
+mcr m1714
+inc r2
+endmcr
+mcr m1715
+inc r3
+endmcr
+mcr m1716
+inc r4
+endmcr
+mcr m1717
+inc r5
+endmcr
+mcr m1718
+inc r6
+endmcr
+mcr m1719
+inc r7
+endmcr
+mcr m1720
+inc r0
+endmcr
+mcr m1721
+inc r1
+endmcr
+mcr m1722
+inc r2
+endmcr
+mcr m1723
+inc r3
+endmcr
+mcr m1724
+inc r4
+endmcr
+mcr m1725
+inc r5
+endmcr
+mcr m1726
+inc r6
+endmcr
+mcr m1727
+inc r7
+endmcr
+mcr m1728
+inc r0
+endmcr
+mcr m1729
+inc r1
+endmcr
+mcr m1730
+inc r2
+endmcr
+mcr m1731
+inc r3
+endmcr
+mcr m1732
+inc r4
+endmcr
+mcr m1733
+inc r5
+endmcr
+mcr m1734
+inc r6
+endmcr
+mcr m1735
+inc r7
+endmcr
+mcr m1736
+inc r0
+endmcr
+mcr m1737
+inc r1
+endmcr
+mcr m1738
+inc r2
+endmcr
+mcr m1739
+inc r3
+endmcr
+mcr m1740
+inc r4
+endmcr
+mcr m1741
+inc r5
+endmcr
+mcr m1742
+inc r6
+endmcr
+mcr m1743
+inc r7
+endmcr
+mcr m1744
+inc r0
+endmcr
+mcr m1745
+inc r1
+endmcr
+mcr m1746
+inc r2
+endmcr
+mcr m1747
+inc r3
+endmcr
+mcr m1748
+inc r4
+endmcr
+mcr m1749
+inc r5
+endmcr
+mcr m1750
+inc r6
+endmcr
+mcr m1751
+inc r7
+endmcr
+mcr m1752
+inc r0
+endmcr
+mcr m1753
+inc r1
+endmcr
+mcr m1754
+inc r2
+endmcr
+mcr m1755
+inc r3
+endmcr
+mcr m1756
+inc r4
+endmcr
+mcr m1757
+inc r5
+endmcr
+mcr m1758
+inc r6
+endmcr
+mcr m1759
+inc r7
+endmcr
+mcr m1760
+inc r0
+endmcr
+mcr m1761
+inc r1
+endmcr
+mcr m1762
+inc r2
+endmcr
+mcr m1763
+inc r3
+endmcr
+mcr m1764
+inc r4
+endmcr
+mcr m1765
+inc r5
+endmcr
+mcr m1766
+inc r6
+endmcr
+mcr m1767
+inc r7
+endmcr
+mcr m1768
+inc r0
+endmcr
+mcr m1769
+inc r1
+endmcr
+mcr m1770
+inc r2
+endmcr
+mcr m1771
+inc r3
+endmcr
+mcr m1772
+inc r4
+endmcr
+mcr m1773
+inc r5
+endmcr
+mcr m1774
+inc r6
+endmcr
+mcr m1775
+inc r7
+endmcr
+mcr m1776
+inc r0
+endmcr
+mcr m1777
+inc r1
+endmcr
+mcr m1778
+inc r2
+endmcr
+mcr m1779
+inc r3
+endmcr
+mcr m1780
+inc r4
+endmcr
+mcr m1781
+inc r5
+endmcr
+mcr m1782
+inc r6
+endmcr
+mcr m1783
+inc r7
+endmcr
+mcr m1784
+inc r0
+endmcr
+mcr m1785
+inc r1
+endmcr
+mcr m1786
+inc r2
+endmcr
+mcr m1787
+inc r3
+endmcr
+mcr m1788
+inc r4
+endmcr
+mcr m1789
+inc r5
+endmcr
+mcr m1790
+inc r6
+endmcr
+mcr m1791
+inc r7
+endmcr
+mcr m1792
+inc r0
+endmcr
+mcr m1793
+inc r1
+endmcr
+mcr m1794
+inc r2
+endmcr
+mcr m1795
+inc r3
+endmcr
+mcr m1796
+inc r4
+endmcr
+mcr m1797
+inc r5
+endmcr
+mcr m1798
+inc r6
+endmcr
+mcr m1799
+inc r7
+endmcr
+mcr m1800
+inc r0
+endmcr
+mcr m1801
+inc r1
+endmcr
+mcr m1802
+inc r2
+endmcr
+mcr m1803
+inc r3
+endmcr
+mcr m1804
+inc r4
+endmcr
+mcr m1805
+inc r5
+endmcr
+mcr m1806
+inc r6
+endmcr
+mcr m1807
+inc r7
+endmcr
+mcr m1808
+inc r0
+endmcr
+mcr m1809
+inc r1
+endmcr
+mcr m1810
+inc r2
+endmcr
+mcr m1811
+inc r3
+endmcr
+mcr m1812
+inc r4
+endmcr
+mcr m1813
+inc r5
+endmcr
+mcr m1814
+inc r6
+endmcr
+mcr m1815
+inc r7
+endmcr
+mcr m1816
+inc r0
+endmcr
+mcr m1817
+inc r1
+endmcr
+mcr m1818
+inc r2
+endmcr
+mcr m1819
+inc r3
+endmcr
+mcr m1820
+inc r4
+endmcr
+mcr m1821
+inc r5
+endmcr
+mcr m1822
+inc r6
+endmcr
+mcr m1823
+inc r7
+endmcr
+mcr m1824
+inc r0
+endmcr
+mcr m1825
+inc r1
+endmcr
+mcr m1826
+inc r2
+endmcr
+mcr m1827
+inc r3
+endmcr
+mcr m1828
+inc r4
+endmcr
+mcr m1829
+inc r5
+endmcr
+mcr m1830
+inc r6
+endmcr
+mcr m1831
+inc r7
+endmcr
+mcr m1832
+inc r0
+endmcr
+mcr m1833
+inc r1
+endmcr
+mcr m1834
+inc r2
+endmcr
+mcr m1835
+inc r3
+endmcr
+mcr m1836
+inc r4
+endmcr
+mcr m1837
+inc r5
+endmcr
+mcr m1838
+inc r6
+endmcr
+mcr m1839
+inc r7
+endmcr
+mcr m1840
+inc r0
+endmcr
+mcr m1841
+inc r1
+endmcr
+mcr m1842
+inc r2
+endmcr
+mcr m1843
+inc r3
+endmcr
+mcr m1844
+inc r4
+endmcr
+mcr m1845
+inc r5
+endmcr
+mcr m1846
+inc r6
+endmcr
+mcr m1847
+inc r7
+endmcr
+mcr m1848
+inc r0
+endmcr
+mcr m1849
+inc r1
+endmcr
+mcr m1850
+inc r2
+endmcr
+mcr m1851
+inc r3
+endmcr
+mcr m1852
+inc r4
+endmcr
+mcr m1853
+inc r5
+endmcr
+mcr m1854
+inc r6
+endmcr
+mcr m1855
+inc r7
+endmcr
+mcr m1856
+inc r0
+endmcr
+mcr m1857
+inc r1
+endmcr
+mcr m1858
+inc r2
+endmcr
+mcr m1859
+inc r3
+endmcr
+mcr m1860
+inc r4
+endmcr
+mcr m1861
+inc r5
+endmcr
+mcr m1862
+inc r6
+endmcr
+mcr m1863
+inc r7
+endmcr
+mcr m1864
+inc r0
+endmcr
+mcr m1865
+inc r1
+endmcr
+mcr m1866
+inc r2
+endmcr
+mcr m1867
+inc r3
+endmcr
+mcr m1868
+inc r4
+endmcr
+mcr m1869
+inc r5
+endmcr
+mcr m1870
+inc r6
+endmcr
+mcr m1871
+inc r7
+endmcr
+mcr m1872
+inc r0
+endmcr
+mcr m1873
+inc r1
+endmcr
+mcr m1874
+inc r2
+endmcr
+mcr m1875
+inc r3
+endmcr
+mcr m1876
+inc r4
+endmcr
+mcr m1877
+inc r5
+endmcr
+mcr m1878
+inc r6
+endmcr
+mcr m1879
+inc r7
+endmcr
+mcr m1880
+inc r0
+endmcr
+mcr m1881
+inc r1
+endmcr
+mcr m1882
+inc r2
+endmcr
+mcr m1883
+inc r3
+endmcr
+mcr m1884
+inc r4
+endmcr
+mcr m1885
+inc r5
+endmcr
+mcr m1886
+inc r6
+endmcr
+mcr m1887
+inc r7
+endmcr
+mcr m1888
+inc r0
+endmcr
+mcr m1889
+inc r1
+endmcr
+mcr m1890
+inc r2
+endmcr
+mcr m1891
+inc r3
+endmcr
+mcr m1892
+inc r4
+endmcr
+mcr m1893
+inc r5
+endmcr
+mcr m1894
+inc r6
+endmcr
+mcr m1895
+inc r7
+endmcr
+mcr m1896
+inc r0
+endmcr
+mcr m1897
+inc r1
+endmcr
+mcr m1898
+inc r2
+endmcr
+mcr m1899
+inc r3
+endmcr
+mcr m1900
+inc r4
+endmcr
+mcr m1901
+inc r5
+endmcr
+mcr m1902
+inc r6
+endmcr
+mcr m1903
+inc r7
+endmcr
+mcr m1904
+inc r0
+endmcr
+mcr m1905
+inc r1
+endmcr
+mcr m1906
+inc r2
+endmcr
+mcr m1907
+inc r3
+endmcr
+mcr m1908
+inc r4
+endmcr
+mcr m1909
+inc r5
+endmcr
+mcr m1910
+inc r6
+endmcr
+mcr m1911
+inc r7
+endmcr
+mcr m1912
+inc r0
+endmcr
+mcr m1913
+inc r1
+endmcr
+mcr m1914
+inc r2
+endmcr
+mcr m1915
+inc r3
+endmcr
+mcr m1916
+inc r4
+endmcr
+mcr m1917
+inc r5
+endmcr
+mcr m1918
+inc r6
+endmcr
+mcr m1919
+inc r7
+endmcr
+mcr m1920
+inc r0
+endmcr
+mcr m1921
+inc r1
+endmcr
+mcr m1922
+inc r2
+endmcr
+mcr m1923
+inc r3
+endmcr
+mcr m1924
+inc r4
+endmcr
+mcr m1925
+inc r5
+endmcr
+mcr m1926
+inc r6
+endmcr
+mcr m1927
+inc r7
+endmcr
+mcr m1928
+inc r0
+endmcr
+mcr m1929
+inc r1
+endmcr
+mcr m1930
+inc r2
+endmcr
+mcr m1931
+inc r3
+endmcr
+mcr m1932
+inc r4
+endmcr
+mcr m1933
+inc r5
+endmcr
+mcr m1934
+inc r6
+endmcr
+mcr m1935
+inc r7
+endmcr
+mcr m1936
+inc r0
+endmcr
+mcr m1937
+inc r1
+endmcr
+mcr m1938
+inc r2
+endmcr
+mcr m1939
+inc r3
+endmcr
+mcr m1940
+inc r4
+endmcr
+mcr m1941
+inc r5
+endmcr
+mcr m1942
+inc r6
+endmcr
+mcr m1943
+inc r7
+endmcr
+mcr m1944
+inc r0
+endmcr
+mcr m1945
+inc r1
+endmcr
+mcr m1946
+inc r2
+endmcr
+mcr m1947
+inc r3
+endmcr
+mcr m1948
+inc r4
+endmcr
+mcr m1949
+inc r5
+endmcr
+mcr m1950
+inc r6
+endmcr
+mcr m1951
+inc r7
+endmcr
+mcr m1952
+inc r0
+endmcr
+mcr m1953
+inc r1
+endmcr
+mcr m1954
+inc r2
+endmcr
+mcr m1955
+inc r3
+endmcr
+mcr m1956
+inc r4
+endmcr
+mcr m1957
+inc r5
+endmcr
+mcr m1958
+inc r6
+endmcr
+mcr m1959
+inc r7
+endmcr
+mcr m1960
+inc r0
+endmcr
+mcr m1961
+inc r1
+endmcr
+mcr m1962
+inc r2
+endmcr
+mcr m1963
+inc r3
+endmcr
+mcr m1964
+inc r4
+endmcr
+mcr m1965
+inc r5
+endmcr
+mcr m1966
+inc r6
+endmcr
+mcr m1967
+inc r7
+endmcr
+mcr m1968
+inc r0
+endmcr
+mcr m1969
+inc r1
+endmcr
+mcr m1970
+inc r2
+endmcr
+mcr m1971
+inc r3
+endmcr
+mcr m1972
+inc r4
+endmcr
+mcr m1973
+inc r5
+endmcr
+mcr m1974
+inc r6
+endmcr
+mcr m1975
+inc r7
+endmcr
+mcr m1976
+inc r0
+endmcr
+mcr m1977
+inc r1
+endmcr
+mcr m1978
+inc r2
+endmcr
+mcr m1979
+inc r3
+endmcr
+mcr m1980
+inc r4
+endmcr
+mcr m1981
+inc r5
+endmcr
+mcr m1982
+inc r6
+endmcr
+mcr m1983
+inc r7
+endmcr
+mcr m1984
+inc r0
+endmcr
+mcr m1985
+inc r1
+endmcr
+mcr m1986
+inc r2
+endmcr
+mcr m1987
+inc r3
+endmcr
+mcr m1988
+inc r4
+endmcr
+mcr m1989
+inc r5
+endmcr
+mcr m1990
+inc r6
+endmcr
+mcr m1991
+inc r7
+endmcr
+mcr m1992
+inc r0
+endmcr
+mcr m1993
+inc r1
+endmcr
+mcr m1994
+inc r2
+endmcr
+mcr m1995
+inc r3
+endmcr
+mcr m1996
+inc r4
+endmcr
+mcr m1997
+inc r5
+endmcr
+mcr m1998
+inc r6
+endmcr
+mcr m1999
+inc r7
+endmcr
+MAIN: hlt
+m0
+m4
+m8
+m12
+m16
+m20
+m24
+m28
+m32
+m36
+m40
+m44
+m48
+m52
+m56
+m60
+m64
+m68
+m72
+m76
+m80
+m84
+m88
+m92
+m96
+m100
+m104
+m108
+m112
+m116
+m120
+m124
+m128
+m132
+m136
+m140
+m144
+m148
+m152
+m156
+m160
+m164
+m168
+m172
+m176
+m180
+m184
+m188
+m192
+m196
+m200
+m204
+m208
+m212
+m216
+m220
+m224
+m228
+m232
+m236
+m240
+m244
+m248
+m252
+m256
+m260
+m264
+m268
+m272
+m276
+m280
+m284
+m288
+m292
+m296
+m300
+m304
+m308
+m312
+m316
+m320
+m324
+m328
+m332
+m336
+m340
+m344
+m348
+m352
+m356
+m360
+m364
+m368
+m372
+m376
+m380
+m384
+m388
+m392
+m396
+m400
+m404
+m408
+m412
+m416
+m420
+m424
+m428
+m432
+m436
+m440
+m444
+m448
+m452
+m456
+m460
+m464
+m468
+m472
+m476
+m480
+m484
+m488
+m492
+m496
+m500
+m504
+m508
+m512
+m516
+m520
+m524
+m528
+m532
+m536
+m540
+m544
+m548
+m552
+m556
+m560
+m564
+m568
+m572
+m576
+m580
+m584
+m588
+m592
+m596
+m600
+m604
+m608
+m612
+m616
+m620
+m624
+m628
+m632
+m636
+m640
+m644
+m648
+m652
+m656
+m660
+m664
+m668
+m672
+m676
+m680
+m684
+m688
+m692
+m696
+m700
+m704
+m708
+m712
+m716
+m720
+m724
+m728
+m732
+m736
+m740
+m744
+m748
+m752
+m756
+m760
+m764
+m768
+m772
+m776
+m780
+m784
+m788
+m792
+m796
+m800
+m804
+m808
+m812
+m816
+m820
+m824
+m828
+m832
+m836
+m840
+m844
+m848
+m852
+m856
+m860
+m864
+m868
+m872
+m876
+m880
+m884
+m888
+m892
+m896
+m900
+m904
+m908
+m912
+m916
+m920
+m924
+m928
+m932
+m936
+m940
+m944
+m948
+m952
+m956
+m960
+m964
+m968
+m972
+m976
+m980
+m984
+m988
+m992
+m996
+m1000
+m1004
+m1008
+m1012
+m1016
+m1020
+m1024
+m1028
+m1032
+m1036
+m1040
+m1044
+m1048
+m1052
+m1056
+m1060
+m1064
+m1068
+m1072
+m1076
+m1080
+m1084
+m1088
+m1092
+m1096
+m1100
+m1104
+m1108
+m1112
+m1116
+m1120
+m1124
+m1128
+m1132
+m1136
+m1140
+m1144
+m1148
+m1152
+m1156
+m1160
+m1164
+m1168
+m1172
+m1176
+m1180
+m1184
+m1188
+m1192
+m1196
+m1200
+m1204
+m1208
+m1212
+m1216
+m1220
+m1224
+m1228
+m1232
+m1236
+m1240
+m1244
+m1248
+m1252
+m1256
+m1260
+m1264
+m1268
+m1272
+m1276
+m1280
+m1284
+m1288
+m1292
+m1296
+m1300
+m1304
+m1308
+m1312
+m1316
+m1320
+m1324
+m1328
+m1332
+m1336
+m1340
+m1344
+m1348
+m1352
+m1356
+m1360
+m1364
+m1368
+m1372
+m1376
+m1380
+m1384
+m1388
+m1392
+m1396
+m1400
+m1404
+m1408
+m1412
+m1416
+m1420
+m1424
+m1428
+m1432
+m1436
+m1440
+m1444
+m1448
+m1452
+m1456
+m1460
+m1464
+m1468
+m1472
+m1476
+m1480
+m1484
+m1488
+m1492
+m1496
+m1500
+m1504
+m1508
+m1512
+m1516
+m1520
+m1524
+m1528
+m1532
+m1536
+m1540
+m1544
+m1548
+m1552
+m1556
+m1560
+m1564
+m1568
+m1572
+m1576
+m1580
+m1584
+m1588
+m1592
+m1596
+m1600
+m1604
+m1608
+m1612
+m1616
+m1620
+m1624
+m1628
+m1632
+m1636
+m1640
+m1644
+m1648
+m1652
+m1656
+m1660
+m1664
+m1668
+m1672
+m1676
+m1680
+m1684
+m1688
+m1692
+m1696
+m1700
+m1704
+m1708
+m1712
+m1716
+m1720
+m1724
+m1728
+m1732
+m1736
+m1740
+m1744
+m1748
+m1752
+m1756
+m1760
+m1764
+m1768
+m1772
+m1776
+m1780
+m1784
+m1788
+m1792
+m1796
+m1800
+m1804
+m1808
+m1812
+m1816
+m1820
+m1824
+m1828
+m1832
+m1836
+m1840
+m1844
+m1848
+m1852
+m1856
+m1860
+m1864
+m1868
+m1872
+m1876
+m1880
+m1884
+m1888
+m1892
+m1896
+m1900
+m1904
+m1908
+m1912
+m1916
+m1920
+m1924
+m1928
+m1932
+m1936
+m1940
+m1944
+m1948
+m1952
+m1956
+m1960
+m1964
+m1968
+m1972
+m1976
+m1980
+m1984
+m1988
+m1992
+m1996
@@ -0,0 +1,672 @@
+#define _POSIX_C_SOURCE 200809L /* fmemopen, open_memstream, clock_gettime and sigaction */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <signal.h>
+#include <time.h>
+#include <fcntl.h>
+#include <dirent.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include "../global_variables.h"
+#include "../data_tables.h"
+#include "../preprocessor.h"
+#include "../assembler.h"
+#include "../statistics.h"
+
+/*
+ * Performance fuzzer of the assembler: macro processing and both passes of an in-memory source.
+ *
+ * Usage: perf_fuzz [--seconds N] [--runs N] [--max-len N] [--timeout N] [--seed N]
+ *                  [--max-ns-per-byte F] [--max-allocs-per-byte F] [--corpus dir] [seed file ...]
+ *        perf_fuzz --replay dir [--max-ns-per-byte F] [--max-allocs-per-byte F] [--timeout N]
+ *
+ * LLVMFuzzerTestOneInput is a libFuzzer target, it aborts on a pathological input so libFuzzer
+ * saves and minimizes it (the thresholds come from PERF_FUZZ_MAX_NS_PER_BYTE and
+ * PERF_FUZZ_MAX_ALLOCS_PER_BYTE). Without libFuzzer (-DLIBFUZZER), the built-in driver below
+ * mutates the seeds for a bounded time, keeps the mutants that cost the most per byte, and
+ * minimizes every pathological input line by line into the corpus directory. An input is
+ * pathological when its assembly time or its heap allocations per byte exceed the thresholds;
+ * small inputs are measured against a budget of MIN_BUDGET_BYTES bytes, so that the fixed cost
+ * of a run doesn't count against them. Inputs that crash or time out are saved as well.
+ * --replay assembles every input of a corpus and fails if one of them is still pathological,
+ * which makes the corpus a set of performance regression tests.
+ */
+
+#define MIN_BUDGET_BYTES 256
+#define MEASURE_RUNS 3
+#define MAX_POOL 256
+#define MAX_PATH_LENGTH 512
+
+/* Cost of assembling an input */
+struct measurement {
+    double ns;          /* Smallest wall time of the runs, in nanoseconds */
+    long allocations;   /* Heap allocations of a run, deterministic */
+    size_t bytes;       /* Bytes assembled, the larger of the source and its macro expansion */
+};
+
+/* An input kept for mutation */
+struct sample {
+    unsigned char *data;
+    size_t size;
+    double cost;        /* Largest ratio of a cost to its threshold */
+};
+
+static double max_ns_per_byte = 2000;      /* Threshold of the assembly time per byte */
+static double max_allocs_per_byte = 2;     /* Threshold of the heap allocations per byte */
+
+/* Saved when the current input crashes or times out, prepared before the input runs */
+static char crash_path[MAX_PATH_LENGTH];
+static char timeout_path[MAX_PATH_LENGTH];
+static const unsigned char *current_data;
+static size_t current_size;
+
+/* Tokens inserted by the mutations */
+static char *tokens[] = {
+    "mcr m1\n", "endmcr\n", "m1\n", ".define K = 3\n", ".extern X\n", ".entry L\n", ".data 1,2,3\n",
+    ".string \"abc\"\n", "L: ", "X", "K", "mov ", "jsr ", "cmp ", "lea ", "prn ", "hlt\n", "#", "#K",
+    "r1", "r7", "L[2]", "L[K]", ",", " ", "\n", ";", ":", "=", "[", "]", "\"", "-", "+", "9999999"
+};
+
+/* Programs the fuzzer starts from, besides the seed files */
+static char *seed_programs[] = {
+    "MAIN: mov r1, r2\ncmp #3, LIST[1]\nbne END\nprn #-5\nEND: hlt\nLIST: .data 1, 2, 3\nSTR: .string \"ab\"\n",
+    ".define SZ = 4\n.extern W\n.entry MAIN\nMAIN: lea ARR[SZ], r3\njsr W\nhlt\nARR: .data SZ, 5, 6\n",
+    "mcr m1\ninc r1\nmov r1, VAL\nendmcr\nMAIN: m1\nm1\nhlt\nVAL: .data 7\n",
+    ".extern X\n.extern Y\nMAIN: jsr X\njsr Y\nmov X, Y\nhlt\n"
+};
+
+/**
+ * @brief Assembles a source held in memory, without writing output files.
+ *
+ * @param data The source.
+ * @param size The size of the source.
+ * @param bytes Set to the number of bytes assembled, the larger of the source and its macro expansion.
+ * @return The number of heap allocations of the assembly.
+ */
+static long assemble_input(const unsigned char *data, size_t size, size_t *bytes) {
+    char input_file_name[] = "perf_fuzz_input.as";
+    char file_name[] = "perf_fuzz_input";
+    char *source;               /* Copy of the data, fmemopen needs a writable buffer */
+    char *expanded = NULL;      /* The source after macro processing */
+    size_t expanded_size = 0;
+    FILE *input_file_ptr;
+    FILE *expanded_file_ptr;
+    FILE *am_file_ptr;
+    assembly_context context;   /* The counters, images and symbols of the source */
+
+    *bytes = size;
+    stats_enabled = TRUE;
+    stats_begin_file();
+    source = (char *)malloc(size + 1);
+    if (size == 0 || source == NULL || (input_file_ptr = fmemopen(source, size, "r")) == NULL) {
+        free(source);
+        return 0;
+    }
+    memcpy(source, data, size);
+    init_assembly_context(&context, file_name, NULL);
+    context.input_file_name = input_file_name;
+    expanded_file_ptr = open_memstream(&expanded, &expanded_size);
+
+    if (expanded_file_ptr != NULL && process_macros_stream(&context, input_file_ptr, input_file_name, expanded_file_ptr)) {
+        fclose(expanded_file_ptr);
+        expanded_file_ptr = NULL;
+        if (!context.has_macros) {
+            rewind(input_file_ptr);
+            assemble_source(&context, input_file_ptr, FALSE, NULL);
+        }
+        else if (expanded_size > 0 && (am_file_ptr = fmemopen(expanded, expanded_size, "r")) != NULL) {
+            input_file_name[strlen(input_file_name) - 1] = 'm';
+            *bytes = expanded_size > size ? expanded_size : size;
+            assemble_source(&context, am_file_ptr, FALSE, NULL);
+            fclose(am_file_ptr);
+        }
+    }
+
+    if (expanded_file_ptr != NULL) {
+        fclose(expanded_file_ptr);
+    }
+    fclose(input_file_ptr);
+    free(expanded);
+    free(source);
+    free_assembly_context(&context);
+    free_include_cache();
+    stats_enabled = FALSE;
+    return current_stats.malloc_calls;
+}
+
+/**
+ * @brief Measures the cost of an input, keeping the fastest of several runs.
+ *
+ * @param runs The number of runs.
+ */
+static struct measurement measure_input(const unsigned char *data, size_t size, int runs) {
+    struct measurement result = {-1, 0, 0};
+    struct timespec start, end;
+    double ns;
+
+    for (; runs > 0; runs--) {
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        result.allocations = assemble_input(data, size, &result.bytes);
+        clock_gettime(CLOCK_MONOTONIC, &end);
+        ns = (end.tv_sec - start.tv_sec) * 1e9 + (end.tv_nsec - start.tv_nsec);
+        if (result.ns < 0 || ns < result.ns) {
+            result.ns = ns;
+        }
+    }
+    return result;
+}
+
+/**
+ * @brief Computes how close the cost of an input is to the thresholds.
+ *
+ * The cost is counted per byte assembled, a macro invocation costs as much as the lines it expands to.
+ *
+ * @return The largest ratio of a cost per byte to its threshold, above 1 for a pathological input.
+ */
+static double cost_ratio(struct measurement measurement) {
+    double budget_bytes = measurement.bytes > MIN_BUDGET_BYTES ? measurement.bytes : MIN_BUDGET_BYTES;
+    double time_ratio = measurement.ns / (max_ns_per_byte * budget_bytes);
+    double allocations_ratio = measurement.allocations / (max_allocs_per_byte * budget_bytes);
+
+    return time_ratio > allocations_ratio ? time_ratio : allocations_ratio;
+}
+
+/**
+ * @brief Checks whether an input is pathological, confirming a slow run with more runs.
+ */
+static bool is_pathological(const unsigned char *data, size_t size) {
+    return cost_ratio(measure_input(data, size, 1)) > 1 &&
+           cost_ratio(measure_input(data, size, MEASURE_RUNS)) > 1;
+}
+
+/* Reads a threshold from the environment, keeping the default if it isn't set */
+static void read_threshold(char *variable, double *threshold) {
+    char *value = getenv(variable);
+
+    if (value != NULL && atof(value) > 0) {
+        *threshold = atof(value);
+    }
+}
+
+/* libFuzzer target: aborts on pathological inputs */
+int LLVMFuzzerTestOneInput(const unsigned char *data, size_t size) {
+    static bool thresholds_read = FALSE;
+
+    if (!thresholds_read) {
+        read_threshold("PERF_FUZZ_MAX_NS_PER_BYTE", &max_ns_per_byte);
+        read_threshold("PERF_FUZZ_MAX_ALLOCS_PER_BYTE", &max_allocs_per_byte);
+        thresholds_read = TRUE;
+    }
+    if (is_pathological(data, size)) {
+        abort();
+    }
+    return 0;
+}
+
+#ifndef LIBFUZZER
+
+/* Descriptor of the original standard output, the assembler's own output is discarded */
+static FILE *report;
+
+/* Hashes an input for its corpus file name (FNV-1a) */
+static unsigned long hash_input(const unsigned char *data, size_t size) {
+    unsigned long hash = 2166136261ul;
+
+    while (size-- > 0) {
+        hash = (hash ^ *data++) * 16777619ul;
+    }
+    return hash & 0xfffffffful;
+}
+
+/* Writes an input to a file, only with calls that are safe in a signal handler */
+static void write_input(char *path, const unsigned char *data, size_t size) {
+    int fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+
+    if (fd >= 0) {
+        while (size > 0 && write(fd, data, size) > 0) {
+            size = 0;
+        }
+        close(fd);
+    }
+}
+
+/* Saves the running input when it crashes or times out, then exits */
+static void handle_fatal_signal(int signal_number) {
+    char *path = signal_number == SIGALRM ? timeout_path : crash_path;
+
+    if (current_data != NULL && path[0] != '\0') {
+        write_input(path, current_data, current_size);
+    }
+    write(STDERR_FILENO, signal_number == SIGALRM ? "perf_fuzz: timeout\n" : "perf_fuzz: crash\n", signal_number == SIGALRM ? 19 : 17);
+    _exit(2);
+}
+
+/**
+ * @brief Prepares the crash and timeout files of an input, before it runs.
+ *
+ * @param corpus The corpus directory, or NULL to not save the input.
+ */
+static void prepare_input(char *corpus, const unsigned char *data, size_t size) {
+    current_data = data;
+    current_size = size;
+    crash_path[0] = timeout_path[0] = '\0';
+    if (corpus != NULL) {
+        sprintf(crash_path, "%s/crash-%08lx.as", corpus, hash_input(data, size));
+        sprintf(timeout_path, "%s/timeout-%08lx.as", corpus, hash_input(data, size));
+    }
+}
+
+/**
+ * @brief Reads a whole file.
+ *
+ * @param size Set to the size of the file.
+ * @return The allocated content, or NULL if the file can't be read.
+ */
+static unsigned char *read_input(char *file_name, size_t *size) {
+    FILE *file = fopen(file_name, "rb");
+    unsigned char *content;
+    long length;
+
+    if (file == NULL) {
+        return NULL;
+    }
+    fseek(file, 0, SEEK_END);
+    length = ftell(file);
+    rewind(file);
+    content = (unsigned char *)malloc(length > 0 ? length : 1);
+    if (content != NULL) {
+        *size = fread(content, 1, length, file);
+    }
+    fclose(file);
+    return content;
+}
+
+/**
+ * @brief Finds the start of every line of an input.
+ *
+ * @param starts Set to the offsets of the lines, followed by the size of the input.
+ * @return The number of lines.
+ */
+static size_t split_lines(const unsigned char *data, size_t size, size_t **starts) {
+    size_t count = 0;
+    size_t offset;
+
+    *starts = (size_t *)malloc((size + 2) * sizeof(size_t));
+    for (offset = 0; offset < size; offset++) {
+        if (offset == 0 || data[offset - 1] == '\n') {
+            (*starts)[count++] = offset;
+        }
+    }
+    (*starts)[count] = size;
+    return count;
+}
+
+/**
+ * @brief Minimizes a pathological input by removing chunks of lines while it stays pathological.
+ *
+ * Removes chunks of half of the lines, then smaller and smaller chunks, down to single lines.
+ *
+ * @param data The input, replaced by the minimized input.
+ * @param size The size of the input, updated.
+ */
+static void minimize_input(unsigned char **data, size_t *size) {
+    unsigned char *candidate = (unsigned char *)malloc(*size);
+    size_t *starts;
+    size_t line_count = split_lines(*data, *size, &starts);
+    size_t chunk, first, last, candidate_size;
+
+    for (chunk = line_count / 2; chunk >= 1 && candidate != NULL; chunk /= 2) {
+        for (first = 0; first < line_count; ) {
+            last = first + chunk < line_count ? first + chunk : line_count;
+            memcpy(candidate, *data, starts[first]);
+            memcpy(candidate + starts[first], *data + starts[last], *size - starts[last]);
+            candidate_size = *size - (starts[last] - starts[first]);
+            if (candidate_size > 0 && is_pathological(candidate, candidate_size)) {
+                memcpy(*data, candidate, candidate_size);
+                *size = candidate_size;
+                free(starts);
+                line_count = split_lines(*data, *size, &starts);
+            }
+            else {
+                first = last;
+            }
+        }
+    }
+    free(starts);
+    free(candidate);
+}
+
+/* Returns a random number below limit, limit must be positive */
+static size_t random_below(size_t limit) {
+    return (size_t)((unsigned long)rand() * ((unsigned long)RAND_MAX + 1) + rand()) % limit;
+}
+
+/**
+ * @brief Mutates an input: flips a byte, inserts a token, repeats a line, doubles a chunk,
+ * deletes a range or splices another input.
+ *
+ * @param data The input, reallocated to hold the mutant.
+ * @param size The size of the input, updated.
+ * @param max_size The largest size of a mutant.
+ * @param pool The inputs kept so far, for splicing.
+ * @param pool_size The number of inputs kept so far.
+ */
+static void mutate_input(unsigned char **data, size_t *size, size_t max_size, struct sample *pool, int pool_size) {
+    unsigned char *mutant = (unsigned char *)malloc(max_size);
+    size_t mutant_size = 0;
+    size_t position = random_below(*size + 1);
+    size_t length, repeat;
+    struct sample *other;
+    char *token;
+
+    if (mutant == NULL) {
+        return;
+    }
+    switch (rand() % 6) {
+    case 0: /* Flip a byte */
+        memcpy(mutant, *data, mutant_size = *size);
+        if (mutant_size > 0) {
+            mutant[random_below(mutant_size)] = " \n\t,:#[]\";.aZ9-"[rand() % 15];
+        }
+        break;
+    case 1: /* Insert a token */
+        token = tokens[rand() % (sizeof(tokens) / sizeof(tokens[0]))];
+        length = strlen(token);
+        if (*size + length <= max_size) {
+            memcpy(mutant, *data, position);
+            memcpy(mutant + position, token, length);
+            memcpy(mutant + position + length, *data + position, *size - position);
+            mutant_size = *size + length;
+        }
+        break;
+    case 2: /* Repeat the line at a position */
+        while (position > 0 && (*data)[position - 1] != '\n') {
+            position--;
+        }
+        for (length = 0; position + length < *size && (*data)[position + length] != '\n'; length++);
+        length += position + length < *size;
+        memcpy(mutant, *data, position);
+        mutant_size = position;
+        for (repeat = 2 + random_below(64); repeat > 0 && mutant_size + length + *size - position <= max_size; repeat--) {
+            memcpy(mutant + mutant_size, *data + position, length);
+            mutant_size += length;
+        }
+        memcpy(mutant + mutant_size, *data + position, *size - position);
+        mutant_size += *size - position;
+        break;
+    case 3: /* Double a chunk, which grows an input quickly */
+        length = random_below(*size - position + 1);
+        if (*size + length <= max_size) {
+            memcpy(mutant, *data, position + length);
+            memcpy(mutant + position + length, *data + position, *size - position);
+            mutant_size = *size + length;
+        }
+        break;
+    case 4: /* Delete a range */
+        length = random_below(*size - position + 1) / 2 + 1;
+        length = length < *size - position ? length : *size - position;
+        memcpy(mutant, *data, position);
+        memcpy(mutant + position, *data + position + length, *size - position - length);
+        mutant_size = *size - length;
+        break;
+    default: /* Splice the start of this input with the end of another */
+        other = &pool[rand() % pool_size];
+        length = random_below(other->size + 1);
+        if (position + length <= max_size) {
+            memcpy(mutant, *data, position);
+            memcpy(mutant + position, other->data + other->size - length, length);
+            mutant_size = position + length;
+        }
+        break;
+    }
+
+    if (mutant_size > 0) {
+        free(*data);
+        *data = mutant;
+        *size = mutant_size;
+    }
+    else {
+        free(mutant);
+    }
+}
+
+/**
+ * @brief Adds an input to the pool, replacing a cheaper one when the pool is full.
+ *
+ * @return Whether the input was added, otherwise the caller keeps ownership of it.
+ */
+static bool add_to_pool(struct sample *pool, int *pool_size, unsigned char *data, size_t size, double cost) {
+    int index = *pool_size;
+
+    if (index == MAX_POOL) {
+        index = rand() % MAX_POOL;
+        if (pool[index].cost > cost) {
+            return FALSE;
+        }
+        free(pool[index].data);
+    }
+    else {
+        (*pool_size)++;
+    }
+    pool[index].data = data;
+    pool[index].size = size;
+    pool[index].cost = cost;
+    return TRUE;
+}
+
+/**
+ * @brief Minimizes a pathological input and saves it into the corpus.
+ *
+ * @return Whether the minimized input is new to the corpus.
+ */
+static bool save_pathological(char *corpus, const unsigned char *data, size_t size) {
+    unsigned char *minimized = (unsigned char *)malloc(size);
+    char path[MAX_PATH_LENGTH];
+    struct measurement measurement;
+    struct stat file_stat;
+
+    if (minimized == NULL) {
+        return FALSE;
+    }
+    memcpy(minimized, data, size);
+    minimize_input(&minimized, &size);
+    sprintf(path, "%s/slow-%08lx.as", corpus, hash_input(minimized, size));
+    if (stat(path, &file_stat) == 0) {
+        free(minimized);
+        return FALSE;
+    }
+    measurement = measure_input(minimized, size, MEASURE_RUNS);
+    write_input(path, minimized, size);
+    fprintf(report, "pathological input: %s (%lu bytes, %.0f ns/byte, %.2f allocations/byte)\n", path, (unsigned long)size,
+            measurement.ns / measurement.bytes, (double)measurement.allocations / measurement.bytes);
+    fflush(report);
+    free(minimized);
+    return TRUE;
+}
+
+/**
+ * @brief Assembles every input of a corpus and reports the pathological ones.
+ *
+ * @return The number of pathological inputs.
+ */
+static int replay_corpus(char *corpus, int timeout) {
+    DIR *directory = opendir(corpus);
+    struct dirent *file;
+    char path[MAX_PATH_LENGTH];
+    unsigned char *data;
+    size_t size = 0;
+    struct measurement measurement;
+    double ratio;
+    int failures = 0;
+
+    if (directory == NULL) {
+        fprintf(report, "Can't open the corpus %s\n", corpus);
+        return 1;
+    }
+    while ((file = readdir(directory)) != NULL) {
+        if (file->d_name[0] == '.' || strlen(corpus) + strlen(file->d_name) + 2 > MAX_PATH_LENGTH) {
+            continue;
+        }
+        sprintf(path, "%s/%s", corpus, file->d_name);
+        if ((data = read_input(path, &size)) == NULL) {
+            continue;
+        }
+        prepare_input(NULL, data, size);
+        alarm(timeout);
+        measurement = measure_input(data, size, MEASURE_RUNS);
+        alarm(0);
+        ratio = cost_ratio(measurement);
+        fprintf(report, "%-40s %8lu bytes %10.0f ns/byte %8.2f allocations/byte: %s\n", file->d_name, (unsigned long)size,
+                size > 0 ? measurement.ns / measurement.bytes : 0, size > 0 ? (double)measurement.allocations / measurement.bytes : 0,
+                ratio > 1 ? "FAIL" : "ok");
+        failures += ratio > 1;
+        free(data);
+    }
+    closedir(directory);
+    return failures;
+}
+
+/* Adds a seed input to the pool, the seeds are never pathological themselves */
+static void add_seed(struct sample *pool, int *pool_size, unsigned char *data, size_t size) {
+    if (data == NULL || size == 0 || !add_to_pool(pool, pool_size, data, size, 0)) {
+        free(data);
+    }
+}
+
+int main(int argc, char *argv[]) {
+    char *corpus = "bench/perf_corpus";     /* Directory of the pathological inputs */
+    char *replay = NULL;                    /* Corpus to replay instead of fuzzing */
+    double seconds = 60;                    /* Time-box of the fuzzing */
+    long runs = -1;                         /* Number of mutants, unbounded if negative */
+    size_t max_size = 65536;                /* Largest size of a mutant */
+    int timeout = 10;                       /* Seconds before an input counts as hanging */
+    unsigned int seed = (unsigned int)time(NULL);
+    struct sample pool[MAX_POOL];           /* Inputs kept for mutation */
+    int pool_size = 0;
+    struct sigaction action;
+    struct timespec start, now;
+    unsigned char *data;
+    size_t size = 0;
+    double cost;
+    long run, found = 0;
+    int index, seed_files = 0;
+    DIR *directory;
+    struct dirent *file;
+    char path[MAX_PATH_LENGTH];
+
+    for (index = 1; index < argc && strncmp(argv[index], "--", 2) == 0; index++) {
+        if (index + 1 == argc) {
+            fprintf(stderr, "Missing value for %s\n", argv[index]);
+            return 1;
+        }
+        if (strcmp(argv[index], "--seconds") == 0) seconds = atof(argv[++index]);
+        else if (strcmp(argv[index], "--runs") == 0) runs = atol(argv[++index]);
+        else if (strcmp(argv[index], "--max-len") == 0) max_size = atol(argv[++index]);
+        else if (strcmp(argv[index], "--timeout") == 0) timeout = atoi(argv[++index]);
+        else if (strcmp(argv[index], "--seed") == 0) seed = (unsigned int)atol(argv[++index]);
+        else if (strcmp(argv[index], "--max-ns-per-byte") == 0) max_ns_per_byte = atof(argv[++index]);
+        else if (strcmp(argv[index], "--max-allocs-per-byte") == 0) max_allocs_per_byte = atof(argv[++index]);
+        else if (strcmp(argv[index], "--corpus") == 0) corpus = argv[++index];
+        else if (strcmp(argv[index], "--replay") == 0) replay = argv[++index];
+        else {
+            fprintf(stderr, "Unknown argument %s\n", argv[index]);
+            return 1;
+        }
+    }
+    if (max_ns_per_byte <= 0 || max_allocs_per_byte <= 0 || max_size < 64 || timeout < 1 ||
+        strlen(replay != NULL ? replay : corpus) + 32 > MAX_PATH_LENGTH) {
+        fprintf(stderr, "Thresholds should be positive, --max-len at least 64, --timeout positive and the corpus path short\n");
+        return 1;
+    }
+
+    /* Report on the original standard output, and discard the errors the assembler prints */
+    report = fdopen(dup(STDOUT_FILENO), "w");
+    if (report == NULL || freopen("/dev/null", "w", stdout) == NULL || freopen("/dev/null", "w", stderr) == NULL) {
+        return 1;
+    }
+
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = handle_fatal_signal;
+    sigaction(SIGALRM, &action, NULL);
+    sigaction(SIGSEGV, &action, NULL);
+    sigaction(SIGBUS, &action, NULL);
+    sigaction(SIGFPE, &action, NULL);
+    sigaction(SIGABRT, &action, NULL);
+
+    if (replay != NULL) {
+        index = replay_corpus(replay, timeout);
+        fprintf(report, "%d pathological input(s)\n", index);
+        return index > 0 ? 1 : 0;
+    }
+
+    /* Seeds: the built-in programs, the files given and the inputs already in the corpus */
+    mkdir(corpus, 0755);
+    for (index = 0; index < (int)(sizeof(seed_programs) / sizeof(seed_programs[0])); index++) {
+        size = strlen(seed_programs[index]);
+        data = (unsigned char *)malloc(size);
+        if (data != NULL) {
+            memcpy(data, seed_programs[index], size);
+        }
+        add_seed(pool, &pool_size, data, size);
+    }
+    for (index = 1; index < argc && strncmp(argv[index], "--", 2) == 0; index += 2);
+    for (; index < argc; index++, seed_files++) {
+        add_seed(pool, &pool_size, read_input(argv[index], &size), size);
+    }
+    if ((directory = opendir(corpus)) != NULL) {
+        while ((file = readdir(directory)) != NULL) {
+            if (file->d_name[0] != '.' && strlen(corpus) + strlen(file->d_name) + 2 <= MAX_PATH_LENGTH) {
+                sprintf(path, "%s/%s", corpus, file->d_name);
+                add_seed(pool, &pool_size, read_input(path, &size), size);
+                seed_files++;
+            }
+        }
+        closedir(directory);
+    }
+    fprintf(report, "perf_fuzz: seed %u, %d seed file(s), %.0f ns/byte and %.2f allocations/byte thresholds\n",
+            seed, seed_files, max_ns_per_byte, max_allocs_per_byte);
+    fflush(report);
+    srand(seed);
+
+    /* Mutate the kept inputs, keeping the mutants that cost the most per byte */
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (run = 0; runs < 0 || run < runs; run++) {
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        if ((now.tv_sec - start.tv_sec) + (now.tv_nsec - start.tv_nsec) / 1e9 >= seconds) {
+            break;
+        }
+        index = rand() % pool_size;
+        size = pool[index].size;
+        data = (unsigned char *)malloc(size);
+        if (data == NULL) {
+            break;
+        }
+        memcpy(data, pool[index].data, size);
+        mutate_input(&data, &size, max_size, pool, pool_size);
+
+        prepare_input(corpus, data, size);
+        alarm(timeout);
+        cost = cost_ratio(measure_input(data, size, 1));
+        if (cost > 1 && is_pathological(data, size)) {
+            alarm(0);
+            found += save_pathological(corpus, data, size);
+            free(data);
+            continue;
+        }
+        alarm(0);
+        if (!add_to_pool(pool, &pool_size, data, size, cost)) {
+            free(data);
+        }
+    }
+
+    fprintf(report, "perf_fuzz: %ld inputs, %ld pathological input(s) saved to %s\n", run, found, corpus);
+    for (index = 0; index < pool_size; index++) {
+        free(pool[index].data);
+    }
+    fclose(report);
+    return found > 0 ? 1 : 0;
+}
+
+#endif
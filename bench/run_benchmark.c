@@ -0,0 +1,202 @@
+#define _DEFAULT_SOURCE /* wait4, mkdir and clock_gettime */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <sys/time.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+
+/*
+ * End-to-end benchmark of the assembler over generated workloads.
+ *
+ * Usage: run_benchmark [--repetitions N] [--warmup N] [--assembler path]
+ *                      [--generator path] [--work-dir dir]
+ *
+ * For every configuration, generates a program with generate_workload, runs the assembler
+ * over it and reports the median and 95th percentile wall time and the peak RSS.
+ */
+
+#define MAX_REPETITIONS 1000
+#define MAX_PATH_LENGTH 512
+
+/* A benchmark configuration: a name and the arguments of generate_workload */
+struct bench_config {
+    char *name;
+    char *generator_args;
+};
+
+static struct bench_config configs[] = {
+    {"baseline",     "--lines 500 --symbols 100"},
+    {"many_labels",  "--lines 1200 --symbols 1100 --data-words 600"},
+    {"macro_heavy",  "--lines 1500 --symbols 200 --macros 10 --macro-size 20"},
+    {"dense_data",   "--lines 400 --symbols 100 --data-words 1200 --define-density 0.2"},
+    {"extern_heavy", "--lines 1000 --symbols 300 --extern-ratio 0.9"},
+    {"define_heavy", "--lines 6000 --symbols 200 --define-density 0.8"},
+    {"max_image",    "--lines 4000 --symbols 1000 --macros 10 --macro-size 10 --extern-ratio 0.3 --define-density 0.2 --data-words 1200"},
+    {NULL, NULL}
+};
+
+/**
+ * @brief Compares two doubles, for qsort.
+ */
+static int compare_doubles(const void *first, const void *second) {
+    double difference = *(const double *)first - *(const double *)second;
+    return (difference > 0) - (difference < 0);
+}
+
+/**
+ * @brief Reads the monotonic clock.
+ *
+ * @return The time in seconds.
+ */
+static double now_seconds(void) {
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec + now.tv_nsec / 1e9;
+}
+
+/**
+ * @brief Runs the assembler once over a file.
+ *
+ * @param assembler The path of the assembler executable.
+ * @param base_name The file name, without the .as extension.
+ * @param seconds Receives the wall time of the run.
+ * @param max_rss_kb Receives the peak resident set size of the run, in kilobytes.
+ * @return Returns 0 if the assembler ran, otherwise -1.
+ */
+static int run_assembler(char *assembler, char *base_name, double *seconds, long *max_rss_kb) {
+    pid_t pid;
+    int status;
+    int null_fd;
+    struct rusage usage;
+    double start = now_seconds();
+
+    pid = fork();
+    if (pid < 0) {
+        perror("fork");
+        return -1;
+    }
+    if (pid == 0) {
+        /* The diagnostics of the assembler are not part of the report */
+        null_fd = open("/dev/null", O_WRONLY);
+        if (null_fd >= 0) {
+            dup2(null_fd, STDOUT_FILENO);
+            dup2(null_fd, STDERR_FILENO);
+        }
+        execl(assembler, assembler, base_name, (char *)NULL);
+        _exit(127);
+    }
+    if (wait4(pid, &status, 0, &usage) < 0) {
+        perror("wait4");
+        return -1;
+    }
+    *seconds = now_seconds() - start;
+    *max_rss_kb = usage.ru_maxrss;
+    return WIFEXITED(status) && WEXITSTATUS(status) != 127 ? 0 : -1;
+}
+
+/**
+ * @brief Counts the lines of a file.
+ *
+ * @return The number of lines, or -1 if the file can't be read.
+ */
+static long count_lines(char *file_name) {
+    FILE *file = fopen(file_name, "r");
+    long lines = 0;
+    int character;
+
+    if (file == NULL) {
+        return -1;
+    }
+    while ((character = fgetc(file)) != EOF) {
+        lines += character == '\n';
+    }
+    fclose(file);
+    return lines;
+}
+
+int main(int argc, char *argv[]) {
+    int repetitions = 15;                       /* Measured runs per configuration */
+    int warmup = 2;                             /* Unmeasured runs per configuration */
+    char *assembler = "./main_program";         /* Assembler under test */
+    char *generator = "bench/generate_workload";
+    char *work_dir = "bench/work";              /* Directory of the generated programs */
+    char base_name[MAX_PATH_LENGTH];            /* Generated program, without extension */
+    char command[3 * MAX_PATH_LENGTH];          /* Command that generates the program */
+    char object_name[MAX_PATH_LENGTH + 4];      /* Object file of the generated program */
+    double times[MAX_REPETITIONS];              /* Wall times of the measured runs */
+    long rss_kb;                                /* Peak RSS of a run */
+    long peak_rss_kb;                           /* Peak RSS over the runs of a configuration */
+    struct bench_config *config;
+    struct stat object_stat;
+    int index;
+    int failures = 0;
+
+    for (index = 1; index < argc; index++) {
+        if (index + 1 == argc) {
+            fprintf(stderr, "Missing value for %s\n", argv[index]);
+            return 1;
+        }
+        if (strcmp(argv[index], "--repetitions") == 0) repetitions = atoi(argv[++index]);
+        else if (strcmp(argv[index], "--warmup") == 0) warmup = atoi(argv[++index]);
+        else if (strcmp(argv[index], "--assembler") == 0) assembler = argv[++index];
+        else if (strcmp(argv[index], "--generator") == 0) generator = argv[++index];
+        else if (strcmp(argv[index], "--work-dir") == 0) work_dir = argv[++index];
+        else {
+            fprintf(stderr, "Unknown argument %s\n", argv[index]);
+            return 1;
+        }
+    }
+    if (repetitions < 1 || repetitions > MAX_REPETITIONS) {
+        fprintf(stderr, "Repetitions should be between 1 and %d\n", MAX_REPETITIONS);
+        return 1;
+    }
+    if (strlen(work_dir) + 32 > MAX_PATH_LENGTH) {
+        fprintf(stderr, "Work directory name is too long\n");
+        return 1;
+    }
+    mkdir(work_dir, 0755);
+
+    printf("%-14s %7s %7s %12s %12s %12s\n", "configuration", "lines", "runs", "median ms", "p95 ms", "peak RSS KB");
+    for (config = configs; config->name != NULL; config++) {
+        /* Generate the program of the configuration */
+        sprintf(base_name, "%s/%s", work_dir, config->name);
+        sprintf(command, "%s %s -o %s.as 2>/dev/null", generator, config->generator_args, base_name);
+        if (system(command) != 0) {
+            fprintf(stderr, "Can't generate %s: %s\n", config->name, command);
+            failures++;
+            continue;
+        }
+        sprintf(object_name, "%s.ob", base_name);
+        remove(object_name);
+
+        /* Run the assembler, discarding the warm-up runs */
+        peak_rss_kb = 0;
+        for (index = -warmup; index < repetitions; index++) {
+            if (run_assembler(assembler, base_name, &times[index < 0 ? 0 : index], &rss_kb) != 0) {
+                fprintf(stderr, "Can't run %s\n", assembler);
+                return 1;
+            }
+            if (rss_kb > peak_rss_kb) {
+                peak_rss_kb = rss_kb;
+            }
+        }
+
+        /* A configuration that doesn't assemble measures the error path, flag it */
+        if (stat(object_name, &object_stat) != 0) {
+            fprintf(stderr, "%s did not assemble, see %s.as\n", config->name, base_name);
+            failures++;
+        }
+
+        qsort(times, repetitions, sizeof(double), compare_doubles);
+        printf("%-14s %7ld %7d %12.3f %12.3f %12ld\n", config->name, count_lines(strcat(base_name, ".as")), repetitions,
+               times[repetitions / 2] * 1e3, times[(repetitions * 95 + 99) / 100 - 1] * 1e3, peak_rss_kb);
+    }
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,291 @@
+#define _DEFAULT_SOURCE /* wait4 and mkdir */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stddef.h>
+#include <string.h>
+#include <math.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <sys/time.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+
+/*
+ * Asymptotic scaling regression tests of the assembler.
+ *
+ * Usage: scaling_test [--assembler path] [--work-dir dir] [--repetitions N]
+ *                     [--steps N] [--max-exponent F]
+ *
+ * For every dimension (symbols, extern uses, macros, macro body length), assembles programs
+ * at doubling sizes and fits the growth exponent of the CPU time and of the table entries
+ * visited (a deterministic counter of --stats) with a least squares fit in log-log space.
+ * A dimension fails when an exponent exceeds --max-exponent, 1.3 by default, which accepts
+ * linearithmic growth with some noise and rejects quadratic growth.
+ */
+
+#define MAX_STEPS 16
+#define MAX_PATH_LENGTH 512
+
+/* A scaled dimension of the input */
+struct dimension {
+    char *name;
+    long first_size;                                /* Size of the smallest program */
+    void (*write_program)(FILE *file, long size);   /* Writes a program of the given size */
+};
+
+/* Measurements of one program */
+struct measurement {
+    long size;
+    double cpu_seconds;     /* Smallest CPU time of the repetitions */
+    double table_steps;     /* Entries visited by find_by_types and add_table_item */
+};
+
+/* size .define constants, each checked against the constants defined before it */
+static void write_symbols_program(FILE *file, long size) {
+    long i;
+
+    for (i = 0; i < size; i++) {
+        fprintf(file, ".define K%ld = %ld\n", i, i);
+    }
+    fprintf(file, "MAIN: prn #K%ld\nhlt\n", size - 1);
+}
+
+/* size references to external symbols, each recorded for the .ext file */
+static void write_extern_uses_program(FILE *file, long size) {
+    long i;
+
+    for (i = 0; i < 8; i++) {
+        fprintf(file, ".extern X%ld\n", i);
+    }
+    fprintf(file, "MAIN: jsr X0\n");
+    for (i = 1; i < size; i++) {
+        fprintf(file, "jsr X%ld\n", i % 8);
+    }
+    fprintf(file, "hlt\n");
+}
+
+/* size macros, each invoked once */
+static void write_macros_program(FILE *file, long size) {
+    long i;
+
+    for (i = 0; i < size; i++) {
+        fprintf(file, "mcr m%ld\n; body of m%ld\nendmcr\n", i, i);
+    }
+    fprintf(file, "MAIN: hlt\n");
+    for (i = 0; i < size; i++) {
+        fprintf(file, "m%ld\n", i);
+    }
+}
+
+/* A macro of size lines, invoked twice */
+static void write_macro_body_program(FILE *file, long size) {
+    long i;
+
+    fprintf(file, "mcr body\n");
+    for (i = 0; i < size; i++) {
+        fprintf(file, "; line %ld of the body\n", i);
+    }
+    fprintf(file, "endmcr\nMAIN: hlt\nbody\nbody\n");
+}
+
+static struct dimension dimensions[] = {
+    {"symbols", 1000, write_symbols_program},
+    {"extern_uses", 32, write_extern_uses_program},
+    {"macros", 500, write_macros_program},
+    {"macro_body", 1000, write_macro_body_program},
+    {NULL, 0, NULL}
+};
+
+/**
+ * @brief Runs the assembler once with --stats.
+ *
+ * @param assembler The path of the assembler executable.
+ * @param base_name The file name, without the .as extension.
+ * @param stats_name The file the --stats report is written to.
+ * @return The CPU time of the run in seconds, or -1 if it couldn't run.
+ */
+static double run_assembler(char *assembler, char *base_name, char *stats_name) {
+    pid_t pid;
+    int status;
+    int fd;
+    struct rusage usage;
+
+    pid = fork();
+    if (pid < 0) {
+        perror("fork");
+        return -1;
+    }
+    if (pid == 0) {
+        fd = open(stats_name, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        if (fd >= 0) {
+            dup2(fd, STDOUT_FILENO);
+        }
+        fd = open("/dev/null", O_WRONLY);
+        if (fd >= 0) {
+            dup2(fd, STDERR_FILENO);
+        }
+        execl(assembler, assembler, "--stats", base_name, (char *)NULL);
+        _exit(127);
+    }
+    if (wait4(pid, &status, 0, &usage) < 0 || !WIFEXITED(status) || WEXITSTATUS(status) == 127) {
+        return -1;
+    }
+    return usage.ru_utime.tv_sec + usage.ru_utime.tv_usec / 1e6 + usage.ru_stime.tv_sec + usage.ru_stime.tv_usec / 1e6;
+}
+
+/**
+ * @brief Reads a counter of the "total" block of a --stats report.
+ *
+ * @return The value of the counter, or -1 if it isn't in the report.
+ */
+static double read_total_counter(char *report, char *counter_name) {
+    char key[64];
+    char *position = strstr(report, "\"total\"");
+    double value;
+
+    sprintf(key, "\"%s\":", counter_name);
+    if (position == NULL || (position = strstr(position, key)) == NULL) {
+        return -1;
+    }
+    return sscanf(position + strlen(key), "%lf", &value) == 1 ? value : -1;
+}
+
+/**
+ * @brief Reads a whole file into a null-terminated string.
+ *
+ * @return The allocated content, or NULL if the file can't be read.
+ */
+static char *read_file(char *file_name) {
+    FILE *file = fopen(file_name, "r");
+    char *content;
+    long length;
+
+    if (file == NULL) {
+        return NULL;
+    }
+    fseek(file, 0, SEEK_END);
+    length = ftell(file);
+    rewind(file);
+    content = malloc(length + 1);
+    if (content != NULL) {
+        content[fread(content, 1, length, file)] = '\0';
+    }
+    fclose(file);
+    return content;
+}
+
+/**
+ * @brief Fits the exponent k of value = c * size^k by least squares in log-log space.
+ *
+ * @param offset Offset of the value in struct measurement.
+ * @return The exponent, or 0 if the values are not all positive.
+ */
+static double fit_exponent(struct measurement *measurements, int count, size_t offset) {
+    double sum_x = 0, sum_y = 0, sum_xx = 0, sum_xy = 0;
+    double x, y;
+    int index;
+
+    for (index = 0; index < count; index++) {
+        y = *(double *)((char *)&measurements[index] + offset);
+        if (y <= 0) {
+            return 0;
+        }
+        x = log((double)measurements[index].size);
+        y = log(y);
+        sum_x += x;
+        sum_y += y;
+        sum_xx += x * x;
+        sum_xy += x * y;
+    }
+    return (count * sum_xy - sum_x * sum_y) / (count * sum_xx - sum_x * sum_x);
+}
+
+int main(int argc, char *argv[]) {
+    char *assembler = "./main_program";     /* Assembler under test */
+    char *work_dir = "bench/work";          /* Directory of the generated programs */
+    int repetitions = 3;                    /* Runs per program, the fastest one is kept */
+    int steps = 5;                          /* Number of doubling sizes per dimension */
+    double max_exponent = 1.3;              /* Largest accepted growth exponent */
+    char base_name[MAX_PATH_LENGTH];        /* Generated program, without extension */
+    char file_name[MAX_PATH_LENGTH + 8];    /* Generated program or its --stats report */
+    struct measurement measurements[MAX_STEPS];
+    struct dimension *dimension;
+    double cpu_seconds, cpu_exponent, steps_exponent;
+    char *report;
+    FILE *file;
+    int index, step, repetition;
+    int failures = 0;
+
+    for (index = 1; index < argc; index++) {
+        if (index + 1 == argc) {
+            fprintf(stderr, "Missing value for %s\n", argv[index]);
+            return 1;
+        }
+        if (strcmp(argv[index], "--assembler") == 0) assembler = argv[++index];
+        else if (strcmp(argv[index], "--work-dir") == 0) work_dir = argv[++index];
+        else if (strcmp(argv[index], "--repetitions") == 0) repetitions = atoi(argv[++index]);
+        else if (strcmp(argv[index], "--steps") == 0) steps = atoi(argv[++index]);
+        else if (strcmp(argv[index], "--max-exponent") == 0) max_exponent = atof(argv[++index]);
+        else {
+            fprintf(stderr, "Unknown argument %s\n", argv[index]);
+            return 1;
+        }
+    }
+    if (steps < 3 || steps > MAX_STEPS || repetitions < 1 || strlen(work_dir) + 32 > MAX_PATH_LENGTH) {
+        fprintf(stderr, "Steps should be between 3 and %d, repetitions positive and the work directory short\n", MAX_STEPS);
+        return 1;
+    }
+    mkdir(work_dir, 0755);
+
+    printf("%-12s %9s %12s %14s\n", "dimension", "size", "cpu ms", "table steps");
+    for (dimension = dimensions; dimension->name != NULL; dimension++) {
+        for (step = 0; step < steps; step++) {
+            measurements[step].size = dimension->first_size << step;
+            sprintf(base_name, "%s/%s_%ld", work_dir, dimension->name, measurements[step].size);
+
+            sprintf(file_name, "%s.as", base_name);
+            if ((file = fopen(file_name, "w")) == NULL) {
+                fprintf(stderr, "Can't create %s\n", file_name);
+                return 1;
+            }
+            dimension->write_program(file, measurements[step].size);
+            fclose(file);
+
+            sprintf(file_name, "%s.stats", base_name);
+            measurements[step].cpu_seconds = -1;
+            for (repetition = 0; repetition < repetitions; repetition++) {
+                cpu_seconds = run_assembler(assembler, base_name, file_name);
+                if (cpu_seconds < 0) {
+                    fprintf(stderr, "%s crashed or can't run on %s.as\n", assembler, base_name);
+                    return 1;
+                }
+                if (measurements[step].cpu_seconds < 0 || cpu_seconds < measurements[step].cpu_seconds) {
+                    measurements[step].cpu_seconds = cpu_seconds;
+                }
+            }
+
+            /* The counters are deterministic, the report of the last run has them */
+            report = read_file(file_name);
+            if (report == NULL || strstr(report, "\"succeeded\": true") == NULL) {
+                fprintf(stderr, "%s did not assemble, see %s.as\n", dimension->name, base_name);
+                free(report);
+                return 1;
+            }
+            measurements[step].table_steps = read_total_counter(report, "find_by_types_entries_scanned") +
+                                             read_total_counter(report, "add_table_item_entries_scanned");
+            free(report);
+
+            printf("%-12s %9ld %12.3f %14.0f\n", dimension->name, measurements[step].size,
+                   measurements[step].cpu_seconds * 1e3, measurements[step].table_steps);
+        }
+
+        cpu_exponent = fit_exponent(measurements, steps, offsetof(struct measurement, cpu_seconds));
+        steps_exponent = fit_exponent(measurements, steps, offsetof(struct measurement, table_steps));
+        printf("%-12s exponents: cpu %.2f, table steps %.2f: %s\n\n", dimension->name, cpu_exponent, steps_exponent,
+               cpu_exponent > max_exponent || steps_exponent > max_exponent ? "FAIL" : "ok");
+        failures += cpu_exponent > max_exponent || steps_exponent > max_exponent;
+    }
+    return failures ? 1 : 0;
+}
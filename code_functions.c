@@ -5,6 +5,7 @@
 #include <stdlib.h>
 #include "code_functions.h"
 #include "utility_functions.h"
+#include "alloc_tracking.h"
 
 /**
  * @brief Validates the addressing mode for an operand.
@@ -108,6 +109,9 @@ addressing_type get_addressing_type(char *operand, table symbol_table) {
             return NONE_ADDR;
         }
         /* Extract label name before '[' */
+        if (open_bracket - operand >= (int)sizeof(label_name)) {
+            return NONE_ADDR;
+        }
         strncpy(label_name, operand, open_bracket - operand);
         label_name[open_bracket - operand] = '\0';
 
@@ -127,15 +131,19 @@ addressing_type get_addressing_type(char *operand, table symbol_table) {
         /* Calculate the length of the index number */
         index_length = closing_bracket - open_bracket - 1; 
         /* Allocate memory for index number */
-        number = (char *)malloc((index_length + 1) * sizeof(char));
+        number = (char *)tracked_malloc(GET_ADDRESSING_TYPE_SITE, (index_length + 1) * sizeof(char));
+        if (number == NULL) {
+            printf("Memory allocation failed");
+            return NONE_ADDR;
+        }
         strncpy(number, open_bracket + 1, index_length); 
         number[index_length] = '\0'; 
         /* Check if index number is a digit or a label name */
-        if (!check_if_digit(number)) {
-            if (find_by_types(symbol_table, number, 1, MDEFINE_SYMBOL) == NULL) {
-                return NONE_ADDR;
-            }
+        if (!check_if_digit(number) && find_by_types(symbol_table, number, 1, MDEFINE_SYMBOL) == NULL) {
+            tracked_free(number);
+            return NONE_ADDR;
         }
+        tracked_free(number);
         return INDEX_FIXED_ADDR;
     }
     else {
@@ -217,13 +225,13 @@ bool analyze_operands(line_info line, int line_index, char **destination, int *o
         /* Check if there are too many operands for the operation */
 		if (*operand_count == 2) {
 			print_error(line, "Too many operands for operation (got >%d)", *operand_count);
-			free(destination[0]);
-			free(destination[1]);
+			tracked_free(destination[0]);
+			tracked_free(destination[1]);
 			return FALSE;   
 		}
 
         /* Allocate memory for the operand string */
-        destination[*operand_count] = malloc(MAX_LINE_LENGTH);
+        destination[*operand_count] = tracked_malloc(ANALYZE_OPERANDS_SITE, MAX_LINE_LENGTH);
         if (destination[*operand_count] == NULL) {
             printf("Memory not allocated");
             return FALSE;
@@ -250,9 +258,9 @@ bool analyze_operands(line_info line, int line_index, char **destination, int *o
         else if (line.content[line_index] != ',') {
             print_error(line, "Expecting ',' between operands");
 
-            free(destination[0]);
+            tracked_free(destination[0]);
             if (*operand_count > 1) {
-                free(destination[1]);
+                tracked_free(destination[1]);
             }
             return FALSE;
         }
@@ -272,9 +280,9 @@ bool analyze_operands(line_info line, int line_index, char **destination, int *o
 
         /* Free memory and return false if any syntax errors are encountered */
         {
-            free(destination[0]);
+            tracked_free(destination[0]);
             if (*operand_count > 1) {
-				free(destination[1]);
+				tracked_free(destination[1]);
 			}
 			return FALSE;
         }
@@ -370,7 +378,7 @@ code_word *get_code_word(line_info line, opcode curr_opcode, int op_count, char
     }
     
     /* Allocate memory for the code word */
-    codeword = (code_word *)malloc(sizeof(code_word));
+    codeword = (code_word *)tracked_malloc(GET_CODE_WORD_SITE, sizeof(code_word));
     if (codeword == NULL) {
         print_error(line, "Memory allocation failed\n");  
         return NULL;
@@ -426,7 +434,7 @@ data_word *build_data_word(addressing_type addressing, long data, bool is_extern
     unsigned long mask_un;  /* Unsigned version of the mask */
 
     /* Allocate memory for the data word */
-    data_word *dataword = (data_word *)malloc(sizeof(data_word));
+    data_word *dataword = (data_word *)tracked_malloc(BUILD_DATA_WORD_SITE, sizeof(data_word));
     if (dataword == NULL) {
         printf("Memory allocation failed");
         return NULL;
@@ -465,7 +473,7 @@ data_word *build_data_word_reg(long first_data, long second_data) {
     long third_data; /* Combined data value */
 
     /* Allocate memory for the data word */
-    data_word *dataword = (data_word *)malloc(sizeof(data_word));
+    data_word *dataword = (data_word *)tracked_malloc(BUILD_DATA_WORD_SITE, sizeof(data_word));
     if (dataword == NULL) {
         printf("Memory allocation failed");
         return NULL;
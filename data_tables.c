@@ -4,6 +4,138 @@
 #include <stdarg.h>
 #include "data_tables.h"
 #include "utility_functions.h"
+#include "statistics.h"
+#include "alloc_tracking.h"
+
+/* Number of buckets of a new name index, a power of two */
+#define INITIAL_INDEX_BUCKETS 64
+
+/* Name index of a table, kept by the first entry of the table */
+struct table_index {
+    table *buckets;         /* First entry of each name by the hash of the name, chained by hash_next */
+    long bucket_count;      /* Number of buckets, a power of two */
+    long name_count;        /* Number of distinct names in the table */
+    table last_added;       /* The last entry added, where the next insertion may start looking */
+};
+
+/* Journal of the current thread, NULL when its changes aren't recorded */
+static __thread table_journal *current_journal = NULL;
+
+/**
+ * @brief Appends a record to the journal of the current thread.
+ *
+ * @param is_lookup Whether the record is a failed lookup.
+ * @param name The name of the symbol.
+ * @param value The value of an added symbol.
+ * @param type The type of an added symbol.
+ * @param type_mask The types a failed lookup asked for.
+ */
+static void journal_record_change(bool is_lookup, char *name, long value, symbol_type type, unsigned int type_mask) {
+    journal_record *records;
+    journal_record *record;
+
+    if (current_journal->count == current_journal->capacity) {
+        records = (journal_record *)tracked_realloc(TABLE_JOURNAL_SITE, current_journal->records, (current_journal->capacity * 2 + 64) * sizeof(journal_record));
+        if (records == NULL) {
+            printf("Memory allocation failed");
+            exit(1);
+        }
+        current_journal->records = records;
+        current_journal->capacity = current_journal->capacity * 2 + 64;
+    }
+    record = &current_journal->records[current_journal->count++];
+    record->is_lookup = is_lookup;
+    record->name[0] = '\0';
+    strncat(record->name, name, MAX_LINE_LENGTH + 1);
+    record->value = value;
+    record->type = type;
+    record->type_mask = type_mask;
+}
+
+/**
+ * @brief Hashes a symbol name (djb2).
+ *
+ * @param name The name to hash.
+ * @return The hash of the name.
+ */
+static unsigned long hash_name(char *name) {
+    unsigned long hash = 5381;
+
+    while (*name) {
+        hash = hash * 33 + (unsigned char)*name++;
+    }
+    return hash;
+}
+
+/**
+ * @brief Allocates an empty name index.
+ *
+ * @return The new index, or NULL if the allocation failed.
+ */
+static struct table_index *create_index(void) {
+    struct table_index *index = (struct table_index *)tracked_malloc(TABLE_INDEX_SITE, sizeof(struct table_index));
+
+    if (index == NULL) {
+        return NULL;
+    }
+    index->buckets = (table *)tracked_calloc(TABLE_INDEX_SITE, INITIAL_INDEX_BUCKETS, sizeof(table));
+    if (index->buckets == NULL) {
+        tracked_free(index);
+        return NULL;
+    }
+    index->bucket_count = INITIAL_INDEX_BUCKETS;
+    index->name_count = 0;
+    index->last_added = NULL;
+    return index;
+}
+
+/**
+ * @brief Adds an entry to a name index, growing the index when its chains get long.
+ *
+ * Each bucket chains the first entry of every name, and the other entries of a name are chained
+ * after the first one, so many entries with the same name don't slow down the other names.
+ *
+ * @param index The name index of the table.
+ * @param entry The entry to add.
+ */
+static void index_entry(struct table_index *index, table entry) {
+    table *buckets;
+    table moved_entry;
+    table first_entry;
+    long bucket;
+
+    index->last_added = entry;
+    bucket = hash_name(entry->name) & (index->bucket_count - 1);
+    for (first_entry = index->buckets[bucket]; first_entry != NULL; first_entry = first_entry->hash_next) {
+        if (strcmp(first_entry->name, entry->name) == 0) {
+            entry->same_name_next = first_entry->same_name_next;
+            first_entry->same_name_next = entry;
+            return;
+        }
+    }
+
+    /* Keep the chains short, at most two names per bucket on average */
+    if (index->name_count >= 2 * index->bucket_count) {
+        buckets = (table *)tracked_calloc(TABLE_INDEX_SITE, 4 * index->bucket_count, sizeof(table));
+        if (buckets != NULL) {
+            for (bucket = 0; bucket < index->bucket_count; bucket++) {
+                while ((moved_entry = index->buckets[bucket]) != NULL) {
+                    index->buckets[bucket] = moved_entry->hash_next;
+                    moved_entry->hash_next = buckets[hash_name(moved_entry->name) & (4 * index->bucket_count - 1)];
+                    buckets[hash_name(moved_entry->name) & (4 * index->bucket_count - 1)] = moved_entry;
+                }
+            }
+            tracked_free(index->buckets);
+            index->buckets = buckets;
+            index->bucket_count *= 4;
+        }
+        bucket = hash_name(entry->name) & (index->bucket_count - 1);
+    }
+
+    entry->hash_next = index->buckets[bucket];
+    index->buckets[bucket] = entry;
+    index->name_count++;
+}
 
 /* Adds a new item to the symbol table */
 void add_table_item(table *tab, char *name, long value, symbol_type type) {
@@ -11,16 +143,17 @@ void add_table_item(table *tab, char *name, long value, symbol_type type) {
     table prev_table;           /* Pointer to the previous table entry */
     table curr_table;           /* Pointer to the current table entry */
     table new_table;            /* Pointer to the new table entry */
+    struct table_index *index;  /* Name index of the table */
 
     /* Allocate memory for the new table entry */
-    new_table = (table)malloc(sizeof(table_entry));
+    new_table = (table)tracked_malloc(ADD_TABLE_ITEM_SITE, sizeof(table_entry));
     if (new_table == NULL) {
         printf("Memory not allocated.\n");
         return;
     }
 
     /* Allocate memory for the copy of the symbol name */
-    copy_name = (char *)malloc((strlen(name) + 1) * sizeof(char));
+    copy_name = (char *)tracked_malloc(ADD_TABLE_ITEM_SITE, (strlen(name) + 1) * sizeof(char));
     if (copy_name == NULL) {
         printf("Memory not allocated.\n");
         return;
@@ -28,42 +161,116 @@ void add_table_item(table *tab, char *name, long value, symbol_type type) {
 
     /* Copy the symbol name */
     strcpy(copy_name, name);
+    if (current_journal != NULL) {
+        journal_record_change(FALSE, name, value, type, 0);
+    }
     new_table->name = copy_name;
     new_table->value = value;
     new_table->type = type;
+    new_table->hash_next = NULL;
+    new_table->same_name_next = NULL;
+    new_table->index = NULL;
+
+    /* The index is created with the table, a table without an index is searched linearly */
+    index = (*tab) != NULL ? (*tab)->index : create_index();
 
     /* Insert the new entry into the symbol table */
     if ((*tab) == NULL || (*tab)->value > value) {
         new_table->next = (*tab);
+        if ((*tab) != NULL) {
+            (*tab)->index = NULL;
+        }
+        new_table->index = index;
         (*tab) = new_table;
-        return;
+    }
+    else {
+        /* The table is sorted, so every entry up to a smaller last added entry is smaller too */
+        prev_table = index != NULL && index->last_added->value < value ? index->last_added : *tab;
+
+        /* Traverse the symbol table to find the correct position to insert the new entry */
+        curr_table = prev_table->next;
+        while (curr_table != NULL && curr_table->value < value) {
+            prev_table = curr_table;
+            curr_table = curr_table->next;
+            STATS_ADD(insert_steps, 1);
+        }
+
+        /* Insert the new entry */
+        new_table->next = curr_table;
+        prev_table->next = new_table;
     }
 
-    /* Traverse the symbol table to find the correct position to insert the new entry */
-    curr_table = (*tab)->next;
-    prev_table = *tab;
-    while (curr_table != NULL && curr_table->value < value) {
-        prev_table = curr_table;
-        curr_table = curr_table->next;
+    if (index != NULL) {
+        index_entry(index, new_table);
     }
-    
-    /* Insert the new entry */
-    new_table->next = curr_table;
-    prev_table->next = new_table;
+}
+
+/**
+ * @brief Sorts a table by value with a merge sort, keeping the order of entries with equal values.
+ *
+ * @param tab The table to sort.
+ * @param count The number of entries in the table.
+ * @return The first entry of the sorted table.
+ */
+static table sort_by_value(table tab, long count) {
+    table first_half_end;       /* Last entry of the first half of the table */
+    table second_half;          /* Second half of the table */
+    table merged = NULL;        /* First entry of the merged table */
+    table *merged_tail = &merged;   /* Where the next merged entry is linked */
+    long index;
+
+    if (count < 2) {
+        return tab;
+    }
+
+    /* Split the table in two halves and sort each of them */
+    first_half_end = tab;
+    for (index = 1; index < count / 2; index++) {
+        first_half_end = first_half_end->next;
+    }
+    second_half = sort_by_value(first_half_end->next, count - count / 2);
+    first_half_end->next = NULL;
+    tab = sort_by_value(tab, count / 2);
+
+    /* Merge the halves, entries of the first half go first among equal values */
+    while (tab != NULL && second_half != NULL) {
+        if (tab->value <= second_half->value) {
+            *merged_tail = tab;
+            tab = tab->next;
+        }
+        else {
+            *merged_tail = second_half;
+            second_half = second_half->next;
+        }
+        merged_tail = &(*merged_tail)->next;
+    }
+    *merged_tail = tab != NULL ? tab : second_half;
+    return merged;
 }
 
 /* Adds a value to all symbols of a specific type in the symbol table */
-void add_value_to_type(table tab, long to_add, symbol_type type) {
-    table curr_item;  /* Pointer to the current table entry */
+void add_value_to_type(table *tab, long to_add, symbol_type type) {
+    table curr_item;            /* Pointer to the current table entry */
+    struct table_index *index;  /* Name index of the table, moved to the new first entry */
+
+    if ((*tab) == NULL) {
+        return;
+    }
 
     /* Iterate through the symbol table */
-    for (curr_item = tab; curr_item != NULL; curr_item = curr_item->next) {
+    for (curr_item = *tab; curr_item != NULL; curr_item = curr_item->next) {
         /* Check if the current symbol's type matches the specified type */
         if (curr_item->type == type) {
             /* Add the specified value to the current symbol's value */
             curr_item->value += to_add;
         }
     }
+
+    /* Restore the order by value that add_table_item relies on */
+    index = (*tab)->index;
+    (*tab)->index = NULL;
+    *tab = sort_by_value(*tab, count_table_items(*tab));
+    (*tab)->index = index;
 }
 
 /* Checks if the name of an item matches a given name */
@@ -71,39 +278,108 @@ bool check_item_name(char *table_name, char *new_name){
     return strcmp(table_name, new_name) == 0;
 }
 
+/**
+ * @brief Finds an item in the table by its name among a set of types.
+ *
+ * @param tab The table to search within.
+ * @param key The name of the item.
+ * @param valid_type_mask The bit of every valid type.
+ * @return A pointer to the found item if it exists, otherwise NULL.
+ */
+static table_entry *find_by_type_mask(table tab, char *key, unsigned int valid_type_mask) {
+	long entries_scanned = 0;
+
+	/* table null => nothing to dos */
+	if (tab == NULL) {
+		return NULL;
+	}
+	/* iterate over the whole table if it has no name index */
+	if (tab->index == NULL) {
+		for (; tab != NULL; tab = tab->next) {
+			entries_scanned++;
+			if ((valid_type_mask >> tab->type & 1) && strcmp(key, tab->name) == 0) {
+				STATS_ADD(entries_scanned, entries_scanned);
+				return tab;
+			}
+		}
+		STATS_ADD(entries_scanned, entries_scanned);
+		return NULL;
+	}
+	/* find the first entry of the key in its bucket, then the entry of a valid type among the entries of the key */
+	for (tab = tab->index->buckets[hash_name(key) & (tab->index->bucket_count - 1)]; tab != NULL; tab = tab->hash_next) {
+		entries_scanned++;
+		if (strcmp(key, tab->name) == 0) {
+			break;
+		}
+	}
+	for (; tab != NULL; tab = tab->same_name_next) {
+		entries_scanned++;
+		if (valid_type_mask >> tab->type & 1) {
+			STATS_ADD(entries_scanned, entries_scanned);
+			return tab;
+		}
+	}
+	/* not found, return NULL */
+	STATS_ADD(entries_scanned, entries_scanned);
+	return NULL;
+}
+
 /* Finds an item in the table by its name and type */
 table_entry *find_by_types(table tab, char *key, int symbol_count, ...) {
 	int i;
+	table_entry *item;
     va_list arglist;
-	symbol_type *valid_symbol_types = malloc((symbol_count) * sizeof(int));
-    
-    if (valid_symbol_types == NULL) {
-        return NULL;
-    }
-	/* Build a list of the valid types */
-	
+	unsigned int valid_type_mask = 0;	/* Bit of every valid type */
+
+	STATS_ADD(find_calls, 1);
+	/* Build the set of the valid types */
 	va_start(arglist, symbol_count);
 	for (i = 0; i < symbol_count; i++) {
-		valid_symbol_types[i] = va_arg(arglist, symbol_type);
+		valid_type_mask |= 1u << va_arg(arglist, symbol_type);
 	}
 	va_end(arglist);
-	/* table null => nothing to dos */
-	if (tab == NULL) {
-		free(valid_symbol_types);
-		return NULL;
+
+	item = find_by_type_mask(tab, key, valid_type_mask);
+	/* Constants don't need to be recorded, the parallel first pass knows all of them in advance */
+	if (item == NULL && current_journal != NULL && (valid_type_mask & ~(1u << MDEFINE_SYMBOL)) != 0) {
+		journal_record_change(TRUE, key, 0, MDEFINE_SYMBOL, valid_type_mask);
 	}
-	/* iterate over table and then over array of valid. if type is valid and same key, return the entry. */
-	do {
-		for (i = 0; i < symbol_count; i++) {
-			if (valid_symbol_types[i] == tab->type && strcmp(key, tab->name) == 0) {
-				free(valid_symbol_types);
-				return tab;
-			}
+	return item;
+}
+
+/* Records the additions and the failed label lookups of the current thread to a journal */
+void journal_table_changes(table_journal *journal) {
+	current_journal = journal;
+}
+
+/* Checks the failed lookups of a journal still find nothing in a table */
+bool journal_lookups_fail(table tab, table_journal *journal) {
+	long index;
+
+	for (index = 0; index < journal->count; index++) {
+		if (journal->records[index].is_lookup && find_by_type_mask(tab, journal->records[index].name, journal->records[index].type_mask) != NULL) {
+			return FALSE;
 		}
-	} while ((tab = tab->next) != NULL);
-	/* not found, return NULL */
-	free(valid_symbol_types);
-	return NULL;
+	}
+	return TRUE;
+}
+
+/* Frees the records of a journal and empties it */
+void free_table_journal(table_journal *journal) {
+	tracked_free(journal->records);
+	journal->records = NULL;
+	journal->count = 0;
+	journal->capacity = 0;
+}
+
+/* Counts the entries of a table */
+long count_table_items(table tab) {
+	long count = 0;
+
+	for (; tab != NULL; tab = tab->next) {
+		count++;
+	}
+	return count;
 }
 
 /* Frees the memory allocated for a table */
@@ -111,22 +387,27 @@ void free_table(table tab) {
 	table prev_entry;
     table curr_entry = tab;
      
+	if (tab != NULL && tab->index != NULL) {
+		tracked_free(tab->index->buckets);
+		tracked_free(tab->index);
+	}
 	while (curr_entry != NULL) {
 		prev_entry = curr_entry;
 		curr_entry = curr_entry->next;
-		free(prev_entry->name); 
-		free(prev_entry);
+		tracked_free(prev_entry->name); 
+		tracked_free(prev_entry);
 	}
 }
 
 /* Filters a table by symbol type */
 table filter_table_by_type(table tab, symbol_type type) {
 	table new_table = NULL;
-	do {
+	/* the table is sorted, so the entries are added in increasing order of value */
+	for (; tab != NULL; tab = tab->next) {
 		if (tab->type == type) {
 			add_table_item(&new_table, tab->name, tab->value, tab->type);
 		}
-	} while ((tab = tab->next) != NULL);
+	}
 	return new_table; 
 }
 
@@ -19,6 +19,11 @@ typedef enum symbol_type {
  */
 typedef struct entry* table;
 
+/** 
+ * Name index of a table, see data_tables.c.
+ */
+struct table_index;
+
 /** 
  * Struct defining a table entry.
  */
@@ -27,12 +32,37 @@ typedef struct entry {
     long value;         /* Value associated with the entry */
     char *name;         /* Name of the entry */
     symbol_type type;   /* Type of the entry (symbol_type enum) */
+    table hash_next;    /* Next name in the same bucket of the name index */
+    table same_name_next;   /* Next entry with the same name, in the name index */
+    struct table_index *index;  /* Name index of the table, only set on its first entry */
 } table_entry;
 
+/**
+ * A symbol added to a table or a label lookup that found nothing, recorded by a table journal.
+ */
+typedef struct journal_record {
+    bool is_lookup;                     /* Whether the record is a failed lookup rather than an addition */
+    char name[MAX_LINE_LENGTH + 2];     /* Name of the symbol, it comes from a source line */
+    long value;                         /* Value of the added symbol */
+    symbol_type type;                   /* Type of the added symbol */
+    unsigned int type_mask;             /* Bit of every type the failed lookup asked for */
+} journal_record;
+
+/**
+ * The additions and failed label lookups of a thread, in the order they were made.
+ */
+typedef struct table_journal {
+    journal_record *records;    /* The records */
+    long count;                 /* Number of records */
+    long capacity;              /* Allocated length of records */
+} table_journal;
+
 /**
  * @brief Adds a new item to the symbol table.
  *
  * This function creates a new table entry with the specified name, value, and type, and inserts it into the symbol table in sorted order based on the value.
+ * The search for the position starts at the previously added entry when its value is smaller, so adding entries in
+ * increasing order of value takes constant time.
  *
  * @param tab Pointer to the symbol table.
  * @param name The name of the symbol to be added.
@@ -45,12 +75,13 @@ void add_table_item(table *tab, char *name, long value, symbol_type type);
  * @brief Adds a value to all symbols of a specific type in the symbol table.
  *
  * This function iterates through the symbol table and adds the specified value to the 'value' field of all symbols of the given type.
+ * The table is then sorted by value again, keeping the order of entries with equal values.
  *
- * @param tab The symbol table.
+ * @param tab Pointer to the symbol table.
  * @param to_add The value to add to symbols of the specified type.
  * @param type The type of symbols to which the value will be added (e.g., DATA_SYMBOL, CODE_SYMBOL).
  */
-void add_value_to_type(table tab, long to_add, symbol_type type);
+void add_value_to_type(table *tab, long to_add, symbol_type type);
 
 /**
  * @brief Checks if the name of an item matches a given name.
@@ -68,6 +99,7 @@ bool check_item_name(char *table_name, char *new_name);
  * @brief Finds an item in the table by its name and type.
  *
  * This function searches for an item in the table with the specified name and type. It returns a pointer to the found item if it exists, otherwise NULL.
+ * The search goes through the name index of the table, so it takes constant time on average.
  *
  * @param tab The table to search within.
  * @param name The name of the item to search for.
@@ -75,6 +107,40 @@ bool check_item_name(char *table_name, char *new_name);
  */
 table_entry *find_by_types(table tab,char *key, int symbol_count, ...);
 
+/**
+ * @brief Counts the entries of a table.
+ *
+ * @param tab The table to count.
+ * @return The number of entries in the table.
+ */
+long count_table_items(table tab);
+
+/**
+ * @brief Records the additions and the failed label lookups of the current thread to a journal.
+ *
+ * Every add_table_item call is recorded, and every find_by_types call that asks for a code, data or external
+ * symbol and finds nothing. Lookups of constants only are not recorded.
+ *
+ * @param journal The journal to append to, or NULL to stop recording.
+ */
+void journal_table_changes(table_journal *journal);
+
+/**
+ * @brief Checks the failed lookups of a journal still find nothing in a table.
+ *
+ * @param tab The table to search within.
+ * @param journal The journal.
+ * @return Returns TRUE if none of the recorded lookups finds a symbol in the table, otherwise FALSE.
+ */
+bool journal_lookups_fail(table tab, table_journal *journal);
+
+/**
+ * @brief Frees the records of a journal and empties it.
+ *
+ * @param journal The journal.
+ */
+void free_table_journal(table_journal *journal);
+
 /**
  * @brief Frees the memory allocated for a table.
  *
@@ -87,7 +153,7 @@ void free_table(table tab);
 /**
  * @brief Filters a table by symbol type.
  *
- * This function creates a new table containing only the entries with the specified symbol type.
+ * This function creates a new table containing only the entries with the specified symbol type, sorted by value.
  *
  * @param tab The original table to be filtered.
  * @param type The symbol type to filter by.
@@ -1,8 +1,14 @@
+#define _POSIX_C_SOURCE 200809L /* open_memstream */
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
+#include <sys/stat.h>
 #include "utility_functions.h"
 #include "data_tables.h"
+#include "trace.h"
+#include "file_writeing.h"
+#include "alloc_tracking.h"
+#include "batch_io.h"
 
 /**
  * @brief Macro to keep only the 24 least significant bits of a value.
@@ -23,75 +29,104 @@
  */
 #define KEEP_ONLY_21_LSB(value) ((value) & 0x1FFFFF)
 
+/* Extension added to an output file for the temporary file it is written to, then renamed over the output file */
+#define TEMPORARY_EXTENSION ".tmp"
+
+/* Bytes of an existing output file compared at a time */
+#define COMPARE_BUFFER_SIZE 4096
+
 
 /**
- * @brief Writes machine code and data to a .ob output file.
- *
- * This function writes machine code and data to a .ob output file. It opens the file for writing,
- * writes the headers containing the final instruction and data counters, then writes the machine
- * code and data lines to the file. It also prints the memory address and binary representation of
- * each code and data entry to the console. Finally, it closes the file and returns whether the
- * operation was successful.
+ * @brief Prints the headers, the machine code and the data of a .ob file to a stream.
  *
+ * @param file The stream the object file is printed to.
  * @param code_img The machine code image.
  * @param data_img The data image.
  * @param icf The final instruction counter value.
  * @param dcf The final data counter value.
- * @param filename The base filename for the output file.
- * @return Returns true if the file was written successfully, otherwise returns false.
  */
-static bool write_ob(machine_word **code_img, long *data_img, long icf, long dcf, char *filename);
+static void print_ob(FILE *file, machine_word **code_img, long *data_img, long icf, long dcf);
 
 /**
- * @brief Writes a table to a file with the specified filename and extension.
+ * @brief Prints the entries of a table to a stream, one name and value per line.
  *
- * This function writes the contents of a table to a file with the specified filename and extension.
- * It opens the file for writing, writes the table entries to the file, then closes the file.
- * If the table is NULL or empty, it returns true without performing any operations.
- * If the file cannot be opened, it prints an error message and returns false.
+ * @param file The stream the table is printed to.
+ * @param tab The table, not empty.
+ */
+static void print_table(FILE *file, table tab);
+
+/**
+ * @brief Writes a rendered file with the specified filename and extension, unless the file already has its contents.
+ *
+ * The file is written to a temporary file, renamed over it once complete.
  *
- * @param tab The table to be written to the file.
+ * @param contents The contents of the file.
+ * @param length The length of the contents.
  * @param filename The base filename for the output file.
  * @param file_extension The extension for the output file.
- * @return Returns true if the table was successfully written to the file, otherwise returns false.
+ * @return Returns true if the file was written or already had the contents, otherwise false.
+ */
+static bool write_rendered_file(char *contents, size_t length, char *filename, char *file_extension);
+
+/**
+ * @brief Checks whether a file has the given contents, comparing the sizes first.
+ *
+ * @param path The file.
+ * @param contents The contents.
+ * @param length The length of the contents.
+ * @return Returns true if the file exists with the same contents, otherwise false.
+ */
+static bool file_has_contents(char *path, char *contents, size_t length);
+
+/**
+ * @brief Renames the temporary file of an output file over the output file, or removes it if that fails.
+ *
+ * @param temporary_path The temporary file.
+ * @param path The output file.
+ * @return Returns true if the output file was replaced, otherwise false.
  */
-static bool write_table_to_file(table tab, char *filename, char *file_extension);
+static bool replace_with_temporary(char *temporary_path, char *path);
 
 
 /* Writes output files including machine code, external references, and entry symbols. */
 int write_output_files(machine_word **code_img, long *data_img, long icf, long dcf, char *filename, table symbol_table) {
+    output_files outputs; /* The files, rendered in memory so the files that didn't change aren't written */
     bool result; /* Result of file writing operations */
-    table externals = filter_table_by_type(symbol_table, EXTERNAL_REFERENCE); /* Extract external references */
-    table entries = filter_table_by_type(symbol_table, ENTRY_SYMBOL); /* Extract entry symbols */
-    
-    /* Write machine code, external references, and entry symbols to separate files */
-    result = write_ob(code_img, data_img, icf, dcf, filename) &&
-             write_table_to_file(externals, filename, ".ext") &&
-             write_table_to_file(entries, filename, ".ent");
-
-    /* Free memory allocated for the filtered tables */
-    free_table(externals);
-    free_table(entries);
 
+    result = render_output_files(code_img, data_img, icf, dcf, symbol_table, &outputs);
+    if (result) {
+        result = write_rendered_outputs(&outputs, filename);
+        free_output_files(&outputs);
+    }
     return result; /* Return result of file writing operations */
 }
 
 
-/* Writes the output of the assembly process to a file in the Object (".ob") format. */
-static bool write_ob(machine_word **code_img, long *data_img, long icf, long dcf, char *filename) {
-    FILE *file; /* File descriptor for the output file */
-    int i, j; /* Loop iterators */
-    int symbol; /* Symbol to represent binary values */
-    long value; /* Value to be written to the file */
-    char *output_file = add_extension(filename, ".ob"); /* File name with ".ob" extension */
-    
-    /* Attempt to open the output file */
-    if (!(file = fopen(output_file, "w"))) {
-        printf("Can't create or rewrite to file %s.", output_file);
-        free(output_file);
-        return FALSE; /* Failed to open file, return FALSE */
+/* Encodes the 14 least significant bits of a value in the "encrypted" base 4 */
+void encode_base4_word(long value, char *encoded) {
+    int j; /* Bit position of the current symbol */
+    int index = 0; /* Index in the encoded buffer */
+
+    for (j = 12; j >= 0; j -= 2) {
+        encoded[index++] = "*#%!"[(value >> j) & 3]; /* Write the appropriate symbol to represent the binary value */
     }
-    free(output_file); /* Free memory allocated for the output file name */
+    encoded[index] = '\0';
+}
+
+/* Computes the value of a word of the code image, as the .ob file encodes it */
+long code_word_value(machine_word *word) {
+    return word->length > 0 ?
+           (word->word.code->opcode << 6) | (word->word.code->src_addressing << 4) |
+           (word->word.code->dest_addressing << 2) | (word->word.code->ARE) :
+           (KEEP_ONLY_21_LSB(word->word.data->data) << 2) | (word->word.data->ARE);
+}
+
+/* Prints the headers, the machine code and the data of a .ob file to a stream */
+static void print_ob(FILE *file, machine_word **code_img, long *data_img, long icf, long dcf) {
+    int i; /* Loop iterator */
+    long value; /* Value to be written to the file */
+    long previous_value = 0; /* Value of the previously written data word */
+    char encoded_word[8]; /* Base 4 representation of the value */
     
     /* Write the header of the object file */
     fprintf(file, "%ld %ld", icf - IC_INIT_VALUE, dcf);
@@ -99,68 +134,253 @@ static bool write_ob(machine_word **code_img, long *data_img, long icf, long dcf
     /* Write the instructions to the object file */
     for (i = 0; i < icf - IC_INIT_VALUE; ++i) {
         /* Construct the value to be written based on the machine word */
-        value = code_img[i]->length > 0 ?
-                (code_img[i]->word.code->opcode << 6) | (code_img[i]->word.code->src_addressing << 4) |
-                (code_img[i]->word.code->dest_addressing << 2) | (code_img[i]->word.code->ARE) :
-                (KEEP_ONLY_21_LSB(code_img[i]->word.data->data) << 2) | (code_img[i]->word.data->ARE);
+        value = code_word_value(code_img[i]);
                 
         /* Write the address followed by the binary representation of the value */
-        fprintf(file, "\n%.7d\t", i + 100);
-        for (j = 12; j >= 0; j -= 2) {
-            symbol = (value >> j) & 3; 
-            fputc("*#%!"[symbol], file); /* Write the appropriate symbol to represent the binary value */
-        }
+        encode_base4_word(value, encoded_word);
+        fprintf(file, "\n%.7d\t%s", i + 100, encoded_word);
     }
     
     /* Write the data to the object file */
     for (i = 0; i < dcf; ++i) {
-        /* Write the address followed by the binary representation of the data */
-        fprintf(file, "\n%.7d\t", i + icf);
         value = KEEP_ONLY_24_LSB(data_img[i]);
-        for (j = 12; j >= 0; j -= 2) {
-            symbol = (value >> j) & 3; 
-            fputc("*#%!"[symbol], file); /* Write the appropriate symbol to represent the binary value */
+
+        /* Runs of equal words (.fill, .space) are encoded only once */
+        if (i == 0 || value != previous_value) {
+            encode_base4_word(value, encoded_word);
+            previous_value = value;
         }
+
+        /* Write the address followed by the binary representation of the data */
+        fprintf(file, "\n%.7ld\t%s", i + icf, encoded_word);
     }
+}
 
-    fclose(file); /* Close the file */
-    return TRUE; /* Successfully wrote the object file, return TRUE */
+/* Prints the entries of a table to a stream, one name and value per line */
+static void print_table(FILE *file, table tab) {
+    fprintf(file, "%s %.7ld", tab->name, tab->value);
+    while ((tab = tab->next) != NULL) {
+        fprintf(file, "\n%s %.7ld", tab->name, tab->value);
+    }
 }
 
+/* Renders the output files in memory, with the same contents write_output_files writes */
+bool render_output_files(machine_word **code_img, long *data_img, long icf, long dcf, table symbol_table, output_files *outputs) {
+    FILE *file; /* Memory stream of the file being rendered */
+    table externals = filter_table_by_type(symbol_table, EXTERNAL_REFERENCE); /* Extract external references */
+    table entries = filter_table_by_type(symbol_table, ENTRY_SYMBOL); /* Extract entry symbols */
+    bool result = TRUE;
 
+    memset(outputs, 0, sizeof(output_files));
+    if ((file = open_memstream(&outputs->object, &outputs->object_length)) == NULL) {
+        result = FALSE;
+    }
+    else {
+        print_ob(file, code_img, data_img, icf, dcf);
+        fclose(file);
+    }
 
+    /* The tables that are empty have no file */
+    if (result && externals != NULL) {
+        if ((file = open_memstream(&outputs->externals, &outputs->externals_length)) == NULL) {
+            result = FALSE;
+        }
+        else {
+            print_table(file, externals);
+            fclose(file);
+        }
+    }
+    if (result && entries != NULL) {
+        if ((file = open_memstream(&outputs->entries, &outputs->entries_length)) == NULL) {
+            result = FALSE;
+        }
+        else {
+            print_table(file, entries);
+            fclose(file);
+        }
+    }
 
+    free_table(externals);
+    free_table(entries);
+    if (!result) {
+        printf("Memory allocation failed");
+        free_output_files(outputs);
+    }
+    return result;
+}
 
-/* Writes a table to a file with the specified filename and extension */
-static bool write_table_to_file(table tab, char *filename, char *file_extension) {
-	FILE *file_descriptor;
-    char *full_filename;
+/* Writes output files rendered by render_output_files */
+bool write_rendered_outputs(output_files *outputs, char *filename) {
+    bool result; /* Result of file writing operations */
+    double writer_start_time; /* Start time of the trace span of the current writer */
 
-    /* If the table is NULL or empty, return true without performing any operations */
-    if (tab == NULL) {
+    writer_start_time = trace_now();
+    result = write_rendered_file(outputs->object, outputs->object_length, filename, ".ob");
+    trace_span("write_ob", filename, writer_start_time);
+
+    if (result && outputs->externals != NULL) {
+        writer_start_time = trace_now();
+        result = write_rendered_file(outputs->externals, outputs->externals_length, filename, ".ext");
+        trace_span("write_ext", filename, writer_start_time);
+    }
+    if (result && outputs->entries != NULL) {
+        writer_start_time = trace_now();
+        result = write_rendered_file(outputs->entries, outputs->entries_length, filename, ".ent");
+        trace_span("write_ent", filename, writer_start_time);
+    }
+    return result;
+}
+
+/* Writes a rendered file with the specified filename and extension, unless the file already has its contents */
+static bool write_rendered_file(char *contents, size_t length, char *filename, char *file_extension) {
+    FILE *file;
+    char *full_filename = add_extension(filename, file_extension); /* Create full filename with extension */
+    char *temporary_filename;
+    bool written;
+
+    /* An output file that didn't change keeps its modification time */
+    if (full_filename != NULL && file_has_contents(full_filename, contents, length)) {
+        tracked_free(full_filename);
         return TRUE;
     }
 
-    full_filename = add_extension(filename, file_extension); /* Create full filename with extension */
+    temporary_filename = full_filename != NULL ? add_extension(full_filename, TEMPORARY_EXTENSION) : NULL;
+    if (temporary_filename == NULL || (file = fopen(temporary_filename, "w")) == NULL) {
+        print_write_error(filename, file_extension);
+        tracked_free(full_filename);
+        tracked_free(temporary_filename);
+        return FALSE;
+    }
+    written = fwrite(contents, 1, length, file) == length;
+    written = fclose(file) == 0 && written;
+    if (!written) {
+        remove(temporary_filename);
+    }
+    written = written && replace_with_temporary(temporary_filename, full_filename);
+    if (!written) {
+        print_write_error(filename, file_extension);
+    }
+    tracked_free(full_filename);
+    tracked_free(temporary_filename);
+    return written;
+}
+
+/* Checks whether a file has the given contents, comparing the sizes first */
+static bool file_has_contents(char *path, char *contents, size_t length) {
+    struct stat file_status;
+    char buffer[COMPARE_BUFFER_SIZE];
+    FILE *file;
+    size_t compared = 0;
+    size_t read_length;
 
-    file_descriptor = fopen(full_filename, "w"); /* Open the output file for writing */
-    free(full_filename); /* Free memory allocated for the full filename */
+    if (stat(path, &file_status) != 0 || !S_ISREG(file_status.st_mode) || (size_t)file_status.st_size != length) {
+        return FALSE;
+    }
+    if ((file = fopen(path, "r")) == NULL) {
+        return FALSE;
+    }
+    while (compared < length && (read_length = fread(buffer, 1, sizeof(buffer), file)) > 0 &&
+           compared + read_length <= length && memcmp(buffer, contents + compared, read_length) == 0) {
+        compared += read_length;
+    }
+    fclose(file);
+    return compared == length;
+}
 
-    /* Check if file is successfully opened */
-    if (file_descriptor == NULL) {
-        printf("Can't create or rewrite to file %s.", full_filename);
+/* Renames the temporary file of an output file over the output file, or removes it if that fails */
+static bool replace_with_temporary(char *temporary_path, char *path) {
+    if (rename(temporary_path, path) != 0) {
+        remove(temporary_path);
         return FALSE;
     }
+    return TRUE;
+}
 
-    /* Write table entries to the file */
-    fprintf(file_descriptor, "%s %.7ld", tab->name, tab->value);
-    while ((tab = tab->next) != NULL) {
-        fprintf(file_descriptor, "\n%s %.7ld", tab->name, tab->value);
+/* Writes the output files rendered for several sources, each kind of file of all the sources together */
+void write_rendered_outputs_batch(output_files **outputs, char **filenames, int count, char **failed_extensions) {
+    static char *extensions[] = {".ob", ".ext", ".ent"};   /* The kinds of output files, in the order they are written */
+    io_request *requests = (io_request *)malloc((count + 1) * sizeof(io_request));
+    int *sources = (int *)malloc((count + 1) * sizeof(int));   /* The source of each request */
+    char **paths = (char **)malloc((count + 1) * sizeof(char *));   /* The output file of each request, written through its temporary file */
+    char *path;
+    int request_count;
+    int kind;
+    int index;
+
+    for (index = 0; index < count; index++) {
+        failed_extensions[index] = NULL;
     }
+    if (requests == NULL || sources == NULL || paths == NULL) {
+        printf("Memory allocation failed");
+        for (index = 0; index < count; index++) {
+            failed_extensions[index] = outputs[index] != NULL ? extensions[0] : NULL;
+        }
+        free(requests);
+        free(sources);
+        free(paths);
+        return;
+    }
+
+    for (kind = 0; kind < 3; kind++) {
+        request_count = 0;
+        for (index = 0; index < count; index++) {
+            if (outputs[index] == NULL || failed_extensions[index] != NULL) {
+                continue;
+            }
+            requests[request_count].contents = kind == 0 ? outputs[index]->object : kind == 1 ? outputs[index]->externals : outputs[index]->entries;
+            requests[request_count].length = kind == 0 ? outputs[index]->object_length : kind == 1 ? outputs[index]->externals_length : outputs[index]->entries_length;
+
+            /* The tables that are empty have no file, like in render_output_files */
+            if (kind != 0 && requests[request_count].contents == NULL) {
+                continue;
+            }
+
+            /* An output file that didn't change keeps its modification time, like in write_rendered_file */
+            path = add_extension(filenames[index], extensions[kind]);
+            if (path != NULL && file_has_contents(path, requests[request_count].contents, requests[request_count].length)) {
+                tracked_free(path);
+                continue;
+            }
+            requests[request_count].path = path != NULL ? add_extension(path, TEMPORARY_EXTENSION) : NULL;
+            if (requests[request_count].path == NULL) {
+                failed_extensions[index] = extensions[kind];
+                tracked_free(path);
+                continue;
+            }
+            paths[request_count] = path;
+            sources[request_count++] = index;
+        }
 
-    fclose(file_descriptor); /* Close the output file */
-    return TRUE; /* Return true indicating successful operation */
+        batch_write_files(requests, request_count);
+        for (index = 0; index < request_count; index++) {
+            if (!requests[index].succeeded) {
+                remove(requests[index].path);
+                failed_extensions[sources[index]] = extensions[kind];
+            }
+            else if (!replace_with_temporary(requests[index].path, paths[index])) {
+                failed_extensions[sources[index]] = extensions[kind];
+            }
+            tracked_free(requests[index].path);
+            tracked_free(paths[index]);
+        }
+    }
+    free(requests);
+    free(sources);
+    free(paths);
 }
 
+/* Prints the error of an output file that can't be created */
+void print_write_error(char *filename, char *file_extension) {
+    char *full_filename = add_extension(filename, file_extension);
 
+    printf("Can't create or rewrite to file %s.", full_filename);
+    tracked_free(full_filename);
+}
 
+/* Frees output files rendered by render_output_files */
+void free_output_files(output_files *outputs) {
+    free(outputs->object);
+    free(outputs->externals);
+    free(outputs->entries);
+    memset(outputs, 0, sizeof(output_files));
+}
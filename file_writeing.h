@@ -1,8 +1,19 @@
 #ifndef _FILE_WRRITEING_H
 #define _FILE_WRRITEING_H
+#include <stddef.h>
 #include "global_variables.h"
 #include "data_tables.h"
 
+/* The output files of a source, rendered in memory before they are written */
+typedef struct output_files {
+    char *object;               /* Contents of the .ob file */
+    size_t object_length;       /* Length of the .ob file */
+    char *externals;            /* Contents of the .ext file, NULL if there are no external references */
+    size_t externals_length;    /* Length of the .ext file */
+    char *entries;              /* Contents of the .ent file, NULL if there are no entry symbols */
+    size_t entries_length;      /* Length of the .ent file */
+} output_files;
+
 /**
  *  Writes output files including machine code, external references, and entry symbols.
  *
@@ -21,4 +32,76 @@
  */
 int write_output_files(machine_word **code_img, long *data_img, long icf, long dcf, char *filename, table symbol_table);
 
+/**
+ * @brief Renders the output files in memory, with the same contents write_output_files writes.
+ *
+ * @param code_img The machine code image.
+ * @param data_img The data image.
+ * @param icf The final instruction counter value.
+ * @param dcf The final data counter value.
+ * @param symbol_table The symbol table.
+ * @param outputs Receives the contents of the files, freed with free_output_files.
+ * @return Returns true if the files were rendered, otherwise false.
+ */
+bool render_output_files(machine_word **code_img, long *data_img, long icf, long dcf, table symbol_table, output_files *outputs);
+
+/**
+ * @brief Writes output files rendered by render_output_files.
+ *
+ * The files are written in the same order and with the same errors as write_output_files.
+ *
+ * @param outputs The rendered files.
+ * @param filename The base filename for output files.
+ * @return Returns true if all files were written successfully, otherwise returns false.
+ */
+bool write_rendered_outputs(output_files *outputs, char *filename);
+
+/**
+ * @brief Writes the output files rendered for several sources, each kind of file of all the sources together.
+ *
+ * The .ob files are written as one batch of batch_write_files, then the .ext files, then the .ent files.
+ * A source stops at its first file that can't be created, like in write_rendered_outputs, but no error
+ * is printed, so the caller prints it in order with print_write_error.
+ *
+ * @param outputs The rendered files of each source, NULL for a source that has no files to write.
+ * @param filenames The base filename of each source.
+ * @param count The number of sources.
+ * @param failed_extensions Receives for each source the extension of the file that couldn't be created, or NULL.
+ */
+void write_rendered_outputs_batch(output_files **outputs, char **filenames, int count, char **failed_extensions);
+
+/**
+ * @brief Prints the error of an output file that can't be created.
+ *
+ * @param filename The base filename of the output file.
+ * @param file_extension The extension of the output file.
+ */
+void print_write_error(char *filename, char *file_extension);
+
+/**
+ * @brief Frees output files rendered by render_output_files.
+ *
+ * @param outputs The rendered files, they are reset to empty files.
+ */
+void free_output_files(output_files *outputs);
+
+/**
+ * @brief Computes the value of a word of the code image, as the .ob file encodes it.
+ *
+ * @param word The word, the first word of an instruction or one of its operand words.
+ * @return The value, its 14 least significant bits are encoded.
+ */
+long code_word_value(machine_word *word);
+
+/**
+ * @brief Encodes the 14 least significant bits of a value in the "encrypted" base 4.
+ *
+ * Each pair of bits, from the most significant one, is represented by one of the
+ * symbols '*', '#', '%' and '!' for 0, 1, 2 and 3 respectively.
+ *
+ * @param value The value to encode.
+ * @param encoded Buffer of at least 8 characters that receives the null-terminated encoding.
+ */
+void encode_base4_word(long value, char *encoded);
+
 #endif
\ No newline at end of file
@@ -10,13 +10,11 @@
 /* Length of the code and data arrays in the image file */
 #define CODE_ARR_IMG_LENGTH 1200
 
-/* Structure to hold information about a line in the source code */
-typedef struct line_info {
-    long line_number;	/* Line number */
-    char *file_name;	/* File name */
-    char *content;		/* Content of the line */
-} line_info;
+/* Most words of a single instruction: the first word and two words for each indexed operand */
+#define MAX_INSTRUCTION_WORDS 5
 
+/* Where the errors of an assembly go, defined in utility_functions.h */
+struct diagnostic_sink;
 
 /* Boolean values */
 typedef enum booleans {
@@ -24,6 +22,16 @@ typedef enum booleans {
 	TRUE = 1	/* True boolean value */
 } bool;
 
+/* Structure to hold information about a line in the source code */
+typedef struct line_info {
+    long line_number;	/* Line number */
+    char *file_name;	/* File name */
+    char *content;		/* Content of the line */
+    struct diagnostic_sink *diagnostics;	/* Where the errors of the line go, NULL to print them */
+    bool check_only;	/* Whether the line is only checked, without building its machine words */
+} line_info;
+
+
 /* Operation codes */
 typedef enum opcodes {
     MOV_OP = 0,     /* Move operation */
@@ -64,6 +72,10 @@ typedef enum instruction {
     EXTERN_INST,	/* Extern  instruction */
     ENTRY_INST,		/* Entry  instruction */
     STRING_INST,	/* String  instruction */
+    INCBIN_INST,	/* Binary include instruction */
+    FILL_INST,		/* Fill instruction */
+    SPACE_INST,		/* Space instruction */
+    INCLUDE_INST,	/* Include instruction, handled by the preprocessor */
     NONE_INST,		/* No instruction */
     ERROR_INST		/* Error  instruction */
 } instruction;		
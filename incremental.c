@@ -0,0 +1,672 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "incremental.h"
+#include "utility_functions.h"
+#include "alloc_tracking.h"
+
+/* Number of buckets of a new name index, a power of two */
+#define INITIAL_NAME_BUCKETS 64
+
+/* Kinds of the dependencies of a file in the manifest */
+typedef enum dependency_kind {
+    INCLUDE_DEPENDENCY,     /* A file the source includes, with the hash and size of its contents */
+    ENTRY_DEPENDENCY,       /* An entry symbol of the file, with its address */
+    EXTERN_DEPENDENCY       /* An external symbol the file uses */
+} dependency_kind;
+
+/* A line of the record of a file */
+struct dependency {
+    dependency_kind kind;   /* What the line records */
+    char *name;             /* Path of the included file, or name of the symbol */
+    unsigned long value;    /* Hash of the included file, or address of the entry */
+    unsigned long size;     /* Size of the included file in bytes, 0 for a symbol */
+};
+
+/* The first member of the items of a name index, so an item is found by its name */
+struct indexed_name {
+    char *name;                         /* The name of the item */
+    struct indexed_name *hash_next;     /* Next item in the same bucket */
+};
+
+/* A hash index of items by their name */
+struct name_index {
+    struct indexed_name **buckets;  /* First item of each bucket by the hash of its name, chained by hash_next */
+    long bucket_count;              /* Number of buckets, a power of two, 0 before the first item */
+    long name_count;                /* Number of items */
+};
+
+/* The record of a file assembled without errors by a previous run */
+struct manifest_record {
+    struct indexed_name file;           /* The file name without extension, as given on the command line */
+    unsigned long source_hash;          /* Hash of the contents of the .as file */
+    unsigned long source_size;          /* Size of the .as file in bytes */
+    struct dependency *dependencies;    /* Its included files, entry symbols and external uses */
+    int dependency_count;               /* Number of dependencies */
+    struct manifest_record *previous;   /* Previous record, in the order of the manifest */
+    struct manifest_record *next;       /* Next record, in the order of the manifest */
+};
+
+/* The contents of a file read by this run */
+struct file_hash {
+    struct indexed_name path;   /* The path of the file */
+    unsigned long hash;         /* Hash of its contents */
+    unsigned long size;         /* Its size in bytes */
+};
+
+/* A growable list of names and values */
+struct dependency_list {
+    struct dependency *items;   /* The names and values */
+    int count;                  /* Number of items */
+    int capacity;               /* Allocated length of items */
+};
+
+char *incremental_manifest_name = NULL;
+
+static struct manifest_record *manifest_records = NULL;                 /* The records, read then updated by this run */
+static struct manifest_record *last_record = NULL;                      /* The last record, new records are added after it */
+static struct name_index record_index = {NULL, 0, 0};                   /* The records by file name */
+static struct name_index file_hashes = {NULL, 0, 0};                    /* The files read by this run by path, so each file is read once */
+static struct dependency_list changed_entries = {NULL, 0, 0};          /* Entry symbols added, removed or moved by this run */
+
+/**
+ * @brief Hashes a name (djb2).
+ *
+ * @param name The name to hash.
+ * @return The hash of the name.
+ */
+static unsigned long hash_name(char *name) {
+    unsigned long hash = 5381;
+
+    while (*name) {
+        hash = hash * 33 + (unsigned char)*name++;
+    }
+    return hash;
+}
+
+/**
+ * @brief Finds an item of a name index.
+ *
+ * @param index The index.
+ * @param name The name of the item.
+ * @return The item, or NULL if there is none.
+ */
+static struct indexed_name *find_name(struct name_index *index, char *name) {
+    struct indexed_name *item;
+
+    if (index->bucket_count == 0) {
+        return NULL;
+    }
+    for (item = index->buckets[hash_name(name) & (index->bucket_count - 1)]; item != NULL && strcmp(item->name, name) != 0;
+         item = item->hash_next);
+    return item;
+}
+
+/**
+ * @brief Adds an item to a name index, growing the index when its chains get long.
+ *
+ * @param index The index.
+ * @param item The item, its name isn't in the index yet.
+ * @return Returns true if the item was added, otherwise false.
+ */
+static bool index_name(struct name_index *index, struct indexed_name *item) {
+    struct indexed_name **buckets;
+    struct indexed_name *moved_item;
+    long bucket;
+
+    if (index->bucket_count == 0) {
+        if ((index->buckets = (struct indexed_name **)calloc(INITIAL_NAME_BUCKETS, sizeof(struct indexed_name *))) == NULL) {
+            printf("Memory allocation failed");
+            return FALSE;
+        }
+        index->bucket_count = INITIAL_NAME_BUCKETS;
+    }
+
+    /* Keep the chains short, at most two names per bucket on average */
+    if (index->name_count >= 2 * index->bucket_count &&
+        (buckets = (struct indexed_name **)calloc(4 * index->bucket_count, sizeof(struct indexed_name *))) != NULL) {
+        for (bucket = 0; bucket < index->bucket_count; bucket++) {
+            while ((moved_item = index->buckets[bucket]) != NULL) {
+                index->buckets[bucket] = moved_item->hash_next;
+                moved_item->hash_next = buckets[hash_name(moved_item->name) & (4 * index->bucket_count - 1)];
+                buckets[hash_name(moved_item->name) & (4 * index->bucket_count - 1)] = moved_item;
+            }
+        }
+        free(index->buckets);
+        index->buckets = buckets;
+        index->bucket_count *= 4;
+    }
+
+    bucket = hash_name(item->name) & (index->bucket_count - 1);
+    item->hash_next = index->buckets[bucket];
+    index->buckets[bucket] = item;
+    index->name_count++;
+    return TRUE;
+}
+
+/**
+ * @brief Removes an item from a name index.
+ *
+ * @param index The index.
+ * @param item The item, in the index.
+ */
+static void unindex_name(struct name_index *index, struct indexed_name *item) {
+    struct indexed_name **link;
+
+    for (link = &index->buckets[hash_name(item->name) & (index->bucket_count - 1)]; *link != item; link = &(*link)->hash_next);
+    *link = item->hash_next;
+    index->name_count--;
+}
+
+/**
+ * @brief Appends a name and a value to a list, copying the name.
+ *
+ * @param list The list.
+ * @param kind What the item records.
+ * @param name The name.
+ * @param value The value.
+ * @param size The size of an included file, 0 for a symbol.
+ * @return Returns true if the item was appended, otherwise false.
+ */
+static bool append_dependency(struct dependency_list *list, dependency_kind kind, char *name, unsigned long value, unsigned long size) {
+    struct dependency *items;
+
+    if (list->count == list->capacity) {
+        items = (struct dependency *)realloc(list->items, (list->capacity * 2 + 8) * sizeof(struct dependency));
+        if (items == NULL) {
+            printf("Memory allocation failed");
+            return FALSE;
+        }
+        list->items = items;
+        list->capacity = list->capacity * 2 + 8;
+    }
+    list->items[list->count].name = (char *)malloc(strlen(name) + 1);
+    if (list->items[list->count].name == NULL) {
+        printf("Memory allocation failed");
+        return FALSE;
+    }
+    strcpy(list->items[list->count].name, name);
+    list->items[list->count].kind = kind;
+    list->items[list->count].size = size;
+    list->items[list->count++].value = value;
+    return TRUE;
+}
+
+/**
+ * @brief Frees the items of a list and empties it.
+ *
+ * @param list The list.
+ */
+static void free_dependency_list(struct dependency_list *list) {
+    while (list->count > 0) {
+        free(list->items[--list->count].name);
+    }
+    free(list->items);
+    list->items = NULL;
+    list->capacity = 0;
+}
+
+/**
+ * @brief Frees a record.
+ *
+ * @param record The record.
+ */
+static void free_record(struct manifest_record *record) {
+    struct dependency_list dependencies;
+
+    dependencies.items = record->dependencies;
+    dependencies.count = record->dependency_count;
+    free_dependency_list(&dependencies);
+    free(record->file.name);
+    free(record);
+}
+
+/**
+ * @brief Finds the record of a file.
+ *
+ * @param file_name The file name without extension.
+ * @return The record, or NULL if there is none.
+ */
+static struct manifest_record *find_record(char *file_name) {
+    return (struct manifest_record *)find_name(&record_index, file_name);
+}
+
+/**
+ * @brief Adds a record to the index and to the order of the manifest.
+ *
+ * @param record The record, its file has no record.
+ * @param next The record it goes before, or NULL to add it after the last record.
+ * @return Returns true if the record was added, otherwise false.
+ */
+static bool link_record(struct manifest_record *record, struct manifest_record *next) {
+    if (!index_name(&record_index, &record->file)) {
+        return FALSE;
+    }
+    record->next = next;
+    record->previous = next != NULL ? next->previous : last_record;
+    *(record->previous != NULL ? &record->previous->next : &manifest_records) = record;
+    *(next != NULL ? &next->previous : &last_record) = record;
+    return TRUE;
+}
+
+/**
+ * @brief Removes a record from the index and from the order of the manifest, without freeing it.
+ *
+ * @param record The record.
+ */
+static void unlink_record(struct manifest_record *record) {
+    unindex_name(&record_index, &record->file);
+    *(record->previous != NULL ? &record->previous->next : &manifest_records) = record->next;
+    *(record->next != NULL ? &record->next->previous : &last_record) = record->previous;
+}
+
+/**
+ * @brief Hashes the contents of a file with FNV-1a and measures its size, once per run.
+ *
+ * @param path The path of the file.
+ * @param hash Receives the hash.
+ * @param size Receives the size in bytes.
+ * @return Returns true if the file could be read, otherwise false.
+ */
+static bool hash_file(char *path, unsigned long *hash, unsigned long *size) {
+    struct file_hash *contents = (struct file_hash *)find_name(&file_hashes, path);
+    FILE *file_ptr;
+    unsigned char buffer[4096];
+    size_t length;
+    size_t index;
+    bool read_success;
+
+    if (contents == NULL) {
+        if ((file_ptr = fopen(path, "rb")) == NULL) {
+            return FALSE;
+        }
+        if ((contents = (struct file_hash *)calloc(1, sizeof(struct file_hash))) == NULL ||
+            (contents->path.name = (char *)malloc(strlen(path) + 1)) == NULL) {
+            printf("Memory allocation failed");
+            free(contents);
+            fclose(file_ptr);
+            return FALSE;
+        }
+        strcpy(contents->path.name, path);
+        contents->hash = 2166136261UL;
+        while ((length = fread(buffer, 1, sizeof(buffer), file_ptr)) > 0) {
+            for (index = 0; index < length; index++) {
+                contents->hash = ((contents->hash ^ buffer[index]) * 16777619UL) & 0xFFFFFFFFUL;
+            }
+            contents->size += length;
+        }
+        read_success = !ferror(file_ptr);
+        fclose(file_ptr);
+        if (!read_success || !index_name(&file_hashes, &contents->path)) {
+            free(contents->path.name);
+            free(contents);
+            return FALSE;
+        }
+    }
+    *hash = contents->hash;
+    *size = contents->size;
+    return TRUE;
+}
+
+/**
+ * @brief Frees the files read by this run.
+ */
+static void free_file_hashes(void) {
+    struct indexed_name *item;
+    long bucket;
+
+    for (bucket = 0; bucket < file_hashes.bucket_count; bucket++) {
+        while ((item = file_hashes.buckets[bucket]) != NULL) {
+            file_hashes.buckets[bucket] = item->hash_next;
+            free(item->name);
+            free(item);
+        }
+    }
+    free(file_hashes.buckets);
+    file_hashes.buckets = NULL;
+    file_hashes.bucket_count = file_hashes.name_count = 0;
+}
+
+/**
+ * @brief Checks whether an output file of a file exists.
+ *
+ * @param file_name The file name without extension.
+ * @param file_extension The extension of the output file.
+ * @return Returns true if the output file exists, otherwise false.
+ */
+static bool output_exists(char *file_name, char *file_extension) {
+    char *output_file_name = add_extension(file_name, file_extension);
+    FILE *file_ptr = output_file_name != NULL ? fopen(output_file_name, "r") : NULL;
+
+    tracked_free(output_file_name);
+    if (file_ptr == NULL) {
+        return FALSE;
+    }
+    fclose(file_ptr);
+    return TRUE;
+}
+
+/**
+ * @brief Checks whether a record has a dependency.
+ *
+ * @param record The record, or NULL.
+ * @param kind The kind of the dependency.
+ * @param name The name of the dependency.
+ * @param value The value of the dependency.
+ * @return Returns true if the record has the dependency with this value, otherwise false.
+ */
+static bool has_dependency(struct manifest_record *record, dependency_kind kind, char *name, unsigned long value) {
+    int index;
+
+    for (index = 0; record != NULL && index < record->dependency_count; index++) {
+        if (record->dependencies[index].kind == kind && record->dependencies[index].value == value &&
+            strcmp(record->dependencies[index].name, name) == 0) {
+            return TRUE;
+        }
+    }
+    return FALSE;
+}
+
+/**
+ * @brief Adds the entry symbols that differ between two records of a file to the changed entries.
+ *
+ * @param old_record The previous record, or NULL.
+ * @param new_record The new record, or NULL.
+ */
+static void note_changed_entries(struct manifest_record *old_record, struct manifest_record *new_record) {
+    struct manifest_record *records[2];
+    struct dependency *entry;
+    int side;
+    int index;
+
+    records[0] = old_record;
+    records[1] = new_record;
+    for (side = 0; side < 2; side++) {
+        for (index = 0; records[side] != NULL && index < records[side]->dependency_count; index++) {
+            entry = &records[side]->dependencies[index];
+            if (entry->kind == ENTRY_DEPENDENCY && !has_dependency(records[1 - side], ENTRY_DEPENDENCY, entry->name, entry->value)) {
+                append_dependency(&changed_entries, ENTRY_DEPENDENCY, entry->name, entry->value, 0);
+            }
+        }
+    }
+}
+
+/* Reads the manifest of the previous run */
+void load_manifest(char *manifest_file_name) {
+    FILE *manifest_ptr;
+    char line[MANIFEST_LINE_LENGTH];
+    struct manifest_record *record = NULL;
+    struct dependency_list dependencies = {NULL, 0, 0};
+    unsigned long value;
+    unsigned long size;
+    long address;
+    int name_index;
+    bool is_valid;
+
+    if ((manifest_ptr = fopen(manifest_file_name, "r")) == NULL) {
+        return;
+    }
+    is_valid = fgets(line, sizeof(line), manifest_ptr) != NULL && strcmp(line, MANIFEST_HEADER "\n") == 0;
+    while (is_valid && fgets(line, sizeof(line), manifest_ptr) != NULL) {
+        if (line[strlen(line) - 1] != '\n') {
+            is_valid = FALSE;
+            break;
+        }
+        line[strlen(line) - 1] = '\0';
+        name_index = 0;
+
+        if (sscanf(line, "file %lx %lu %n", &value, &size, &name_index) == 2 && name_index > 0 && line[name_index] != '\0') {
+            /* A new record starts, the dependencies read so far belong to the previous one */
+            if (record != NULL) {
+                record->dependencies = dependencies.items;
+                record->dependency_count = dependencies.count;
+            }
+            dependencies.items = NULL;
+            dependencies.count = dependencies.capacity = 0;
+            if ((record = (struct manifest_record *)calloc(1, sizeof(struct manifest_record))) == NULL ||
+                (record->file.name = (char *)malloc(strlen(line + name_index) + 1)) == NULL) {
+                printf("Memory allocation failed");
+                free(record);
+                record = NULL;
+                is_valid = FALSE;
+                break;
+            }
+            strcpy(record->file.name, line + name_index);
+            record->source_hash = value;
+            record->source_size = size;
+
+            /* A file is recorded once */
+            if (find_record(record->file.name) != NULL || !link_record(record, NULL)) {
+                free_record(record);
+                record = NULL;
+                is_valid = FALSE;
+                break;
+            }
+        }
+        else if (record != NULL && sscanf(line, "include %lx %lu %n", &value, &size, &name_index) == 2 && name_index > 0 &&
+                 line[name_index] != '\0') {
+            is_valid = append_dependency(&dependencies, INCLUDE_DEPENDENCY, line + name_index, value, size);
+        }
+        else if (record != NULL && sscanf(line, "entry %ld %n", &address, &name_index) == 1 && name_index > 0 && line[name_index] != '\0') {
+            is_valid = append_dependency(&dependencies, ENTRY_DEPENDENCY, line + name_index, (unsigned long)address, 0);
+        }
+        else if (record != NULL && strncmp(line, "extern ", 7) == 0 && line[7] != '\0') {
+            is_valid = append_dependency(&dependencies, EXTERN_DEPENDENCY, line + 7, 0, 0);
+        }
+        else {
+            is_valid = FALSE;
+        }
+    }
+    if (record != NULL) {
+        record->dependencies = dependencies.items;
+        record->dependency_count = dependencies.count;
+    }
+    else {
+        free_dependency_list(&dependencies);
+    }
+    fclose(manifest_ptr);
+
+    /* Without a valid manifest, every file is assembled again */
+    if (!is_valid) {
+        free_manifest();
+    }
+}
+
+/* Checks whether the outputs of the previous run of a file can be reused */
+bool file_is_up_to_date(char *file_name, char *output_name) {
+    struct manifest_record *record = find_record(file_name);
+    char *input_file_name;
+    unsigned long hash;
+    unsigned long size;
+    bool has_entries = FALSE;
+    bool has_externs = FALSE;
+    bool up_to_date;
+    int index;
+
+    if (record == NULL) {
+        return FALSE;
+    }
+    input_file_name = add_extension(file_name, ".as");
+    up_to_date = input_file_name != NULL && hash_file(input_file_name, &hash, &size) &&
+                 hash == record->source_hash && size == record->source_size;
+    tracked_free(input_file_name);
+
+    for (index = 0; up_to_date && index < record->dependency_count; index++) {
+        switch (record->dependencies[index].kind) {
+            case INCLUDE_DEPENDENCY:
+                up_to_date = hash_file(record->dependencies[index].name, &hash, &size) &&
+                             hash == record->dependencies[index].value && size == record->dependencies[index].size;
+                break;
+            case ENTRY_DEPENDENCY:
+                has_entries = TRUE;
+                break;
+            case EXTERN_DEPENDENCY:
+                has_externs = TRUE;
+                break;
+        }
+    }
+
+    /* The tables that are empty have no file */
+    return up_to_date && output_exists(output_name, ".ob") &&
+           (!has_entries || output_exists(output_name, ".ent")) && (!has_externs || output_exists(output_name, ".ext"));
+}
+
+/* Checks whether an entry symbol a file uses as an external symbol changed during this run */
+bool imports_changed(char *file_name) {
+    struct manifest_record *record = find_record(file_name);
+    int index;
+    int entry;
+
+    if (record == NULL) {
+        return TRUE;
+    }
+    for (index = 0; index < record->dependency_count; index++) {
+        if (record->dependencies[index].kind != EXTERN_DEPENDENCY) {
+            continue;
+        }
+        for (entry = 0; entry < changed_entries.count; entry++) {
+            if (strcmp(changed_entries.items[entry].name, record->dependencies[index].name) == 0) {
+                return TRUE;
+            }
+        }
+    }
+    return FALSE;
+}
+
+/* Replaces the record of a file assembled without errors */
+void record_file_dependencies(assembly_context *context) {
+    struct manifest_record *old_record = find_record(context->file_name);
+    struct manifest_record *next_record = NULL;
+    struct manifest_record *record;
+    struct dependency_list dependencies = {NULL, 0, 0};
+    char *input_file_name;
+    unsigned long hash;
+    unsigned long size;
+    bool is_valid;
+    table curr_entry;
+    int index;
+
+    record = (struct manifest_record *)calloc(1, sizeof(struct manifest_record));
+    if (record == NULL || (record->file.name = (char *)malloc(strlen(context->file_name) + 1)) == NULL) {
+        printf("Memory allocation failed");
+        free(record);
+        forget_file_dependencies(context->file_name);
+        return;
+    }
+    strcpy(record->file.name, context->file_name);
+    input_file_name = add_extension(context->file_name, ".as");
+    is_valid = input_file_name != NULL && hash_file(input_file_name, &record->source_hash, &record->source_size);
+    tracked_free(input_file_name);
+
+    for (index = 0; is_valid && index < context->included_file_count; index++) {
+        is_valid = hash_file(context->included_files[index], &hash, &size) &&
+                   append_dependency(&dependencies, INCLUDE_DEPENDENCY, context->included_files[index], hash, size);
+    }
+    for (curr_entry = context->symbol_table; is_valid && curr_entry != NULL; curr_entry = curr_entry->next) {
+        if (curr_entry->type == ENTRY_SYMBOL) {
+            is_valid = append_dependency(&dependencies, ENTRY_DEPENDENCY, curr_entry->name, (unsigned long)curr_entry->value, 0);
+        }
+        else if (curr_entry->type == EXTERNAL_REFERENCE) {
+            /* An external symbol used several times is recorded once */
+            for (index = 0; index < dependencies.count && (dependencies.items[index].kind != EXTERN_DEPENDENCY ||
+                 strcmp(dependencies.items[index].name, curr_entry->name) != 0); index++);
+            if (index == dependencies.count) {
+                is_valid = append_dependency(&dependencies, EXTERN_DEPENDENCY, curr_entry->name, 0, 0);
+            }
+        }
+    }
+    record->dependencies = dependencies.items;
+    record->dependency_count = dependencies.count;
+
+    /* A file that can't be recorded is assembled again by the next run */
+    if (!is_valid) {
+        free_record(record);
+        forget_file_dependencies(context->file_name);
+        return;
+    }
+    note_changed_entries(old_record, record);
+    if (old_record != NULL) {
+        next_record = old_record->next;
+        unlink_record(old_record);
+        free_record(old_record);
+    }
+    if (!link_record(record, next_record)) {
+        free_record(record);
+    }
+}
+
+/* Removes the record of a file that failed */
+void forget_file_dependencies(char *file_name) {
+    struct manifest_record *record = find_record(file_name);
+
+    if (record != NULL) {
+        /* Its entries are gone until it is assembled again */
+        note_changed_entries(record, NULL);
+        unlink_record(record);
+        free_record(record);
+    }
+}
+
+/* Writes the manifest for the next run */
+bool write_manifest(void) {
+    char *temporary_file_name;
+    FILE *manifest_ptr;
+    struct manifest_record *record;
+    struct dependency *dependency;
+    bool result;
+    int index;
+
+    temporary_file_name = add_extension(incremental_manifest_name, ".tmp");
+    if (temporary_file_name == NULL || (manifest_ptr = fopen(temporary_file_name, "w")) == NULL) {
+        printf("Can't write the manifest %s\n", incremental_manifest_name);
+        tracked_free(temporary_file_name);
+        return FALSE;
+    }
+
+    fprintf(manifest_ptr, "%s\n", MANIFEST_HEADER);
+    for (record = manifest_records; record != NULL; record = record->next) {
+        fprintf(manifest_ptr, "file %lx %lu %s\n", record->source_hash, record->source_size, record->file.name);
+        for (index = 0; index < record->dependency_count; index++) {
+            dependency = &record->dependencies[index];
+            switch (dependency->kind) {
+                case INCLUDE_DEPENDENCY:
+                    fprintf(manifest_ptr, "include %lx %lu %s\n", dependency->value, dependency->size, dependency->name);
+                    break;
+                case ENTRY_DEPENDENCY:
+                    fprintf(manifest_ptr, "entry %ld %s\n", (long)dependency->value, dependency->name);
+                    break;
+                case EXTERN_DEPENDENCY:
+                    fprintf(manifest_ptr, "extern %s\n", dependency->name);
+                    break;
+            }
+        }
+    }
+
+    /* The previous manifest is only replaced by a complete one */
+    result = !ferror(manifest_ptr);
+    result &= fclose(manifest_ptr) == 0;
+    if (!result || rename(temporary_file_name, incremental_manifest_name) != 0) {
+        printf("Can't write the manifest %s\n", incremental_manifest_name);
+        remove(temporary_file_name);
+        result = FALSE;
+    }
+    tracked_free(temporary_file_name);
+    return result;
+}
+
+/* Frees the records of the manifest */
+void free_manifest(void) {
+    struct manifest_record *record;
+
+    while (manifest_records != NULL) {
+        record = manifest_records;
+        manifest_records = manifest_records->next;
+        free_record(record);
+    }
+    last_record = NULL;
+    free(record_index.buckets);
+    record_index.buckets = NULL;
+    record_index.bucket_count = record_index.name_count = 0;
+    free_file_hashes();
+    free_dependency_list(&changed_entries);
+}
@@ -0,0 +1,75 @@
+#ifndef _INCREMENTAL_H
+#define _INCREMENTAL_H
+#include "global_variables.h"
+#include "assembler.h"
+
+/* First line of a manifest, with the version of its format */
+#define MANIFEST_HEADER "assembler-manifest 2"
+
+/* Length of the longest line of a manifest, a longer line makes the whole manifest invalid */
+#define MANIFEST_LINE_LENGTH 4096
+
+/* The manifest given by --incremental, NULL without it */
+extern char *incremental_manifest_name;
+
+/**
+ * @brief Reads the manifest of the previous run.
+ *
+ * A missing or invalid manifest is read as an empty one, every file is assembled again then.
+ *
+ * @param manifest_file_name The manifest.
+ */
+void load_manifest(char *manifest_file_name);
+
+/**
+ * @brief Checks whether the outputs of the previous run of a file can be reused.
+ *
+ * They can if the previous run assembled the file without errors, the source and every
+ * file it included have the same contents, and the output files it wrote still exist.
+ *
+ * @param file_name The file name without extension.
+ * @param output_name The name of its output files without extension.
+ * @return Returns true if the file doesn't need to be assembled, otherwise false.
+ */
+bool file_is_up_to_date(char *file_name, char *output_name);
+
+/**
+ * @brief Checks whether an entry symbol a file uses as an external symbol changed during this run.
+ *
+ * An entry changed when a file assembled again during this run added it, removed it
+ * or moved it, or when a file defining it failed.
+ *
+ * @param file_name The file name without extension, up to date until now.
+ * @return Returns true if the file must be assembled again, otherwise false.
+ */
+bool imports_changed(char *file_name);
+
+/**
+ * @brief Replaces the record of a file assembled without errors with its entries, external uses and included files.
+ *
+ * @param context The context of the file, after both passes.
+ */
+void record_file_dependencies(assembly_context *context);
+
+/**
+ * @brief Removes the record of a file that failed, so the next run assembles it again.
+ *
+ * @param file_name The file name without extension.
+ */
+void forget_file_dependencies(char *file_name);
+
+/**
+ * @brief Writes the manifest for the next run, the records of files outside this run are kept.
+ *
+ * The manifest is written to a temporary file first, then renamed over the previous one.
+ *
+ * @return Returns true if the manifest was written, otherwise false.
+ */
+bool write_manifest(void);
+
+/**
+ * @brief Frees the records of the manifest.
+ */
+void free_manifest(void);
+
+#endif
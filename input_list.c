@@ -0,0 +1,179 @@
+#define _POSIX_C_SOURCE 200809L /* mkdir */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <sys/stat.h>
+#include "input_list.h"
+
+/* The characters that separate the fields of a line of a manifest */
+#define INPUT_LIST_SPACES " \t\r\n"
+
+static char *created_directory = NULL;     /* The output directory created last, most manifest entries share the directory of the one before */
+
+/**
+ * @brief Creates a directory and its missing parents.
+ *
+ * @param directory The directory.
+ * @return Returns true if the directory exists, otherwise false.
+ */
+static bool create_directories(char *directory) {
+    char *path;
+    char *slash;
+    bool created = TRUE;
+
+    if (created_directory != NULL && strcmp(created_directory, directory) == 0) {
+        return TRUE;
+    }
+    path = (char *)malloc(strlen(directory) + 1);
+    if (path == NULL) {
+        printf("Memory allocation failed");
+        return FALSE;
+    }
+    strcpy(path, directory);
+
+    /* Every parent first, skipping the slash of an absolute path */
+    for (slash = strchr(path + 1, '/'); slash != NULL && created; slash = strchr(slash + 1, '/')) {
+        *slash = '\0';
+        created = mkdir(path, 0777) == 0 || errno == EEXIST;
+        *slash = '/';
+    }
+    created = created && (mkdir(path, 0777) == 0 || errno == EEXIST);
+    if (created) {
+        free(created_directory);
+        created_directory = path;
+    }
+    else {
+        free(path);
+    }
+    return created;
+}
+
+/* Adds an input file to a list */
+bool add_input_file(input_list *inputs, char *file_name, char *output_directory) {
+    char **file_names;
+    char **output_names;
+    char *base_name;
+    size_t directory_length;
+
+    if (inputs->count == inputs->capacity) {
+        file_names = (char **)realloc(inputs->file_names, (inputs->capacity * 2 + 16) * sizeof(char *));
+        if (file_names != NULL) {
+            inputs->file_names = file_names;
+        }
+        output_names = (char **)realloc(inputs->output_names, (inputs->capacity * 2 + 16) * sizeof(char *));
+        if (output_names != NULL) {
+            inputs->output_names = output_names;
+        }
+        if (file_names == NULL || output_names == NULL) {
+            printf("Memory allocation failed");
+            return FALSE;
+        }
+        inputs->capacity = inputs->capacity * 2 + 16;
+    }
+
+    inputs->file_names[inputs->count] = (char *)malloc(strlen(file_name) + 1);
+    if (inputs->file_names[inputs->count] == NULL) {
+        printf("Memory allocation failed");
+        return FALSE;
+    }
+    strcpy(inputs->file_names[inputs->count], file_name);
+    if (output_directory == NULL) {
+        inputs->output_names[inputs->count] = inputs->file_names[inputs->count];
+        inputs->count++;
+        return TRUE;
+    }
+
+    /* The output files keep the name of the input file, in the output directory */
+    if (!create_directories(output_directory)) {
+        printf("Can't create the output directory %s\n", output_directory);
+        free(inputs->file_names[inputs->count]);
+        return FALSE;
+    }
+    base_name = strrchr(file_name, '/') != NULL ? strrchr(file_name, '/') + 1 : file_name;
+    directory_length = strlen(output_directory);
+    while (directory_length > 1 && output_directory[directory_length - 1] == '/') {
+        directory_length--;
+    }
+    inputs->output_names[inputs->count] = (char *)malloc(directory_length + strlen(base_name) + 2);
+    if (inputs->output_names[inputs->count] == NULL) {
+        printf("Memory allocation failed");
+        free(inputs->file_names[inputs->count]);
+        return FALSE;
+    }
+    strncpy(inputs->output_names[inputs->count], output_directory, directory_length);
+    sprintf(inputs->output_names[inputs->count] + directory_length, "%s%s", output_directory[directory_length - 1] == '/' ? "" : "/", base_name);
+    inputs->count++;
+    return TRUE;
+}
+
+/* Adds the input files of a manifest to a list */
+bool read_input_manifest(input_list *inputs, char *manifest_file_name) {
+    FILE *manifest_ptr;
+    char line[INPUT_LIST_LINE_LENGTH + 2];
+    char *file_name;
+    char *output_directory;
+    char *rest;                 /* What follows the output directory, only spaces */
+    long line_number = 0;
+    bool read_success = TRUE;
+
+    manifest_ptr = strcmp(manifest_file_name, "-") == 0 ? stdin : fopen(manifest_file_name, "r");
+    if (manifest_ptr == NULL) {
+        printf("The manifest %s can't be opened\n", manifest_file_name);
+        return FALSE;
+    }
+    while (read_success && fgets(line, sizeof(line), manifest_ptr) != NULL) {
+        line_number++;
+        if (strchr(line, '\n') == NULL && !feof(manifest_ptr)) {
+            printf("Line %ld of the manifest %s is too long\n", line_number, manifest_file_name);
+            read_success = FALSE;
+            break;
+        }
+        /* The file name, then the output directory, each up to the first space or new line */
+        file_name = line + strspn(line, INPUT_LIST_SPACES);
+        if (file_name[0] == '\0' || file_name[0] == '#') {
+            continue;
+        }
+        output_directory = file_name + strcspn(file_name, INPUT_LIST_SPACES);
+        if (output_directory[0] != '\0') {
+            *output_directory++ = '\0';
+            output_directory += strspn(output_directory, INPUT_LIST_SPACES);
+        }
+        rest = output_directory + strcspn(output_directory, INPUT_LIST_SPACES);
+        if (rest[0] != '\0') {
+            *rest++ = '\0';
+        }
+        if (output_directory[0] == '\0') {
+            output_directory = NULL;
+        }
+        if (rest[strspn(rest, INPUT_LIST_SPACES)] != '\0') {
+            printf("Line %ld of the manifest %s has more than a file and an output directory\n", line_number, manifest_file_name);
+            read_success = FALSE;
+            break;
+        }
+        read_success = add_input_file(inputs, file_name, output_directory);
+    }
+    if (manifest_ptr != stdin) {
+        fclose(manifest_ptr);
+    }
+    return read_success;
+}
+
+/* Frees the files of a list */
+void free_input_list(input_list *inputs) {
+    int index;
+
+    for (index = 0; index < inputs->count; index++) {
+        if (inputs->output_names[index] != inputs->file_names[index]) {
+            free(inputs->output_names[index]);
+        }
+        free(inputs->file_names[index]);
+    }
+    free(inputs->file_names);
+    free(inputs->output_names);
+    inputs->file_names = NULL;
+    inputs->output_names = NULL;
+    inputs->count = inputs->capacity = 0;
+    free(created_directory);
+    created_directory = NULL;
+}
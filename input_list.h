@@ -0,0 +1,46 @@
+#ifndef _INPUT_LIST_H
+#define _INPUT_LIST_H
+#include "global_variables.h"
+
+/* Length of the longest line of a manifest of --manifest */
+#define INPUT_LIST_LINE_LENGTH 4096
+
+/* The input files of a run, from the command line and from --manifest */
+typedef struct input_list {
+    char **file_names;      /* The input files, without extension */
+    char **output_names;    /* The output files of each input file, without extension: the input file itself, or its name in its output directory */
+    int count;              /* Number of input files */
+    int capacity;           /* Allocated length of the arrays */
+} input_list;
+
+/**
+ * @brief Adds an input file to a list.
+ *
+ * @param inputs The list.
+ * @param file_name The file name without extension, it is copied.
+ * @param output_directory The directory of its output files, created if missing, or NULL to write them next to the input file.
+ * @return Returns true if the file was added, otherwise false.
+ */
+bool add_input_file(input_list *inputs, char *file_name, char *output_directory);
+
+/**
+ * @brief Adds the input files of a manifest to a list.
+ *
+ * Each line of the manifest is a file name without extension, optionally followed by
+ * spaces or tabs and the directory of its output files. Empty lines and lines starting
+ * with # are skipped.
+ *
+ * @param inputs The list.
+ * @param manifest_file_name The manifest, or "-" to read it from the standard input.
+ * @return Returns true if the whole manifest was read, otherwise false.
+ */
+bool read_input_manifest(input_list *inputs, char *manifest_file_name);
+
+/**
+ * @brief Frees the files of a list.
+ *
+ * @param inputs The list.
+ */
+void free_input_list(input_list *inputs);
+
+#endif
@@ -1,9 +1,73 @@
+#define _POSIX_C_SOURCE 200112L /* open, fstat and mmap for .incbin */
 #include <string.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include "utility_functions.h"
 #include "data_tables.h"
 #include "code_functions.h"
+#include "alloc_tracking.h"
+
+/**
+ * @brief Extracts the comma separated integer operands of a directive.
+ *
+ * Each operand is either an integer or a .define name, which is converted to its value.
+ *
+ * @param line The line_info structure containing information about the current line.
+ * @param index_line The index within the line content where the operands start.
+ * @param operands Array to store the parsed operand values.
+ * @param max_operands The maximum number of operands the directive accepts.
+ * @param leading_comma Whether a comma is expected before the first operand.
+ * @param directive_name The name of the directive, used in error messages.
+ * @param symbol_table The symbol table containing defined symbols.
+ * @return Returns the number of operands found, or -1 if an error was printed.
+ */
+static int extract_integer_operands(line_info line, int index_line, long *operands, int max_operands, bool leading_comma, char *directive_name, table symbol_table) {
+    char temp_string[MAX_LINE_LENGTH]; /* Temporary buffer to store the extracted operand */
+    int operand_count = 0; /* Number of operands found */
+    int index_number; /* Index for storing characters in the temporary string buffer */
+
+    index_line = skip_spaces(line.content, index_line); /* Skip leading spaces */
+
+    while (line.content[index_line] && line.content[index_line] != '\n' && line.content[index_line] != EOF) {
+        /* Operands are separated by commas */
+        if (leading_comma || operand_count > 0) {
+            if (line.content[index_line] != ',') {
+                print_error(line, "Expecting ',' between %s operands", directive_name);
+                return -1;
+            }
+            index_line = skip_spaces(line.content, index_line + 1);
+        }
+        if (operand_count == max_operands) {
+            print_error(line, "Too many operands for %s instruction (expected at most %d)", directive_name, max_operands);
+            return -1;
+        }
+
+        /* Extract characters until encountering whitespace, comma, or newline */
+        index_number = 0;
+        while (line.content[index_line] && line.content[index_line] != EOF && line.content[index_line] != '\t' &&
+               line.content[index_line] != ' ' && line.content[index_line] != ',' && line.content[index_line] != '\n') {
+            temp_string[index_number] = line.content[index_line];
+            index_line++;
+            index_number++;
+        }
+        temp_string[index_number] = '\0'; /* Null-terminate the extracted string */
+
+        /* Convert any defined symbols to their corresponding numeric values */
+        convert_defind(temp_string, symbol_table, FALSE);
+        if (!check_if_digit(temp_string)) {
+            print_error(line, "Expected integer for %s instruction (got '%s')", directive_name, temp_string);
+            return -1;
+        }
+        operands[operand_count++] = strtol(temp_string, NULL, 10);
+
+        index_line = skip_spaces(line.content, index_line); /* Skip trailing spaces */
+    }
+    return operand_count;
+}
 
 /* Finds the instruction from the index within a line */
 instruction find_instruction_from_index(line_info line, int *index_line) {
@@ -66,6 +130,12 @@ bool process_string_instruction(line_info line, int index_line, long *data_img,
         /* Null-terminate the extracted string */
         temp_string[last_quote_location - line.content] = '\0';
 
+        /* Check the string and its terminator fit in the data image */
+        if ((long)strcspn(temp_string + 1, "\"") + 1 > CODE_ARR_IMG_LENGTH - *dc) {
+            print_error(line, "String is too large for the data image");
+            return FALSE;
+        }
+
         /* Convert the string content into ASCII values and store them in the data_img array */
         for (index_string = 1; temp_string[index_string] && temp_string[index_string] != '"'; index_string++) {
             data_img[*dc] = temp_string[index_string]; /* Store ASCII value */
@@ -112,6 +182,12 @@ bool process_data_instruction(line_info line, int index_line, long *data_img, lo
             return FALSE;
         }
 
+        /* Check the value fits in the data image */
+        if (*dc >= CODE_ARR_IMG_LENGTH) {
+            print_error(line, "Data is too large for the data image");
+            return FALSE;
+        }
+
         /* Convert the string to a long integer */
         number_value = strtol(temp_string, &temp_pointer, 10);
         data_img[*dc] = number_value; /* Store the parsed integer value */
@@ -141,4 +217,152 @@ bool process_data_instruction(line_info line, int index_line, long *data_img, lo
     }
 
     return TRUE; /* Return TRUE indicating successful processing */
-}
\ No newline at end of file
+}
+
+/* Processes the .incbin instruction within a line */
+bool process_incbin_instruction(line_info line, int index_line, long *data_img, long *dc, table symbol_table) {
+    char file_name[MAX_LINE_LENGTH]; /* Buffer to store the quoted file name */
+    long operands[2]; /* Offset and length of the copied range, in bytes */
+    int operand_count; /* Number of offset/length operands found */
+    int index_string = 0; /* Index for storing characters in the file name buffer */
+    char *path; /* File name resolved against the source file directory */
+    int file_descriptor; /* Descriptor of the binary file */
+    struct stat file_stat; /* Used to get the size of the binary file */
+    void *contents; /* Mapped contents of the binary file */
+    unsigned char *bytes; /* First byte of the copied range */
+    long index_byte; /* Index of the byte being copied */
+
+    index_line = skip_spaces(line.content, index_line); /* Skip leading spaces */
+
+    /* Extract the quoted file name */
+    if (line.content[index_line] != '"') {
+        print_error(line, "Missing opening quote of .incbin file name");
+        return FALSE;
+    }
+    index_line++;
+    while (line.content[index_line] && line.content[index_line] != '"' && line.content[index_line] != '\n') {
+        file_name[index_string] = line.content[index_line];
+        index_line++;
+        index_string++;
+    }
+    file_name[index_string] = '\0';
+    if (line.content[index_line] != '"') {
+        print_error(line, "Missing closing quote of .incbin file name");
+        return FALSE;
+    }
+    if (file_name[0] == '\0') {
+        print_error(line, "You have to specify a file name for .incbin instruction.");
+        return FALSE;
+    }
+    index_line++;
+
+    /* Extract the optional offset and length operands */
+    operand_count = extract_integer_operands(line, index_line, operands, 2, TRUE, ".incbin", symbol_table);
+    if (operand_count < 0) {
+        return FALSE;
+    }
+    if ((operand_count > 0 && operands[0] < 0) || (operand_count > 1 && operands[1] < 0)) {
+        print_error(line, "Offset and length of .incbin instruction can't be negative");
+        return FALSE;
+    }
+
+    /* Open the binary file and get its size */
+    path = resolve_relative_path(line.file_name, file_name);
+    if (path == NULL) {
+        return FALSE;
+    }
+    file_descriptor = open(path, O_RDONLY);
+    if (file_descriptor < 0 || fstat(file_descriptor, &file_stat) != 0) {
+        print_error(line, "Can't open binary file %s", path);
+        if (file_descriptor >= 0) {
+            close(file_descriptor);
+        }
+        tracked_free(path);
+        return FALSE;
+    }
+
+    /* The range defaults to the whole file */
+    if (operand_count < 1) {
+        operands[0] = 0;
+    }
+    if (operand_count < 2) {
+        operands[1] = file_stat.st_size > operands[0] ? file_stat.st_size - operands[0] : 0;
+    }
+    if (operands[0] > file_stat.st_size || operands[1] > file_stat.st_size - operands[0]) {
+        print_error(line, "Range %ld+%ld is out of the bounds of binary file %s (%ld bytes)", operands[0], operands[1], path, (long)file_stat.st_size);
+        close(file_descriptor);
+        tracked_free(path);
+        return FALSE;
+    }
+    if (operands[1] > CODE_ARR_IMG_LENGTH - *dc) {
+        print_error(line, "Binary file %s is too large for the data image (%ld bytes)", path, operands[1]);
+        close(file_descriptor);
+        tracked_free(path);
+        return FALSE;
+    }
+
+    /* Map the file and copy the requested range into the data image, one byte per word */
+    if (operands[1] > 0) {
+        contents = mmap(NULL, operands[0] + operands[1], PROT_READ, MAP_PRIVATE, file_descriptor, 0);
+        if (contents == MAP_FAILED) {
+            print_error(line, "Can't map binary file %s", path);
+            close(file_descriptor);
+            tracked_free(path);
+            return FALSE;
+        }
+        bytes = (unsigned char *)contents + operands[0];
+        for (index_byte = 0; index_byte < operands[1]; index_byte++) {
+            data_img[*dc + index_byte] = bytes[index_byte];
+        }
+        munmap(contents, operands[0] + operands[1]);
+        (*dc) += operands[1]; /* Advance the data counter past the copied range */
+    }
+
+    close(file_descriptor);
+    tracked_free(path);
+    return TRUE; /* Return TRUE indicating successful processing */
+}
+
+/* Processes the .fill and .space instructions within a line */
+bool process_fill_instruction(line_info line, int index_line, long *data_img, long *dc, table symbol_table, instruction fill_instruction) {
+    long operands[2]; /* Count of words and the value to store in them */
+    int expected_count = fill_instruction == SPACE_INST ? 1 : 2; /* .space takes only a count */
+    char *directive_name = fill_instruction == SPACE_INST ? ".space" : ".fill";
+    int operand_count; /* Number of operands found */
+    long index_word; /* Index of the word being initialized */
+
+    /* Extract the operands, errors were already printed if operand_count is negative */
+    operand_count = extract_integer_operands(line, index_line, operands, expected_count, FALSE, directive_name, symbol_table);
+    if (operand_count < 0) {
+        return FALSE;
+    }
+    if (operand_count != expected_count) {
+        print_error(line, "Operation %s requires %d operand(s) (got %d)", directive_name, expected_count, operand_count);
+        return FALSE;
+    }
+    if (fill_instruction == SPACE_INST) {
+        operands[1] = 0; /* Reserved words are zeroed */
+    }
+
+    /* Validate the count against the remaining space in the data image */
+    if (operands[0] < 0) {
+        print_error(line, "Count of %s instruction can't be negative (got %ld)", directive_name, operands[0]);
+        return FALSE;
+    }
+    if (operands[0] > CODE_ARR_IMG_LENGTH - *dc) {
+        print_error(line, "Count of %s instruction is too large for the data image (got %ld)", directive_name, operands[0]);
+        return FALSE;
+    }
+
+    /* Initialize the whole region at once */
+    if (operands[1] == 0) {
+        memset(data_img + *dc, 0, operands[0] * sizeof(long));
+    }
+    else {
+        for (index_word = 0; index_word < operands[0]; index_word++) {
+            data_img[*dc + index_word] = operands[1];
+        }
+    }
+    (*dc) += operands[0]; /* Advance the data counter past the region */
+    return TRUE;
+}
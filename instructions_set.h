@@ -49,4 +49,39 @@ bool process_string_instruction(line_info line, int index_line, long *data_img,
  */
 bool process_data_instruction(line_info line, int index_line, long *data_img, long *dc, table symbol_table);
 
+/**
+ * @brief Processes the .incbin instruction within a line.
+ *
+ * This function extracts the quoted file name and the optional offset and length operands
+ * (integers or .define names) from the specified index within the content of a line.
+ * A relative file name is resolved against the directory of the source file. The file is
+ * mapped into memory and the requested range of bytes is copied into the data_img array,
+ * one byte per data word.
+ *
+ * @param line The line_info structure containing information about the current line.
+ * @param index_line The index within the line content from where to start processing the .incbin instruction.
+ * @param data_img Array to store the bytes read from the binary file.
+ * @param dc Pointer to the data counter to track the position in the data_img array.
+ * @param symbol_table The symbol table containing defined symbols.
+ * @return Returns TRUE if the .incbin instruction is successfully processed, otherwise returns FALSE.
+ */
+bool process_incbin_instruction(line_info line, int index_line, long *data_img, long *dc, table symbol_table);
+
+/**
+ * @brief Processes the .fill and .space instructions within a line.
+ *
+ * This function extracts the count (and for .fill, the value) operands, integers or .define names,
+ * from the specified index within the content of a line. It then initializes count words of the
+ * data_img array with the value (zero for .space) in a single bulk operation.
+ *
+ * @param line The line_info structure containing information about the current line.
+ * @param index_line The index within the line content from where to start processing the instruction.
+ * @param data_img Array to store the initialized words.
+ * @param dc Pointer to the data counter to track the position in the data_img array.
+ * @param symbol_table The symbol table containing defined symbols.
+ * @param fill_instruction Either FILL_INST or SPACE_INST.
+ * @return Returns TRUE if the instruction is successfully processed, otherwise returns FALSE.
+ */
+bool process_fill_instruction(line_info line, int index_line, long *data_img, long *dc, table symbol_table, instruction fill_instruction);
+
 #endif
\ No newline at end of file
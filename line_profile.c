@@ -0,0 +1,252 @@
+#define _POSIX_C_SOURCE 199309L /* clock_gettime */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "line_profile.h"
+#include "statistics.h"
+
+/* Characters of a line kept for the report */
+#define PROFILE_TEXT_LENGTH 48
+
+/* Length of the macro names kept for the report, like the names of the macro table */
+#define PROFILE_MACRO_NAME_LENGTH 50
+
+/* A profiled file */
+struct profiled_file {
+    char *name;                     /* The file name without extension */
+    bool has_macros;                /* Whether the lines are lines of the .am file */
+    struct profiled_file *next;     /* The file profiled before it */
+};
+
+/* Where a line of the expanded source comes from */
+struct line_origin {
+    int source_line_number;                         /* Line of the .as file */
+    char macro_name[PROFILE_MACRO_NAME_LENGTH];     /* Macro the line comes from, empty if none */
+    int macro_line_number;                          /* Line of the macro definition it comes from */
+};
+
+/* Measurements of a line, summed over both passes */
+struct line_cost {
+    struct profiled_file *file;         /* The file of the line */
+    int line_number;                    /* Line of the assembled source */
+    struct line_origin origin;          /* Where the line comes from */
+    char text[PROFILE_TEXT_LENGTH + 1]; /* Start of the line */
+    double cycles;                      /* Cycles spent processing the line */
+    long lookups;                       /* Calls to find_by_types */
+    long entries;                       /* Table entries visited by find_by_types and add_table_item */
+};
+
+bool profile_lines_enabled = FALSE;
+
+static struct line_cost *line_costs = NULL;         /* Lines of every file profiled so far */
+static long line_count = 0;                         /* Number of recorded lines */
+static long line_capacity = 0;                      /* Allocated length of line_costs */
+static long file_first_line = 0;                    /* Index in line_costs of the first line of the current file */
+static struct profiled_file *profiled_files = NULL; /* The profiled files, the current one first */
+
+static struct line_origin *origins = NULL;          /* Origins of the lines of the current file */
+static long origin_count = 0;                       /* Number of recorded origins */
+static long origin_capacity = 0;                    /* Allocated length of origins */
+
+static double line_start_cycles;    /* Cycles when the current line started */
+static long line_start_lookups;     /* Lookups when the current line started */
+static long line_start_entries;     /* Entries visited when the current line started */
+
+/**
+ * @brief Reads the time stamp counter, or the monotonic clock in nanoseconds where there is none.
+ *
+ * @return The current cycle count.
+ */
+static double read_cycles(void) {
+#if defined(__x86_64__) || defined(__i386__)
+    unsigned int low, high;
+
+    __asm__ __volatile__("rdtsc" : "=a"(low), "=d"(high));
+    return high * 4294967296.0 + low;
+#else
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec * 1e9 + now.tv_nsec;
+#endif
+}
+
+/* Starts profiling the lines of a file */
+void profile_begin_file(char *file_name) {
+    struct profiled_file *file;
+
+    if (!profile_lines_enabled) {
+        return;
+    }
+    file = (struct profiled_file *)malloc(sizeof(struct profiled_file));
+    if (file == NULL || (file->name = (char *)malloc(strlen(file_name) + 1)) == NULL) {
+        printf("Memory allocation failed");
+        free(file);
+        profile_lines_enabled = FALSE;
+        return;
+    }
+    strcpy(file->name, file_name);
+    file->has_macros = FALSE;
+    file->next = profiled_files;
+    profiled_files = file;
+    file_first_line = line_count;
+    origin_count = 0;
+}
+
+/* Records where the next line of the expanded source comes from */
+void profile_add_origin(int source_line_number, char *macro_name, int macro_line_number) {
+    struct line_origin *new_origins;
+
+    if (!profile_lines_enabled || profiled_files == NULL) {
+        return;
+    }
+    if (origin_count == origin_capacity) {
+        new_origins = (struct line_origin *)realloc(origins, (origin_capacity * 2 + 64) * sizeof(struct line_origin));
+        if (new_origins == NULL) {
+            return;
+        }
+        origins = new_origins;
+        origin_capacity = origin_capacity * 2 + 64;
+    }
+    origins[origin_count].source_line_number = source_line_number;
+    origins[origin_count].macro_name[0] = '\0';
+    if (macro_name != NULL) {
+        strncat(origins[origin_count].macro_name, macro_name, PROFILE_MACRO_NAME_LENGTH - 1);
+    }
+    origins[origin_count].macro_line_number = macro_line_number;
+    origin_count++;
+    profiled_files->has_macros |= macro_name != NULL;
+}
+
+/* Starts measuring a line */
+void profile_line_begin(void) {
+    if (!profile_lines_enabled) {
+        return;
+    }
+    line_start_lookups = current_stats.find_calls;
+    line_start_entries = current_stats.entries_scanned + current_stats.insert_steps;
+    line_start_cycles = read_cycles();
+}
+
+/* Stops measuring a line, adding its cycles and symbol table probes to the line */
+void profile_line_end(line_info line) {
+    double end_cycles;
+    struct line_cost *new_costs;
+    struct line_cost *cost;
+    long index = file_first_line + line.line_number - 1;
+    int text_index;
+
+    if (!profile_lines_enabled || profiled_files == NULL || line.line_number < 1) {
+        return;
+    }
+    end_cycles = read_cycles();
+
+    /* Record every line up to this one, the lines that weren't measured cost nothing */
+    while (line_count <= index) {
+        if (line_count == line_capacity) {
+            new_costs = (struct line_cost *)realloc(line_costs, (line_capacity * 2 + 256) * sizeof(struct line_cost));
+            if (new_costs == NULL) {
+                return;
+            }
+            line_costs = new_costs;
+            line_capacity = line_capacity * 2 + 256;
+        }
+        cost = &line_costs[line_count];
+        memset(cost, 0, sizeof(struct line_cost));
+        cost->file = profiled_files;
+        cost->line_number = line_count - file_first_line + 1;
+        if (line_count - file_first_line < origin_count) {
+            cost->origin = origins[line_count - file_first_line];
+        }
+        else {
+            cost->origin.source_line_number = cost->line_number;
+        }
+        line_count++;
+    }
+
+    cost = &line_costs[index];
+    if (cost->text[0] == '\0') {
+        /* Keep the start of the line, without the leading spaces and the new line */
+        for (text_index = 0; line.content[text_index] == ' ' || line.content[text_index] == '\t'; text_index++);
+        strncat(cost->text, line.content + text_index, PROFILE_TEXT_LENGTH);
+        cost->text[strcspn(cost->text, "\r\n")] = '\0';
+    }
+    cost->cycles += end_cycles - line_start_cycles;
+    cost->lookups += current_stats.find_calls - line_start_lookups;
+    cost->entries += current_stats.entries_scanned + current_stats.insert_steps - line_start_entries;
+}
+
+/**
+ * @brief Orders lines by decreasing cycles, then by their order in the run.
+ */
+static int compare_line_costs(const void *first, const void *second) {
+    const struct line_cost *first_cost = *(const struct line_cost **)first;
+    const struct line_cost *second_cost = *(const struct line_cost **)second;
+
+    if (first_cost->cycles != second_cost->cycles) {
+        return first_cost->cycles < second_cost->cycles ? 1 : -1;
+    }
+    return first_cost < second_cost ? -1 : first_cost > second_cost;
+}
+
+/* Prints the most expensive lines of every profiled file */
+void profile_print_report(FILE *output, long top_count) {
+    struct line_cost **sorted_costs;
+    struct line_cost *cost;
+    double total_cycles = 0;
+    long index;
+
+    if (!profile_lines_enabled) {
+        return;
+    }
+    sorted_costs = (struct line_cost **)malloc((line_count + 1) * sizeof(struct line_cost *));
+    if (sorted_costs == NULL) {
+        printf("Memory allocation failed");
+        return;
+    }
+    for (index = 0; index < line_count; index++) {
+        sorted_costs[index] = &line_costs[index];
+        total_cycles += line_costs[index].cycles;
+    }
+    qsort(sorted_costs, line_count, sizeof(struct line_cost *), compare_line_costs);
+
+    top_count = top_count < line_count ? top_count : line_count;
+#if defined(__x86_64__) || defined(__i386__)
+    fprintf(output, "Hot lines: top %ld of %ld lines by cycles, %.0f cycles in total\n", top_count, line_count, total_cycles);
+#else
+    fprintf(output, "Hot lines: top %ld of %ld lines by time, %.0f ns in total\n", top_count, line_count, total_cycles);
+#endif
+    for (index = 0; index < top_count; index++) {
+        cost = sorted_costs[index];
+        fprintf(output, "%3ld. %s%s:%d  %.0f (%.1f%%), %ld lookups, %ld entries visited\n", index + 1, cost->file->name,
+                cost->file->has_macros ? ".am" : ".as", cost->line_number, cost->cycles,
+                total_cycles > 0 ? 100 * cost->cycles / total_cycles : 0, cost->lookups, cost->entries);
+        if (cost->origin.macro_name[0] != '\0') {
+            fprintf(output, "     expanded from %s.as:%d by macro %s, body line %s.as:%d\n", cost->file->name,
+                    cost->origin.source_line_number, cost->origin.macro_name, cost->file->name, cost->origin.macro_line_number);
+        }
+        else if (cost->file->has_macros) {
+            fprintf(output, "     from %s.as:%d\n", cost->file->name, cost->origin.source_line_number);
+        }
+        fprintf(output, "     %s\n", cost->text);
+    }
+    free(sorted_costs);
+}
+
+/* Frees the recorded lines */
+void free_line_profile(void) {
+    struct profiled_file *next_file;
+
+    while (profiled_files != NULL) {
+        next_file = profiled_files->next;
+        free(profiled_files->name);
+        free(profiled_files);
+        profiled_files = next_file;
+    }
+    free(line_costs);
+    free(origins);
+    line_costs = NULL;
+    origins = NULL;
+    line_count = line_capacity = origin_count = origin_capacity = 0;
+}
@@ -0,0 +1,57 @@
+#ifndef _LINE_PROFILE_H
+#define _LINE_PROFILE_H
+#include <stdio.h>
+#include "global_variables.h"
+
+/* Number of lines reported when --profile-lines isn't followed by a count */
+#define DEFAULT_PROFILE_LINES 10
+
+/* Whether --profile-lines was given, lines are only measured when it is set */
+extern bool profile_lines_enabled;
+
+/**
+ * @brief Starts profiling the lines of a file.
+ *
+ * Must be called before the macros of the file are processed, so the origins of its lines are recorded.
+ *
+ * @param file_name The file name without extension.
+ */
+void profile_begin_file(char *file_name);
+
+/**
+ * @brief Records where the next line of the expanded source comes from.
+ *
+ * Called by the macro processing once per line it writes, in order.
+ *
+ * @param source_line_number The line of the source file that was expanded.
+ * @param macro_name The name of the macro the line comes from, or NULL for a line copied as is.
+ * @param macro_line_number The line of the macro definition the line comes from, if it comes from a macro.
+ */
+void profile_add_origin(int source_line_number, char *macro_name, int macro_line_number);
+
+/**
+ * @brief Starts measuring a line.
+ */
+void profile_line_begin(void);
+
+/**
+ * @brief Stops measuring a line, adding its cycles and symbol table probes to the line.
+ *
+ * @param line The line that was processed.
+ */
+void profile_line_end(line_info line);
+
+/**
+ * @brief Prints the most expensive lines of every profiled file.
+ *
+ * @param output The stream the report is written to.
+ * @param top_count The number of lines to print.
+ */
+void profile_print_report(FILE *output, long top_count);
+
+/**
+ * @brief Frees the recorded lines.
+ */
+void free_line_profile(void);
+
+#endif
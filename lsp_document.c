@@ -0,0 +1,668 @@
+#define _POSIX_C_SOURCE 200809L /* fmemopen and open_memstream */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include "lsp_document.h"
+#include "assembler.h"
+#include "preprocessor.h"
+#include "code_functions.h"
+
+/**
+ * @brief Splits a text into lines, without their new lines. A text ending with a new line ends with an empty line.
+ *
+ * @param text The text.
+ * @param line_count Receives the number of lines.
+ * @return Returns the lines, each allocated, or NULL if memory allocation failed.
+ */
+static char **split_lines(char *text, long *line_count) {
+    char **lines;
+    char *line_end;
+    size_t length;
+    long count = 1;
+    long index;
+
+    for (line_end = strchr(text, '\n'); line_end != NULL; line_end = strchr(line_end + 1, '\n')) {
+        count++;
+    }
+    if ((lines = (char **)calloc(count, sizeof(char *))) == NULL) {
+        printf("Memory allocation failed");
+        return NULL;
+    }
+    for (index = 0; index < count; index++) {
+        line_end = strchr(text, '\n');
+        length = line_end != NULL ? (size_t)(line_end - text) : strlen(text);
+        if ((lines[index] = (char *)malloc(length + 1)) == NULL) {
+            printf("Memory allocation failed");
+            while (index > 0) {
+                free(lines[--index]);
+            }
+            free(lines);
+            return NULL;
+        }
+        memcpy(lines[index], text, length);
+        lines[index][length] = '\0';
+
+        /* Editors on Windows end their lines with a carriage return too */
+        if (length > 0 && lines[index][length - 1] == '\r') {
+            lines[index][length - 1] = '\0';
+        }
+        text += length + 1;
+    }
+    *line_count = count;
+    return lines;
+}
+
+/**
+ * @brief Adds a symbol to a line.
+ *
+ * @param line The line.
+ * @param column The column of the symbol.
+ * @param length The length of its name.
+ * @param is_definition Whether the line defines the symbol.
+ * @return Returns true if the symbol was added, otherwise false.
+ */
+static bool add_occurrence(document_line *line, int column, int length, bool is_definition) {
+    symbol_occurrence *occurrences;
+    symbol_occurrence *occurrence;
+
+    occurrences = (symbol_occurrence *)realloc(line->occurrences, (line->occurrence_count + 1) * sizeof(symbol_occurrence));
+    if (occurrences == NULL) {
+        printf("Memory allocation failed");
+        return FALSE;
+    }
+    line->occurrences = occurrences;
+    occurrence = &line->occurrences[line->occurrence_count];
+    if ((occurrence->name = (char *)malloc(length + 1)) == NULL) {
+        printf("Memory allocation failed");
+        return FALSE;
+    }
+    memcpy(occurrence->name, line->text + column, length);
+    occurrence->name[length] = '\0';
+    occurrence->column = column;
+    occurrence->length = length;
+    occurrence->is_definition = is_definition;
+    line->occurrence_count++;
+    return TRUE;
+}
+
+/**
+ * @brief Measures the word that starts at a column, up to a space, a comma or a colon.
+ *
+ * @param text The line.
+ * @param column The column.
+ * @return Returns the length of the word.
+ */
+static int word_length(char *text, int column) {
+    int length = 0;
+
+    while (text[column + length] && !isspace((unsigned char)text[column + length]) && text[column + length] != ',' && text[column + length] != ':') {
+        length++;
+    }
+    return length;
+}
+
+/**
+ * @brief Adds every name of a part of a line as a use, except the registers.
+ *
+ * @param line The line.
+ * @param column The column the part starts at.
+ * @return Returns true if the names were added, otherwise false.
+ */
+static bool add_uses(document_line *line, int column) {
+    char name[MAX_LINE_LENGTH];
+    char *text = line->text;
+    int length;
+
+    while (text[column]) {
+        if (!isalpha((unsigned char)text[column]) || (column > 0 && isalnum((unsigned char)text[column - 1]))) {
+            column++;
+            continue;
+        }
+        for (length = 0; isalnum((unsigned char)text[column + length]); length++);
+        if (length < MAX_LINE_LENGTH) {
+            memcpy(name, text + column, length);
+            name[length] = '\0';
+            if (get_register_by_name(name) == NONE_REG && !add_occurrence(line, column, length, FALSE)) {
+                return FALSE;
+            }
+        }
+        column += length;
+    }
+    return TRUE;
+}
+
+/**
+ * @brief Finds the symbols a line defines and uses, and where a macro may be invoked.
+ *
+ * @param line The line, its previous analysis is replaced.
+ * @return Returns true if the line was analyzed, otherwise false.
+ */
+static bool analyze_line(document_line *line) {
+    char command[MAX_LINE_LENGTH];
+    char *text = line->text;
+    int column;
+    int length;
+    opcode command_opcode;
+
+    while (line->occurrence_count > 0) {
+        free(line->occurrences[--line->occurrence_count].name);
+    }
+    free(line->occurrences);
+    line->occurrences = NULL;
+    line->kind = PLAIN_LINE;
+    line->command_start = -1;
+    line->command_length = 0;
+
+    column = skip_spaces(text, 0);
+    if (!text[column] || text[column] == ';') {
+        return TRUE;
+    }
+    line->command_start = column;
+    line->command_length = word_length(text, column);
+
+    /* Macro definitions, as the macro processing finds them */
+    if (strncmp(text + column, "mcr ", 4) == 0) {
+        line->kind = MACRO_START_LINE;
+        column = skip_spaces(text, column + 4);
+        return !text[column] || add_occurrence(line, column, word_length(text, column), TRUE);
+    }
+    if (strncmp(text + column, "endmcr", 6) == 0) {
+        line->kind = MACRO_END_LINE;
+        return TRUE;
+    }
+
+    /* A label defines a symbol */
+    length = word_length(text, column);
+    if (text[column + length] == ':') {
+        if (!add_occurrence(line, column, length, TRUE)) {
+            return FALSE;
+        }
+        column = skip_spaces(text, column + length + 1);
+        length = word_length(text, column);
+    }
+    if (length == 0 || length >= MAX_LINE_LENGTH) {
+        return TRUE;
+    }
+    memcpy(command, text + column, length);
+    command[length] = '\0';
+
+    if (strcmp(command, ".define") == 0 || strcmp(command, ".extern") == 0) {
+        column = skip_spaces(text, column + length);
+        for (length = 0; text[column + length] && !isspace((unsigned char)text[column + length]) && text[column + length] != '='; length++);
+        return length == 0 || (add_occurrence(line, column, length, TRUE) && add_uses(line, column + length));
+    }
+    if (strcmp(command, ".string") == 0 || strcmp(command, ".include") == 0) {
+        return TRUE;
+    }
+    if (isalpha((unsigned char)command[0])) {
+        /* A word that isn't an instruction may invoke a macro */
+        get_opcode(command, &command_opcode);
+        if (command_opcode == NONE_OP && !add_occurrence(line, column, length, FALSE)) {
+            return FALSE;
+        }
+    }
+    return add_uses(line, column + length);
+}
+
+/**
+ * @brief Orders the symbols of the index by name, then by line and column.
+ *
+ * @param first The first symbol.
+ * @param second The second symbol.
+ * @return Returns a negative number, zero or a positive number if the first symbol comes before, with or after the second.
+ */
+static int compare_indexed_symbols(const void *first, const void *second) {
+    const indexed_symbol *first_symbol = (const indexed_symbol *)first;
+    const indexed_symbol *second_symbol = (const indexed_symbol *)second;
+    int order = strcmp(first_symbol->occurrence->name, second_symbol->occurrence->name);
+
+    if (order == 0 && first_symbol->line != second_symbol->line) {
+        order = first_symbol->line < second_symbol->line ? -1 : 1;
+    }
+    if (order == 0) {
+        order = first_symbol->occurrence->column - second_symbol->occurrence->column;
+    }
+    return order;
+}
+
+/**
+ * @brief Builds the index of a document again from the analysis of its lines.
+ *
+ * @param document The document.
+ * @return Returns true if the index was built, otherwise false.
+ */
+static bool index_document(lsp_document *document) {
+    long line;
+    long count = 0;
+    int occurrence;
+
+    for (line = 0; line < document->line_count; line++) {
+        count += document->lines[line].occurrence_count;
+    }
+    free(document->index);
+    document->index_count = 0;
+    document->index = (indexed_symbol *)malloc((count + 1) * sizeof(indexed_symbol));
+    if (document->index == NULL) {
+        printf("Memory allocation failed");
+        return FALSE;
+    }
+    for (line = 0; line < document->line_count; line++) {
+        for (occurrence = 0; occurrence < document->lines[line].occurrence_count; occurrence++) {
+            document->index[document->index_count].occurrence = &document->lines[line].occurrences[occurrence];
+            document->index[document->index_count++].line = line;
+        }
+    }
+    qsort(document->index, document->index_count, sizeof(indexed_symbol), compare_indexed_symbols);
+    return TRUE;
+}
+
+/**
+ * @brief Frees the text and the analysis of a line.
+ *
+ * @param line The line.
+ */
+static void free_document_line(document_line *line) {
+    while (line->occurrence_count > 0) {
+        free(line->occurrences[--line->occurrence_count].name);
+    }
+    free(line->occurrences);
+    free(line->text);
+}
+
+/**
+ * @brief Replaces lines of a document with new lines, analyzes the new lines and indexes the document again.
+ *
+ * @param document The document.
+ * @param first_line The first line replaced.
+ * @param removed_count The number of lines replaced.
+ * @param texts The new lines, the document takes them.
+ * @param added_count The number of new lines.
+ * @return Returns true if the lines were replaced, otherwise false.
+ */
+static bool replace_lines(lsp_document *document, long first_line, long removed_count, char **texts, long added_count) {
+    document_line *lines;
+    long new_count = document->line_count - removed_count + added_count;
+    long index;
+    bool success = TRUE;
+
+    if (new_count > document->line_capacity) {
+        lines = (document_line *)realloc(document->lines, new_count * 2 * sizeof(document_line));
+        if (lines == NULL) {
+            printf("Memory allocation failed");
+            for (index = 0; index < added_count; index++) {
+                free(texts[index]);
+            }
+            return FALSE;
+        }
+        document->lines = lines;
+        document->line_capacity = new_count * 2;
+    }
+
+    for (index = first_line; index < first_line + removed_count; index++) {
+        free_document_line(&document->lines[index]);
+    }
+    memmove(document->lines + first_line + added_count, document->lines + first_line + removed_count,
+            (document->line_count - first_line - removed_count) * sizeof(document_line));
+    for (index = 0; index < added_count; index++) {
+        document->lines[first_line + index].text = texts[index];
+        document->lines[first_line + index].occurrences = NULL;
+        document->lines[first_line + index].occurrence_count = 0;
+        success &= analyze_line(&document->lines[first_line + index]);
+    }
+    document->line_count = new_count;
+    document->analyzed_lines = added_count;
+    return index_document(document) && success;
+}
+
+/* Opens a document and analyzes all its lines */
+lsp_document *open_document(char *uri, char *path, char *text) {
+    lsp_document *document;
+    char **texts;
+    long line_count;
+
+    document = (lsp_document *)calloc(1, sizeof(lsp_document));
+    if (document == NULL || (document->uri = (char *)malloc(strlen(uri) + 1)) == NULL ||
+        (document->path = (char *)malloc(strlen(path) + 1)) == NULL) {
+        printf("Memory allocation failed");
+        if (document != NULL) {
+            free(document->uri);
+        }
+        free(document);
+        return NULL;
+    }
+    strcpy(document->uri, uri);
+    strcpy(document->path, path);
+    if ((texts = split_lines(text, &line_count)) == NULL) {
+        close_document(document);
+        return NULL;
+    }
+    replace_lines(document, 0, 0, texts, line_count);
+    free(texts);
+    return document;
+}
+
+/* Replaces a range of a document with a text */
+bool edit_document(lsp_document *document, long start_line, int start_column, long end_line, int end_column, char *text) {
+    char *start_text;
+    char *end_text;
+    char *edited;
+    char **texts;
+    long line_count;
+    bool result;
+
+    /* A range past the end of the document ends at its end */
+    if (end_line >= document->line_count) {
+        end_line = document->line_count - 1;
+        end_column = strlen(document->lines[end_line].text);
+    }
+    if (start_line > end_line || start_line < 0) {
+        return FALSE;
+    }
+    start_text = document->lines[start_line].text;
+    end_text = document->lines[end_line].text;
+    if (start_column > (int)strlen(start_text)) {
+        start_column = strlen(start_text);
+    }
+    if (end_column > (int)strlen(end_text)) {
+        end_column = strlen(end_text);
+    }
+
+    /* The lines of the range become the text before the range, the new text and the text after the range */
+    edited = (char *)malloc(start_column + strlen(text) + strlen(end_text + end_column) + 1);
+    if (edited == NULL) {
+        printf("Memory allocation failed");
+        return FALSE;
+    }
+    memcpy(edited, start_text, start_column);
+    strcpy(edited + start_column, text);
+    strcat(edited, end_text + end_column);
+    texts = split_lines(edited, &line_count);
+    free(edited);
+    if (texts == NULL) {
+        return FALSE;
+    }
+    result = replace_lines(document, start_line, end_line - start_line + 1, texts, line_count);
+    free(texts);
+    return result;
+}
+
+/* Replaces the whole text of a document */
+bool replace_document(lsp_document *document, char *text) {
+    char **texts;
+    long line_count;
+    long same_start = 0;    /* Lines that are the same at the start */
+    long same_end = 0;      /* Lines that are the same at the end */
+    long index;
+    bool result;
+
+    if ((texts = split_lines(text, &line_count)) == NULL) {
+        return FALSE;
+    }
+    while (same_start < line_count && same_start < document->line_count && strcmp(texts[same_start], document->lines[same_start].text) == 0) {
+        same_start++;
+    }
+    while (same_end < line_count - same_start && same_end < document->line_count - same_start &&
+           strcmp(texts[line_count - 1 - same_end], document->lines[document->line_count - 1 - same_end].text) == 0) {
+        same_end++;
+    }
+
+    /* The lines that are the same keep their text and analysis */
+    for (index = 0; index < same_start; index++) {
+        free(texts[index]);
+    }
+    for (index = line_count - same_end; index < line_count; index++) {
+        free(texts[index]);
+    }
+    result = replace_lines(document, same_start, document->line_count - same_start - same_end, texts + same_start, line_count - same_start - same_end);
+    free(texts);
+    return result;
+}
+
+/**
+ * @brief Counts the UTF-16 code units of the character a byte of UTF-8 starts.
+ *
+ * @param byte The byte.
+ * @return 0 for a byte that continues a character, 2 for a character outside the basic plane, otherwise 1.
+ */
+static int utf16_units(unsigned char byte) {
+    if ((byte & 0xC0) == 0x80) {
+        return 0;
+    }
+    return byte >= 0xF0 ? 2 : 1;
+}
+
+/* Converts a position of the editor in a line to a column of the line */
+int document_column(lsp_document *document, long line, long character) {
+    char *text;
+    int column = 0;
+
+    if (line < 0 || line >= document->line_count) {
+        return (int)character;
+    }
+    text = document->lines[line].text;
+    while (text[column] && character > 0) {
+        character -= utf16_units((unsigned char)text[column++]);
+        while (text[column] && utf16_units((unsigned char)text[column]) == 0) {
+            column++;
+        }
+    }
+    return column + (int)(character > 0 ? character : 0);
+}
+
+/* Converts a column of a line to a position of the editor */
+long document_character(lsp_document *document, long line, int column) {
+    char *text;
+    long character = 0;
+    int index;
+
+    if (line < 0 || line >= document->line_count) {
+        return column;
+    }
+    text = document->lines[line].text;
+    for (index = 0; index < column && text[index]; index++) {
+        character += utf16_units((unsigned char)text[index]);
+    }
+    return character;
+}
+
+/* Finds the symbol at a position of a document */
+symbol_occurrence *find_occurrence(lsp_document *document, long line, int column) {
+    document_line *current;
+    int index;
+
+    if (line < 0 || line >= document->line_count) {
+        return NULL;
+    }
+    current = &document->lines[line];
+    for (index = 0; index < current->occurrence_count; index++) {
+        if (column >= current->occurrences[index].column && column <= current->occurrences[index].column + current->occurrences[index].length) {
+            return &current->occurrences[index];
+        }
+    }
+    return NULL;
+}
+
+/* Finds the symbols of a name in the index of a document */
+indexed_symbol *find_indexed_symbols(lsp_document *document, char *name, long *count) {
+    long low = 0;
+    long high = document->index_count;
+    long middle;
+
+    /* The first symbol whose name isn't before the name */
+    while (low < high) {
+        middle = (low + high) / 2;
+        if (strcmp(document->index[middle].occurrence->name, name) < 0) {
+            low = middle + 1;
+        }
+        else {
+            high = middle;
+        }
+    }
+    for (*count = 0; low + *count < document->index_count && strcmp(document->index[low + *count].occurrence->name, name) == 0; (*count)++);
+    return *count > 0 ? &document->index[low] : NULL;
+}
+
+/**
+ * @brief Maps the lines of the expanded document to its lines, as the macro processing expands it.
+ *
+ * @param document The document.
+ * @param line_map Receives for each line of the expanded document the line it comes from, from 0,
+ *                 or minus one more than the line of the macro invocation that wrote it.
+ * @param map_count Receives the number of lines of the expanded document.
+ * @return Returns true if the lines were mapped, otherwise false.
+ */
+static bool map_expanded_lines(lsp_document *document, long **line_map, long *map_count) {
+    long *body_lengths;         /* Number of lines of the body of the macro defined by each line, -1 on other lines */
+    long *grown_map;
+    long line;
+    long end;
+    long macro;
+    long copy;
+    document_line *current;
+
+    body_lengths = (long *)malloc((document->line_count + 1) * sizeof(long));
+    *line_map = (long *)malloc((document->line_count + 1) * sizeof(long));
+    if (body_lengths == NULL || *line_map == NULL) {
+        printf("Memory allocation failed");
+        free(body_lengths);
+        free(*line_map);
+        *line_map = NULL;
+        return FALSE;
+    }
+
+    /* The body of a macro ends at the first line with endmcr */
+    for (line = 0; line < document->line_count; line++) {
+        body_lengths[line] = -1;
+        if (document->lines[line].kind == MACRO_START_LINE) {
+            for (end = line + 1; end < document->line_count && strstr(document->lines[end].text, "endmcr") == NULL; end++);
+            body_lengths[line] = end - line - 1;
+        }
+    }
+
+    *map_count = 0;
+    for (line = 0; line < document->line_count; line++) {
+        current = &document->lines[line];
+        if (current->kind == MACRO_START_LINE) {
+            line += body_lengths[line] + 1;
+            continue;
+        }
+
+        /* An invocation writes the body of the macro, the macros may be defined after it */
+        for (macro = 0; current->command_start >= 0 && macro < document->line_count; macro++) {
+            if (body_lengths[macro] >= 0 && document->lines[macro].occurrence_count > 0 &&
+                (int)strlen(document->lines[macro].occurrences[0].name) == current->command_length &&
+                strncmp(document->lines[macro].occurrences[0].name, current->text + current->command_start, current->command_length) == 0) {
+                break;
+            }
+        }
+        if (current->command_start < 0 || macro == document->line_count) {
+            (*line_map)[(*map_count)++] = line;
+            continue;
+        }
+        copy = body_lengths[macro];
+        if (copy > 1) {
+            grown_map = (long *)realloc(*line_map, (*map_count + copy + document->line_count - line) * sizeof(long));
+            if (grown_map == NULL) {
+                printf("Memory allocation failed");
+                free(body_lengths);
+                free(*line_map);
+                *line_map = NULL;
+                return FALSE;
+            }
+            *line_map = grown_map;
+        }
+        while (copy-- > 0) {
+            (*line_map)[(*map_count)++] = -(line + 1);
+        }
+    }
+    free(body_lengths);
+    return TRUE;
+}
+
+/* Runs the macro processing and both passes over a document and collects its errors */
+void check_document(lsp_document *document, diagnostic_sink *diagnostics) {
+    assembly_context context;           /* The counters and symbols of the document */
+    char *source = NULL;                /* The lines of the document */
+    size_t source_length = 0;
+    char *expanded = NULL;              /* The document after the macro processing, if it has macros */
+    size_t expanded_length = 0;
+    long macro_errors;                  /* Errors of the macro processing, they are on the lines of the document */
+    long *line_map = NULL;
+    long map_count = 0;
+    long line;
+    long index;
+    FILE *source_file_ptr;
+    FILE *expanded_file_ptr;
+    FILE *am_file_ptr;
+
+    open_diagnostic_sink(diagnostics, 0);
+    init_assembly_context(&context, document->path, diagnostics);
+    context.check_only = TRUE;
+    context.keep_going = TRUE;
+
+    source_file_ptr = open_memstream(&source, &source_length);
+    for (line = 0; source_file_ptr != NULL && line < document->line_count; line++) {
+        fprintf(source_file_ptr, "%s\n", document->lines[line].text);
+    }
+    if (source_file_ptr == NULL || fclose(source_file_ptr) != 0 || (source_file_ptr = fmemopen(source, source_length, "r")) == NULL) {
+        printf("Memory allocation failed");
+        free(source);
+        free_assembly_context(&context);
+        close_diagnostic_sink(diagnostics);
+        return;
+    }
+
+    expanded_file_ptr = open_memstream(&expanded, &expanded_length);
+    if (expanded_file_ptr != NULL && process_macros_stream(&context, source_file_ptr, document->path, expanded_file_ptr)) {
+        fclose(expanded_file_ptr);
+        expanded_file_ptr = NULL;
+        macro_errors = diagnostics->count;
+        if (!context.has_macros) {
+            rewind(source_file_ptr);
+            assemble_source(&context, source_file_ptr, FALSE, NULL);
+        }
+        else if ((am_file_ptr = fmemopen(expanded, expanded_length, "r")) != NULL && map_expanded_lines(document, &line_map, &map_count)) {
+            assemble_source(&context, am_file_ptr, FALSE, NULL);
+
+            /* The passes read the expanded document, their errors go to the lines they come from */
+            for (index = macro_errors; index < diagnostics->count; index++) {
+                line = diagnostics->records[index].line_number - 1;
+                if (strcmp(diagnostics->records[index].file_name, document->path) == 0 && line >= 0 && line < map_count) {
+                    /* The columns of a line of a macro body aren't columns of the invocation */
+                    if (line_map[line] < 0) {
+                        diagnostics->records[index].column = 0;
+                    }
+                    diagnostics->records[index].line_number = (line_map[line] < 0 ? -line_map[line] - 1 : line_map[line]) + 1;
+                }
+            }
+            fclose(am_file_ptr);
+        }
+        else if (am_file_ptr != NULL) {
+            fclose(am_file_ptr);
+        }
+    }
+    if (expanded_file_ptr != NULL) {
+        fclose(expanded_file_ptr);
+    }
+    fclose(source_file_ptr);
+    free(source);
+    free(expanded);
+    free(line_map);
+    free_assembly_context(&context);
+    close_diagnostic_sink(diagnostics);
+}
+
+/* Frees a document */
+void close_document(lsp_document *document) {
+    long line;
+
+    for (line = 0; line < document->line_count; line++) {
+        free_document_line(&document->lines[line]);
+    }
+    free(document->lines);
+    free(document->index);
+    free(document->uri);
+    free(document->path);
+    free(document);
+}
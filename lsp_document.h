@@ -0,0 +1,144 @@
+#ifndef _LSP_DOCUMENT_H
+#define _LSP_DOCUMENT_H
+#include "global_variables.h"
+#include "utility_functions.h"
+
+/* Kinds of the lines of a document, as the macro processing sees them */
+typedef enum document_line_kind {
+    PLAIN_LINE,         /* A statement, a comment or an empty line */
+    MACRO_START_LINE,   /* An mcr line, the macro body follows */
+    MACRO_END_LINE      /* An endmcr line */
+} document_line_kind;
+
+/* A symbol named by a line: a label, a constant, an external symbol or a macro */
+typedef struct symbol_occurrence {
+    char *name;             /* Name of the symbol */
+    int column;             /* Column of its first character, from 0 */
+    int length;             /* Length of the name */
+    bool is_definition;     /* Whether the line defines the symbol rather than uses it */
+} symbol_occurrence;
+
+/* A line of a document and what its last analysis found */
+typedef struct document_line {
+    char *text;                         /* The line, without its new line */
+    document_line_kind kind;            /* What the line is to the macro processing */
+    int command_start;                  /* Column of the first word, where a macro is invoked, -1 on an empty line */
+    int command_length;                 /* Length of the first word */
+    symbol_occurrence *occurrences;     /* The symbols of the line, in the order of their columns */
+    int occurrence_count;               /* Number of symbols */
+} document_line;
+
+/* A symbol of the index of a document */
+typedef struct indexed_symbol {
+    symbol_occurrence *occurrence;      /* The symbol within its line */
+    long line;                          /* The line, from 0 */
+} indexed_symbol;
+
+/* A document open in the editor */
+typedef struct lsp_document {
+    char *uri;                          /* The URI the editor knows the document by */
+    char *path;                         /* The file of the document, its included files are relative to it */
+    document_line *lines;               /* The lines */
+    long line_count;                    /* Number of lines */
+    long line_capacity;                 /* Allocated length of lines */
+    indexed_symbol *index;              /* The symbols of all the lines, sorted by name, then line and column */
+    long index_count;                   /* Number of indexed symbols */
+    long analyzed_lines;                /* Lines analyzed by the last change */
+    struct lsp_document *next;          /* Next open document */
+} lsp_document;
+
+/**
+ * @brief Opens a document and analyzes all its lines.
+ *
+ * @param uri The URI of the document.
+ * @param path The file of the document.
+ * @param text The text of the document.
+ * @return Returns the document, or NULL if memory allocation failed.
+ */
+lsp_document *open_document(char *uri, char *path, char *text);
+
+/**
+ * @brief Replaces a range of a document with a text, analyzing again only the lines the range touched.
+ *
+ * @param document The document.
+ * @param start_line The line of the start of the range, from 0.
+ * @param start_column The column of the start of the range, from 0.
+ * @param end_line The line of the end of the range, from 0.
+ * @param end_column The column of the end of the range, from 0.
+ * @param text The text that replaces the range.
+ * @return Returns true if the document was changed, otherwise false.
+ */
+bool edit_document(lsp_document *document, long start_line, int start_column, long end_line, int end_column, char *text);
+
+/**
+ * @brief Replaces the whole text of a document, analyzing again only the lines that differ.
+ *
+ * The lines that are the same at the start and at the end of the document keep their analysis.
+ *
+ * @param document The document.
+ * @param text The new text.
+ * @return Returns true if the document was changed, otherwise false.
+ */
+bool replace_document(lsp_document *document, char *text);
+
+/**
+ * @brief Converts a position of the editor in a line, counted in UTF-16 code units, to a column of the line.
+ *
+ * @param document The document.
+ * @param line The line, from 0.
+ * @param character The position, in UTF-16 code units from 0.
+ * @return The column in bytes, from 0. A position past the end of the line stays as far past it.
+ */
+int document_column(lsp_document *document, long line, long character);
+
+/**
+ * @brief Converts a column of a line to a position of the editor, counted in UTF-16 code units.
+ *
+ * @param document The document.
+ * @param line The line, from 0.
+ * @param column The column in bytes, from 0, at most the length of the line.
+ * @return The position, in UTF-16 code units from 0.
+ */
+long document_character(lsp_document *document, long line, int column);
+
+/**
+ * @brief Finds the symbol at a position of a document.
+ *
+ * @param document The document.
+ * @param line The line, from 0.
+ * @param column The column, from 0.
+ * @return Returns the symbol, or NULL if there is none at the position.
+ */
+symbol_occurrence *find_occurrence(lsp_document *document, long line, int column);
+
+/**
+ * @brief Finds the symbols of a name in the index of a document.
+ *
+ * @param document The document.
+ * @param name The name.
+ * @param count Receives the number of symbols with the name.
+ * @return Returns the first symbol with the name in the index, or NULL if there is none.
+ */
+indexed_symbol *find_indexed_symbols(lsp_document *document, char *name, long *count);
+
+/**
+ * @brief Runs the macro processing and both passes over a document and collects its errors.
+ *
+ * The lines of the errors of the document are its lines, an error in a line written by a
+ * macro invocation is on the invocation. The errors of the included files keep their lines.
+ *
+ * The passes only check the source, like --check, and keep going after errors of the first pass.
+ *
+ * @param document The document.
+ * @param diagnostics Receives the errors, freed with free_diagnostic_sink.
+ */
+void check_document(lsp_document *document, diagnostic_sink *diagnostics);
+
+/**
+ * @brief Frees a document.
+ *
+ * @param document The document.
+ */
+void close_document(lsp_document *document);
+
+#endif
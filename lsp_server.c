@@ -0,0 +1,920 @@
+#define _POSIX_C_SOURCE 200809L /* open_memstream */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include "lsp_document.h"
+#include "preprocessor.h"
+
+/* Prefix of the URIs of local files */
+#define FILE_URI_PREFIX "file://"
+
+/* JSON-RPC error of a request whose method the server doesn't handle */
+#define METHOD_NOT_FOUND -32601
+
+/* JSON-RPC error of a message that isn't valid JSON */
+#define PARSE_ERROR -32700
+
+/* Kinds of JSON values */
+typedef enum json_type {
+    JSON_NULL,      /* null */
+    JSON_FALSE,     /* false */
+    JSON_TRUE,      /* true */
+    JSON_NUMBER,    /* A number, kept as its text */
+    JSON_STRING,    /* A string */
+    JSON_ARRAY,     /* An array, its elements are the children */
+    JSON_OBJECT     /* An object, its members are the children */
+} json_type;
+
+/* A JSON value of a message */
+typedef struct json_value {
+    json_type type;                 /* Kind of the value */
+    char *key;                      /* Name of the member, for the members of an object */
+    char *text;                     /* Contents of a string, or text of a number */
+    struct json_value *children;    /* First element of an array or member of an object */
+    struct json_value *next;        /* Next element or member */
+} json_value;
+
+static lsp_document *open_documents = NULL;    /* The documents open in the editor */
+static bool shutdown_requested = FALSE;         /* Whether the shutdown request came, the exit notification ends the server then */
+
+/**
+ * @brief Frees a JSON value and its children.
+ *
+ * @param value The value, or NULL.
+ */
+static void free_json(json_value *value) {
+    json_value *next;
+
+    while (value != NULL) {
+        next = value->next;
+        free_json(value->children);
+        free(value->key);
+        free(value->text);
+        free(value);
+        value = next;
+    }
+}
+
+/**
+ * @brief Writes a Unicode code point to a string in UTF-8.
+ *
+ * @param output Where the bytes are written.
+ * @param code_point The code point.
+ * @return Returns the number of bytes written.
+ */
+static int encode_utf8(char *output, unsigned long code_point) {
+    if (code_point < 0x80) {
+        output[0] = (char)code_point;
+        return 1;
+    }
+    if (code_point < 0x800) {
+        output[0] = (char)(0xC0 | (code_point >> 6));
+        output[1] = (char)(0x80 | (code_point & 0x3F));
+        return 2;
+    }
+    if (code_point < 0x10000) {
+        output[0] = (char)(0xE0 | (code_point >> 12));
+        output[1] = (char)(0x80 | ((code_point >> 6) & 0x3F));
+        output[2] = (char)(0x80 | (code_point & 0x3F));
+        return 3;
+    }
+    output[0] = (char)(0xF0 | (code_point >> 18));
+    output[1] = (char)(0x80 | ((code_point >> 12) & 0x3F));
+    output[2] = (char)(0x80 | ((code_point >> 6) & 0x3F));
+    output[3] = (char)(0x80 | (code_point & 0x3F));
+    return 4;
+}
+
+/**
+ * @brief Reads the four hex digits of a \u escape.
+ *
+ * @param cursor The digits, moved past them.
+ * @param code_unit Receives their value.
+ * @return Returns true if there were four hex digits, otherwise false.
+ */
+static bool parse_code_unit(char **cursor, unsigned long *code_unit) {
+    int index;
+
+    *code_unit = 0;
+    for (index = 0; index < 4; index++) {
+        if (!isxdigit((unsigned char)(*cursor)[index])) {
+            return FALSE;
+        }
+        *code_unit = *code_unit * 16 + (isdigit((unsigned char)(*cursor)[index]) ? (*cursor)[index] - '0' : tolower((unsigned char)(*cursor)[index]) - 'a' + 10);
+    }
+    *cursor += 4;
+    return TRUE;
+}
+
+/**
+ * @brief Reads a JSON string.
+ *
+ * @param cursor The opening quote, moved past the closing quote.
+ * @return Returns the contents of the string, allocated, or NULL if it isn't a valid string.
+ */
+static char *parse_json_string(char **cursor) {
+    char *start = ++(*cursor);
+    char *contents;
+    size_t length = 0;
+    unsigned long code_point;
+    unsigned long low_surrogate;
+
+    /* The contents are never longer than the string with its escapes */
+    while (**cursor && **cursor != '"') {
+        *cursor += **cursor == '\\' && (*cursor)[1] ? 2 : 1;
+    }
+    if (**cursor != '"' || (contents = (char *)malloc(*cursor - start + 1)) == NULL) {
+        return NULL;
+    }
+    for (*cursor = start; **cursor != '"'; ) {
+        if (**cursor != '\\') {
+            contents[length++] = *(*cursor)++;
+            continue;
+        }
+        (*cursor)++;
+        switch (*(*cursor)++) {
+            case 'b': contents[length++] = '\b'; break;
+            case 'f': contents[length++] = '\f'; break;
+            case 'n': contents[length++] = '\n'; break;
+            case 'r': contents[length++] = '\r'; break;
+            case 't': contents[length++] = '\t'; break;
+            case 'u':
+                if (!parse_code_unit(cursor, &code_point)) {
+                    free(contents);
+                    return NULL;
+                }
+                /* A character outside the basic plane is a pair of surrogates */
+                if (code_point >= 0xD800 && code_point < 0xDC00 && (*cursor)[0] == '\\' && (*cursor)[1] == 'u') {
+                    *cursor += 2;
+                    if (!parse_code_unit(cursor, &low_surrogate)) {
+                        free(contents);
+                        return NULL;
+                    }
+                    code_point = 0x10000 + ((code_point - 0xD800) << 10) + (low_surrogate - 0xDC00);
+                }
+                length += encode_utf8(contents + length, code_point);
+                break;
+            default:
+                contents[length++] = (*cursor)[-1];
+        }
+    }
+    (*cursor)++;
+    contents[length] = '\0';
+    return contents;
+}
+
+/**
+ * @brief Reads a JSON value.
+ *
+ * @param cursor The value, possibly after spaces, moved past it.
+ * @return Returns the value, or NULL if it isn't valid JSON.
+ */
+static json_value *parse_json(char **cursor) {
+    json_value *value;
+    json_value **last_child;
+    char closing;
+
+    while (isspace((unsigned char)**cursor)) {
+        (*cursor)++;
+    }
+    if ((value = (json_value *)calloc(1, sizeof(json_value))) == NULL) {
+        return NULL;
+    }
+
+    switch (**cursor) {
+        case '"':
+            value->type = JSON_STRING;
+            if ((value->text = parse_json_string(cursor)) == NULL) {
+                free_json(value);
+                return NULL;
+            }
+            return value;
+        case '[':
+        case '{':
+            value->type = **cursor == '[' ? JSON_ARRAY : JSON_OBJECT;
+            closing = **cursor == '[' ? ']' : '}';
+            last_child = &value->children;
+            (*cursor)++;
+            while (isspace((unsigned char)**cursor)) {
+                (*cursor)++;
+            }
+            while (**cursor != closing) {
+                char *key = NULL;
+
+                /* A member starts with its name */
+                if (value->type == JSON_OBJECT) {
+                    while (isspace((unsigned char)**cursor)) {
+                        (*cursor)++;
+                    }
+                    if (**cursor != '"' || (key = parse_json_string(cursor)) == NULL) {
+                        free_json(value);
+                        return NULL;
+                    }
+                    while (isspace((unsigned char)**cursor)) {
+                        (*cursor)++;
+                    }
+                    if (*(*cursor)++ != ':') {
+                        free(key);
+                        free_json(value);
+                        return NULL;
+                    }
+                }
+                if ((*last_child = parse_json(cursor)) == NULL) {
+                    free(key);
+                    free_json(value);
+                    return NULL;
+                }
+                (*last_child)->key = key;
+                last_child = &(*last_child)->next;
+                while (isspace((unsigned char)**cursor)) {
+                    (*cursor)++;
+                }
+                if (**cursor == ',') {
+                    (*cursor)++;
+                }
+                else if (**cursor != closing) {
+                    free_json(value);
+                    return NULL;
+                }
+            }
+            (*cursor)++;
+            return value;
+        default:
+            break;
+    }
+
+    if (strncmp(*cursor, "null", 4) == 0 || strncmp(*cursor, "true", 4) == 0) {
+        value->type = **cursor == 'n' ? JSON_NULL : JSON_TRUE;
+        *cursor += 4;
+    }
+    else if (strncmp(*cursor, "false", 5) == 0) {
+        value->type = JSON_FALSE;
+        *cursor += 5;
+    }
+    else if (**cursor == '-' || isdigit((unsigned char)**cursor)) {
+        char *start = *cursor;
+
+        value->type = JSON_NUMBER;
+        while (**cursor && strchr("+-.eE0123456789", **cursor) != NULL) {
+            (*cursor)++;
+        }
+        if ((value->text = (char *)malloc(*cursor - start + 1)) == NULL) {
+            free_json(value);
+            return NULL;
+        }
+        memcpy(value->text, start, *cursor - start);
+        value->text[*cursor - start] = '\0';
+    }
+    else {
+        free_json(value);
+        return NULL;
+    }
+    return value;
+}
+
+/**
+ * @brief Finds a value by the path of member names that leads to it.
+ *
+ * @param value The object the path starts at, or NULL.
+ * @param path The member names, separated by dots.
+ * @return Returns the value, or NULL if there is no such member.
+ */
+static json_value *json_member(json_value *value, char *path) {
+    json_value *member;
+    size_t length;
+
+    while (value != NULL && *path) {
+        length = strcspn(path, ".");
+        if (value->type != JSON_OBJECT) {
+            return NULL;
+        }
+        for (member = value->children; member != NULL && (strlen(member->key) != length || strncmp(member->key, path, length) != 0); member = member->next);
+        value = member;
+        path += path[length] == '.' ? length + 1 : length;
+    }
+    return value;
+}
+
+/**
+ * @brief Reads a member of a value as a number.
+ *
+ * @param value The object the path starts at.
+ * @param path The member names, separated by dots.
+ * @return Returns the number, or 0 if there is no such number.
+ */
+static long json_number(json_value *value, char *path) {
+    value = json_member(value, path);
+    return value != NULL && value->type == JSON_NUMBER ? atol(value->text) : 0;
+}
+
+/**
+ * @brief Reads a member of a value as a string.
+ *
+ * @param value The object the path starts at.
+ * @param path The member names, separated by dots.
+ * @return Returns the string, or NULL if there is no such string.
+ */
+static char *json_string(json_value *value, char *path) {
+    value = json_member(value, path);
+    return value != NULL && value->type == JSON_STRING ? value->text : NULL;
+}
+
+/**
+ * @brief Measures the UTF-8 character at the start of a string.
+ *
+ * @param string The string, its first byte is above 0x7F.
+ * @param length The length of the string.
+ * @return The length of the character, or 0 if the bytes aren't a whole character.
+ */
+static size_t utf8_length(char *string, size_t length) {
+    unsigned char lead = (unsigned char)string[0];
+    size_t character_length = lead >= 0xC2 && lead <= 0xDF ? 2 : lead >= 0xE0 && lead <= 0xEF ? 3 : lead >= 0xF0 && lead <= 0xF4 ? 4 : 0;
+    size_t index;
+
+    if (character_length > length) {
+        return 0;
+    }
+    for (index = 1; index < character_length; index++) {
+        if (((unsigned char)string[index] & 0xC0) != 0x80) {
+            return 0;
+        }
+    }
+    return character_length;
+}
+
+/**
+ * @brief Writes a string as a JSON string, without its trailing new lines.
+ *
+ * A byte that isn't part of a whole UTF-8 character, like the end of a word an error message
+ * cut in the middle of a character, is written as the replacement character.
+ *
+ * @param output The stream.
+ * @param string The string.
+ */
+static void print_json_string(FILE *output, char *string) {
+    size_t length = strlen(string);
+    size_t character_length;
+
+    while (length > 0 && string[length - 1] == '\n') {
+        length--;
+    }
+    fputc('"', output);
+    for (; length > 0; string++, length--) {
+        if (*string == '"' || *string == '\\') {
+            fprintf(output, "\\%c", *string);
+        }
+        else if ((unsigned char)*string < 0x20) {
+            fprintf(output, "\\u%04x", (unsigned char)*string);
+        }
+        else if ((unsigned char)*string < 0x80) {
+            fputc(*string, output);
+        }
+        else if ((character_length = utf8_length(string, length)) == 0) {
+            fputs("\\ufffd", output);
+        }
+        else {
+            fwrite(string, 1, character_length, output);
+            string += character_length - 1;
+            length -= character_length - 1;
+        }
+    }
+    fputc('"', output);
+}
+
+/**
+ * @brief Writes a JSON value as it was read.
+ *
+ * @param output The stream.
+ * @param value The value.
+ */
+static void print_json(FILE *output, json_value *value) {
+    json_value *child;
+
+    switch (value->type) {
+        case JSON_NULL: fputs("null", output); break;
+        case JSON_FALSE: fputs("false", output); break;
+        case JSON_TRUE: fputs("true", output); break;
+        case JSON_NUMBER: fputs(value->text, output); break;
+        case JSON_STRING: print_json_string(output, value->text); break;
+        case JSON_ARRAY:
+        case JSON_OBJECT:
+            fputc(value->type == JSON_ARRAY ? '[' : '{', output);
+            for (child = value->children; child != NULL; child = child->next) {
+                if (value->type == JSON_OBJECT) {
+                    print_json_string(output, child->key);
+                    fputc(':', output);
+                }
+                print_json(output, child);
+                if (child->next != NULL) {
+                    fputc(',', output);
+                }
+            }
+            fputc(value->type == JSON_ARRAY ? ']' : '}', output);
+            break;
+    }
+}
+
+/**
+ * @brief Writes a range of a line of a document as a JSON object, in the UTF-16 code units of the editor.
+ *
+ * @param output The stream.
+ * @param document The document.
+ * @param line The line of the range, from 0.
+ * @param start_column The start of the range, in bytes from 0.
+ * @param end_column The end of the range, in bytes from 0.
+ */
+static void print_range(FILE *output, lsp_document *document, long line, int start_column, int end_column) {
+    fprintf(output, "{\"start\":{\"line\":%ld,\"character\":%ld},\"end\":{\"line\":%ld,\"character\":%ld}}", line,
+            document_character(document, line, start_column), line, document_character(document, line, end_column));
+}
+
+/**
+ * @brief Writes the location of a symbol as a JSON object.
+ *
+ * @param output The stream.
+ * @param document The document of the symbol.
+ * @param symbol The symbol.
+ */
+static void print_location(FILE *output, lsp_document *document, indexed_symbol *symbol) {
+    fputs("{\"uri\":", output);
+    print_json_string(output, document->uri);
+    fputs(",\"range\":", output);
+    print_range(output, document, symbol->line, symbol->occurrence->column, symbol->occurrence->column + symbol->occurrence->length);
+    fputc('}', output);
+}
+
+/**
+ * @brief Sends a message with its Content-Length header to the editor.
+ *
+ * @param body The JSON of the message.
+ * @param length The length of the JSON.
+ */
+static void send_message(char *body, size_t length) {
+    printf("Content-Length: %lu\r\n\r\n", (unsigned long)length);
+    fwrite(body, 1, length, stdout);
+    fflush(stdout);
+}
+
+/**
+ * @brief Starts a message, in memory until it is sent.
+ *
+ * @param body Receives the memory of the message.
+ * @param length Receives the length of the message.
+ * @return Returns the stream of the message, or NULL if memory allocation failed.
+ */
+static FILE *begin_message(char **body, size_t *length) {
+    FILE *output = open_memstream(body, length);
+
+    if (output == NULL) {
+        printf("Memory allocation failed");
+    }
+    return output;
+}
+
+/**
+ * @brief Sends a message started by begin_message, and frees it.
+ *
+ * @param output The stream of the message.
+ * @param body The memory of the message.
+ * @param length The length of the message.
+ */
+static void end_message(FILE *output, char **body, size_t *length) {
+    fclose(output);
+    send_message(*body, *length);
+    free(*body);
+}
+
+/**
+ * @brief Starts the response to a request, up to its result.
+ *
+ * @param output The stream of the message.
+ * @param id The id of the request.
+ */
+static void begin_response(FILE *output, json_value *id) {
+    fputs("{\"jsonrpc\":\"2.0\",\"id\":", output);
+    print_json(output, id);
+    fputs(",\"result\":", output);
+}
+
+/**
+ * @brief Converts the URI of a document to its file, decoding the escaped characters.
+ *
+ * @param uri The URI.
+ * @return Returns the file, allocated, or NULL if memory allocation failed.
+ */
+static char *uri_to_path(char *uri) {
+    char *path = (char *)malloc(strlen(uri) + 1);
+    size_t length = 0;
+    unsigned int character;
+
+    if (path == NULL) {
+        printf("Memory allocation failed");
+        return NULL;
+    }
+    if (strncmp(uri, FILE_URI_PREFIX, strlen(FILE_URI_PREFIX)) == 0) {
+        uri += strlen(FILE_URI_PREFIX);
+    }
+    for (; *uri; uri++) {
+        if (*uri == '%' && isxdigit((unsigned char)uri[1]) && isxdigit((unsigned char)uri[2]) && sscanf(uri + 1, "%2x", &character) == 1) {
+            path[length++] = (char)character;
+            uri += 2;
+        }
+        else {
+            path[length++] = *uri;
+        }
+    }
+    path[length] = '\0';
+    return path;
+}
+
+/**
+ * @brief Finds an open document.
+ *
+ * @param uri The URI of the document.
+ * @return Returns the link that points to the document, or the link at the end of the documents if it isn't open.
+ */
+static lsp_document **find_document(char *uri) {
+    lsp_document **link;
+
+    for (link = &open_documents; *link != NULL && strcmp((*link)->uri, uri) != 0; link = &(*link)->next);
+    return link;
+}
+
+/**
+ * @brief Sends the errors of a document to the editor, or no errors for a closed document.
+ *
+ * @param uri The URI of the document.
+ * @param document The document, or NULL if it was closed.
+ */
+static void publish_diagnostics(char *uri, lsp_document *document) {
+    diagnostic_sink diagnostics = {FALSE, NULL, 0, 0, 0};
+    diagnostic *error;
+    char *located;          /* The message of an error of an included file, with its location */
+    FILE *output;
+    char *body = NULL;
+    size_t length = 0;
+    long line;
+    long column;
+    long index;
+
+    if (document != NULL) {
+        check_document(document, &diagnostics);
+    }
+    if ((output = begin_message(&body, &length)) == NULL) {
+        free_diagnostic_sink(&diagnostics);
+        return;
+    }
+    fputs("{\"jsonrpc\":\"2.0\",\"method\":\"textDocument/publishDiagnostics\",\"params\":{\"uri\":", output);
+    print_json_string(output, uri);
+    fputs(",\"diagnostics\":[", output);
+    for (index = 0; index < diagnostics.count; index++) {
+        error = &diagnostics.records[index];
+
+        /* The errors of the included files are on the first line, with their own location */
+        line = 0;
+        if (strcmp(error->file_name, document->path) == 0 && error->line_number >= 1 && error->line_number <= document->line_count) {
+            line = error->line_number - 1;
+        }
+        column = line == error->line_number - 1 && error->column > 0 ? error->column - 1 : 0;
+        if (index > 0) {
+            fputc(',', output);
+        }
+        fputs("{\"range\":", output);
+        print_range(output, document, line, (int)column, (int)strlen(document->lines[line].text));
+        fprintf(output, ",\"severity\":1,\"source\":\"assembler\",\"code\":\"E%05lX\",\"message\":", error->code);
+        if (line == error->line_number - 1 || (located = (char *)malloc(strlen(error->file_name) + strlen(error->message) + 32)) == NULL) {
+            print_json_string(output, error->message);
+        }
+        else {
+            sprintf(located, "%s:%ld: %s", error->file_name, error->line_number, error->message);
+            print_json_string(output, located);
+            free(located);
+        }
+        fputc('}', output);
+    }
+    fputs("]}}", output);
+    end_message(output, &body, &length);
+    free_diagnostic_sink(&diagnostics);
+}
+
+/**
+ * @brief Answers the initialize request with the capabilities of the server.
+ *
+ * @param id The id of the request.
+ */
+static void handle_initialize(json_value *id) {
+    char *body = NULL;
+    size_t length = 0;
+    FILE *output = begin_message(&body, &length);
+
+    if (output == NULL) {
+        return;
+    }
+    begin_response(output, id);
+    fputs("{\"capabilities\":{\"textDocumentSync\":{\"openClose\":true,\"change\":2},"
+          "\"definitionProvider\":true,\"referencesProvider\":true},"
+          "\"serverInfo\":{\"name\":\"assembler_lsp\"}}}", output);
+    end_message(output, &body, &length);
+}
+
+/**
+ * @brief Opens a document, or replaces the text of a document already open, and publishes its errors.
+ *
+ * @param params The parameters of the didOpen notification.
+ */
+static void handle_did_open(json_value *params) {
+    char *uri = json_string(params, "textDocument.uri");
+    char *text = json_string(params, "textDocument.text");
+    char *path;
+    lsp_document **link;
+    lsp_document *document;
+
+    if (uri == NULL || text == NULL) {
+        return;
+    }
+    link = find_document(uri);
+    if (*link != NULL) {
+        replace_document(*link, text);
+    }
+    else if ((path = uri_to_path(uri)) != NULL) {
+        document = open_document(uri, path, text);
+        free(path);
+        if (document == NULL) {
+            return;
+        }
+        *link = document;
+    }
+    publish_diagnostics(uri, *link);
+}
+
+/**
+ * @brief Applies the changes of a document, analyzing again only the lines they touch, and publishes its errors.
+ *
+ * @param params The parameters of the didChange notification.
+ */
+static void handle_did_change(json_value *params) {
+    char *uri = json_string(params, "textDocument.uri");
+    json_value *changes = json_member(params, "contentChanges");
+    json_value *change;
+    lsp_document *document;
+    char *text;
+    long start_line;
+    long end_line;
+
+    if (uri == NULL || (document = *find_document(uri)) == NULL || changes == NULL || changes->type != JSON_ARRAY) {
+        return;
+    }
+    for (change = changes->children; change != NULL; change = change->next) {
+        if ((text = json_string(change, "text")) == NULL) {
+            continue;
+        }
+        if (json_member(change, "range") != NULL) {
+            /* The range is in the document before the change */
+            start_line = json_number(change, "range.start.line");
+            end_line = json_number(change, "range.end.line");
+            edit_document(document, start_line, document_column(document, start_line, json_number(change, "range.start.character")),
+                          end_line, document_column(document, end_line, json_number(change, "range.end.character")), text);
+        }
+        else {
+            replace_document(document, text);
+        }
+    }
+    publish_diagnostics(uri, document);
+}
+
+/**
+ * @brief Closes a document and clears its errors.
+ *
+ * @param params The parameters of the didClose notification.
+ */
+static void handle_did_close(json_value *params) {
+    char *uri = json_string(params, "textDocument.uri");
+    lsp_document **link;
+    lsp_document *document;
+
+    if (uri == NULL || *(link = find_document(uri)) == NULL) {
+        return;
+    }
+    document = *link;
+    *link = document->next;
+    publish_diagnostics(uri, NULL);
+    close_document(document);
+}
+
+/**
+ * @brief Answers a definition or references request from the symbol index of the document.
+ *
+ * @param id The id of the request.
+ * @param params The parameters of the request.
+ * @param references Whether every symbol of the name is asked for, rather than its definition.
+ */
+static void handle_symbol_request(json_value *id, json_value *params, bool references) {
+    char *uri = json_string(params, "textDocument.uri");
+    json_value *include_declaration = json_member(params, "context.includeDeclaration");
+    lsp_document *document = uri != NULL ? *find_document(uri) : NULL;
+    symbol_occurrence *occurrence = NULL;
+    indexed_symbol *symbols = NULL;
+    long count = 0;
+    long index;
+    bool first = TRUE;
+    char *body = NULL;
+    size_t length = 0;
+    FILE *output = begin_message(&body, &length);
+
+    if (output == NULL) {
+        return;
+    }
+    if (document != NULL) {
+        occurrence = find_occurrence(document, json_number(params, "position.line"),
+                                     document_column(document, json_number(params, "position.line"), json_number(params, "position.character")));
+    }
+    if (occurrence != NULL) {
+        symbols = find_indexed_symbols(document, occurrence->name, &count);
+    }
+
+    begin_response(output, id);
+    if (references) {
+        fputc('[', output);
+        for (index = 0; index < count; index++) {
+            if (symbols[index].occurrence->is_definition && include_declaration != NULL && include_declaration->type == JSON_FALSE) {
+                continue;
+            }
+            if (!first) {
+                fputc(',', output);
+            }
+            print_location(output, document, &symbols[index]);
+            first = FALSE;
+        }
+        fputc(']', output);
+    }
+    else {
+        /* The first definition, a label defined twice is an error of its second line */
+        for (index = 0; index < count && !symbols[index].occurrence->is_definition; index++);
+        if (index < count) {
+            print_location(output, document, &symbols[index]);
+        }
+        else {
+            fputs("null", output);
+        }
+    }
+    fputc('}', output);
+    end_message(output, &body, &length);
+}
+
+/**
+ * @brief Answers a request with a null result.
+ *
+ * @param id The id of the request.
+ */
+static void send_null_result(json_value *id) {
+    char *body = NULL;
+    size_t length = 0;
+    FILE *output = begin_message(&body, &length);
+
+    if (output == NULL) {
+        return;
+    }
+    begin_response(output, id);
+    fputs("null}", output);
+    end_message(output, &body, &length);
+}
+
+/**
+ * @brief Answers a request with a JSON-RPC error.
+ *
+ * @param id The id of the request, or NULL if it couldn't be read.
+ * @param code The code of the error.
+ * @param message The message of the error.
+ */
+static void send_error(json_value *id, int code, char *message) {
+    char *body = NULL;
+    size_t length = 0;
+    FILE *output = begin_message(&body, &length);
+
+    if (output == NULL) {
+        return;
+    }
+    fputs("{\"jsonrpc\":\"2.0\",\"id\":", output);
+    if (id != NULL) {
+        print_json(output, id);
+    }
+    else {
+        fputs("null", output);
+    }
+    fprintf(output, ",\"error\":{\"code\":%d,\"message\":", code);
+    print_json_string(output, message);
+    fputs("}}", output);
+    end_message(output, &body, &length);
+}
+
+/**
+ * @brief Reads the next message from the editor.
+ *
+ * @return Returns the JSON of the message, allocated, or NULL at the end of the input.
+ */
+static char *read_message(void) {
+    char header[1024];
+    unsigned long content_length = 0;
+    char *body;
+
+    /* The headers end with an empty line */
+    while (fgets(header, sizeof(header), stdin) != NULL) {
+        if (strcmp(header, "\r\n") == 0 || strcmp(header, "\n") == 0) {
+            if (content_length == 0) {
+                continue;
+            }
+            if ((body = (char *)malloc(content_length + 1)) == NULL) {
+                printf("Memory allocation failed");
+                return NULL;
+            }
+            if (fread(body, 1, content_length, stdin) != content_length) {
+                free(body);
+                return NULL;
+            }
+            body[content_length] = '\0';
+            return body;
+        }
+        sscanf(header, "Content-Length: %lu", &content_length);
+    }
+    return NULL;
+}
+
+/**
+ * @brief Handles a message from the editor.
+ *
+ * @param message The JSON of the message.
+ * @return Returns true while the server keeps running, false after the exit notification.
+ */
+static bool handle_message(char *message) {
+    json_value *request = parse_json(&message);
+    json_value *id = json_member(request, "id");
+    json_value *params = json_member(request, "params");
+    char *method = json_string(request, "method");
+
+    if (request == NULL) {
+        send_error(NULL, PARSE_ERROR, "Parse error");
+        return TRUE;
+    }
+    if (method == NULL) {
+        /* A response to the server, it sends no request */
+    }
+    else if (strcmp(method, "initialize") == 0 && id != NULL) {
+        handle_initialize(id);
+    }
+    else if (strcmp(method, "shutdown") == 0 && id != NULL) {
+        shutdown_requested = TRUE;
+        send_null_result(id);
+    }
+    else if (strcmp(method, "exit") == 0) {
+        free_json(request);
+        return FALSE;
+    }
+    else if (strcmp(method, "textDocument/didOpen") == 0) {
+        handle_did_open(params);
+    }
+    else if (strcmp(method, "textDocument/didChange") == 0) {
+        handle_did_change(params);
+    }
+    else if (strcmp(method, "textDocument/didClose") == 0) {
+        handle_did_close(params);
+    }
+    else if (strcmp(method, "textDocument/definition") == 0 && id != NULL) {
+        handle_symbol_request(id, params, FALSE);
+    }
+    else if (strcmp(method, "textDocument/references") == 0 && id != NULL) {
+        handle_symbol_request(id, params, TRUE);
+    }
+    else if (id != NULL) {
+        send_error(id, METHOD_NOT_FOUND, "Method not found");
+    }
+    free_json(request);
+    return TRUE;
+}
+
+/**
+ * @brief A language server for the assembly sources, over the standard input and output.
+ *
+ * It answers the diagnostics, go to definition and find references of the editors that speak
+ * the Language Server Protocol. The open documents keep the analysis of their lines, and an
+ * edit only analyzes the lines it touches again.
+ *
+ * @return 0 if the exit notification came after the shutdown request, otherwise 1.
+ */
+int main(void) {
+    char *message;
+    bool running = TRUE;
+
+    while (running && (message = read_message()) != NULL) {
+        running = handle_message(message);
+        free(message);
+    }
+    while (open_documents != NULL) {
+        lsp_document *document = open_documents;
+
+        open_documents = document->next;
+        close_document(document);
+    }
+    free_include_cache();
+    return shutdown_requested ? 0 : 1;
+}
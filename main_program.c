@@ -1,19 +1,64 @@
+#define _POSIX_C_SOURCE 200809L /* fmemopen and open_memstream */
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
-#include "file_writeing.h"
-#include "parsing_phase.h"
-#include "analysis_phase.h"
+#include "assembler.h"
 #include "global_variables.h"
 #include "utility_functions.h"
 #include "preprocessor.h"
+#include "statistics.h"
+#include "trace.h"
+#include "line_profile.h"
+#include "alloc_tracking.h"
+#include "pipeline.h"
+#include "batch_io.h"
+#include "incremental.h"
+#include "watch.h"
+#include "input_list.h"
 
 /**
  * @brief  Processes a singel assembly input file, and returns the result
  * @param file_name The file name
+ * @param output_name The name of the .am and output files, without extension
+ * @param line_count Receives the source lines read by the first pass
  * @return True or false, if succeeded or not
 */
-bool handle_single_file(char *file_name);
+bool handle_single_file(char *file_name, char *output_name, long *line_count);
+
+/**
+ * @brief  Checks a singel assembly input file for errors, like handle_single_file without writing any file
+ *         or building the machine words. The expanded source is kept in memory.
+ * @param file_name The file name
+ * @param line_count Receives the source lines read by the first pass
+ * @return True or false, if the file has no errors or not
+*/
+bool check_single_file(char *file_name, long *line_count);
+
+/**
+ * @brief  Assembles, or checks with --check, one of the input files, with the measurements of the run
+ * @param file_name The file name
+ * @param output_name The name of the .am and output files, without extension
+ * @param check_mode Whether --check was given
+ * @return True or false, if succeeded or not
+*/
+bool process_input_file(char *file_name, char *output_name, bool check_mode);
+
+/**
+ * @brief  Assembles the input files whose outputs of the previous run can't be reused, as recorded by
+ *         the manifest of --incremental, then the files using entry symbols that changed, until none did.
+ *         The manifest is updated for the next run.
+ * @param inputs The input files
+*/
+void assemble_files_incrementally(input_list *inputs);
+
+/**
+ * @brief  Assembles again, or checks again with --check, the input files whose source or included files
+ *         change, until the program is interrupted or the watch fails. The cache of included files stays
+ *         between the changes, an included file is only parsed again when it changed.
+ * @param inputs The input files
+ * @param check_mode Whether --check was given
+*/
+void watch_input_files(input_list *inputs, bool check_mode);
 
 /**
  * @brief The main function for the assembler program.
@@ -26,66 +71,353 @@ bool handle_single_file(char *file_name);
  * @return An integer indicating the exit status of the program.
  */
 int main(int argc, char *argv[]){
-    int file_index;         /* Index of the input file in the argv array */
+    int arg_index;          /* Index of the command-line argument */
+    int file_index;         /* Index of the input file in the input list */
+    int file_count;         /* Number of input files left to handle */
+    input_list inputs = {NULL, NULL, 0, 0};     /* The input files, without the options, and the names of their output files */
+    double run_start_time = wall_clock_seconds();   /* Wall clock when the run started, for the summary */
     bool succeeded = TRUE;  /* Flag indicating the success of file processing */     
+    bool print_stats = FALSE;   /* Whether --stats was given */
+    long profile_top_count = DEFAULT_PROFILE_LINES;  /* Number of lines reported by --profile-lines */
+    int pipeline_depth = 0; /* Files of each queue of --pipeline, 0 without it */
+    bool check_mode = FALSE;    /* Whether --check was given */
+    int input_count;        /* Number of input files, for --watch */
+
+    /* Handle the options, they may appear anywhere between the file names */
+    for (arg_index = 1; arg_index < argc; ++arg_index) {
+        if (strcmp(argv[arg_index], "--stats") == 0) {
+            stats_enabled = TRUE;
+            print_stats = TRUE;
+        }
+        else if (strcmp(argv[arg_index], "--track-allocs") == 0) {
+            alloc_tracking_enabled = TRUE;
+        }
+        else if (strcmp(argv[arg_index], "--profile-lines") == 0) {
+            /* The line profile reads the symbol table counters of the statistics */
+            stats_enabled = TRUE;
+            profile_lines_enabled = TRUE;
+            if (arg_index + 1 < argc && argv[arg_index + 1][0] != '\0' && strspn(argv[arg_index + 1], "0123456789") == strlen(argv[arg_index + 1])) {
+                profile_top_count = atol(argv[++arg_index]);
+            }
+        }
+        else if (strcmp(argv[arg_index], "--check") == 0) {
+            check_mode = TRUE;
+        }
+        else if (strcmp(argv[arg_index], "--incremental") == 0) {
+            if (arg_index + 1 == argc) {
+                printf("Option --incremental requires a manifest file name\n");
+                free_input_list(&inputs);
+                return 1;
+            }
+            incremental_manifest_name = argv[++arg_index];
+        }
+        else if (strcmp(argv[arg_index], "--manifest") == 0) {
+            /* The files of the manifest come in its place among the file names */
+            summary_enabled = TRUE;
+            if (arg_index + 1 == argc) {
+                printf("Option --manifest requires a manifest file name, or - for the standard input\n");
+                free_input_list(&inputs);
+                return 1;
+            }
+            if (!read_input_manifest(&inputs, argv[++arg_index])) {
+                free_input_list(&inputs);
+                return 1;
+            }
+        }
+        else if (strcmp(argv[arg_index], "--watch") == 0) {
+            watch_enabled = TRUE;
+        }
+        else if (strcmp(argv[arg_index], "--keep-going") == 0) {
+            keep_going_after_errors = TRUE;
+        }
+        else if (strcmp(argv[arg_index], "--jobs") == 0) {
+            if (arg_index + 1 == argc || atoi(argv[arg_index + 1]) < 1) {
+                printf("Option --jobs requires a number of threads\n");
+                free_input_list(&inputs);
+                return 1;
+            }
+            assembly_jobs = atoi(argv[++arg_index]);
+        }
+        else if (strcmp(argv[arg_index], "--pipeline") == 0) {
+            pipeline_depth = DEFAULT_PIPELINE_DEPTH;
+            if (arg_index + 1 < argc && argv[arg_index + 1][0] != '\0' && strspn(argv[arg_index + 1], "0123456789") == strlen(argv[arg_index + 1])) {
+                pipeline_depth = atoi(argv[++arg_index]);
+                if (pipeline_depth < 1) {
+                    printf("Option --pipeline requires a queue depth of at least 1\n");
+                    free_input_list(&inputs);
+                    return 1;
+                }
+            }
+        }
+        else if (strcmp(argv[arg_index], "--io-backend") == 0) {
+            if (arg_index + 1 < argc && strcmp(argv[arg_index + 1], "uring") == 0) {
+                batch_io_backend = URING_IO_BACKEND;
+            }
+            else if (arg_index + 1 < argc && strcmp(argv[arg_index + 1], "threads") == 0) {
+                batch_io_backend = THREADS_IO_BACKEND;
+            }
+            else {
+                printf("Option --io-backend requires uring or threads\n");
+                free_input_list(&inputs);
+                return 1;
+            }
+            arg_index++;
+        }
+        else if (strcmp(argv[arg_index], "--diagnostics-format") == 0) {
+            if (arg_index + 1 < argc && strcmp(argv[arg_index + 1], "text") == 0) {
+                diagnostics_format = TEXT_DIAGNOSTICS;
+            }
+            else if (arg_index + 1 < argc && strcmp(argv[arg_index + 1], "json") == 0) {
+                diagnostics_format = JSON_DIAGNOSTICS;
+            }
+            else {
+                printf("Option --diagnostics-format requires text or json\n");
+                free_input_list(&inputs);
+                return 1;
+            }
+            arg_index++;
+        }
+        else if (strcmp(argv[arg_index], "--max-errors") == 0) {
+            if (arg_index + 1 == argc || atol(argv[arg_index + 1]) < 1) {
+                printf("Option --max-errors requires a number of errors\n");
+                free_input_list(&inputs);
+                return 1;
+            }
+            max_errors_per_file = atol(argv[++arg_index]);
+        }
+        else if (strcmp(argv[arg_index], "--trace") == 0) {
+            if (arg_index + 1 == argc) {
+                printf("Option --trace requires an output file name\n");
+                free_input_list(&inputs);
+                return 1;
+            }
+            if (!trace_open(argv[++arg_index])) {
+                free_input_list(&inputs);
+                return 1;
+            }
+        }
+        else if (strncmp(argv[arg_index], "--", 2) == 0) {
+            printf("Unknown option %s\n", argv[arg_index]);
+            free_input_list(&inputs);
+            return 1;
+        }
+        else if (!add_input_file(&inputs, argv[arg_index], NULL)) {
+            free_input_list(&inputs);
+            return 1;
+        }
+    }
+    file_count = inputs.count;
 
     /* Check if no input files are provided */
-    if (argc == 1){
+    if (file_count == 0){
         printf("You didn't enter any files\n");
     }
+    input_count = file_count;
+    if (watch_enabled && file_count > 0 && !open_watch()) {
+        printf("Option --watch requires inotify\n");
+        free_input_list(&inputs);
+        return 1;
+    }
 
-    /* Iterate over the input files, starting from the second element in the argv array */
-    for (file_index = 1; file_index < argc; ++file_index) {
+    /* Only the files that changed since the previous run are assembled, --check doesn't write outputs to reuse */
+    if (incremental_manifest_name != NULL && file_count > 0 && !check_mode) {
+        assemble_files_incrementally(&inputs);
+        file_count = 0;
+    }
+
+    /* The pipeline handles several files at a time, the measurements follow a single file, they disable it. It writes files, --check doesn't.
+       --watch needs the included files of every file */
+    if (pipeline_depth > 0 && file_count > 0 && !check_mode && !stats_enabled && !alloc_tracking_enabled && !trace_enabled && !watch_enabled &&
+        assemble_files_pipelined(inputs.file_names, inputs.output_names, file_count, pipeline_depth)) {
+        file_count = 0;
+    }
+
+    /* Iterate over the input files */
+    for (file_index = 0; file_index < file_count; ++file_index) {
         /* If a previous file processing failed, print a newline */
 		if (!succeeded) {
             puts("");
         } 
 
         /* Process the current input file and update the success flag */
-		succeeded = handle_single_file(argv[file_index]);
+		succeeded = process_input_file(inputs.file_names[file_index], inputs.output_names[file_index], check_mode);
 	}
+
+    /* Assemble the files again as they change */
+    if (watch_enabled && input_count > 0) {
+        watch_input_files(&inputs, check_mode);
+    }
+    close_watch();
+    free_manifest();
+
+    /* Free the included files shared by all the input files */
+    free_include_cache();
+
+    /* Report the statistics of the run */
+    if (print_stats) {
+        stats_print_report(stdout);
+    }
+    free_stats();
+
+    /* Report the summary of --manifest on stderr, so it doesn't mix with the --stats report */
+    summary_print(stderr, wall_clock_seconds() - run_start_time);
+    free_summary();
+
+    /* Report the hot lines on stderr, so they don't mix with the --stats report */
+    profile_print_report(stderr, profile_top_count);
+    free_line_profile();
+    free_alloc_tracking();
+    trace_write();
+
+    /* The reports above name the files through the input list, it is freed last */
+    free_input_list(&inputs);
     
     /* Return 0 to indicate successful program execution */
 	return 0;
 }
 
 
-bool handle_single_file(char *file_name) {
+bool process_input_file(char *file_name, char *output_name, bool check_mode) {
+    double file_start_time; /* Start time of the trace span of the file */
+    double summary_start_time = summary_enabled ? wall_clock_seconds() : 0;     /* Start time of the file for the summary */
+    long line_count = 0;    /* Source lines read by the first pass */
+    bool succeeded;
+
+    stats_begin_file();
+    alloc_begin_file();
+    file_start_time = trace_now();
+    succeeded = check_mode ? check_single_file(file_name, &line_count) : handle_single_file(file_name, output_name, &line_count);
+    trace_span(file_name, file_name, file_start_time);
+    stats_end_file(file_name, succeeded);
+    alloc_end_file(file_name, stderr);
+    summary_record_file(succeeded, line_count, summary_enabled ? wall_clock_seconds() - summary_start_time : 0);
+    return succeeded;
+}
+
+
+void assemble_files_incrementally(input_list *inputs) {
+    bool *stale;                /* Whether each file must be assembled */
+    bool *assembled;            /* Whether each file was assembled by this run */
+    bool succeeded = TRUE;      /* Whether the last assembled file succeeded */
+    bool found_stale = TRUE;    /* Whether the last round found files to assemble */
+    int file_index;
+
+    stale = (bool *)calloc(inputs->count, sizeof(bool));
+    assembled = (bool *)calloc(inputs->count, sizeof(bool));
+    if (stale == NULL || assembled == NULL) {
+        printf("Memory allocation failed");
+        free(stale);
+        free(assembled);
+        return;
+    }
+
+    load_manifest(incremental_manifest_name);
+    for (file_index = 0; file_index < inputs->count; ++file_index) {
+        stale[file_index] = !file_is_up_to_date(inputs->file_names[file_index], inputs->output_names[file_index]);
+    }
+
+    while (found_stale) {
+        for (file_index = 0; file_index < inputs->count; ++file_index) {
+            if (!stale[file_index] || assembled[file_index]) {
+                continue;
+            }
+            if (!succeeded) {
+                puts("");
+            }
+            succeeded = process_input_file(inputs->file_names[file_index], inputs->output_names[file_index], FALSE);
+            assembled[file_index] = TRUE;
+            if (!succeeded) {
+                forget_file_dependencies(inputs->file_names[file_index]);
+            }
+        }
+
+        /* A file reused so far is assembled again if an entry symbol it uses changed */
+        found_stale = FALSE;
+        for (file_index = 0; file_index < inputs->count; ++file_index) {
+            if (!stale[file_index] && imports_changed(inputs->file_names[file_index])) {
+                stale[file_index] = TRUE;
+                found_stale = TRUE;
+            }
+        }
+    }
+
+    write_manifest();
+    free(stale);
+    free(assembled);
+}
+
+
+void watch_input_files(input_list *inputs, bool check_mode) {
+    bool *changed;              /* Whether each file must be assembled again */
+    bool succeeded = TRUE;      /* Whether the last assembled file succeeded */
+    bool incremental = incremental_manifest_name != NULL && !check_mode;    /* Whether the manifest follows the changes */
+    int file_index;
+
+    changed = (bool *)calloc(inputs->count, sizeof(bool));
+    if (changed == NULL) {
+        printf("Memory allocation failed");
+        return;
+    }
+    while (wait_for_changed_sources(inputs->file_names, inputs->count, changed) >= 0) {
+        for (file_index = 0; file_index < inputs->count; ++file_index) {
+            if (!changed[file_index]) {
+                continue;
+            }
+            if (!succeeded) {
+                puts("");
+            }
+            succeeded = process_input_file(inputs->file_names[file_index], inputs->output_names[file_index], check_mode);
+            if (!succeeded && incremental) {
+                forget_file_dependencies(inputs->file_names[file_index]);
+            }
+        }
+        if (incremental) {
+            write_manifest();
+        }
+        fflush(stdout);
+    }
+    free(changed);
+}
+
+
+bool handle_single_file(char *file_name, char *output_name, long *line_count) {
     /* File-related variables */
     char *input_file_name;                /* Name of the input assembly file */ 
     FILE *input_file_ptr;                 /* Current assembly file */
 
-    /* Line processing variables */
-    char current_line_buffer[MAX_LINE_LENGTH + 2];  /* Temporary string variable representing an input line */
-    line_info current_line;               /* Information about the current line being processed */
-    int current_character;                /* Temporary variable for skipping remaining characters*/
-    int line_index;                       /* Index of line, used to track the position within a line of the input file */
-
-    /* Assembly counters */
-    long ic = IC_INIT_VALUE;                /* Instruction counter */
-    long dc = 0;                            /* Data counter */
-    long beginning_ic_value;                /* Initial value of instruction counter */
-    long beginning_dc_value;                /* Initial value of data counter */
-
-    /* Symbol table and image arrays */
-    table symbol_table = NULL;              /* The symbol table */
-    long data_image[CODE_ARR_IMG_LENGTH];   /* Contains an image of the data */
-    machine_word *code_image[CODE_ARR_IMG_LENGTH];  /* Contains an image of the machine code */
+    /* The counters, images and symbol table of the file, and its errors, printed together at the end */
+    assembly_context context;
+    diagnostic_sink diagnostics = {FALSE, NULL, 0, 0, 0};
 
     /* Assembly process status */
     bool process_success = TRUE;
-    
-    /* Boolean flag indicating whether macros are present */
-    bool has_macros;
+    bool macros_processed;                  /* Whether process_macros succeeded */
+    double phase_start_time;                /* Start time of the trace span of the current phase */
 
     /* Process macros in the current input file */
-    if (!process_macros(file_name, &has_macros)){
+    open_diagnostic_sink(&diagnostics, max_errors_per_file);
+    init_assembly_context(&context, file_name, &diagnostics);
+    context.output_name = output_name;
+    context.keep_going = keep_going_after_errors;
+    profile_begin_file(file_name);
+    stats_begin_phase(MACROS_PHASE);
+    phase_start_time = trace_now();
+    macros_processed = process_macros(&context);
+    trace_span("process_macros", file_name, phase_start_time);
+    stats_end_phase(MACROS_PHASE);
+    if (watch_enabled) {
+        watch_source_dependencies(&context);
+    }
+    if (!macros_processed){
+        free_assembly_context(&context);
+        print_recorded_diagnostics(&diagnostics, NULL);
+        free_diagnostic_sink(&diagnostics);
         return FALSE;
     }
 
-    if (has_macros) {
+    if (context.has_macros) {
         /* Add .am extension to input file name in case there is macros present */
-        input_file_name = add_extension(file_name, ".am");
+        input_file_name = add_extension(output_name, ".am");
     }
     else {
         /* Add .as extension to input file name in case there isn't macros present*/
@@ -97,73 +429,121 @@ bool handle_single_file(char *file_name) {
     /* Open input file with error checking */
     input_file_ptr = fopen(input_file_name, "r");
     if (input_file_ptr == NULL){
+        print_recorded_diagnostics(&diagnostics, NULL);
+        free_diagnostic_sink(&diagnostics);
         printf("file can't be opened \n");
-        free(input_file_name);
+        tracked_free(input_file_name);
+        free_assembly_context(&context);
         return FALSE;
     } 
-    
-    /* Initialize line information */
-    current_line.file_name = input_file_name;
-    current_line.content = current_line_buffer;
-    current_line.line_number = 1; 
-
-    /* First iteration: process each line of the input file */
-    while (fgets(current_line_buffer, MAX_LINE_LENGTH + 2, input_file_ptr) != NULL) {
-        /* Check for line length exceeding the maximum */ 
-        if (strchr(current_line_buffer, '\n') == NULL && !feof(input_file_ptr)) {
-            print_error(current_line, "Line too long to process. Maximum line length should be %d.", MAX_LINE_LENGTH);
-            process_success = FALSE;
-
-            /* skip leftovers */
-            current_character = fgetc(input_file_ptr);
-            while (current_character != '\n' && current_character != EOF) {
-                current_character = fgetc(input_file_ptr);
-            } 
-        } else {
-            /* Process the line in the current iteration */
-            if (!process_line_fpass(current_line, &ic, &dc, code_image, data_image, &symbol_table)){
-                if (process_success) {
-                    beginning_ic_value = -1;
-                    process_success = FALSE;
-                }
-            }  
-        }
-        current_line.line_number++;
-    }
-    
-    /* Save initial IC and DC values */
-    beginning_ic_value = ic;
-    beginning_dc_value = dc;
-    /* If the first iteration succeeded, start the second iteration */
-    if (process_success) {
-        ic = IC_INIT_VALUE;
-        add_value_to_type(symbol_table, beginning_ic_value, DATA_SYMBOL);
-        rewind(input_file_ptr);
-        
-        /* Second iteration: process each line of the input file */
-        for (current_line.line_number = 1; !feof(input_file_ptr); current_line.line_number++) {
-            line_index = 0;
-            fgets(current_line_buffer, MAX_LINE_LENGTH, input_file_ptr);
-            line_index = skip_spaces(current_line_buffer, line_index);
-            if (code_image[ic - IC_INIT_VALUE] != NULL || current_line_buffer[line_index] == '.') {
-                process_success &= process_line_spass(current_line, &ic, code_image, &symbol_table);
-            }
-        }
-        
-        /* If second iteration succeeded, write output files */
-		if (process_success) {
-			process_success = write_output_files(code_image, data_image, beginning_ic_value, beginning_dc_value, file_name, symbol_table);
-		}
-        
+
+    /* Run both passes and write the output files */
+    context.input_file_name = input_file_name;
+    process_success = assemble_source(&context, input_file_ptr, TRUE, NULL);
+    *line_count = context.line_count;
+
+    /* Record what the outputs depend on, for the next run with --incremental */
+    if (process_success && incremental_manifest_name != NULL) {
+        record_file_dependencies(&context);
     }
     
     /* Clean up resources */
-	free(input_file_name);
-	free_table(symbol_table);
-	free_code_image(code_image, beginning_ic_value);
+	fclose(input_file_ptr);
+	tracked_free(input_file_name);
+	free_assembly_context(&context);
+    print_recorded_diagnostics(&diagnostics, NULL);
+    free_diagnostic_sink(&diagnostics);
 
 	return process_success;
 }
 
 
+bool check_single_file(char *file_name, long *line_count) {
+    char *input_file_name;                  /* Name of the input assembly file */
+    char *expanded_file_name = NULL;        /* Name the passes give the expanded source, as if the .am file was written */
+    FILE *input_file_ptr;                   /* Current assembly file */
+    FILE *expanded_file_ptr = NULL;         /* The expanded source, written in memory */
+    FILE *am_file_ptr;                      /* The expanded source, read by the passes */
+    char *expanded = NULL;                  /* The memory of the expanded source */
+    size_t expanded_length = 0;
+
+    /* The counters and symbol table of the file, and its errors, printed together at the end */
+    assembly_context context;
+    diagnostic_sink diagnostics = {FALSE, NULL, 0, 0, 0};
+
+    /* Assembly process status */
+    bool process_success = FALSE;
+    bool macros_processed = FALSE;          /* Whether process_macros_stream succeeded */
+    double phase_start_time;                /* Start time of the trace span of the current phase */
+
+    open_diagnostic_sink(&diagnostics, max_errors_per_file);
+    init_assembly_context(&context, file_name, &diagnostics);
+    context.check_only = TRUE;
+    context.keep_going = keep_going_after_errors;
+
+    /* Open input file with error checking */
+    input_file_name = add_extension(file_name, ".as");
+    input_file_ptr = input_file_name != NULL ? fopen(input_file_name, "r") : NULL;
+    if (input_file_ptr == NULL) {
+        printf("file can't be opend \n");
+        if (watch_enabled) {
+            watch_source_dependencies(&context);
+        }
+        tracked_free(input_file_name);
+        free_assembly_context(&context);
+        free_diagnostic_sink(&diagnostics);
+        return FALSE;
+    }
+
+    /* Process macros in the current input file, in memory */
+    profile_begin_file(file_name);
+    stats_begin_phase(MACROS_PHASE);
+    phase_start_time = trace_now();
+    expanded_file_ptr = open_memstream(&expanded, &expanded_length);
+    if (expanded_file_ptr == NULL) {
+        printf("Memory allocation failed");
+    }
+    else {
+        macros_processed = process_macros_stream(&context, input_file_ptr, input_file_name, expanded_file_ptr);
+        fclose(expanded_file_ptr);
+    }
+    trace_span("process_macros", file_name, phase_start_time);
+    stats_end_phase(MACROS_PHASE);
+    if (watch_enabled) {
+        watch_source_dependencies(&context);
+    }
+
+    /* Run both passes, over the expanded source if there is macros present */
+    if (macros_processed && !context.has_macros) {
+        rewind(input_file_ptr);
+        context.input_file_name = input_file_name;
+        process_success = assemble_source(&context, input_file_ptr, FALSE, NULL);
+    }
+    else if (macros_processed) {
+        expanded_file_name = add_extension(file_name, ".am");
+        am_file_ptr = fmemopen(expanded, expanded_length, "r");
+        if (expanded_file_name == NULL || am_file_ptr == NULL) {
+            printf("Memory allocation failed");
+        }
+        else {
+            context.input_file_name = expanded_file_name;
+            process_success = assemble_source(&context, am_file_ptr, FALSE, NULL);
+        }
+        if (am_file_ptr != NULL) {
+            fclose(am_file_ptr);
+        }
+    }
+
+    *line_count = context.line_count;
+
+    /* Clean up resources */
+    fclose(input_file_ptr);
+    tracked_free(input_file_name);
+    tracked_free(expanded_file_name);
+    free(expanded);
+    free_assembly_context(&context);
+    print_recorded_diagnostics(&diagnostics, NULL);
+    free_diagnostic_sink(&diagnostics);
 
+    return process_success;
+}
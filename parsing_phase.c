@@ -6,6 +6,7 @@
 #include "utility_functions.h"
 #include "instructions_set.h"
 #include "parsing_phase.h"
+#include "alloc_tracking.h"
 
 
 /**
@@ -28,7 +29,7 @@ static bool process_code(line_info line, int index_l, long *ic, machine_word **c
 bool process_line_fpass(line_info line, long *IC, long *DC, machine_word **code_img, long *data_img, table *symbol_table) {
     int index_line = 0;     /* Index within the line content */
     int index_symbol = 0;   /* Index within the symbol */
-    char symbol[MAX_LINE_LENGTH];   /* Temporary buffer to store symbol */
+    char symbol[MAX_LINE_LENGTH + 2];   /* Temporary buffer to store symbol, extract_label copies up to a whole line */
     instruction currentInstruction;  /* Current instruction */
 
     /* Skip leading spaces */
@@ -39,7 +40,8 @@ bool process_line_fpass(line_info line, long *IC, long *DC, machine_word **code_
         return TRUE;
     }
     
-    /* Check for macro definition */
+    /* Check for macro definition (symbol is only filled by a .define line) */
+    symbol[0] = '\0';
     if (!check_mdefine(line, symbol_table, symbol)) {
         return FALSE;
     } else if (find_by_types(*symbol_table, symbol, 1, MDEFINE_SYMBOL) != NULL) {
@@ -92,8 +94,9 @@ bool process_line_fpass(line_info line, long *IC, long *DC, machine_word **code_
     
     /* Process instruction */
     if (currentInstruction != NONE_INST) {
-        /* Process .data and .string instructions */
-        if ((currentInstruction == DATA_INST || currentInstruction == STRING_INST) && symbol[0] != '\0') {
+        /* Process .data, .string, .incbin, .fill and .space instructions */
+        if ((currentInstruction == DATA_INST || currentInstruction == STRING_INST || currentInstruction == INCBIN_INST ||
+             currentInstruction == FILL_INST || currentInstruction == SPACE_INST) && symbol[0] != '\0') {
             if (currentInstruction == STRING_INST) {
                 add_table_item(symbol_table, symbol, *DC, DATA_SYMBOL);
             }
@@ -108,6 +111,14 @@ bool process_line_fpass(line_info line, long *IC, long *DC, machine_word **code_
         else if (currentInstruction == DATA_INST) {
             return process_data_instruction(line, index_line, data_img, DC, *symbol_table);
         }
+        /* Process .incbin instruction */
+        else if (currentInstruction == INCBIN_INST) {
+            return process_incbin_instruction(line, index_line, data_img, DC, *symbol_table);
+        }
+        /* Process .fill and .space instructions */
+        else if (currentInstruction == FILL_INST || currentInstruction == SPACE_INST) {
+            return process_fill_instruction(line, index_line, data_img, DC, *symbol_table, currentInstruction);
+        }
         /* Process .extern instruction */
         else if (currentInstruction == EXTERN_INST) {
             /* Extract external symbol */
@@ -131,6 +142,11 @@ bool process_line_fpass(line_info line, long *IC, long *DC, machine_word **code_
             print_error(line, "Can't define a label to an entry instruction.");
             return FALSE;
         }
+        /* Process .include instruction, its symbols were added by the preprocessor */
+        else if (currentInstruction == INCLUDE_INST && symbol[0] != '\0') {
+            print_error(line, "Can't define a label to an include instruction.");
+            return FALSE;
+        }
     } else {
         /* Process regular code instruction */
         if (symbol[0] != '\0') {
@@ -169,6 +185,33 @@ static void build_extra_codeword_fpass(machine_word **code_img, long *ic, char *
  */
 static void build_extra_codeword_fpass_reg(machine_word **code_img, long *ic, char **operands, table symbol_table);
 
+/**
+ * @brief Checks a code instruction without building its words, for a line that is only checked.
+ *
+ * The code image gets shared machine words in the entries process_code fills, with the same lengths,
+ * which is all the second pass reads of them.
+ *
+ * @param line The line_info struct containing information about the current line.
+ * @param curr_opcode The opcode of the instruction.
+ * @param operands The operands of the instruction, they are freed.
+ * @param operand_count The number of operands.
+ * @param ic Pointer to the instruction counter to track the position in the code_img array.
+ * @param code_img Array to store machine words representing code instructions.
+ * @param symbol_table The symbol table containing defined symbols.
+ * @return Returns TRUE if the operands are valid for the instruction, otherwise returns FALSE.
+ */
+static bool check_code(line_info line, opcode curr_opcode, char **operands, int operand_count, long *ic, machine_word **code_img, table symbol_table);
+
+/**
+ * @brief Computes the number of words of a code instruction from the addressing modes of its operands.
+ *
+ * @param operands The operands of the instruction.
+ * @param operand_count The number of operands.
+ * @param symbol_table The symbol table containing defined symbols.
+ * @return The number of words, the first word included. Two registers share a word.
+ */
+static long instruction_words(char **operands, int operand_count, table symbol_table);
+
 /* Processes a single code instruction during the first pass of assembly. */
 static bool process_code(line_info line, int index_l, long *ic, machine_word **code_img, table symbol_table) {
     char operation[8];      /* Buffer to store the operation */
@@ -205,13 +248,27 @@ static bool process_code(line_info line, int index_l, long *ic, machine_word **c
         return FALSE;
     }
 
+    /* Check the instruction fits in the code image, with the entry after it the second pass reads */
+    if ((*ic) - IC_INIT_VALUE + instruction_words(operands, operand_count, symbol_table) >= CODE_ARR_IMG_LENGTH) {
+        print_error(line, "Instruction is too large for the code image (%d words)", CODE_ARR_IMG_LENGTH);
+        while (operand_count > 0) {
+            tracked_free(operands[--operand_count]);
+        }
+        return FALSE;
+    }
+
+    /* A checked line only needs the length of the instruction */
+    if (line.check_only) {
+        return check_code(line, curr_opcode, operands, operand_count, ic, code_img, symbol_table);
+    }
+
     /* Get code word */
     codeword = get_code_word(line, curr_opcode, operand_count, operands, symbol_table);
     if (codeword == NULL) {
         if (operands[0]) {
-            free(operands[0]);
+            tracked_free(operands[0]);
             if (operands[1]) {
-                free(operands[1]);
+                tracked_free(operands[1]);
             }
         }
         return FALSE;
@@ -221,7 +278,7 @@ static bool process_code(line_info line, int index_l, long *ic, machine_word **c
     ic_before = *ic;
 
     /* Allocate memory for machine word */
-    word_to_write = (machine_word *)malloc(sizeof(machine_word));
+    word_to_write = (machine_word *)tracked_malloc(PROCESS_CODE_SITE, sizeof(machine_word));
     if (word_to_write == NULL) {
         printf("Memory allocation failed");
         return FALSE;
@@ -234,8 +291,8 @@ static bool process_code(line_info line, int index_l, long *ic, machine_word **c
         if (get_addressing_type(operands[0], symbol_table) == REGISTER_ADDR) {
             if (get_addressing_type(operands[1], symbol_table) == REGISTER_ADDR) {
                 build_extra_codeword_fpass_reg(code_img, ic, operands, symbol_table);
-                free(operands[0]);
-                free(operands[1]);
+                tracked_free(operands[0]);
+                tracked_free(operands[1]);
                 operand_count = 0;
             }   
         }
@@ -243,10 +300,10 @@ static bool process_code(line_info line, int index_l, long *ic, machine_word **c
     /* Process operands */
     if (operand_count--) {
         build_extra_codeword_fpass(code_img, ic, operands[0], TRUE, symbol_table);
-        free(operands[0]);
+        tracked_free(operands[0]);
         if (operand_count) {
             build_extra_codeword_fpass(code_img, ic, operands[1], FALSE, symbol_table);
-            free(operands[1]);
+            tracked_free(operands[1]);
         }
     }
 
@@ -258,6 +315,64 @@ static bool process_code(line_info line, int index_l, long *ic, machine_word **c
     return TRUE; 
 }
 
+/* Computes the number of words of a code instruction from the addressing modes of its operands */
+static long instruction_words(char **operands, int operand_count, table symbol_table) {
+    addressing_type addressing[2];  /* Addressing modes of the operands */
+    long words = 1;                 /* The first word */
+    int index;
+
+    for (index = 0; index < 2; index++) {
+        addressing[index] = index < operand_count ? get_addressing_type(operands[index], symbol_table) : NONE_ADDR;
+    }
+    if (operand_count == 2 && addressing[0] == REGISTER_ADDR && addressing[1] == REGISTER_ADDR) {
+        return words + 1;
+    }
+    for (index = 0; index < operand_count; index++) {
+        words += addressing[index] == NONE_ADDR ? 0 : addressing[index] == INDEX_FIXED_ADDR ? 2 : 1;
+    }
+    return words;
+}
+
+/* Checks a code instruction without building its words */
+static bool check_code(line_info line, opcode curr_opcode, char **operands, int operand_count, long *ic, machine_word **code_img, table symbol_table) {
+    addressing_type addressing[2];  /* Addressing modes of the operands */
+    long ic_before = *ic;           /* Instruction counter before processing */
+    bool is_valid;
+    int index;
+
+    for (index = 0; index < 2; index++) {
+        addressing[index] = index < operand_count ? get_addressing_type(operands[index], symbol_table) : NONE_ADDR;
+    }
+    is_valid = validate_operand_by_opcode(line, addressing[0], addressing[1], curr_opcode, operand_count);
+    for (index = 0; index < operand_count; index++) {
+        tracked_free(operands[index]);
+    }
+    if (!is_valid) {
+        return FALSE;
+    }
+
+    /* Fill the entries the words of process_code would fill, two registers share a word */
+    if (operand_count == 2 && addressing[0] == REGISTER_ADDR && addressing[1] == REGISTER_ADDR) {
+        code_img[(++(*ic)) - IC_INIT_VALUE] = checked_word(0);
+    }
+    else {
+        for (index = 0; index < operand_count; index++) {
+            if (addressing[index] != NONE_ADDR) {
+                (*ic)++;
+            }
+            if (addressing[index] == IMMEDIATE_ADDR || addressing[index] == REGISTER_ADDR) {
+                code_img[(*ic) - IC_INIT_VALUE] = checked_word(0);
+            }
+            if (addressing[index] == INDEX_FIXED_ADDR) {
+                (*ic)++;
+            }
+        }
+    }
+    (*ic)++;
+    code_img[ic_before - IC_INIT_VALUE] = checked_word((*ic) - ic_before);
+    return TRUE;
+}
+
 /* Builds an extra code word for a register addressing mode instruction during the first pass */
 static void build_extra_codeword_fpass_reg(machine_word **code_img, long *ic, char **operands, table symbol_table) {
     machine_word *word_to_write;   /* Machine word to write */
@@ -272,7 +387,7 @@ static void build_extra_codeword_fpass_reg(machine_word **code_img, long *ic, ch
     second_value = strtol(operands[1] + 1, NULL, 10);
 
     /* Allocate memory for machine word */
-    word_to_write = (machine_word *)malloc(sizeof(machine_word));
+    word_to_write = (machine_word *)tracked_malloc(PROCESS_CODE_SITE, sizeof(machine_word));
     if (word_to_write == NULL) {
         printf("Memory allocation failed");
         exit(1);
@@ -305,7 +420,7 @@ static void build_extra_codeword_fpass(machine_word **code_img, long *ic, char *
             }
             
             /* Allocate memory for machine word */
-            word_to_write = (machine_word *)malloc(sizeof(machine_word));
+            word_to_write = (machine_word *)tracked_malloc(PROCESS_CODE_SITE, sizeof(machine_word));
             if (word_to_write == NULL) {
                 printf("Memory allocation failed");
                 exit(1);
@@ -0,0 +1,535 @@
+#define _POSIX_C_SOURCE 200809L /* fmemopen and open_memstream */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include "pipeline.h"
+#include "assembler.h"
+#include "file_writeing.h"
+#include "preprocessor.h"
+#include "utility_functions.h"
+#include "alloc_tracking.h"
+#include "batch_io.h"
+#include "statistics.h"
+
+/* An input file moving through the stages of the pipeline */
+struct pipelined_file {
+    char *file_name;                /* The file name without extension */
+    char *output_name;              /* The name of its .am and output files without extension */
+    double start_time;              /* Wall clock when its batch started being read, for the summary of the run */
+    long line_count;                /* Source lines read by the first pass */
+    bool opened;                    /* Whether the .as file could be opened */
+    char *source;                   /* Contents of the .as file, freed once the file is assembled */
+    size_t source_length;           /* Length of the .as file */
+    table symbol_table;             /* Symbols of the included files, then of the whole source */
+    bool macros_processed;          /* Whether the macros were processed without errors */
+    bool has_macros;                /* Whether the source has macros, and an expanded .am source */
+    char *expanded;                 /* Contents of the .am file */
+    size_t expanded_length;         /* Length of the .am file */
+    diagnostic_sink macro_diagnostics;      /* Errors of the macro processing */
+    bool assembled;                 /* Whether both passes succeeded and the output files were rendered */
+    diagnostic_sink assembly_diagnostics;   /* Errors of both passes */
+    output_files outputs;           /* The rendered .ob, .ext and .ent files */
+};
+
+/* A bounded queue of files between two stages */
+struct file_queue {
+    struct pipelined_file **files;  /* Ring buffer of the files */
+    int capacity;                   /* Length of the ring buffer */
+    int first;                      /* Index of the oldest file */
+    int count;                      /* Number of files in the queue */
+    bool closed;                    /* Whether the stage before the queue has no more files */
+    pthread_mutex_t lock;           /* Protects the fields above */
+    pthread_cond_t not_empty;       /* Signaled when a file is added or the queue is closed */
+    pthread_cond_t not_full;        /* Signaled when a file is removed */
+};
+
+/* Files the writer stage writes together */
+struct writer_batch {
+    struct pipelined_file **files;  /* The files, in order */
+    int count;                      /* Number of files */
+    io_request *requests;           /* The .am files written together */
+    bool *am_written;               /* Whether each file has no .am file or it was written */
+    output_files **outputs;         /* The rendered output files of each file, NULL if they aren't written */
+    char **output_names;            /* The name of the output files of each file without extension */
+    char **failed_extensions;       /* The output file of each file that couldn't be created, or NULL */
+};
+
+/* The stages and the queues between them */
+struct pipeline {
+    char **file_names;                  /* The input files, without extension */
+    char **output_names;                /* The name of the .am and output files of each input file, without extension */
+    int file_count;                     /* Number of input files */
+    int queue_depth;                    /* Files of each queue, and of each batch read or written together */
+    struct file_queue read_files;       /* Files read by the reader stage */
+    struct file_queue preprocessed_files;   /* Files whose macros were processed */
+    struct file_queue assembled_files;  /* Files whose output files were rendered */
+};
+
+/**
+ * @brief Initializes an empty queue.
+ *
+ * @return Returns true if the queue was allocated, otherwise false.
+ */
+static bool init_queue(struct file_queue *queue, int capacity);
+
+/**
+ * @brief Frees a queue, it must be empty.
+ */
+static void free_queue(struct file_queue *queue);
+
+/**
+ * @brief Adds a file to a queue, waiting while the queue is full.
+ */
+static void push_file(struct file_queue *queue, struct pipelined_file *file);
+
+/**
+ * @brief Removes the oldest file of a queue, waiting while the queue is empty.
+ *
+ * @return The file, or NULL once the queue is closed and empty.
+ */
+static struct pipelined_file *pop_file(struct file_queue *queue);
+
+/**
+ * @brief Removes the oldest file of a queue if it has one, without waiting.
+ *
+ * @return The file, or NULL if the queue is empty.
+ */
+static struct pipelined_file *try_pop_file(struct file_queue *queue);
+
+/**
+ * @brief Marks a queue as having no more files.
+ */
+static void close_queue(struct file_queue *queue);
+
+/**
+ * @brief The reader stage: reads the .as file of every input file, in order.
+ *
+ * @param argument The pipeline.
+ * @return NULL.
+ */
+static void *read_stage(void *argument);
+
+/**
+ * @brief The preprocess stage: processes the macros of the files that were read.
+ *
+ * The cache of included files is only used by this stage, so it needs no lock.
+ *
+ * @param argument The pipeline.
+ * @return NULL.
+ */
+static void *preprocess_stage(void *argument);
+
+/**
+ * @brief The assembly stage: runs both passes over the preprocessed files and renders their output files.
+ *
+ * @param argument The pipeline.
+ * @return NULL.
+ */
+static void *assembly_stage(void *argument);
+
+/**
+ * @brief Allocates the arrays of a batch of the writer stage.
+ *
+ * @return Returns true if the arrays were allocated, otherwise false.
+ */
+static bool init_writer_batch(struct writer_batch *batch, int capacity);
+
+/**
+ * @brief Frees the arrays of a batch of the writer stage.
+ */
+static void free_writer_batch(struct writer_batch *batch);
+
+/**
+ * @brief Writes the .am and output files of a batch together, then prints the errors of each file in order, like handle_single_file.
+ *
+ * @param batch The assembled files, they are freed.
+ * @param succeeded Whether the file before the batch succeeded, receives whether its last file succeeded.
+ */
+static void write_pipelined_batch(struct writer_batch *batch, bool *succeeded);
+
+/**
+ * @brief Frees a file and everything it holds.
+ */
+static void free_pipelined_file(struct pipelined_file *file);
+
+/* Initializes an empty queue */
+static bool init_queue(struct file_queue *queue, int capacity) {
+    queue->files = (struct pipelined_file **)malloc(capacity * sizeof(struct pipelined_file *));
+    if (queue->files == NULL) {
+        return FALSE;
+    }
+    queue->capacity = capacity;
+    queue->first = 0;
+    queue->count = 0;
+    queue->closed = FALSE;
+    pthread_mutex_init(&queue->lock, NULL);
+    pthread_cond_init(&queue->not_empty, NULL);
+    pthread_cond_init(&queue->not_full, NULL);
+    return TRUE;
+}
+
+/* Frees a queue, it must be empty */
+static void free_queue(struct file_queue *queue) {
+    pthread_mutex_destroy(&queue->lock);
+    pthread_cond_destroy(&queue->not_empty);
+    pthread_cond_destroy(&queue->not_full);
+    free(queue->files);
+}
+
+/* Adds a file to a queue, waiting while the queue is full */
+static void push_file(struct file_queue *queue, struct pipelined_file *file) {
+    pthread_mutex_lock(&queue->lock);
+    while (queue->count == queue->capacity) {
+        pthread_cond_wait(&queue->not_full, &queue->lock);
+    }
+    queue->files[(queue->first + queue->count) % queue->capacity] = file;
+    queue->count++;
+    pthread_cond_signal(&queue->not_empty);
+    pthread_mutex_unlock(&queue->lock);
+}
+
+/* Removes the oldest file of a queue, waiting while the queue is empty */
+static struct pipelined_file *pop_file(struct file_queue *queue) {
+    struct pipelined_file *file = NULL;
+
+    pthread_mutex_lock(&queue->lock);
+    while (queue->count == 0 && !queue->closed) {
+        pthread_cond_wait(&queue->not_empty, &queue->lock);
+    }
+    if (queue->count > 0) {
+        file = queue->files[queue->first];
+        queue->first = (queue->first + 1) % queue->capacity;
+        queue->count--;
+        pthread_cond_signal(&queue->not_full);
+    }
+    pthread_mutex_unlock(&queue->lock);
+    return file;
+}
+
+/* Removes the oldest file of a queue if it has one, without waiting */
+static struct pipelined_file *try_pop_file(struct file_queue *queue) {
+    struct pipelined_file *file = NULL;
+
+    pthread_mutex_lock(&queue->lock);
+    if (queue->count > 0) {
+        file = queue->files[queue->first];
+        queue->first = (queue->first + 1) % queue->capacity;
+        queue->count--;
+        pthread_cond_signal(&queue->not_full);
+    }
+    pthread_mutex_unlock(&queue->lock);
+    return file;
+}
+
+/* Marks a queue as having no more files */
+static void close_queue(struct file_queue *queue) {
+    pthread_mutex_lock(&queue->lock);
+    queue->closed = TRUE;
+    pthread_cond_broadcast(&queue->not_empty);
+    pthread_mutex_unlock(&queue->lock);
+}
+
+/* The reader stage: reads the .as files of the input files in batches, in order */
+static void *read_stage(void *argument) {
+    struct pipeline *pipeline = (struct pipeline *)argument;
+    struct pipelined_file *file;
+    io_request *requests = (io_request *)malloc(pipeline->queue_depth * sizeof(io_request));
+    int first_file;
+    int batch_count;
+    int index;
+    double start_time;
+
+    for (first_file = 0; requests != NULL && first_file < pipeline->file_count; first_file += batch_count) {
+        batch_count = pipeline->file_count - first_file < pipeline->queue_depth ? pipeline->file_count - first_file : pipeline->queue_depth;
+        start_time = summary_enabled ? wall_clock_seconds() : 0;
+        for (index = 0; index < batch_count; index++) {
+            requests[index].path = add_extension(pipeline->file_names[first_file + index], ".as");
+        }
+        batch_read_files(requests, batch_count);
+
+        for (index = 0; index < batch_count; index++) {
+            tracked_free(requests[index].path);
+            file = (struct pipelined_file *)calloc(1, sizeof(struct pipelined_file));
+            if (file == NULL) {
+                printf("Memory allocation failed");
+                free(requests[index].contents);
+                continue;
+            }
+            file->file_name = pipeline->file_names[first_file + index];
+            file->output_name = pipeline->output_names[first_file + index];
+            file->start_time = start_time;
+            file->opened = requests[index].succeeded;
+            file->source = requests[index].contents;
+            file->source_length = requests[index].length;
+            push_file(&pipeline->read_files, file);
+        }
+    }
+    if (requests == NULL) {
+        printf("Memory allocation failed");
+    }
+    free(requests);
+    close_queue(&pipeline->read_files);
+    return NULL;
+}
+
+/* The preprocess stage: processes the macros of the files that were read */
+static void *preprocess_stage(void *argument) {
+    struct pipeline *pipeline = (struct pipeline *)argument;
+    struct pipelined_file *file;
+    assembly_context context;       /* The context of the macro processing of the current file */
+    char *input_file_name;
+    FILE *input_file_ptr;
+    FILE *output_file_ptr;
+
+    while ((file = pop_file(&pipeline->read_files)) != NULL) {
+        if (file->source != NULL) {
+            init_assembly_context(&context, file->file_name, &file->macro_diagnostics);
+            input_file_name = add_extension(file->file_name, ".as");
+            input_file_ptr = fmemopen(file->source, file->source_length, "r");
+            output_file_ptr = open_memstream(&file->expanded, &file->expanded_length);
+            if (input_file_name != NULL && input_file_ptr != NULL && output_file_ptr != NULL) {
+                open_diagnostic_sink(&file->macro_diagnostics, max_errors_per_file);
+                file->macros_processed = process_macros_stream(&context, input_file_ptr, input_file_name, output_file_ptr);
+                file->has_macros = context.has_macros;
+                file->symbol_table = context.symbol_table;
+            }
+            else {
+                printf("Memory allocation failed");
+            }
+            if (input_file_ptr != NULL) {
+                fclose(input_file_ptr);
+            }
+            if (output_file_ptr != NULL) {
+                fclose(output_file_ptr);
+            }
+            close_diagnostic_sink(&file->macro_diagnostics);
+            tracked_free(input_file_name);
+
+            /* The symbol table moved to the file, the rest of the context isn't used further */
+            context.symbol_table = NULL;
+            free_assembly_context(&context);
+        }
+        push_file(&pipeline->preprocessed_files, file);
+    }
+    close_queue(&pipeline->preprocessed_files);
+    return NULL;
+}
+
+/* The assembly stage: runs both passes over the preprocessed files and renders their output files */
+static void *assembly_stage(void *argument) {
+    struct pipeline *pipeline = (struct pipeline *)argument;
+    struct pipelined_file *file;
+    assembly_context context;       /* The context of the passes over the current file */
+    char *input_file_name;
+    FILE *input_file_ptr;
+
+    while ((file = pop_file(&pipeline->preprocessed_files)) != NULL) {
+        if (file->macros_processed) {
+            /* The source is assembled from its .am file when it has macros, like handle_single_file does */
+            init_assembly_context(&context, file->file_name, &file->assembly_diagnostics);
+            context.symbol_table = file->symbol_table;
+            context.keep_going = keep_going_after_errors;
+            file->symbol_table = NULL;
+            input_file_name = file->has_macros ? add_extension(file->output_name, ".am") : add_extension(file->file_name, ".as");
+            input_file_ptr = file->has_macros ? fmemopen(file->expanded, file->expanded_length, "r") :
+                                                fmemopen(file->source, file->source_length, "r");
+            if (input_file_name != NULL && input_file_ptr != NULL) {
+                open_diagnostic_sink(&file->assembly_diagnostics, max_errors_per_file);
+                context.input_file_name = input_file_name;
+                file->assembled = assemble_source(&context, input_file_ptr, TRUE, &file->outputs);
+                file->line_count = context.line_count;
+            }
+            else {
+                printf("Memory allocation failed");
+            }
+            if (input_file_ptr != NULL) {
+                fclose(input_file_ptr);
+            }
+            close_diagnostic_sink(&file->assembly_diagnostics);
+            tracked_free(input_file_name);
+            free_assembly_context(&context);
+        }
+
+        /* Only the .am file and the output files are left to write */
+        free(file->source);
+        file->source = NULL;
+        file->source_length = 0;
+        free_table(file->symbol_table);
+        file->symbol_table = NULL;
+        push_file(&pipeline->assembled_files, file);
+    }
+    close_queue(&pipeline->assembled_files);
+    return NULL;
+}
+
+/* Allocates the arrays of a batch of the writer stage */
+static bool init_writer_batch(struct writer_batch *batch, int capacity) {
+    batch->count = 0;
+    batch->files = (struct pipelined_file **)malloc(capacity * sizeof(struct pipelined_file *));
+    batch->requests = (io_request *)malloc(capacity * sizeof(io_request));
+    batch->am_written = (bool *)malloc(capacity * sizeof(bool));
+    batch->outputs = (output_files **)malloc(capacity * sizeof(output_files *));
+    batch->output_names = (char **)malloc(capacity * sizeof(char *));
+    batch->failed_extensions = (char **)malloc(capacity * sizeof(char *));
+    if (batch->files == NULL || batch->requests == NULL || batch->am_written == NULL || batch->outputs == NULL ||
+        batch->output_names == NULL || batch->failed_extensions == NULL) {
+        free_writer_batch(batch);
+        return FALSE;
+    }
+    return TRUE;
+}
+
+/* Frees the arrays of a batch of the writer stage */
+static void free_writer_batch(struct writer_batch *batch) {
+    free(batch->files);
+    free(batch->requests);
+    free(batch->am_written);
+    free(batch->outputs);
+    free(batch->output_names);
+    free(batch->failed_extensions);
+}
+
+/* Writes the .am and output files of a batch together, then prints the errors of each file in order */
+static void write_pipelined_batch(struct writer_batch *batch, bool *succeeded) {
+    struct pipelined_file *file;
+    int request_count = 0;
+    int index;
+
+    /* The .am files first, the output files of a file whose .am file can't be written aren't written */
+    for (index = 0; index < batch->count; index++) {
+        file = batch->files[index];
+        if (file->macros_processed && file->has_macros) {
+            batch->requests[request_count].path = add_extension(file->output_name, ".am");
+            batch->requests[request_count].contents = file->expanded;
+            batch->requests[request_count].length = file->expanded_length;
+            request_count++;
+        }
+    }
+    batch_write_files(batch->requests, request_count);
+
+    request_count = 0;
+    for (index = 0; index < batch->count; index++) {
+        file = batch->files[index];
+        batch->am_written[index] = TRUE;
+        if (file->macros_processed && file->has_macros) {
+            batch->am_written[index] = batch->requests[request_count].succeeded;
+            tracked_free(batch->requests[request_count++].path);
+        }
+        batch->outputs[index] = batch->am_written[index] && file->assembled ? &file->outputs : NULL;
+        batch->output_names[index] = file->output_name;
+    }
+    write_rendered_outputs_batch(batch->outputs, batch->output_names, batch->count, batch->failed_extensions);
+
+    /* Print the errors in the order handle_single_file prints them */
+    for (index = 0; index < batch->count; index++) {
+        file = batch->files[index];
+
+        /* If a previous file processing failed, print a newline */
+        if (!*succeeded) {
+            puts("");
+        }
+        *succeeded = FALSE;
+        if (!file->opened) {
+            printf("file can't be opend \n");
+        }
+        else {
+            print_recorded_diagnostics(&file->macro_diagnostics, NULL);
+            if (file->macros_processed && !batch->am_written[index]) {
+                printf("file can't be opend \n");
+            }
+            else if (file->macros_processed) {
+                print_recorded_diagnostics(&file->assembly_diagnostics, NULL);
+                if (file->assembled && batch->failed_extensions[index] != NULL) {
+                    print_write_error(file->output_name, batch->failed_extensions[index]);
+                }
+                *succeeded = file->assembled && batch->failed_extensions[index] == NULL;
+            }
+        }
+        summary_record_file(*succeeded, file->line_count, summary_enabled ? wall_clock_seconds() - file->start_time : 0);
+        free_pipelined_file(file);
+    }
+    batch->count = 0;
+}
+
+/* Frees a file and everything it holds */
+static void free_pipelined_file(struct pipelined_file *file) {
+    free(file->source);
+    free_table(file->symbol_table);
+    free(file->expanded);
+    free_diagnostic_sink(&file->macro_diagnostics);
+    free_diagnostic_sink(&file->assembly_diagnostics);
+    free_output_files(&file->outputs);
+    free(file);
+}
+
+/* Assembles input files through a pipeline of stages running on their own threads */
+bool assemble_files_pipelined(char **file_names, char **output_names, int file_count, int queue_depth) {
+    struct pipeline pipeline;
+    struct writer_batch batch;
+    pthread_t threads[3];       /* The assembly, preprocess and reader stages */
+    int thread_count = 0;       /* Number of started stages */
+    bool started;               /* Whether every stage started */
+    bool succeeded = TRUE;      /* Whether the previous file succeeded */
+
+    pipeline.file_names = file_names;
+    pipeline.output_names = output_names;
+    pipeline.file_count = file_count;
+    pipeline.queue_depth = queue_depth;
+    if (!init_writer_batch(&batch, queue_depth)) {
+        return FALSE;
+    }
+    if (!init_queue(&pipeline.read_files, queue_depth)) {
+        free_writer_batch(&batch);
+        return FALSE;
+    }
+    if (!init_queue(&pipeline.preprocessed_files, queue_depth)) {
+        free_writer_batch(&batch);
+        free_queue(&pipeline.read_files);
+        return FALSE;
+    }
+    if (!init_queue(&pipeline.assembled_files, queue_depth)) {
+        free_writer_batch(&batch);
+        free_queue(&pipeline.read_files);
+        free_queue(&pipeline.preprocessed_files);
+        return FALSE;
+    }
+
+    /* Start the stages from the last one, so a stage that can't start stops the ones after it before any file is read */
+    if (pthread_create(&threads[thread_count], NULL, assembly_stage, &pipeline) == 0) {
+        thread_count++;
+        if (pthread_create(&threads[thread_count], NULL, preprocess_stage, &pipeline) == 0) {
+            thread_count++;
+            if (pthread_create(&threads[thread_count], NULL, read_stage, &pipeline) == 0) {
+                thread_count++;
+            }
+            else {
+                close_queue(&pipeline.read_files);
+            }
+        }
+        else {
+            close_queue(&pipeline.preprocessed_files);
+        }
+    }
+
+    /* The calling thread is the writer stage, it writes the files that are ready together */
+    started = thread_count == 3;
+    if (started) {
+        while ((batch.files[0] = pop_file(&pipeline.assembled_files)) != NULL) {
+            batch.count = 1;
+            while (batch.count < queue_depth && (batch.files[batch.count] = try_pop_file(&pipeline.assembled_files)) != NULL) {
+                batch.count++;
+            }
+            write_pipelined_batch(&batch, &succeeded);
+        }
+    }
+    while (thread_count > 0) {
+        pthread_join(threads[--thread_count], NULL);
+    }
+
+    free_queue(&pipeline.read_files);
+    free_queue(&pipeline.preprocessed_files);
+    free_queue(&pipeline.assembled_files);
+    free_writer_batch(&batch);
+    return started;
+}
@@ -0,0 +1,27 @@
+#ifndef _PIPELINE_H
+#define _PIPELINE_H
+#include "global_variables.h"
+
+/* Files each queue of the pipeline holds when --pipeline isn't followed by a depth */
+#define DEFAULT_PIPELINE_DEPTH 4
+
+/**
+ * @brief Assembles input files through a pipeline of stages running on their own threads.
+ *
+ * A reader stage reads the next files in memory, a preprocess stage processes their macros, an
+ * assembly stage runs both passes and renders the output files, and the calling thread writes
+ * them. The stages are connected by queues of at most queue_depth files, so the reading and the
+ * writing of some files overlap with the assembly of others, while the memory stays bounded.
+ * The files are written and their errors are printed in order, as when they are handled one
+ * after the other. The statistics, the line profile, the allocation tracking and the trace
+ * measure a single file at a time, so they must be disabled.
+ *
+ * @param file_names The input files, without extension.
+ * @param output_names The name of the .am and output files of each input file, without extension.
+ * @param file_count The number of input files.
+ * @param queue_depth The number of files each queue holds, at least 1.
+ * @return Returns true if the files were assembled, false if the threads couldn't be started and no file was handled.
+ */
+bool assemble_files_pipelined(char **file_names, char **output_names, int file_count, int queue_depth);
+
+#endif
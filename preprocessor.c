@@ -1,20 +1,575 @@
+#define _POSIX_C_SOURCE 200112L /* stat for the include cache */
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <pthread.h>
+#include <sys/types.h>
+#include <sys/stat.h>
 #include "global_variables.h"
 #include "utility_functions.h"
+#include "preprocessor.h"
+#include "line_profile.h"
+#include "alloc_tracking.h"
 
 #define MAX_NAME_LENGTH 50
-#define MAX_CODE_LENGTH 1024
-#define MAX_MACROS 10
+#define INITIAL_CODE_CAPACITY 256
+#define INITIAL_MACROS_CAPACITY 16
+#define MAX_INCLUDE_DEPTH 8
 
 /* Define struct for macro information */
 struct macro_info {
     char macro_name[MAX_NAME_LENGTH];
-    char macro_code[MAX_CODE_LENGTH];
+    char *macro_code;           /* Body of the macro, grows as lines are added */
+    size_t code_length;         /* Length of the body */
+    size_t code_capacity;       /* Allocated size of the body */
     int macro_line_number;
+    int hash_next;              /* Index of the next macro in the same bucket, or -1 */
 };
 
+/* Define struct for the macros of a file, looked up by name through a hash table */
+struct macro_table {
+    struct macro_info *macros;  /* The macros, in the order of their definitions */
+    int count;                  /* Number of macros */
+    int capacity;               /* Allocated number of macros */
+    int *buckets;               /* Index of the first macro of each bucket, or -1 */
+    int bucket_count;           /* Number of buckets, a power of two */
+};
+
+/* Define struct for a parsed included file, cached for the whole run */
+struct include_module {
+    char *path;                     /* Resolved path of the included file */
+    time_t modification_time;       /* Modification time of the file when it was parsed */
+    off_t size;                     /* Size of the file when it was parsed */
+    table symbols;                  /* The .define constants and .extern declarations of the file itself */
+    bool is_valid;                  /* Whether the file and the files it includes were parsed without errors */
+    bool is_parsing;                /* Whether the file is being parsed, so a file it includes that includes it back is a cycle */
+    struct include_module **includes;   /* The files the file includes itself, their symbols are merged with its own */
+    int include_count;              /* Number of files the file includes */
+    long checked;                   /* The last check for changes that visited the file */
+    struct include_module *next;    /* Next cached file */
+};
+
+/* The .include lines handled by a process_macros call */
+struct include_scope {
+    diagnostic_sink *diagnostics;   /* Where the errors of the call go */
+    struct include_module **merged; /* The files merged by the call, so a file included twice is merged once */
+    int merged_count;               /* Number of merged files */
+    int merged_capacity;            /* Allocated length of merged */
+    struct include_module *parsed;  /* The included file being parsed, NULL while the source is read */
+    struct include_module **roots;  /* The files the source includes itself, with errors or not */
+    int root_count;                 /* Number of files the source includes itself */
+};
+
+/* Cache of the included files parsed so far, keyed by path and modification time */
+static struct include_module *include_cache = NULL;
+
+/* Number of checks for changes of the cached files so far, so a check visits each file once */
+static long cache_checks = 0;
+
+/* Held while a source handles an .include line, the cache is shared by the sources assembled at the same time */
+static pthread_mutex_t include_cache_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static struct include_module *load_include_module(char *path, int depth, struct include_scope *scope);
+
+/**
+ * @brief Extracts the quoted file name of an .include line and resolves it.
+ * 
+ * @param line A struct containing the content of the .include line, used for the error messages.
+ * @param line_index The index within the line content right after ".include".
+ * @return Returns the resolved path of the included file, or NULL if the file name is invalid.
+ */
+static char *extract_include_path(line_info line, int line_index) {
+    char file_name[MAX_LINE_LENGTH];
+    int name_index = 0;
+
+    line_index = skip_spaces(line.content, line_index);
+    if (line.content[line_index] != '"') {
+        print_error(line, "Missing opening quote of .include file name");
+        return NULL;
+    }
+    line_index++;
+
+    /* Extract the file name up to the closing quote */
+    while (line.content[line_index] && line.content[line_index] != '"' && line.content[line_index] != '\n') {
+        file_name[name_index++] = line.content[line_index++];
+    }
+    file_name[name_index] = '\0';
+    if (line.content[line_index] != '"' || name_index == 0) {
+        print_error(line, "Missing closing quote or file name of .include");
+        return NULL;
+    }
+
+    /* Check for unexpected characters after the file name */
+    line_index = skip_spaces(line.content, line_index + 1);
+    if (line.content[line_index] && line.content[line_index] != '\n') {
+        print_error(line, "Unexpected characters after .include file name");
+        return NULL;
+    }
+    return resolve_relative_path(line.file_name, file_name);
+}
+
+/**
+ * @brief Adds the symbols of an included file to a symbol table.
+ * 
+ * The symbols of the files it includes, directly or not, are added too. A file that was
+ * already merged by the current process_macros call is skipped, and a constant that is
+ * already defined in the symbol table is reported as an error.
+ * 
+ * @param line A struct containing the .include line of the source, used for the error messages.
+ * @param module The parsed included file.
+ * @param symbol_table The symbol table the symbols are added to.
+ * @param scope The .include lines of the current process_macros call.
+ * @return Returns true if the symbols were added, otherwise false.
+ */
+static bool merge_include_symbols(line_info line, struct include_module *module, table *symbol_table, struct include_scope *scope) {
+    struct include_module **merged;
+    table curr_entry;
+    bool is_valid = TRUE;
+    int index;
+
+    if (!module->is_valid) {
+        print_error(line, "Included file %s has errors", module->path);
+        return FALSE;
+    }
+    for (index = 0; index < scope->merged_count; index++) {
+        if (scope->merged[index] == module) {
+            return TRUE;    /* Already included into this file */
+        }
+    }
+    if (scope->merged_count == scope->merged_capacity) {
+        merged = (struct include_module **)tracked_realloc(INCLUDE_CACHE_SITE, scope->merged, (scope->merged_capacity * 2 + 4) * sizeof(struct include_module *));
+        if (merged == NULL) {
+            printf("Memory allocation failed");
+            return FALSE;
+        }
+        scope->merged = merged;
+        scope->merged_capacity = scope->merged_capacity * 2 + 4;
+    }
+    scope->merged[scope->merged_count++] = module;
+
+    for (curr_entry = module->symbols; curr_entry != NULL; curr_entry = curr_entry->next) {
+        if (curr_entry->type == MDEFINE_SYMBOL && find_by_types(*symbol_table, curr_entry->name, 1, MDEFINE_SYMBOL) != NULL) {
+            print_error(line, "The constant %s from %s is already defined", curr_entry->name, module->path);
+            is_valid = FALSE;
+            continue;
+        }
+        add_table_item(symbol_table, curr_entry->name, curr_entry->value, curr_entry->type);
+    }
+    for (index = 0; index < module->include_count; index++) {
+        is_valid &= merge_include_symbols(line, module->includes[index], symbol_table, scope);
+    }
+    return is_valid;
+}
+
+/**
+ * @brief Adds a file to the files included by an included file or by the source.
+ * 
+ * @param includes The included files, reallocated.
+ * @param include_count The number of included files.
+ * @param module The file included.
+ * @return Returns true if the file was added, otherwise false.
+ */
+static bool add_included_module(struct include_module ***includes, int *include_count, struct include_module *module) {
+    struct include_module **grown;
+
+    grown = (struct include_module **)tracked_realloc(INCLUDE_CACHE_SITE, *includes, (*include_count + 1) * sizeof(struct include_module *));
+    if (grown == NULL) {
+        printf("Memory allocation failed");
+        return FALSE;
+    }
+    *includes = grown;
+    (*includes)[(*include_count)++] = module;
+    return TRUE;
+}
+
+/**
+ * @brief Handles an .include line and adds the symbols of the included file to a symbol table.
+ * 
+ * An .include line of an included file only links the two files, the symbols are merged
+ * once into the source, so a cached file holds the same files whoever includes it.
+ * 
+ * @param line A struct containing the content of the .include line.
+ * @param line_index The index within the line content right after ".include".
+ * @param symbol_table The symbol table of the source the symbols are added to, NULL for an included file.
+ * @param depth The nesting depth of the file that contains the line.
+ * @param scope The .include lines of the current process_macros call.
+ * @return Returns true if the file was included successfully, otherwise false.
+ */
+static bool process_include(line_info line, int line_index, table *symbol_table, int depth, struct include_scope *scope) {
+    char *path;
+    struct include_module *module;
+    bool is_valid;
+
+    if (depth >= MAX_INCLUDE_DEPTH) {
+        print_error(line, "Too many nested .include files (maximum is %d)", MAX_INCLUDE_DEPTH);
+        return FALSE;
+    }
+    path = extract_include_path(line, line_index);
+    if (path == NULL) {
+        return FALSE;
+    }
+    /* The nested .include lines are handled while the source that includes them holds the cache */
+    if (depth == 0) {
+        pthread_mutex_lock(&include_cache_lock);
+    }
+
+    /* The cached files live for the whole run, they are not allocations of the including file */
+    alloc_begin_run_scope();
+    module = load_include_module(path, depth + 1, scope);
+    alloc_end_run_scope();
+    if (module == NULL) {
+        print_error(line, "Can't open included file %s", path);
+        is_valid = FALSE;
+    }
+    /* The file is remembered with errors too, so a source can be assembled again once it is fixed */
+    else if (scope->parsed != NULL) {
+        is_valid = add_included_module(&scope->parsed->includes, &scope->parsed->include_count, module);
+        if (module->is_parsing) {
+            print_error(line, "Circular .include of %s", module->path);
+            is_valid = FALSE;
+        }
+        else if (!module->is_valid) {
+            print_error(line, "Included file %s has errors", module->path);
+            is_valid = FALSE;
+        }
+    }
+    else {
+        is_valid = add_included_module(&scope->roots, &scope->root_count, module);
+        is_valid &= merge_include_symbols(line, module, symbol_table, scope);
+    }
+    if (depth == 0) {
+        pthread_mutex_unlock(&include_cache_lock);
+    }
+    tracked_free(path);
+    return is_valid;
+}
+
+/**
+ * @brief Parses an included file into a symbol table.
+ * 
+ * An included file may only contain .define, .extern and .include lines, comments and empty lines.
+ * 
+ * @param path The path of the included file.
+ * @param symbols The symbol table the constants and external declarations of the file itself are added to.
+ * @param depth The nesting depth of the included file.
+ * @param scope The .include lines of the current process_macros call.
+ * @return Returns true if the file was parsed without errors, otherwise false.
+ */
+static bool parse_include_file(char *path, table *symbols, int depth, struct include_scope *scope) {
+    FILE *include_file_ptr;
+    char line_buffer[MAX_LINE_LENGTH + 2];
+    char symbol[MAX_LINE_LENGTH];
+    line_info current_line;
+    int line_index;
+    int symbol_index;
+    bool is_valid = TRUE;
+
+    include_file_ptr = fopen(path, "r");
+    if (include_file_ptr == NULL) {
+        return FALSE;
+    }
+    current_line.file_name = path;
+    current_line.content = line_buffer;
+    current_line.diagnostics = scope->diagnostics;
+    current_line.check_only = FALSE;
+
+    for (current_line.line_number = 1; fgets(line_buffer, MAX_LINE_LENGTH + 2, include_file_ptr) != NULL; current_line.line_number++) {
+        line_index = skip_spaces(line_buffer, 0);
+
+        /* Skip empty lines and comments */
+        if (!line_buffer[line_index] || line_buffer[line_index] == '\n' || line_buffer[line_index] == ';') {
+            continue;
+        }
+
+        if (strncmp(line_buffer + line_index, ".define", 7) == 0) {
+            is_valid &= check_mdefine(current_line, symbols, symbol);
+        }
+        else if (strncmp(line_buffer + line_index, ".extern", 7) == 0) {
+            /* Extract the external symbol */
+            line_index = skip_spaces(line_buffer, line_index + 7);
+            symbol_index = 0;
+            while (line_buffer[line_index] && line_buffer[line_index] != '\n' && line_buffer[line_index] != ' ' && line_buffer[line_index] != '\t') {
+                symbol[symbol_index++] = line_buffer[line_index++];
+            }
+            symbol[symbol_index] = '\0';
+            if (!check_label_name(symbol)) {
+                print_error(current_line, "Invalid external label name: %s", symbol);
+                is_valid = FALSE;
+                continue;
+            }
+            add_table_item(symbols, symbol, 0, EXTERNAL_SYMBOL);
+        }
+        else if (strncmp(line_buffer + line_index, ".include", 8) == 0) {
+            is_valid &= process_include(current_line, line_index + 8, NULL, depth, scope);
+        }
+        else {
+            print_error(current_line, "Only .define, .extern and .include lines are allowed in an included file");
+            is_valid = FALSE;
+        }
+    }
+
+    fclose(include_file_ptr);
+    return is_valid;
+}
+
+/**
+ * @brief Checks whether a cached file and the files it includes, directly or not, are unchanged since they were parsed.
+ * 
+ * @param module The cached file.
+ * @param check The number of the current check, a file it already visited is not checked again.
+ * @return Returns true if none of the files changed, otherwise false.
+ */
+static bool module_is_current(struct include_module *module, long check) {
+    struct stat file_stat;
+    int index;
+
+    if (module->checked == check) {
+        return TRUE;
+    }
+    module->checked = check;
+    if (stat(module->path, &file_stat) != 0 || module->modification_time != file_stat.st_mtime || module->size != file_stat.st_size) {
+        return FALSE;
+    }
+    for (index = 0; index < module->include_count; index++) {
+        if (!module_is_current(module->includes[index], check)) {
+            return FALSE;
+        }
+    }
+    return TRUE;
+}
+
+/**
+ * @brief Returns the parsed included file at the given path, parsing it if needed.
+ * 
+ * A cached file is reused as long as its modification time and size, and those of the
+ * files it includes, did not change. A file that is being parsed, included back by
+ * a file it includes, is returned as it is.
+ * 
+ * @param path The resolved path of the included file.
+ * @param depth The nesting depth of the included file.
+ * @param scope The .include lines of the current process_macros call.
+ * @return Returns the parsed file, or NULL if the file can't be accessed.
+ */
+static struct include_module *load_include_module(char *path, int depth, struct include_scope *scope) {
+    struct stat file_stat;
+    struct include_module *module;
+    struct include_module *parent;      /* The included file that includes this one, if any */
+
+    if (stat(path, &file_stat) != 0) {
+        return NULL;
+    }
+
+    /* Look for the file in the cache */
+    for (module = include_cache; module != NULL; module = module->next) {
+        if (strcmp(module->path, path) == 0) {
+            break;
+        }
+    }
+    if (module != NULL && (module->is_parsing || module_is_current(module, ++cache_checks))) {
+        return module;
+    }
+
+    if (module == NULL) {
+        /* First time the file is included */
+        module = (struct include_module *)tracked_malloc(INCLUDE_CACHE_SITE, sizeof(struct include_module));
+        if (module == NULL) {
+            printf("Memory allocation failed");
+            return NULL;
+        }
+        module->path = add_extension(path, "");
+        module->includes = NULL;
+        module->is_parsing = FALSE;
+        module->checked = 0;
+        module->next = include_cache;
+        include_cache = module;
+    }
+    else {
+        /* The file changed since it was parsed */
+        free_table(module->symbols);
+    }
+    module->symbols = NULL;
+    module->modification_time = file_stat.st_mtime;
+    module->size = file_stat.st_size;
+    tracked_free(module->includes);
+    module->includes = NULL;
+    module->include_count = 0;
+
+    /* Mark the file invalid while it is parsed, so a circular include fails */
+    module->is_valid = FALSE;
+    module->is_parsing = TRUE;
+    parent = scope->parsed;
+    scope->parsed = module;
+    module->is_valid = parse_include_file(path, &module->symbols, depth, scope);
+    scope->parsed = parent;
+    module->is_parsing = FALSE;
+    return module;
+}
+
+void forget_cached_include(char *path) {
+    struct include_module *module;
+    bool forgot = FALSE;        /* Whether the last scan forgot a file */
+    int index;
+
+    pthread_mutex_lock(&include_cache_lock);
+    for (module = include_cache; module != NULL; module = module->next) {
+        if (strcmp(module->path, path) == 0) {
+            module->modification_time = (time_t)-1;
+            forgot = TRUE;
+        }
+    }
+
+    /* The files that include a forgotten file hold its old symbols, forget them too */
+    while (forgot) {
+        forgot = FALSE;
+        for (module = include_cache; module != NULL; module = module->next) {
+            for (index = 0; module->modification_time != (time_t)-1 && index < module->include_count; index++) {
+                if (module->includes[index]->modification_time == (time_t)-1) {
+                    module->modification_time = (time_t)-1;
+                    forgot = TRUE;
+                }
+            }
+        }
+    }
+    pthread_mutex_unlock(&include_cache_lock);
+}
+
+void free_include_cache(void) {
+    struct include_module *module;
+
+    pthread_mutex_lock(&include_cache_lock);
+    while (include_cache != NULL) {
+        module = include_cache;
+        include_cache = include_cache->next;
+        free_table(module->symbols);
+        tracked_free(module->includes);
+        tracked_free(module->path);
+        tracked_free(module);
+    }
+    pthread_mutex_unlock(&include_cache_lock);
+}
+
+/**
+ * @brief Hashes the first word of a string, up to a space, a newline or the end of the string.
+ * 
+ * @param word The word to hash.
+ * @param length Pointer to an integer receiving the length of the word.
+ * @return The hash of the word.
+ */
+static unsigned long hash_macro_name(char *word, int *length) {
+    unsigned long hash = 5381;
+
+    for (*length = 0; word[*length] && word[*length] != ' ' && word[*length] != '\n'; (*length)++) {
+        hash = hash * 33 + (unsigned char)word[*length];
+    }
+    return hash;
+}
+
+/**
+ * @brief Appends a line to the body of a macro, doubling its capacity when needed.
+ * 
+ * @param macro The macro the line is added to.
+ * @param line The line to add.
+ * @return Returns true if the line was added, otherwise false.
+ */
+static bool append_macro_code(struct macro_info *macro, char *line) {
+    size_t line_length = strlen(line);
+    size_t new_capacity;
+    char *new_code;
+
+    if (macro->code_length + line_length + 1 > macro->code_capacity) {
+        new_capacity = macro->code_capacity ? macro->code_capacity : INITIAL_CODE_CAPACITY;
+        while (macro->code_length + line_length + 1 > new_capacity) {
+            new_capacity *= 2;
+        }
+        new_code = (char *)tracked_realloc(MACRO_TABLE_SITE, macro->macro_code, new_capacity);
+        if (new_code == NULL) {
+            printf("Memory allocation failed");
+            return FALSE;
+        }
+        macro->macro_code = new_code;
+        macro->code_capacity = new_capacity;
+    }
+    memcpy(macro->macro_code + macro->code_length, line, line_length + 1);
+    macro->code_length += line_length;
+    return TRUE;
+}
+
+/**
+ * @brief Adds an empty macro to a macro table, growing the table when needed.
+ * 
+ * @param table_of_macros The macro table.
+ * @return Returns the new macro, or NULL if the allocation failed.
+ */
+static struct macro_info *add_macro(struct macro_table *table_of_macros) {
+    struct macro_info *macros;
+    int new_capacity;
+
+    if (table_of_macros->count == table_of_macros->capacity) {
+        new_capacity = table_of_macros->capacity ? 2 * table_of_macros->capacity : INITIAL_MACROS_CAPACITY;
+        macros = (struct macro_info *)tracked_realloc(MACRO_TABLE_SITE, table_of_macros->macros, new_capacity * sizeof(struct macro_info));
+        if (macros == NULL) {
+            printf("Memory allocation failed");
+            return NULL;
+        }
+        table_of_macros->macros = macros;
+        table_of_macros->capacity = new_capacity;
+    }
+    macros = &table_of_macros->macros[table_of_macros->count++];
+    macros->macro_name[0] = '\0';
+    macros->macro_code = NULL;
+    macros->code_length = 0;
+    macros->code_capacity = 0;
+    macros->hash_next = -1;
+    return macros;
+}
+
+/**
+ * @brief Builds the hash table of the macro names, once all the macros are defined.
+ * 
+ * The first definition of a name is found first, like a search in the order of the definitions.
+ * 
+ * @param table_of_macros The macro table.
+ * @return Returns true if the hash table was built, otherwise false.
+ */
+static bool index_macros(struct macro_table *table_of_macros) {
+    int macro_index;
+    int bucket;
+    int name_length;
+
+    for (table_of_macros->bucket_count = 1; table_of_macros->bucket_count < 2 * table_of_macros->count; table_of_macros->bucket_count *= 2);
+    table_of_macros->buckets = (int *)tracked_malloc(MACRO_TABLE_SITE, table_of_macros->bucket_count * sizeof(int));
+    if (table_of_macros->buckets == NULL) {
+        printf("Memory allocation failed");
+        return FALSE;
+    }
+    for (bucket = 0; bucket < table_of_macros->bucket_count; bucket++) {
+        table_of_macros->buckets[bucket] = -1;
+    }
+
+    /* Add the macros from the last one, so the first definition heads its chain */
+    for (macro_index = table_of_macros->count - 1; macro_index >= 0; macro_index--) {
+        bucket = hash_macro_name(table_of_macros->macros[macro_index].macro_name, &name_length) & (table_of_macros->bucket_count - 1);
+        table_of_macros->macros[macro_index].hash_next = table_of_macros->buckets[bucket];
+        table_of_macros->buckets[bucket] = macro_index;
+    }
+    return TRUE;
+}
+
+/**
+ * @brief Frees the macros of a macro table.
+ * 
+ * @param table_of_macros The macro table.
+ */
+static void free_macros(struct macro_table *table_of_macros) {
+    int macro_index;
+
+    for (macro_index = 0; macro_index < table_of_macros->count; macro_index++) {
+        tracked_free(table_of_macros->macros[macro_index].macro_code);
+    }
+    tracked_free(table_of_macros->macros);
+    tracked_free(table_of_macros->buckets);
+}
+
 /**
  * @brief Extracts a macro definition from an input file and populates a struct with its information.
  * 
@@ -24,24 +579,30 @@ struct macro_info {
  * 
  * @param input_file Pointer to the input file stream.
  * @param line A struct containing the content of the line where the macro definition starts and its corresponding line number.
- * @param macros An array of struct macro_info where the extracted macro information will be stored.
- * @param index_of_macro The index of the macro_info array where the extracted macro information will be stored.
+ * @param macro The struct macro_info where the extracted macro information will be stored.
  * @param new_line_num Pointer to an integer storing the number of lines processed in the input file.
  * 
- * @return void
+ * @return Returns false if the memory for the macro body can't be allocated, otherwise true.
  */
-static void extract_macro(FILE *input_file, line_info line, struct macro_info *macros, int index_of_macro, int *new_line_num) {
+static bool extract_macro(FILE *input_file, line_info line, struct macro_info *macro, int *new_line_num) {
     char current_line[MAX_LINE_LENGTH];
     int line_index  = 0;
     int macro_index  = 0;
     bool code_copy_finished  = FALSE;
+
+    /* Start from an empty body, so a macro without lines expands to nothing */
+    if (!append_macro_code(macro, "")) {
+        return FALSE;
+    }
     
     /* Read lines from the input file until encountering "endmcr" marker */
     while (code_copy_finished  == FALSE && fgets(current_line, MAX_LINE_LENGTH, input_file)) {
         /* Check if the line contains "endmcr" marker */
         if (strstr(current_line, "endmcr") == NULL) {
-            /* Concatenate the line content to the macro's code */
-            strcat(macros[index_of_macro].macro_code, current_line);
+            /* Append the line content to the macro's code */
+            if (!append_macro_code(macro, current_line)) {
+                return FALSE;
+            }
             (*new_line_num)++;   /* Increment the line count */
         }
         else {
@@ -55,57 +616,54 @@ static void extract_macro(FILE *input_file, line_info line, struct macro_info *m
     line_index  = skip_spaces(line.content, line_index );
 
     /* Extract the macro name */
-    while (line.content[line_index ] && line.content[line_index ] != ' ' && line.content[line_index ] != '\n') {
-        macros[index_of_macro].macro_name[macro_index ] = line.content[line_index ];
+    while (line.content[line_index ] && line.content[line_index ] != ' ' && line.content[line_index ] != '\n' && macro_index < MAX_NAME_LENGTH - 1) {
+        macro->macro_name[macro_index ] = line.content[line_index ];
         line_index++;
         macro_index ++;
     }
-    macros[index_of_macro].macro_name[macro_index ] = '\0'; /* Null-terminate the macro name */
+    macro->macro_name[macro_index ] = '\0'; /* Null-terminate the macro name */
 
-    macros[index_of_macro].macro_line_number = line.line_number; /* Record the line number of macro definition */
+    macro->macro_line_number = line.line_number; /* Record the line number of macro definition */
+    return TRUE;
 }
 
 /**
  * @brief Skips lines corresponding to macro definitions in the input file.
  * 
- * This function checks if the current line number matches any macro definition's line number.
- * If a match is found, it reads subsequent lines until it encounters the "endmcr" marker
+ * This function checks if the current line number matches the line number of the next macro definition.
+ * If it does, it reads subsequent lines until it encounters the "endmcr" marker
  * or reaches the end of the file. This is done to skip macro definitions in the input file
  * since they are not directly copied to the output file.
  * 
  * @param input_file Pointer to the input file stream.
  * @param line A struct containing the content of the current line and its corresponding line number.
- * @param macros An array of struct macro_info containing information about defined macros.
- * @param number_of_macros The number of macros in the macros array.
+ * @param next_macro The next macro definition of the file, or NULL if all of them were skipped.
  * @param end_of_macro_line Pointer to an integer storing the line number where the macro definition ends.
  * @return Returns false if the current line marks the end of a macro definition, otherwise returns true.
  */
-static bool skip_macro_definitions(FILE *input_file, line_info line, struct macro_info *macros, int number_of_macros, int *end_of_macro_line) {
+static bool skip_macro_definitions(FILE *input_file, line_info line, struct macro_info *next_macro, int *end_of_macro_line) {
     char line_buffer[MAX_LINE_LENGTH];
     int line_index;
-    int remaining_macro_count = number_of_macros;
 
-    /* Iterate through the macros to find the one matching the current line number */
-    while (remaining_macro_count--){
-        
-        if (line.line_number == macros[remaining_macro_count].macro_line_number) {
-            line.content = line_buffer;
-            /* Read subsequent lines until the end of the current macro definition is found */
-            do {
-                /* Skip spaces and move to the next char in the line*/
-                line_index = 0;  
-                line_index = skip_spaces(line.content, line_index);
-                line.line_number++; /* Increment the line count */
-
-                /* Check if the line contains the "endmcr" marker */
-                if (strncmp(line.content + line_index, "endmcr", 6) == 0) {
-                    
-                    (*end_of_macro_line) = line.line_number;
-                    return FALSE;   /* Macro definition found, skip to the endmcr marker */
-                }  
-            }
-            while(fgets(line_buffer, MAX_LINE_LENGTH, input_file) != NULL); 
-        } 
+    /* The definitions are in the order of their lines, only the next one can start here */
+    if (next_macro != NULL && line.line_number == next_macro->macro_line_number) {
+        line_buffer[0] = '\0';    /* The definition line itself is not the end of the macro */
+        line.content = line_buffer;
+        /* Read subsequent lines until the end of the current macro definition is found */
+        do {
+            /* Skip spaces and move to the next char in the line*/
+            line_index = 0;  
+            line_index = skip_spaces(line.content, line_index);
+            line.line_number++; /* Increment the line count */
+
+            /* Check if the line contains the "endmcr" marker */
+            if (strncmp(line.content + line_index, "endmcr", 6) == 0) {
+                
+                (*end_of_macro_line) = line.line_number;
+                return FALSE;   /* Macro definition found, skip to the endmcr marker */
+            }  
+        }
+        while(fgets(line_buffer, MAX_LINE_LENGTH, input_file) != NULL); 
     }
     return TRUE;    /* Not a macro definition, continue processing */
 }
@@ -113,42 +671,34 @@ static bool skip_macro_definitions(FILE *input_file, line_info line, struct macr
 /**
  * @brief Checks if the current line contains a macro invocation and retrieves the corresponding macro index.
  * 
- * This function iterates through the list of defined macros and checks if the current line content matches
- * any macro's name. If a match is found, it stores the index of the matched macro in the index_of_macro pointer
+ * This function looks up the first word of the current line in the hash table of the macro names.
+ * If a macro has this name, it stores the index of the macro in the macro_index_output pointer
  * and returns true, indicating that the current line contains a macro invocation. Otherwise, it returns false.
  * 
  * @param line A struct containing the content of the current line.
- * @param macros An array of struct macro_info containing information about defined macros.
- * @param number_of_macros The number of macros in the macros array.
+ * @param table_of_macros The macros of the file, with their hash table.
  * @param macro_index_output Pointer to an integer storing the index of the matched macro.
  * 
  * @return Returns true if the current line contains a macro invocation, otherwise returns false.
  */
-static bool find_macro_index(line_info line, struct macro_info *macros, int number_of_macros, int *macro_index_output) {
+static bool find_macro_index(line_info line, struct macro_table *table_of_macros, int *macro_index_output) {
     int line_index;
     int matched_macro_index;
-    int macro_name_index = 0;
-    bool is_macro_match  = TRUE;
+    int word_length;
+    unsigned long hash;
     
-    /* Iterate through the macros array to find a matching macro */
-    for (matched_macro_index = 0; matched_macro_index < number_of_macros; matched_macro_index++) {
-        line_index = 0;
-        macro_name_index = 0;
-        line_index = skip_spaces(line.content, line_index);
-        is_macro_match  = TRUE;
-
-        /* Check if the content of the current line matches the macro name */
-        while (line.content[line_index] && line.content[line_index] != ' ' && line.content[line_index] != '\0' && line.content[line_index] != '\n') {
-            if (line.content[line_index] != macros[matched_macro_index].macro_name[macro_name_index]) {
-                is_macro_match  = FALSE;
-            }
-            line_index++;
-            macro_name_index++;
-            
-        }
+    line_index = skip_spaces(line.content, 0);
+    hash = hash_macro_name(line.content + line_index, &word_length);
+    if (word_length == 0) {
+        return FALSE;
+    }
 
-        /* If a matching macro is found, update the macro_index_output and return true */
-        if (is_macro_match ) {
+    /* Search the bucket of the word for a macro with the same name */
+    for (matched_macro_index = table_of_macros->buckets[hash & (table_of_macros->bucket_count - 1)];
+         matched_macro_index != -1;
+         matched_macro_index = table_of_macros->macros[matched_macro_index].hash_next) {
+        if (strncmp(line.content + line_index, table_of_macros->macros[matched_macro_index].macro_name, word_length) == 0 &&
+            table_of_macros->macros[matched_macro_index].macro_name[word_length] == '\0') {
             (*macro_index_output) = matched_macro_index;
             return TRUE;
         }
@@ -158,38 +708,86 @@ static bool find_macro_index(line_info line, struct macro_info *macros, int numb
     return FALSE;
 }
 
-bool process_macros(char *file_name, bool *has_macros) {
-    FILE *input_file_ptr;                   /* Pointer to input file */
-    FILE *output_file_ptr;                  /* Pointer to output file */
+/**
+ * @brief Adds an included file and the files it includes to the included files of a context, once each.
+ * 
+ * @param context The context of the source.
+ * @param module The included file.
+ * @return Returns true if the files were added, otherwise false.
+ */
+static bool keep_included_file(assembly_context *context, struct include_module *module) {
+    char **included_files;
+    int index;
+
+    for (index = 0; index < context->included_file_count; index++) {
+        if (strcmp(context->included_files[index], module->path) == 0) {
+            return TRUE;
+        }
+    }
+    included_files = (char **)tracked_realloc(FILE_NAME_SITE, context->included_files, (context->included_file_count + 1) * sizeof(char *));
+    if (included_files == NULL) {
+        printf("Memory allocation failed");
+        return FALSE;
+    }
+    context->included_files = included_files;
+    if ((context->included_files[context->included_file_count] = add_extension(module->path, "")) == NULL) {
+        return FALSE;
+    }
+    context->included_file_count++;
+    for (index = 0; index < module->include_count; index++) {
+        if (!keep_included_file(context, module->includes[index])) {
+            return FALSE;
+        }
+    }
+    return TRUE;
+}
+
+/**
+ * @brief Keeps the paths of the files a source included, directly or not, in its context, and frees its list of included files.
+ * 
+ * @param context The context of the source.
+ * @param scope The .include lines of the source.
+ */
+static void keep_included_files(assembly_context *context, struct include_scope *scope) {
+    int index;
+
+    if (scope->root_count == 0) {
+        return;
+    }
+    /* A file included by another source at the same time may be parsed again meanwhile */
+    pthread_mutex_lock(&include_cache_lock);
+    for (index = 0; index < scope->root_count && keep_included_file(context, scope->roots[index]); index++);
+    pthread_mutex_unlock(&include_cache_lock);
+    tracked_free(scope->roots);
+}
+
+/**
+ * @brief Reads the macro definitions and handles the .include lines of a source.
+ * 
+ * @param input_file_ptr The source, read from its current position.
+ * @param input_file_name The name of the source, used for the error messages and the included file names.
+ * @param table_of_macros The macro table the definitions are added to, indexed when the source was read.
+ * @param context The context of the source, the symbols of the included files are added to its symbol table.
+ * @return Returns true if the source was read without errors, otherwise false.
+ */
+static bool collect_macros(FILE *input_file_ptr, char *input_file_name, struct macro_table *table_of_macros, assembly_context *context) {
     line_info current_line;                 /* Information about the current line */
     int line_index = 0;                     /* Index of the current line */
-    char *input_file_name;                  /* Pointer to input file name */
-    char *outout_file_name;                 /* Pointer to output file name */
-    struct macro_info macros[MAX_MACROS];   /* Array to store macros */
+    struct macro_info *macro;               /* The macro being defined */
     char line_buffer[MAX_LINE_LENGTH];      /* Buffer for temporary line storage */
-    int total_macros;                       /* Total number of macros */
     int macro_end_line = 0;                 /* Line number where macro definition ends */
-    int matched_macro_index;                /* Index of the matched macro */
-
-    /* Add .as extension to input file name */
-    input_file_name = add_extension(file_name, ".as");
+    bool includes_valid = TRUE;             /* Whether all the included files were processed */
+    struct include_scope scope = {NULL, NULL, 0, 0, NULL, NULL, 0};   /* The included files of the source */
 
-    /* Open input file with error checking */
-    input_file_ptr = fopen(input_file_name, "r");
-    if (input_file_ptr == NULL){
-        printf("file can't be opend \n");
-        free(input_file_ptr);
-        return FALSE;
-    } 
-
-     
-    
+    current_line.file_name = input_file_name;
     current_line.content = line_buffer;
     current_line.line_number = 1;
-    total_macros = 0;
+    current_line.diagnostics = context->diagnostics;
+    current_line.check_only = FALSE;
+    scope.diagnostics = context->diagnostics;
 
     /* Read input file line by line */
-    while (fgets(line_buffer, MAX_LINE_LENGTH, input_file_ptr) != NULL) {
+    while (!diagnostic_limit_reached(context->diagnostics) && fgets(line_buffer, MAX_LINE_LENGTH, input_file_ptr) != NULL) {
         if (current_line.content[0] == '\n' || current_line.content[0] == '\0') {
             current_line.line_number++;
             continue;
@@ -198,68 +796,172 @@ bool process_macros(char *file_name, bool *has_macros) {
         line_index = 0;
         line_index = skip_spaces(current_line.content, line_index);
         
+        /* Check for include directive, the symbols of the file are added to the symbol table */
+        if (strncmp(current_line.content + line_index, ".include", 8) == 0) {
+            includes_valid &= process_include(current_line, line_index + 8, &context->symbol_table, 0, &scope);
+        }
+
         /* Check for macro definition */
         if (strncmp(current_line.content + line_index, "mcr ", 4) == 0) {
             macro_end_line = 0;
-            extract_macro(input_file_ptr, current_line, macros, total_macros, &macro_end_line);
+            macro = add_macro(table_of_macros);
+            if (macro == NULL || !extract_macro(input_file_ptr, current_line, macro, &macro_end_line)) {
+                keep_included_files(context, &scope);
+                tracked_free(scope.merged);
+                return FALSE;
+            }
             current_line.line_number += macro_end_line;
-            total_macros++; 
             current_line.line_number += 2;  /* Increment line number to skip macro definition */
             continue;
         }
         current_line.line_number++;
     }
+    keep_included_files(context, &scope);
+    tracked_free(scope.merged);
     
-    if (total_macros == 0){
-        (*has_macros) = FALSE;
-        return TRUE;
-    }
-    
-    (*has_macros) = TRUE;
-
-
+    return includes_valid && (table_of_macros->count == 0 || index_macros(table_of_macros));
+}
 
-    /* Add .txt extension to output file name */
-    outout_file_name = add_extension(file_name, ".am");
+/**
+ * @brief Records the origins of the lines written by a macro invocation, for --profile-lines.
+ *
+ * @param macro The invoked macro.
+ * @param invocation_line_number The line of the invocation.
+ */
+static void profile_macro_origins(struct macro_info *macro, int invocation_line_number) {
+    int body_line_number = macro->macro_line_number + 1;    /* The body starts after the mcr line */
+    size_t code_index;
 
-    /* Open output file with error checking */
-    output_file_ptr = fopen(outout_file_name, "w");
-    if (output_file_ptr == NULL){
-        printf("file can't be opend \n");
-        free(outout_file_name);
-        return FALSE;
+    for (code_index = 0; code_index < macro->code_length; code_index++) {
+        if (macro->macro_code[code_index] == '\n') {
+            profile_add_origin(invocation_line_number, macro->macro_name, body_line_number++);
+        }
     }
+}
+
+/**
+ * @brief Writes a source without its macro definitions, with the macro invocations replaced by their bodies.
+ * 
+ * @param input_file_ptr The source, read from its beginning.
+ * @param output_file_ptr The stream the expanded source is written to.
+ * @param table_of_macros The macros of the source, as read by collect_macros.
+ * @param diagnostics Where the errors of the source go, or NULL to print them.
+ */
+static void expand_macros(FILE *input_file_ptr, FILE *output_file_ptr, struct macro_table *table_of_macros, diagnostic_sink *diagnostics) {
+    line_info current_line;                 /* Information about the current line */
+    char line_buffer[MAX_LINE_LENGTH];      /* Buffer for temporary line storage */
+    int next_definition = 0;                /* Index of the next macro definition to skip */
+    int macro_end_line = 0;                 /* Line number where macro definition ends */
+    int matched_macro_index;                /* Index of the matched macro */
 
-    fseek(input_file_ptr, 0, SEEK_SET);
     current_line.content = line_buffer;
     current_line.line_number = 1;
+    current_line.diagnostics = diagnostics;
+    current_line.check_only = FALSE;
     
     /*  Read input file again to handle macro invocations */
     while (fgets(line_buffer, MAX_LINE_LENGTH, input_file_ptr) != NULL) {
         if (current_line.content[0] == '\n' || current_line.content[0] == '\0') {
+            profile_add_origin(current_line.line_number, NULL, 0);
             current_line.line_number++;
             fprintf(output_file_ptr, "\n");
             continue;
         }
 
         /* Skips lines corresponding to macro definitions */
-        if(!skip_macro_definitions(input_file_ptr, current_line, macros, total_macros, &macro_end_line)) {
+        if(!skip_macro_definitions(input_file_ptr, current_line, next_definition < table_of_macros->count ? &table_of_macros->macros[next_definition] : NULL, &macro_end_line)) {
             current_line.line_number = macro_end_line;
+            next_definition++;
             continue;
         }
 
         /* Check if the line contains a macro invocation and replace it with macro content */
-        if(find_macro_index(current_line, macros, total_macros, &matched_macro_index)) {
-            fprintf(output_file_ptr, "%s", macros[matched_macro_index].macro_code);
+        if(find_macro_index(current_line, table_of_macros, &matched_macro_index)) {
+            fwrite(table_of_macros->macros[matched_macro_index].macro_code, 1, table_of_macros->macros[matched_macro_index].code_length, output_file_ptr);
+            if (profile_lines_enabled) {
+                profile_macro_origins(&table_of_macros->macros[matched_macro_index], current_line.line_number);
+            }
             current_line.line_number++;
             continue;
         }
         
         /* Write unchanged line to output file */
         fprintf(output_file_ptr, "%s", current_line.content);
+        profile_add_origin(current_line.line_number, NULL, 0);
         current_line.line_number++;
     }
+}
+
+bool process_macros(assembly_context *context) {
+    FILE *input_file_ptr;                   /* Pointer to input file */
+    FILE *output_file_ptr;                  /* Pointer to output file */
+    char *input_file_name;                  /* Pointer to input file name */
+    char *outout_file_name;                 /* Pointer to output file name */
+    struct macro_table table_of_macros = {NULL, 0, 0, NULL, 0};   /* The macros of the file */
+
+    /* Add .as extension to input file name */
+    input_file_name = add_extension(context->file_name, ".as");
+
+    /* Open input file with error checking */
+    input_file_ptr = fopen(input_file_name, "r");
+    if (input_file_ptr == NULL){
+        printf("file can't be opend \n");
+        tracked_free(input_file_name);
+        return FALSE;
+    } 
+
+    if (!collect_macros(input_file_ptr, input_file_name, &table_of_macros, context)) {
+        free_macros(&table_of_macros);
+        fclose(input_file_ptr);
+        tracked_free(input_file_name);
+        return FALSE;
+    }
+
+    if (table_of_macros.count == 0){
+        context->has_macros = FALSE;
+        free_macros(&table_of_macros);
+        fclose(input_file_ptr);
+        tracked_free(input_file_name);
+        return TRUE;
+    }
+    
+    context->has_macros = TRUE;
+
+    /* Add .txt extension to output file name */
+    outout_file_name = add_extension(context->output_name, ".am");
+
+    /* Open output file with error checking */
+    output_file_ptr = fopen(outout_file_name, "w");
+    if (output_file_ptr == NULL){
+        printf("file can't be opend \n");
+        free_macros(&table_of_macros);
+        fclose(input_file_ptr);
+        tracked_free(input_file_name);
+        tracked_free(outout_file_name);
+        return FALSE;
+    }
+
+    fseek(input_file_ptr, 0, SEEK_SET);
+    expand_macros(input_file_ptr, output_file_ptr, &table_of_macros, context->diagnostics);
 
     fclose(output_file_ptr);
+    fclose(input_file_ptr);
+    free_macros(&table_of_macros);
+    tracked_free(outout_file_name);
+    tracked_free(input_file_name);
     return TRUE;
 }
+
+bool process_macros_stream(assembly_context *context, FILE *input_file_ptr, char *input_file_name, FILE *output_file_ptr) {
+    struct macro_table table_of_macros = {NULL, 0, 0, NULL, 0};   /* The macros of the source */
+    bool success;
+
+    success = collect_macros(input_file_ptr, input_file_name, &table_of_macros, context);
+    context->has_macros = table_of_macros.count > 0;
+    if (success && context->has_macros) {
+        fseek(input_file_ptr, 0, SEEK_SET);
+        expand_macros(input_file_ptr, output_file_ptr, &table_of_macros, context->diagnostics);
+    }
+    free_macros(&table_of_macros);
+    return success;
+}
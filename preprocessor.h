@@ -1,5 +1,8 @@
 #ifndef _PREPROCESSOR_H
 #define _PREPROCESSOR_H
+#include "global_variables.h"
+#include "data_tables.h"
+#include "assembler.h"
 
 /**
  * @brief Handles macro processing for a given input file.
@@ -7,10 +10,47 @@
  * This function reads the contents of the input file, identifies macro definitions,
  * extracts their contents, and writes them into a separate output file. Macro invocations
  * are replaced with the corresponding macro content in the output file.
+ * The .define constants and .extern declarations of files included with .include
+ * are added to the symbol table. Included files are parsed once and cached for
+ * the rest of the run, as long as they are not modified. The cache is shared by
+ * the sources processed at the same time, the macros are kept by each call.
  * 
- * @param file_name Pointer to a string containing the name of the input file.
- * @param has_macros Boolean flag indicating whether macros are present
+ * @param context The context of the input file, its symbol table gets the symbols of the included
+ *                files and has_macros is set to whether macros are present.
  */
-bool process_macros(char *file_name, bool *has_macros);
+bool process_macros(assembly_context *context);
+
+/**
+ * @brief Handles macro processing for a source that is already open.
+ * 
+ * Like process_macros, but the source is read from a stream, and the expanded source is
+ * written to the given stream only if the source has macros. The input stream must support
+ * seeking back to its beginning.
+ * 
+ * @param context The context of the source, like for process_macros.
+ * @param input_file_ptr The source, read from its beginning.
+ * @param input_file_name The name of the source, used for the error messages and the included file names.
+ * @param output_file_ptr The stream the expanded source is written to.
+ * @return Returns true if the source was processed without errors, otherwise false.
+ */
+bool process_macros_stream(assembly_context *context, FILE *input_file_ptr, char *input_file_name, FILE *output_file_ptr);
+
+/**
+ * @brief Makes the next source that includes a file parse it again.
+ * 
+ * A cached file is reused while its modification time and size don't change, a file
+ * rewritten within the same second with the same size is only noticed through this call.
+ * The cached files that include it, directly or not, are parsed again too.
+ * 
+ * @param path The resolved path of the included file.
+ */
+void forget_cached_include(char *path);
+
+/**
+ * @brief Frees the cache of included files.
+ * 
+ * This function is called once all the input files were processed.
+ */
+void free_include_cache(void);
 
 #endif
\ No newline at end of file
@@ -0,0 +1,289 @@
+#define _POSIX_C_SOURCE 199309L /* clock_gettime */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "statistics.h"
+
+/* Names of the phases in the report, in the order of the assembly_phase enum */
+static char *phase_names[PHASE_COUNT] = {
+    "process_macros",
+    "first_pass",
+    "second_pass",
+    "write_output_files"
+};
+
+/* Statistics recorded for a file that was assembled */
+struct file_stats {
+    char *file_name;        /* The name of the file */
+    bool succeeded;         /* Whether the file was assembled successfully */
+    assembly_stats stats;   /* Counters and timings of the file */
+};
+
+bool stats_enabled = FALSE;
+assembly_stats current_stats;
+
+static struct file_stats *recorded_files = NULL;    /* Statistics of the files assembled so far */
+static long recorded_count = 0;                     /* Number of recorded files */
+static long recorded_capacity = 0;                  /* Allocated length of recorded_files */
+
+bool summary_enabled = FALSE;
+
+static double *file_seconds = NULL;                 /* Wall time of each file handled, for the summary */
+static long summary_file_count = 0;                 /* Number of files handled */
+static long summary_capacity = 0;                   /* Allocated length of file_seconds */
+static long summary_succeeded_count = 0;            /* Number of files that succeeded */
+static long summary_lines = 0;                      /* Source lines of the files handled */
+
+static double phase_start_wall;     /* Wall clock when the current phase started */
+static double phase_start_cpu;      /* CPU clock when the current phase started */
+
+/**
+ * @brief Reads a clock in seconds.
+ *
+ * @param clock_id The clock to read.
+ * @return The time of the clock in seconds.
+ */
+static double read_clock(clockid_t clock_id) {
+    struct timespec now;
+
+    clock_gettime(clock_id, &now);
+    return now.tv_sec + now.tv_nsec / 1e9;
+}
+
+/* Resets the statistics of the file being assembled */
+void stats_begin_file(void) {
+    memset(&current_stats, 0, sizeof(current_stats));
+}
+
+/* Starts measuring a phase of the file being assembled */
+void stats_begin_phase(assembly_phase phase) {
+    if (!stats_enabled) {
+        return;
+    }
+    phase_start_wall = read_clock(CLOCK_MONOTONIC);
+    phase_start_cpu = read_clock(CLOCK_PROCESS_CPUTIME_ID);
+}
+
+/* Stops measuring a phase and adds its wall and CPU time to the file statistics */
+void stats_end_phase(assembly_phase phase) {
+    if (!stats_enabled) {
+        return;
+    }
+    current_stats.wall_seconds[phase] += read_clock(CLOCK_MONOTONIC) - phase_start_wall;
+    current_stats.cpu_seconds[phase] += read_clock(CLOCK_PROCESS_CPUTIME_ID) - phase_start_cpu;
+}
+
+/* Records the statistics of the file that was assembled */
+void stats_end_file(char *file_name, bool succeeded) {
+    struct file_stats *record;
+
+    if (!stats_enabled) {
+        return;
+    }
+
+    /* Grow the records array when it is full */
+    if (recorded_count == recorded_capacity) {
+        long new_capacity = recorded_capacity ? recorded_capacity * 2 : 16;
+        struct file_stats *new_files = realloc(recorded_files, new_capacity * sizeof(struct file_stats));
+        if (new_files == NULL) {
+            printf("Memory allocation failed");
+            return;
+        }
+        recorded_files = new_files;
+        recorded_capacity = new_capacity;
+    }
+
+    record = &recorded_files[recorded_count];
+    record->file_name = malloc(strlen(file_name) + 1);
+    if (record->file_name == NULL) {
+        printf("Memory allocation failed");
+        return;
+    }
+    strcpy(record->file_name, file_name);
+    record->succeeded = succeeded;
+    record->stats = current_stats;
+    recorded_count++;
+}
+
+/**
+ * @brief Writes a string as a JSON string literal.
+ *
+ * @param output The stream the string is written to.
+ * @param string The string to write.
+ */
+static void print_json_string(FILE *output, char *string) {
+    fputc('"', output);
+    for (; *string; string++) {
+        if (*string == '"' || *string == '\\') {
+            fprintf(output, "\\%c", *string);
+        }
+        else if ((unsigned char)*string < 0x20) {
+            fprintf(output, "\\u%04x", *string);
+        }
+        else {
+            fputc(*string, output);
+        }
+    }
+    fputc('"', output);
+}
+
+/**
+ * @brief Writes the counters and phase timings of a statistics block as JSON members.
+ *
+ * @param output The stream the members are written to.
+ * @param stats The statistics to write.
+ * @param indent The indentation of the members.
+ */
+static void print_stats_members(FILE *output, assembly_stats *stats, char *indent) {
+    int phase;
+    double total_wall = 0;
+    double total_cpu = 0;
+
+    for (phase = 0; phase < PHASE_COUNT; phase++) {
+        total_wall += stats->wall_seconds[phase];
+        total_cpu += stats->cpu_seconds[phase];
+    }
+
+    fprintf(output, "%s\"wall_seconds\": %.9f,\n", indent, total_wall);
+    fprintf(output, "%s\"cpu_seconds\": %.9f,\n", indent, total_cpu);
+    fprintf(output, "%s\"lines\": %ld,\n", indent, stats->lines);
+    fprintf(output, "%s\"lines_per_second\": %.1f,\n", indent, total_wall > 0 ? stats->lines / total_wall : 0.0);
+    fprintf(output, "%s\"words_emitted\": %ld,\n", indent, stats->words_emitted);
+    fprintf(output, "%s\"symbols\": %ld,\n", indent, stats->symbols);
+    fprintf(output, "%s\"find_by_types_calls\": %ld,\n", indent, stats->find_calls);
+    fprintf(output, "%s\"find_by_types_entries_scanned\": %ld,\n", indent, stats->entries_scanned);
+    fprintf(output, "%s\"add_table_item_entries_scanned\": %ld,\n", indent, stats->insert_steps);
+    fprintf(output, "%s\"malloc_calls\": %ld,\n", indent, stats->malloc_calls);
+    fprintf(output, "%s\"phases\": {", indent);
+    for (phase = 0; phase < PHASE_COUNT; phase++) {
+        fprintf(output, "%s\n%s  \"%s\": {\"wall_seconds\": %.9f, \"cpu_seconds\": %.9f}", phase ? "," : "",
+                indent, phase_names[phase], stats->wall_seconds[phase], stats->cpu_seconds[phase]);
+    }
+    fprintf(output, "\n%s}\n", indent);
+}
+
+/* Writes the statistics of every file and their aggregate as a JSON document */
+void stats_print_report(FILE *output) {
+    assembly_stats total;
+    long index;
+    long succeeded_count = 0;
+    int phase;
+
+    memset(&total, 0, sizeof(total));
+    fprintf(output, "{\n  \"files\": [");
+    for (index = 0; index < recorded_count; index++) {
+        assembly_stats *stats = &recorded_files[index].stats;
+
+        fprintf(output, "%s\n    {\n      \"file\": ", index ? "," : "");
+        print_json_string(output, recorded_files[index].file_name);
+        fprintf(output, ",\n      \"succeeded\": %s,\n", recorded_files[index].succeeded ? "true" : "false");
+        print_stats_members(output, stats, "      ");
+        fprintf(output, "    }");
+
+        /* Accumulate the aggregate statistics */
+        succeeded_count += recorded_files[index].succeeded;
+        for (phase = 0; phase < PHASE_COUNT; phase++) {
+            total.wall_seconds[phase] += stats->wall_seconds[phase];
+            total.cpu_seconds[phase] += stats->cpu_seconds[phase];
+        }
+        total.lines += stats->lines;
+        total.words_emitted += stats->words_emitted;
+        total.symbols += stats->symbols;
+        total.find_calls += stats->find_calls;
+        total.entries_scanned += stats->entries_scanned;
+        total.insert_steps += stats->insert_steps;
+        total.malloc_calls += stats->malloc_calls;
+    }
+    fprintf(output, "\n  ],\n  \"total\": {\n");
+    fprintf(output, "    \"files\": %ld,\n    \"succeeded\": %ld,\n", recorded_count, succeeded_count);
+    print_stats_members(output, &total, "    ");
+    fprintf(output, "  }\n}\n");
+}
+
+/* Frees the recorded statistics */
+void free_stats(void) {
+    long index;
+
+    for (index = 0; index < recorded_count; index++) {
+        free(recorded_files[index].file_name);
+    }
+    free(recorded_files);
+    recorded_files = NULL;
+    recorded_count = 0;
+    recorded_capacity = 0;
+}
+
+/* Reads the monotonic wall clock */
+double wall_clock_seconds(void) {
+    return read_clock(CLOCK_MONOTONIC);
+}
+
+/* Records a file that was handled, for the summary of the run */
+void summary_record_file(bool succeeded, long lines, double seconds) {
+    double *new_seconds;
+
+    if (!summary_enabled) {
+        return;
+    }
+    if (summary_file_count == summary_capacity) {
+        new_seconds = (double *)realloc(file_seconds, (summary_capacity * 2 + 1024) * sizeof(double));
+        if (new_seconds == NULL) {
+            printf("Memory allocation failed");
+            return;
+        }
+        file_seconds = new_seconds;
+        summary_capacity = summary_capacity * 2 + 1024;
+    }
+    file_seconds[summary_file_count++] = seconds;
+    summary_succeeded_count += succeeded;
+    summary_lines += lines;
+}
+
+/**
+ * @brief Compares two durations, for qsort.
+ *
+ * @param first The first duration.
+ * @param second The second duration.
+ * @return Returns a negative number, zero or a positive number if the first duration is shorter, equal or longer.
+ */
+static int compare_seconds(const void *first, const void *second) {
+    double difference = *(const double *)first - *(const double *)second;
+
+    return (difference > 0) - (difference < 0);
+}
+
+/**
+ * @brief Finds a percentile of sorted durations, by the nearest rank.
+ *
+ * @param percent The percentile, from 1 to 100.
+ * @return The duration, 0 without durations.
+ */
+static double seconds_percentile(int percent) {
+    long rank = (summary_file_count * percent + 99) / 100;
+
+    return rank > 0 ? file_seconds[rank - 1] : 0;
+}
+
+/* Writes the summary of the run */
+void summary_print(FILE *output, double wall_seconds) {
+    if (!summary_enabled) {
+        return;
+    }
+    if (summary_file_count > 0) {
+        qsort(file_seconds, summary_file_count, sizeof(double), compare_seconds);
+    }
+    fprintf(output, "Summary: %ld files ok, %ld failed, %ld lines, %.3f s wall, per file p50 %.3f ms, p99 %.3f ms\n",
+            summary_succeeded_count, summary_file_count - summary_succeeded_count, summary_lines, wall_seconds,
+            seconds_percentile(50) * 1e3, seconds_percentile(99) * 1e3);
+}
+
+/* Frees the files recorded for the summary */
+void free_summary(void) {
+    free(file_seconds);
+    file_seconds = NULL;
+    summary_file_count = 0;
+    summary_capacity = 0;
+    summary_succeeded_count = 0;
+    summary_lines = 0;
+}
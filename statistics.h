@@ -0,0 +1,119 @@
+#ifndef _STATISTICS_H
+#define _STATISTICS_H
+#include <stdio.h>
+#include <stddef.h>
+#include "global_variables.h"
+
+/* Phases of the assembly of a single file */
+typedef enum assembly_phase {
+    MACROS_PHASE,       /* process_macros */
+    FIRST_PASS_PHASE,   /* First pass over the source lines */
+    SECOND_PASS_PHASE,  /* Second pass over the source lines */
+    WRITE_PHASE,        /* write_output_files */
+    PHASE_COUNT         /* Number of phases */
+} assembly_phase;
+
+/* Counters and timings collected while assembling files */
+typedef struct assembly_stats {
+    double wall_seconds[PHASE_COUNT];   /* Wall time of each phase */
+    double cpu_seconds[PHASE_COUNT];    /* CPU time of each phase */
+    long lines;                         /* Source lines read by the first pass */
+    long words_emitted;                 /* Code and data words of the object file */
+    long symbols;                       /* Entries of the symbol table at the end of the file */
+    long find_calls;                    /* Calls to find_by_types */
+    long entries_scanned;               /* Table entries visited by find_by_types */
+    long insert_steps;                  /* Table entries visited by add_table_item */
+    long malloc_calls;                  /* Heap allocations */
+} assembly_stats;
+
+/* Whether statistics are collected, set by --stats and by --profile-lines */
+extern bool stats_enabled;
+
+/* Statistics of the file being assembled */
+extern assembly_stats current_stats;
+
+/* Whether the summary of the run is collected, set by --manifest */
+extern bool summary_enabled;
+
+/**
+ * @brief Adds an amount to a counter of the file being assembled.
+ *
+ * The amount is only evaluated when statistics are enabled, and the whole
+ * statement compiles out when the assembler is built with -DNO_STATS.
+ */
+#ifdef NO_STATS
+#define STATS_ADD(counter, amount) ((void)0)
+#else
+#define STATS_ADD(counter, amount) ((void)(stats_enabled && (current_stats.counter += (amount))))
+#endif
+
+/**
+ * @brief Resets the statistics of the file being assembled.
+ */
+void stats_begin_file(void);
+
+/**
+ * @brief Starts measuring a phase of the file being assembled.
+ *
+ * @param phase The phase that starts.
+ */
+void stats_begin_phase(assembly_phase phase);
+
+/**
+ * @brief Stops measuring a phase and adds its wall and CPU time to the file statistics.
+ *
+ * @param phase The phase that ends.
+ */
+void stats_end_phase(assembly_phase phase);
+
+/**
+ * @brief Records the statistics of the file that was assembled.
+ *
+ * @param file_name The name of the file.
+ * @param succeeded Whether the file was assembled successfully.
+ */
+void stats_end_file(char *file_name, bool succeeded);
+
+/**
+ * @brief Writes the statistics of every file and their aggregate as a JSON document.
+ *
+ * @param output The stream the report is written to.
+ */
+void stats_print_report(FILE *output);
+
+/**
+ * @brief Frees the recorded statistics.
+ */
+void free_stats(void);
+
+/**
+ * @brief Reads the monotonic wall clock.
+ *
+ * @return The time of the clock in seconds.
+ */
+double wall_clock_seconds(void);
+
+/**
+ * @brief Records a file that was handled, for the summary of the run.
+ *
+ * @param succeeded Whether the file was assembled successfully.
+ * @param lines The source lines read by its first pass.
+ * @param seconds The wall time from when the file started being handled to when it was done.
+ */
+void summary_record_file(bool succeeded, long lines, double seconds);
+
+/**
+ * @brief Writes the summary of the run: the files that succeeded and failed, their source lines,
+ * the wall time of the run and the median and 99th percentile of the wall time of a file.
+ *
+ * @param output The stream the summary is written to.
+ * @param wall_seconds The wall time of the run.
+ */
+void summary_print(FILE *output, double wall_seconds);
+
+/**
+ * @brief Frees the files recorded for the summary.
+ */
+void free_summary(void);
+
+#endif
@@ -0,0 +1,136 @@
+#define _DEFAULT_SOURCE /* clock_gettime and syscall(SYS_gettid) */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include "trace.h"
+
+/* A complete ("X") trace event */
+struct trace_event {
+    char *name;             /* Name of the span */
+    char *file_name;        /* File the span belongs to, or NULL */
+    double start_time;      /* Start of the span, in microseconds */
+    double duration;        /* Duration of the span, in microseconds */
+    long thread_id;         /* Thread that recorded the span */
+};
+
+bool trace_enabled = FALSE;
+
+static struct trace_event *trace_buffer = NULL;    /* Preallocated ring buffer of events */
+static unsigned long trace_next_event = 0;          /* Number of events recorded so far */
+static char *trace_output_file_name = NULL;         /* The JSON file the events are written to */
+static long trace_process_id;                       /* Process id of the events */
+
+/* Starts tracing into a preallocated ring buffer */
+bool trace_open(char *output_file_name) {
+    trace_buffer = (struct trace_event *)malloc(TRACE_BUFFER_EVENTS * sizeof(struct trace_event));
+    if (trace_buffer == NULL) {
+        printf("Memory allocation failed");
+        return FALSE;
+    }
+
+    /* Touch the whole buffer now, so page faults don't show up in the measured spans */
+    memset(trace_buffer, 0, TRACE_BUFFER_EVENTS * sizeof(struct trace_event));
+    trace_output_file_name = output_file_name;
+    trace_process_id = getpid();
+    trace_next_event = 0;
+    trace_enabled = TRUE;
+    return TRUE;
+}
+
+/* Returns the start time of a span */
+double trace_now(void) {
+    struct timespec now;
+
+    if (!trace_enabled) {
+        return 0;
+    }
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec * 1e6 + now.tv_nsec / 1e3;
+}
+
+/* Records a span that started at the given time and ends now */
+void trace_span(char *name, char *file_name, double start_time) {
+    struct trace_event *event;
+    double end_time;
+
+    if (!trace_enabled) {
+        return;
+    }
+    end_time = trace_now();
+
+    /* Claim a slot atomically, so workers may record concurrently */
+    event = &trace_buffer[__sync_fetch_and_add(&trace_next_event, 1) % TRACE_BUFFER_EVENTS];
+    event->name = name;
+    event->file_name = file_name;
+    event->start_time = start_time;
+    event->duration = end_time - start_time;
+    event->thread_id = syscall(SYS_gettid);
+}
+
+/**
+ * @brief Writes a string as a JSON string literal.
+ *
+ * @param output The stream the string is written to.
+ * @param string The string to write.
+ */
+static void write_json_string(FILE *output, char *string) {
+    fputc('"', output);
+    for (; *string; string++) {
+        if (*string == '"' || *string == '\\') {
+            fprintf(output, "\\%c", *string);
+        }
+        else if ((unsigned char)*string < 0x20) {
+            fprintf(output, "\\u%04x", *string);
+        }
+        else {
+            fputc(*string, output);
+        }
+    }
+    fputc('"', output);
+}
+
+/* Writes the recorded events to the output file and frees the buffer */
+bool trace_write(void) {
+    FILE *output;
+    unsigned long first_event;  /* Oldest event still in the ring buffer */
+    unsigned long index;
+    struct trace_event *event;
+
+    if (!trace_enabled) {
+        return TRUE;
+    }
+    trace_enabled = FALSE;
+
+    output = fopen(trace_output_file_name, "w");
+    if (output == NULL) {
+        printf("Can't create or rewrite to file %s.", trace_output_file_name);
+        free(trace_buffer);
+        trace_buffer = NULL;
+        return FALSE;
+    }
+
+    first_event = trace_next_event > TRACE_BUFFER_EVENTS ? trace_next_event - TRACE_BUFFER_EVENTS : 0;
+    fprintf(output, "{\"traceEvents\": [");
+    for (index = first_event; index < trace_next_event; index++) {
+        event = &trace_buffer[index % TRACE_BUFFER_EVENTS];
+        fprintf(output, "%s\n  {\"name\": ", index == first_event ? "" : ",");
+        write_json_string(output, event->name);
+        fprintf(output, ", \"cat\": \"assembler\", \"ph\": \"X\", \"ts\": %.3f, \"dur\": %.3f, \"pid\": %ld, \"tid\": %ld",
+                event->start_time, event->duration, trace_process_id, event->thread_id);
+        if (event->file_name != NULL) {
+            fprintf(output, ", \"args\": {\"file\": ");
+            write_json_string(output, event->file_name);
+            fputc('}', output);
+        }
+        fputc('}', output);
+    }
+    fprintf(output, "\n], \"displayTimeUnit\": \"ms\", \"otherData\": {\"dropped_events\": %lu}}\n", first_event);
+
+    fclose(output);
+    free(trace_buffer);
+    trace_buffer = NULL;
+    return TRUE;
+}
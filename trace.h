@@ -0,0 +1,47 @@
+#ifndef _TRACE_H
+#define _TRACE_H
+#include "global_variables.h"
+
+/* Number of events kept by the trace buffer, older events are overwritten */
+#define TRACE_BUFFER_EVENTS 65536
+
+/* Whether --trace was given, events are only recorded when it is set */
+extern bool trace_enabled;
+
+/**
+ * @brief Starts tracing into a preallocated ring buffer.
+ *
+ * The events are kept in memory and written as Chrome/Perfetto trace events by trace_write.
+ *
+ * @param output_file_name The name of the JSON file the events are written to.
+ * @return Returns true if the buffer was allocated, otherwise false.
+ */
+bool trace_open(char *output_file_name);
+
+/**
+ * @brief Returns the start time of a span.
+ *
+ * @return The current time in microseconds, or 0 if tracing is disabled.
+ */
+double trace_now(void);
+
+/**
+ * @brief Records a span that started at the given time and ends now.
+ *
+ * The name and file name are not copied, they must stay valid until trace_write is called.
+ * Spans of the same thread nest by their times, so a span must end before its parent does.
+ *
+ * @param name The name of the span.
+ * @param file_name The file the span belongs to, or NULL.
+ * @param start_time The start time returned by trace_now.
+ */
+void trace_span(char *name, char *file_name, double start_time);
+
+/**
+ * @brief Writes the recorded events to the output file and frees the buffer.
+ *
+ * @return Returns true if the file was written, otherwise false.
+ */
+bool trace_write(void);
+
+#endif
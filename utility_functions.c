@@ -1,3 +1,4 @@
+#define _POSIX_C_SOURCE 200809L /* vsnprintf and open_memstream */
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
@@ -6,9 +7,22 @@
 #include "utility_functions.h"
 #include "code_functions.h"
 #include "data_tables.h"
+#include "alloc_tracking.h"
 
 #define ERR_OUTPUT_FILE stderr
 
+/* Errors a sink records before it first grows */
+#define INITIAL_DIAGNOSTICS_CAPACITY 16
+
+/* Bits of the code of an error, 5 hex digits */
+#define DIAGNOSTIC_CODE_MASK 0xFFFFFUL
+
+diagnostics_output diagnostics_format = TEXT_DIAGNOSTICS;
+long max_errors_per_file = 0;
+
+/* The words of checked lines by length, they have no code or data word */
+static machine_word checked_words[MAX_INSTRUCTION_WORDS + 1] = {{0, {NULL}}, {1, {NULL}}, {2, {NULL}}, {3, {NULL}}, {4, {NULL}}, {5, {NULL}}};
+
 /* Define instruction lookup item structure */
 struct instruction_lookup_item {
 	char *name;
@@ -21,6 +35,10 @@ static struct instruction_lookup_item instructions_lookup_table[] = {
 		{"data",   DATA_INST},
 		{"entry",  ENTRY_INST},
 		{"extern", EXTERN_INST},
+		{"incbin", INCBIN_INST},
+		{"fill",   FILL_INST},
+		{"space",  SPACE_INST},
+		{"include", INCLUDE_INST},
 		{NULL, NONE_INST}
 };
 
@@ -31,7 +49,7 @@ char* add_extension(char *original_file_name, char *extension ){
     size_t new_length = strlen(original_file_name) + strlen(extension) + 1;
 
     /* Allocate memory for the new string */
-    char *new_file_name = (char*)malloc(new_length * sizeof(char));
+    char *new_file_name = (char*)tracked_malloc(FILE_NAME_SITE, new_length * sizeof(char));
 
     /*  Check if memory allocation was successful */
     if(new_file_name  == NULL){
@@ -49,6 +67,30 @@ char* add_extension(char *original_file_name, char *extension ){
     return new_file_name;
 }
 
+/* Resolves a file name relative to the directory of another file */
+char* resolve_relative_path(char *base_file_name, char *file_name){
+    char *last_slash = strrchr(base_file_name, '/');   /* End of the directory part of the base file name */
+    size_t directory_length = 0;                        /* Length of the directory part, including the slash */
+    char *resolved_name;
+
+    /* Keep the directory part only for relative file names */
+    if (last_slash != NULL && file_name[0] != '/') {
+        directory_length = last_slash - base_file_name + 1;
+    }
+
+    /* Allocate memory for the directory part, the file name and the null terminator */
+    resolved_name = (char*)tracked_malloc(FILE_NAME_SITE, (directory_length + strlen(file_name) + 1) * sizeof(char));
+    if (resolved_name == NULL) {
+        printf("Memory allocation failed.");
+        return NULL;
+    }
+
+    /* Copy the directory part and append the file name */
+    strncpy(resolved_name, base_file_name, directory_length);
+    strcpy(resolved_name + directory_length, file_name);
+    return resolved_name;
+}
+
 /* Skips whitespace characters in a string starting from the given index */
 int skip_spaces(char *string, int index){
     /* Iterate through the string starting from the given index */
@@ -205,21 +247,341 @@ instruction find_instruction_by_name(char *name) {
 	return NONE_INST;
 }
 
+/**
+ * @brief Copies a string to memory allocated for a recorded error.
+ *
+ * @param string The string.
+ * @return The copy, or NULL if memory allocation failed.
+ */
+static char *copy_diagnostic_string(char *string) {
+    char *copy = (char *)malloc(strlen(string) + 1);
+
+    if (copy != NULL) {
+        strcpy(copy, string);
+    }
+    return copy;
+}
+
+/**
+ * @brief Finds the code of a message, the same for every error printed with it whatever its arguments.
+ *
+ * @param message The message, before its arguments are formatted into it.
+ * @return The code.
+ */
+static unsigned long diagnostic_code(char *message) {
+    unsigned long hash = 5381;
+
+    while (*message != '\0') {
+        hash = hash * 33 + (unsigned char)*message++;
+    }
+    return hash & DIAGNOSTIC_CODE_MASK;
+}
+
+/**
+ * @brief Finds the column of an error: where the token it names is on its line, or where the statement starts.
+ *
+ * @param content The line.
+ * @param token The token the message names, or NULL.
+ * @return The column, from 1, or 0 if the line isn't known.
+ */
+static long diagnostic_column(char *content, char *token) {
+    char *found = NULL;
+
+    if (content == NULL) {
+        return 0;
+    }
+    if (token != NULL && token[0] != '\0') {
+        found = strstr(content, token);
+    }
+    return found != NULL ? (long)(found - content) + 1 : (long)strspn(content, " \t") + 1;
+}
+
+/**
+ * @brief Adds an error to the records of an open sink, unless the sink is full.
+ *
+ * @param sink The sink.
+ * @param error The error, its file name is copied and its message is owned by the sink from now on.
+ */
+static void record_diagnostic(diagnostic_sink *sink, diagnostic *error) {
+    diagnostic *records;
+    char *file_name_copy;
+
+    if (diagnostic_limit_reached(sink)) {
+        free(error->message);
+        return;
+    }
+    file_name_copy = error->file_name != NULL ? copy_diagnostic_string(error->file_name) : NULL;
+    if (sink->count == sink->capacity) {
+        records = (diagnostic *)realloc(sink->records, (sink->capacity > 0 ? sink->capacity * 2 : INITIAL_DIAGNOSTICS_CAPACITY) * sizeof(diagnostic));
+        if (records == NULL) {
+            printf("Memory allocation failed");
+            free(file_name_copy);
+            free(error->message);
+            return;
+        }
+        sink->records = records;
+        sink->capacity = sink->capacity > 0 ? sink->capacity * 2 : INITIAL_DIAGNOSTICS_CAPACITY;
+    }
+    sink->records[sink->count] = *error;
+    sink->records[sink->count].file_name = file_name_copy;
+    sink->count++;
+}
+
+/**
+ * @brief Prints an error, or records it when its sink is open.
+ *
+ * @param sink The sink the error is reported to, or NULL.
+ * @param error The error, its strings are copied.
+ */
+static void report_diagnostic(diagnostic_sink *sink, diagnostic *error) {
+    diagnostic copy = *error;
+
+    if (sink != NULL && sink->recording) {
+        copy.message = copy_diagnostic_string(error->message);
+        if (copy.message == NULL) {
+            printf("Memory allocation failed");
+            return;
+        }
+        record_diagnostic(sink, &copy);
+    }
+    else if (error->format == LOCATED_DIAGNOSTIC) {
+        fprintf(ERR_OUTPUT_FILE, "Error In %s:%ld: %s\n", error->file_name, error->line_number, error->message);
+    }
+    else {
+        fputs(error->message, stdout);
+    }
+}
+
+/**
+ * @brief Prints an error of a .define line to the standard output.
+ *
+ * @param line The .define line.
+ * @param message The error message.
+ */
+static void print_define_error(line_info line, char *message) {
+    diagnostic error;
+
+    error.file_name = line.file_name;
+    error.line_number = line.line_number;
+    error.column = diagnostic_column(line.content, NULL);
+    error.code = diagnostic_code(message);
+    error.message = message;
+    error.format = PLAIN_DIAGNOSTIC;
+    report_diagnostic(line.diagnostics, &error);
+}
+
+/**
+ * @brief Prints a string as a JSON string, without its trailing new lines.
+ *
+ * @param output_file The file printed to.
+ * @param string The string.
+ */
+static void print_json_string(FILE *output_file, char *string) {
+    size_t length = strlen(string);
+    size_t index;
+
+    while (length > 0 && string[length - 1] == '\n') {
+        length--;
+    }
+    fputc('"', output_file);
+    for (index = 0; index < length; index++) {
+        if (string[index] == '"' || string[index] == '\\') {
+            fprintf(output_file, "\\%c", string[index]);
+        }
+        else if (string[index] == '\n') {
+            fputs("\\n", output_file);
+        }
+        else if (string[index] == '\t') {
+            fputs("\\t", output_file);
+        }
+        else if ((unsigned char)string[index] < ' ') {
+            fprintf(output_file, "\\u%04x", (unsigned char)string[index]);
+        }
+        else {
+            fputc(string[index], output_file);
+        }
+    }
+    fputc('"', output_file);
+}
+
+/**
+ * @brief Prints a recorded error as a JSON object on a line of its own.
+ *
+ * @param output_file The file printed to.
+ * @param error The error.
+ */
+static void print_json_diagnostic(FILE *output_file, diagnostic *error) {
+    fputs("{\"file\":", output_file);
+    print_json_string(output_file, error->file_name != NULL ? error->file_name : "");
+    fprintf(output_file, ",\"line\":%ld,\"column\":%ld,\"code\":\"E%05lX\",\"message\":", error->line_number, error->column, error->code);
+    print_json_string(output_file, error->message);
+    fputs("}\n", output_file);
+}
+
+/**
+ * @brief Writes the part of the errors gathered for the standard error that isn't written yet.
+ *
+ * @param batch_file The stream the errors are gathered in, or NULL if they were printed directly.
+ * @param batch The memory of the stream.
+ * @param batch_length The length of the memory of the stream.
+ * @param written Pointer to the length written so far.
+ */
+static void write_diagnostics_batch(FILE *batch_file, char **batch, size_t *batch_length, size_t *written) {
+    if (batch_file == NULL) {
+        return;
+    }
+    fflush(batch_file);
+    if (*batch_length > *written) {
+        fwrite(*batch + *written, 1, *batch_length - *written, ERR_OUTPUT_FILE);
+        *written = *batch_length;
+    }
+}
+
+/**
+ * @brief Prints the errors recorded by a sink in the format of --diagnostics-format.
+ *
+ * The errors for the standard error are gathered in memory and written at once, before an error
+ * for the standard output and at the end, so they keep their order with it.
+ *
+ * @param records The sink.
+ */
+static void flush_diagnostics(diagnostic_sink *records) {
+    char *batch = NULL;             /* The errors gathered for the standard error */
+    size_t batch_length = 0;
+    size_t written = 0;             /* Length of the batch written so far */
+    FILE *batch_file;
+    FILE *error_output;
+    diagnostic *error;
+    long index;
+
+    if (records->count == 0) {
+        return;
+    }
+    batch_file = open_memstream(&batch, &batch_length);
+    error_output = batch_file != NULL ? batch_file : ERR_OUTPUT_FILE;
+    for (index = 0; index < records->count; index++) {
+        error = &records->records[index];
+        if (diagnostics_format == JSON_DIAGNOSTICS) {
+            print_json_diagnostic(error_output, error);
+        }
+        else if (error->format == LOCATED_DIAGNOSTIC) {
+            fprintf(error_output, "Error In %s:%ld: %s\n", error->file_name, error->line_number, error->message);
+        }
+        else {
+            write_diagnostics_batch(batch_file, &batch, &batch_length, &written);
+            fputs(error->message, stdout);
+        }
+    }
+
+    /* Say the file was not scanned to its end */
+    if (diagnostic_limit_reached(records)) {
+        if (diagnostics_format == JSON_DIAGNOSTICS) {
+            fprintf(error_output, "{\"code\":\"max-errors\",\"message\":\"Stopped after %ld errors\"}\n", records->count);
+        }
+        else {
+            fprintf(error_output, "Stopped after %ld errors, the limit of --max-errors\n", records->count);
+        }
+    }
+    write_diagnostics_batch(batch_file, &batch, &batch_length, &written);
+    if (batch_file != NULL) {
+        fclose(batch_file);
+    }
+    free(batch);
+}
+
+/* Opens a sink that records errors instead of printing them */
+void open_diagnostic_sink(diagnostic_sink *sink, long error_limit) {
+    sink->recording = TRUE;
+    sink->error_limit = error_limit;
+}
+
+/* Checks whether a sink recorded as many errors as it may */
+bool diagnostic_limit_reached(diagnostic_sink *sink) {
+    return sink != NULL && sink->error_limit > 0 && sink->count >= sink->error_limit;
+}
+
+/* Closes a sink, errors reported to it afterwards are printed */
+void close_diagnostic_sink(diagnostic_sink *sink) {
+    sink->recording = FALSE;
+}
+
+/* Prints the errors recorded by a sink, in the order they were recorded */
+void print_recorded_diagnostics(diagnostic_sink *records, diagnostic_sink *output) {
+    long index;
+
+    if (output == NULL || !output->recording) {
+        flush_diagnostics(records);
+        return;
+    }
+
+    /* An open output sink records them again, so sinks nest */
+    for (index = 0; index < records->count; index++) {
+        report_diagnostic(output, &records->records[index]);
+    }
+}
+
+/* Closes a sink and frees its records */
+void free_diagnostic_sink(diagnostic_sink *sink) {
+    long index;
+
+    for (index = 0; index < sink->count; index++) {
+        free(sink->records[index].file_name);
+        free(sink->records[index].message);
+    }
+    free(sink->records);
+    sink->recording = FALSE;
+    sink->records = NULL;
+    sink->count = 0;
+    sink->capacity = 0;
+}
+
 /* Prints an error message. */
 bool print_error(line_info line, char *massage, ...) {
-    bool result;
+    bool result = TRUE;
 	va_list args; 
+    diagnostic error;       /* The error, when it is recorded */
+    int message_length;     /* Length of the formatted message */
+    char *conversion;       /* The first conversion of the message */
+    char *token = NULL;     /* The first argument of the message, when it is a string */
+
+    /* Print error location (file name and line number) and the formatted error message with additional arguments */
+    if (line.diagnostics == NULL || !line.diagnostics->recording) {
+        fprintf(ERR_OUTPUT_FILE,"Error In %s:%ld: ", line.file_name, line.line_number);
+        va_start(args, massage);
+        result = vfprintf(ERR_OUTPUT_FILE, massage, args);
+        va_end(args);
+
+        /* Print a newline character after the error message */
+        fprintf(ERR_OUTPUT_FILE, "\n");
+        return result;
+    }
 
-    /* Print error location (file name and line number) */
-	fprintf(ERR_OUTPUT_FILE,"Error In %s:%ld: ", line.file_name, line.line_number);
-
-    /* Print the formatted error message with additional arguments */
-	va_start(args, massage);
-	result = vfprintf(ERR_OUTPUT_FILE, massage, args);
-	va_end(args);
+    /* A string as first argument is the token the error is about, its place on the line is the column */
+    for (conversion = strchr(massage, '%'); conversion != NULL && conversion[1] == '%'; conversion = strchr(conversion + 2, '%'));
+    if (conversion != NULL && conversion[1] == 's') {
+        va_start(args, massage);
+        token = va_arg(args, char *);
+        va_end(args);
+    }
 
-    /* Print a newline character after the error message */
-	fprintf(ERR_OUTPUT_FILE, "\n");
+    /* Format the message once to find its length, then into the record */
+    va_start(args, massage);
+    message_length = vsnprintf(NULL, 0, massage, args);
+    va_end(args);
+    error.message = message_length >= 0 ? (char *)malloc(message_length + 1) : NULL;
+    if (error.message == NULL) {
+        printf("Memory allocation failed");
+        return FALSE;
+    }
+    va_start(args, massage);
+    vsnprintf(error.message, message_length + 1, massage, args);
+    va_end(args);
+    error.file_name = line.file_name;
+    error.line_number = line.line_number;
+    error.column = diagnostic_column(line.content, token);
+    error.code = diagnostic_code(massage);
+    error.format = LOCATED_DIAGNOSTIC;
+    record_diagnostic(line.diagnostics, &error);
 	return result;
 }
 
@@ -256,20 +618,20 @@ bool check_mdefine(line_info line, table *symbol_table, char *symbol) {
 
             /* Check if label name is provided */
             if (label[0] == '\0') {
-                printf("You have to specify a label name for .define");
+                print_define_error(line, "You have to specify a label name for .define");
                 return FALSE;
             }
 
             /* Validate label name */
             if (!check_label_name(label)) {
-                printf("Iligal name");
+                print_define_error(line, "Iligal name");
                 return FALSE;
             }
 
             index_line  = skip_spaces(line.content, index_line );   /* Skip spaces */
             /* Check if '=' is found */
             if (line.content[index_line ] != '=') {
-                printf("Error: '=' not found in the input string.\n");
+                print_define_error(line, "Error: '=' not found in the input string.\n");
                 return FALSE;
             }
             index_line ++;
@@ -287,20 +649,20 @@ bool check_mdefine(line_info line, table *symbol_table, char *symbol) {
 
             /* Check if number is provided */
             if (number == NULL) {
-                printf("Error: Number not found after '='.\n");
+                print_define_error(line, "Error: Number not found after '='.\n");
                 return FALSE;
             }
 
             /* Validate number */
             if (!check_if_digit(number)) {
-                printf("It isn't a digit");
+                print_define_error(line, "It isn't a digit");
                 return FALSE;
             }
             index_line  = skip_spaces(line.content, index_line );   /*  Skip spaces */
             
             /* Check if unexpected characters exist after the number */
             if (line.content[index_line] && line.content[index_line] != '\n') {
-                printf("Error: Unexpected characters after the number.\n");
+                print_define_error(line, "Error: Unexpected characters after the number.\n");
                 return FALSE;
             }
 
@@ -308,11 +670,11 @@ bool check_mdefine(line_info line, table *symbol_table, char *symbol) {
             item = find_by_types(*symbol_table, label, 1, MDEFINE_SYMBOL);
             if (item != NULL) {
                 if (item != NULL) {
-                printf("You cannot define a mdefine type more than once with the same name.");
+                print_define_error(line, "You cannot define a mdefine type more than once with the same name.");
                 return FALSE;
                 }
                 else {
-                    printf("You cannot define type define and instruction with the same name.");
+                    print_define_error(line, "You cannot define type define and instruction with the same name.");
                     return FALSE;
                 }
             }
@@ -336,22 +698,28 @@ void free_code_image(machine_word **code_image, long total_instructions) {
     /* Iterate through each index of the code image array */
     for (index = 0; index < total_instructions; index++) {
         machine_word *curr_word = code_image[index];
-        if (curr_word != NULL) {
+
+        /* The words of checked lines are shared */
+        if (curr_word != NULL && curr_word->length >= 0 && curr_word->length <= MAX_INSTRUCTION_WORDS && curr_word == checked_word(curr_word->length)) {
+            code_image[index] = NULL;
+        }
+        else if (curr_word != NULL) {
             /* Check if the current machine word is not NULL */
             if (curr_word->length > 0) {
                 /* If the length is positive, it's a code word, free the code memory */
-                free(curr_word->word.code);
+                tracked_free(curr_word->word.code);
             } else {
                 /* If the length is zero or negative, it's a data word, free the data memory */
-                free(curr_word->word.data);
+                tracked_free(curr_word->word.data);
             }
-            free(curr_word);
+            tracked_free(curr_word);
             /* Set the corresponding index in the code image array to NULL */
             code_image[index] = NULL;
         }
     }
 }
 
-
-
-
+/* Gets the shared machine word a checked line stores where it would build a word */
+machine_word *checked_word(long length) {
+    return &checked_words[length];
+}
@@ -1,9 +1,47 @@
 #ifndef _UTILITY_FUNCTIONS_H
 #define _UTILITY_FUNCTIONS_H
 
+#include <stdio.h>
 #include "global_variables.h"
 #include "data_tables.h"
 
+/* How an error is printed */
+typedef enum diagnostic_format {
+    LOCATED_DIAGNOSTIC,     /* To the standard error after its file and line, the errors of print_error */
+    PLAIN_DIAGNOSTIC        /* As is to the standard output, the errors of .define lines */
+} diagnostic_format;
+
+/* How the recorded errors of a file are printed, given by --diagnostics-format */
+typedef enum diagnostics_output {
+    TEXT_DIAGNOSTICS,       /* As print_error and check_mdefine print them */
+    JSON_DIAGNOSTICS        /* One JSON object per error and per line, to the standard error */
+} diagnostics_output;
+
+/* An error recorded by a sink */
+typedef struct diagnostic {
+    char *file_name;            /* File of the error */
+    long line_number;           /* Line of the error */
+    long column;                /* Column of the error, from 1, or 0 if it isn't known */
+    unsigned long code;         /* Identifies the message without its arguments, printed as E and 5 hex digits */
+    char *message;              /* The message as it is printed, without the location */
+    diagnostic_format format;   /* How the error is printed */
+} diagnostic;
+
+/* Where the errors of an assembly go, so assemblies running at the same time don't mix their errors */
+typedef struct diagnostic_sink {
+    bool recording;             /* Whether the errors are recorded, they are printed otherwise */
+    diagnostic *records;        /* The recorded errors, in the order they were reported */
+    long count;                 /* Number of recorded errors */
+    long capacity;              /* Allocated length of records */
+    long error_limit;           /* Errors recorded at most, the scan of the file stops there. 0 for no limit */
+} diagnostic_sink;
+
+/* The format given by --diagnostics-format */
+extern diagnostics_output diagnostics_format;
+
+/* The limit given by --max-errors, 0 without it */
+extern long max_errors_per_file;
+
 /**
  * @brief Adds an extension to a file name.
  * 
@@ -18,6 +56,21 @@
  */
 char* add_extension(char *original_file_name, char *extension );
 
+/**
+ * @brief Resolves a file name relative to the directory of another file.
+ * 
+ * This function is used for files referenced from inside a source file. An absolute file name,
+ * or a base file name without a directory part, leaves the file name unchanged. Otherwise the
+ * directory of the base file is prepended to the file name.
+ * 
+ * @param base_file_name The name of the file that references the other file.
+ * @param file_name The referenced file name.
+ * 
+ * @return A pointer to a new string containing the resolved file name.
+ *         Returns NULL if memory allocation fails.
+ */
+char* resolve_relative_path(char *base_file_name, char *file_name);
+
 /**
  * @brief Skips whitespace characters in a string starting from the given index.
  * 
@@ -128,6 +181,51 @@ instruction find_instruction_by_name(char *name);
  */
 bool print_error(line_info line, char *massage, ...);
 
+/**
+ * @brief Opens a sink that records errors instead of printing them.
+ *
+ * The errors of print_error and check_mdefine are recorded with their location and the way
+ * they are printed, so print_recorded_diagnostics prints them later exactly as they would
+ * have been printed.
+ *
+ * @param sink The sink, empty.
+ * @param error_limit Errors recorded at most, the later ones are dropped. 0 for no limit.
+ */
+void open_diagnostic_sink(diagnostic_sink *sink, long error_limit);
+
+/**
+ * @brief Checks whether a sink recorded as many errors as it may, so the scan of its file can stop.
+ *
+ * @param sink The sink, or NULL.
+ * @return Returns true if the sink is full, otherwise false.
+ */
+bool diagnostic_limit_reached(diagnostic_sink *sink);
+
+/**
+ * @brief Closes a sink, errors reported to it afterwards are printed. Its records are kept.
+ *
+ * @param sink The sink.
+ */
+void close_diagnostic_sink(diagnostic_sink *sink);
+
+/**
+ * @brief Prints the errors recorded by a sink, in the order they were recorded.
+ *
+ * The errors are printed in the format given by --diagnostics-format, the errors for the standard
+ * error are written together rather than one by one.
+ *
+ * @param records The sink.
+ * @param output The sink the errors are reported to, they are recorded again if it is open, or NULL to print them.
+ */
+void print_recorded_diagnostics(diagnostic_sink *records, diagnostic_sink *output);
+
+/**
+ * @brief Closes a sink and frees its records.
+ *
+ * @param sink The sink.
+ */
+void free_diagnostic_sink(diagnostic_sink *sink);
+
 /**
  * @brief Checks and processes a line for define definition.
  * 
@@ -156,4 +254,16 @@ bool check_mdefine(line_info line, table *symbol_table, char *symbol);
  */
 void free_code_image(machine_word **code_image, long total_instructions);
 
+/**
+ * @brief Gets the shared machine word a checked line stores where it would build a word.
+ *
+ * A line that is only checked fills the same entries of the code image with the same lengths,
+ * so the second pass goes through it the same way, but without allocating or encoding any word.
+ * free_code_image leaves these words alone.
+ *
+ * @param length The length of the word: of the instruction for its first word, 0 for the words of its operands.
+ * @return The word.
+ */
+machine_word *checked_word(long length);
+
 #endif
\ No newline at end of file
@@ -0,0 +1,239 @@
+#define _DEFAULT_SOURCE /* inotify_init1 and poll */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <poll.h>
+#include <unistd.h>
+#include <sys/inotify.h>
+#include "watch.h"
+#include "preprocessor.h"
+#include "utility_functions.h"
+#include "alloc_tracking.h"
+
+/* Bytes of inotify events read at a time */
+#define WATCH_BUFFER_SIZE 4096
+
+/* Changes of a directory that may change one of its files */
+#define WATCH_EVENTS (IN_CLOSE_WRITE | IN_MOVED_TO | IN_MOVED_FROM | IN_DELETE)
+
+/* A file watched through its directory */
+struct watched_file {
+    int descriptor;         /* The inotify watch of its directory, -1 if the directory can't be watched */
+    char *path;             /* Path of the file */
+    char *base_name;        /* Name of the file within its directory, as in the events */
+};
+
+/* The files a source depends on */
+struct watched_source {
+    char *file_name;                /* The file name without extension, as given on the command line */
+    struct watched_file *files;     /* The .as file, then its included files */
+    int file_count;                 /* Number of files */
+};
+
+bool watch_enabled = FALSE;
+
+static int inotify_descriptor = -1;                     /* The inotify instance */
+static struct watched_source *watched_sources = NULL;   /* The sources watched so far */
+static int watched_source_count = 0;                    /* Number of watched sources */
+
+/**
+ * @brief Frees the files watched for a source.
+ *
+ * @param source The source.
+ */
+static void free_watched_files(struct watched_source *source) {
+    while (source->file_count > 0) {
+        source->file_count--;
+        free(source->files[source->file_count].path);
+        free(source->files[source->file_count].base_name);
+    }
+    free(source->files);
+    source->files = NULL;
+}
+
+/**
+ * @brief Watches the directory of a file for a source.
+ *
+ * @param source The source.
+ * @param path The path of the file.
+ * @return Returns true if the file was added to the source, otherwise false.
+ */
+static bool watch_file(struct watched_source *source, char *path) {
+    struct watched_file *files;
+    struct watched_file *file;
+    char *last_slash = strrchr(path, '/');
+    char *directory;
+
+    files = (struct watched_file *)realloc(source->files, (source->file_count + 1) * sizeof(struct watched_file));
+    if (files == NULL) {
+        printf("Memory allocation failed");
+        return FALSE;
+    }
+    source->files = files;
+    file = &source->files[source->file_count];
+    file->path = (char *)malloc(strlen(path) + 1);
+    file->base_name = (char *)malloc(strlen(path) + 1);
+    directory = (char *)malloc(strlen(path) + 2);
+    if (file->path == NULL || file->base_name == NULL || directory == NULL) {
+        printf("Memory allocation failed");
+        free(file->path);
+        free(file->base_name);
+        free(directory);
+        return FALSE;
+    }
+    strcpy(file->path, path);
+    strcpy(file->base_name, last_slash != NULL ? last_slash + 1 : path);
+
+    /* A file without a directory part is in the working directory, a file right under the root keeps the slash */
+    if (last_slash == NULL) {
+        strcpy(directory, ".");
+    }
+    else {
+        strncpy(directory, path, last_slash - path + (last_slash == path));
+        directory[last_slash - path + (last_slash == path)] = '\0';
+    }
+    file->descriptor = inotify_add_watch(inotify_descriptor, directory, WATCH_EVENTS);
+    free(directory);
+    source->file_count++;
+    return TRUE;
+}
+
+/**
+ * @brief Marks the sources that depend on a file that changed.
+ *
+ * @param descriptor The inotify watch of the directory of the file.
+ * @param base_name The name of the file within its directory.
+ * @param file_names The input files, without extension.
+ * @param file_count The number of input files.
+ * @param changed The input files to assemble again.
+ * @return Returns the number of input files newly marked.
+ */
+static int mark_changed_sources(int descriptor, char *base_name, char **file_names, int file_count, bool *changed) {
+    struct watched_source *source;
+    int source_index;
+    int file_index;
+    int input_index;
+    int marked = 0;
+
+    for (source_index = 0; source_index < watched_source_count; source_index++) {
+        source = &watched_sources[source_index];
+        for (file_index = 0; file_index < source->file_count; file_index++) {
+            if (source->files[file_index].descriptor != descriptor || strcmp(source->files[file_index].base_name, base_name) != 0) {
+                continue;
+            }
+            /* An included file is parsed again by the next source that includes it */
+            if (file_index > 0) {
+                forget_cached_include(source->files[file_index].path);
+            }
+            for (input_index = 0; input_index < file_count; input_index++) {
+                if (!changed[input_index] && strcmp(file_names[input_index], source->file_name) == 0) {
+                    changed[input_index] = TRUE;
+                    marked++;
+                }
+            }
+        }
+    }
+    return marked;
+}
+
+/* Starts watching for changes with inotify */
+bool open_watch(void) {
+    inotify_descriptor = inotify_init1(IN_CLOEXEC);
+    return inotify_descriptor >= 0;
+}
+
+/* Watches the source of a context and the files it included */
+void watch_source_dependencies(assembly_context *context) {
+    struct watched_source *sources;
+    struct watched_source *source;
+    char *input_file_name;
+    int index;
+
+    for (index = 0; index < watched_source_count && strcmp(watched_sources[index].file_name, context->file_name) != 0; index++);
+    if (index == watched_source_count) {
+        sources = (struct watched_source *)realloc(watched_sources, (watched_source_count + 1) * sizeof(struct watched_source));
+        if (sources == NULL || (sources[index].file_name = (char *)malloc(strlen(context->file_name) + 1)) == NULL) {
+            printf("Memory allocation failed");
+            if (sources != NULL) {
+                watched_sources = sources;
+            }
+            return;
+        }
+        watched_sources = sources;
+        strcpy(watched_sources[index].file_name, context->file_name);
+        watched_sources[index].files = NULL;
+        watched_sources[index].file_count = 0;
+        watched_source_count++;
+    }
+    source = &watched_sources[index];
+    free_watched_files(source);
+
+    input_file_name = add_extension(context->file_name, ".as");
+    if (input_file_name == NULL || !watch_file(source, input_file_name)) {
+        tracked_free(input_file_name);
+        return;
+    }
+    tracked_free(input_file_name);
+    for (index = 0; index < context->included_file_count && watch_file(source, context->included_files[index]); index++);
+}
+
+/* Waits until sources or included files change */
+int wait_for_changed_sources(char **file_names, int file_count, bool *changed) {
+    union {
+        struct inotify_event event;         /* Aligns the buffer for the events */
+        char bytes[WATCH_BUFFER_SIZE];
+    } buffer;
+    struct inotify_event *event;
+    struct pollfd poll_descriptor;
+    int timeout = -1;           /* Wait for the first change, then until the changes settle */
+    int marked = 0;
+    int ready;
+    ssize_t length;
+    ssize_t offset;
+
+    memset(changed, 0, file_count * sizeof(bool));
+    poll_descriptor.fd = inotify_descriptor;
+    poll_descriptor.events = POLLIN;
+    for (;;) {
+        ready = poll(&poll_descriptor, 1, timeout);
+        if (ready < 0 && errno == EINTR) {
+            continue;
+        }
+        if (ready <= 0) {
+            break;
+        }
+        length = read(inotify_descriptor, buffer.bytes, sizeof(buffer.bytes));
+        if (length <= 0) {
+            ready = -1;
+            break;
+        }
+        for (offset = 0; offset < length; offset += sizeof(struct inotify_event) + event->len) {
+            event = (struct inotify_event *)(buffer.bytes + offset);
+            if (event->len > 0) {
+                marked += mark_changed_sources(event->wd, event->name, file_names, file_count, changed);
+            }
+        }
+        if (marked > 0) {
+            timeout = WATCH_SETTLE_MS;
+        }
+    }
+    return ready < 0 ? -1 : marked;
+}
+
+/* Stops watching and frees what was watched */
+void close_watch(void) {
+    int index;
+
+    for (index = 0; index < watched_source_count; index++) {
+        free_watched_files(&watched_sources[index]);
+        free(watched_sources[index].file_name);
+    }
+    free(watched_sources);
+    watched_sources = NULL;
+    watched_source_count = 0;
+    if (inotify_descriptor >= 0) {
+        close(inotify_descriptor);
+        inotify_descriptor = -1;
+    }
+}
@@ -0,0 +1,46 @@
+#ifndef _WATCH_H
+#define _WATCH_H
+#include "global_variables.h"
+#include "assembler.h"
+
+/* Milliseconds without new changes before the changed files are assembled again, an editor saving a file may write it several times */
+#define WATCH_SETTLE_MS 50
+
+/* Whether --watch was given */
+extern bool watch_enabled;
+
+/**
+ * @brief Starts watching for changes of the sources and of their included files, with inotify.
+ *
+ * @return Returns true if inotify is available, otherwise false.
+ */
+bool open_watch(void);
+
+/**
+ * @brief Watches the source of a context and the files it included, replacing what was watched for it before.
+ *
+ * The directories of the files are watched rather than the files, so a file replaced
+ * by a rename, as editors save them, or created later is noticed too.
+ *
+ * @param context The context of the source, after the macro processing.
+ */
+void watch_source_dependencies(assembly_context *context);
+
+/**
+ * @brief Waits until sources or included files change.
+ *
+ * The included files that changed are dropped from the cache of included files.
+ *
+ * @param file_names The input files, without extension.
+ * @param file_count The number of input files.
+ * @param changed Receives for each input file whether it must be assembled again.
+ * @return Returns the number of input files to assemble again, or -1 if the watch failed.
+ */
+int wait_for_changed_sources(char **file_names, int file_count, bool *changed);
+
+/**
+ * @brief Stops watching and frees what was watched.
+ */
+void close_watch(void);
+
+#endif